@@ -19,6 +19,9 @@ if(PLATFORM_WIN32 OR PLATFORM_UNIVERSAL_WINDOWS)
         if(WEBGPU_SUPPORTED)
             list(APPEND ENGINE_DLLS Diligent-GraphicsEngineWebGPU-shared)
         endif()
+        if(NULL_SUPPORTED)
+            list(APPEND ENGINE_DLLS Diligent-GraphicsEngineNull-shared)
+        endif()
         if(TARGET Diligent-Archiver-shared)
             list(APPEND ENGINE_DLLS Diligent-Archiver-shared)
         endif()
@@ -270,6 +273,9 @@ function(get_supported_backends _TARGETS)
     if(WEBGPU_SUPPORTED)
         list(APPEND BACKENDS Diligent-GraphicsEngineWebGPU-${LIB_TYPE})
     endif()
+    if(NULL_SUPPORTED)
+        list(APPEND BACKENDS Diligent-GraphicsEngineNull-${LIB_TYPE})
+    endif()
 
     # ${_TARGETS} == ENGINE_LIBRARIES
     # ${${_TARGETS}} == ${ENGINE_LIBRARIES}
@@ -0,0 +1,276 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <new>
+#include <utility>
+#include <limits>
+#include <cstddef>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Primitives/interface/MemoryAllocator.h"
+#include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "../../Platforms/interface/PlatformMisc.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+namespace Threading
+{
+
+/// Lock-free multi-producer multi-consumer stack.
+
+/// Any number of threads may call Push() and Pop() simultaneously. Items are
+/// returned in an unspecified order. Every item is pushed and popped individually
+/// with a single compare-exchange on the head, so popping is O(1) and the stack
+/// never appears empty to other threads while it is not.
+///
+/// Nodes are referenced by 32-bit indices. The head packs the index of the top
+/// node together with a tag that is incremented by every update, which protects
+/// the compare-exchange from the ABA problem. Nodes are allocated in blocks through
+/// the raw memory allocator given to the constructor and are recycled through an
+/// internal free list, so the memory of a node that is read by a concurrent Pop()
+/// is never released before the stack is destroyed.
+template <typename T>
+class LockFreeStack
+{
+    static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types are not supported as the allocator only guarantees fundamental alignment");
+
+public:
+    explicit LockFreeStack(Diligent::IMemoryAllocator& Allocator = Diligent::DefaultRawMemoryAllocator::GetAllocator()) noexcept :
+        m_Allocator{Allocator}
+    {
+        for (auto& Block : m_Blocks)
+            Block.store(nullptr, std::memory_order_relaxed);
+    }
+
+    // clang-format off
+    LockFreeStack             (const LockFreeStack&)  = delete;
+    LockFreeStack& operator = (const LockFreeStack&)  = delete;
+    LockFreeStack             (      LockFreeStack&&) = delete;
+    LockFreeStack& operator = (      LockFreeStack&&) = delete;
+    // clang-format on
+
+    ~LockFreeStack()
+    {
+        for (Diligent::Uint32 NodeIdx = PopNode(m_Head); NodeIdx != InvalidIndex; NodeIdx = PopNode(m_Head))
+            GetNode(NodeIdx).GetValue().~T();
+
+        for (Diligent::Uint32 b = 0; b < MaxBlocks; ++b)
+        {
+            if (Node* pBlock = m_Blocks[b].load(std::memory_order_relaxed))
+            {
+                for (Diligent::Uint32 i = 0; i < GetBlockSize(b); ++i)
+                    pBlock[i].~Node();
+                m_Allocator.Free(pBlock);
+            }
+        }
+    }
+
+    /// Adds an item to the stack. Can be called by multiple threads simultaneously.
+    template <typename... ArgsType>
+    void Push(ArgsType&&... Args)
+    {
+        const Diligent::Uint32 NodeIdx = AllocateNode();
+
+        Node& N = GetNode(NodeIdx);
+        try
+        {
+            new (&N.Storage) T{std::forward<ArgsType>(Args)...};
+        }
+        catch (...)
+        {
+            PushNode(m_FreeHead, NodeIdx);
+            throw;
+        }
+
+        // Increment the size first so that it never underflows when the item is popped
+        // by another thread before the counter is updated.
+        m_Size.fetch_add(1, std::memory_order_relaxed);
+        PushNode(m_Head, NodeIdx);
+    }
+
+    /// Removes up to MaxCount items from the stack and calls Handler(T&&) for each item.
+    /// Can be called by multiple threads simultaneously.
+
+    /// \return     The number of items that were removed.
+    template <typename HandlerType>
+    size_t Pop(size_t MaxCount, HandlerType&& Handler)
+    {
+        size_t NumItems = 0;
+        while (NumItems < MaxCount)
+        {
+            const Diligent::Uint32 NodeIdx = PopNode(m_Head);
+            if (NodeIdx == InvalidIndex)
+                break;
+            m_Size.fetch_sub(1, std::memory_order_relaxed);
+            ++NumItems;
+
+            T& Value = GetNode(NodeIdx).GetValue();
+            Handler(std::move(Value));
+            Value.~T();
+            PushNode(m_FreeHead, NodeIdx);
+        }
+
+        return NumItems;
+    }
+
+    /// Removes all items from the stack and calls Handler(T&&) for each item.
+    template <typename HandlerType>
+    size_t PopAll(HandlerType&& Handler)
+    {
+        return Pop(std::numeric_limits<size_t>::max(), std::forward<HandlerType>(Handler));
+    }
+
+    /// Returns the number of items in the stack.
+    /// The value may be outdated by the time the method returns.
+    size_t GetSize() const
+    {
+        return m_Size.load(std::memory_order_relaxed);
+    }
+
+    bool IsEmpty() const
+    {
+        return UnpackIndex(m_Head.load(std::memory_order_relaxed)) == InvalidIndex;
+    }
+
+private:
+    static constexpr Diligent::Uint32 InvalidIndex   = ~Diligent::Uint32{0};
+    static constexpr Diligent::Uint32 FirstBlockSize = 16;
+    // Block b contains FirstBlockSize << b nodes, which allows up to FirstBlockSize * (2^MaxBlocks - 1) nodes
+    static constexpr Diligent::Uint32 MaxBlocks = 24;
+
+    struct Node
+    {
+        alignas(T) unsigned char Storage[sizeof(T)];
+        std::atomic<Diligent::Uint32> Next{InvalidIndex};
+
+        T& GetValue()
+        {
+            return *reinterpret_cast<T*>(&Storage);
+        }
+    };
+
+    static constexpr Diligent::Uint64 PackHead(Diligent::Uint32 Index, Diligent::Uint32 Tag)
+    {
+        return (Diligent::Uint64{Tag} << 32u) | Diligent::Uint64{Index};
+    }
+    static constexpr Diligent::Uint32 UnpackIndex(Diligent::Uint64 Head)
+    {
+        return static_cast<Diligent::Uint32>(Head & 0xFFFFFFFFu);
+    }
+    static constexpr Diligent::Uint32 UnpackTag(Diligent::Uint64 Head)
+    {
+        return static_cast<Diligent::Uint32>(Head >> 32u);
+    }
+
+    static constexpr Diligent::Uint32 GetBlockSize(Diligent::Uint32 Block)
+    {
+        return FirstBlockSize << Block;
+    }
+
+    // Returns the block that contains the node and the index of the node within the block
+    static std::pair<Diligent::Uint32, Diligent::Uint32> GetNodeLocation(Diligent::Uint32 NodeIdx)
+    {
+        // The first node of block b has index FirstBlockSize * (2^b - 1)
+        const Diligent::Uint32 Block = Diligent::PlatformMisc::GetMSB(NodeIdx / FirstBlockSize + 1);
+        return {Block, NodeIdx - FirstBlockSize * ((1u << Block) - 1u)};
+    }
+
+    Node& GetNode(Diligent::Uint32 NodeIdx)
+    {
+        const auto Location = GetNodeLocation(NodeIdx);
+        Node*      pBlock   = m_Blocks[Location.first].load(std::memory_order_acquire);
+        VERIFY_EXPR(pBlock != nullptr);
+        return pBlock[Location.second];
+    }
+
+    Diligent::Uint32 AllocateNode()
+    {
+        Diligent::Uint32 NodeIdx = PopNode(m_FreeHead);
+        if (NodeIdx != InvalidIndex)
+            return NodeIdx;
+
+        NodeIdx = m_NumNodes.fetch_add(1, std::memory_order_relaxed);
+
+        const Diligent::Uint32 Block = GetNodeLocation(NodeIdx).first;
+        VERIFY(Block < MaxBlocks, "The maximum number of nodes has been exceeded");
+        if (m_Blocks[Block].load(std::memory_order_acquire) == nullptr)
+        {
+            const Diligent::Uint32 BlockSize = GetBlockSize(Block);
+
+            Node* pNewBlock = static_cast<Node*>(m_Allocator.Allocate(sizeof(Node) * BlockSize, "LockFreeStack node block", __FILE__, __LINE__));
+            for (Diligent::Uint32 i = 0; i < BlockSize; ++i)
+                new (pNewBlock + i) Node{};
+
+            // Another thread that got an index in the same block may have allocated it first
+            Node* pExpected = nullptr;
+            if (!m_Blocks[Block].compare_exchange_strong(pExpected, pNewBlock, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                for (Diligent::Uint32 i = 0; i < BlockSize; ++i)
+                    pNewBlock[i].~Node();
+                m_Allocator.Free(pNewBlock);
+            }
+        }
+
+        return NodeIdx;
+    }
+
+    void PushNode(std::atomic<Diligent::Uint64>& Head, Diligent::Uint32 NodeIdx)
+    {
+        Node&            N       = GetNode(NodeIdx);
+        Diligent::Uint64 OldHead = Head.load(std::memory_order_relaxed);
+        do
+        {
+            N.Next.store(UnpackIndex(OldHead), std::memory_order_relaxed);
+        } while (!Head.compare_exchange_weak(OldHead, PackHead(NodeIdx, UnpackTag(OldHead) + 1), std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    Diligent::Uint32 PopNode(std::atomic<Diligent::Uint64>& Head)
+    {
+        Diligent::Uint64 OldHead = Head.load(std::memory_order_acquire);
+        while (UnpackIndex(OldHead) != InvalidIndex)
+        {
+            // The node may be popped and pushed again by another thread at any moment, in
+            // which case the value of Next is stale, but the tag makes the exchange fail.
+            const Diligent::Uint32 NextIdx = GetNode(UnpackIndex(OldHead)).Next.load(std::memory_order_relaxed);
+            if (Head.compare_exchange_weak(OldHead, PackHead(NextIdx, UnpackTag(OldHead) + 1), std::memory_order_acquire, std::memory_order_acquire))
+                return UnpackIndex(OldHead);
+        }
+        return InvalidIndex;
+    }
+
+    Diligent::IMemoryAllocator& m_Allocator;
+
+    std::atomic<Diligent::Uint64> m_Head{PackHead(InvalidIndex, 0)};
+    std::atomic<Diligent::Uint64> m_FreeHead{PackHead(InvalidIndex, 0)};
+    std::atomic<Diligent::Uint32> m_NumNodes{0};
+    std::atomic<size_t>           m_Size{0};
+
+    std::atomic<Node*> m_Blocks[MaxBlocks];
+};
+
+} // namespace Threading
@@ -0,0 +1,178 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <new>
+#include <utility>
+
+#include "../../Primitives/interface/MemoryAllocator.h"
+#include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+namespace Threading
+{
+
+/// Lock-free multi-producer single-consumer queue.
+
+/// Any number of threads may call Push() simultaneously. Only one thread at a time
+/// may call PopAll(). Producers push nodes onto an atomic list head; the consumer
+/// detaches the whole list with a single exchange and restores the FIFO order.
+///
+/// Nodes are allocated through the raw memory allocator given to the constructor.
+template <typename T>
+class MPSCQueue
+{
+public:
+    explicit MPSCQueue(Diligent::IMemoryAllocator& Allocator = Diligent::DefaultRawMemoryAllocator::GetAllocator()) noexcept :
+        m_Allocator{Allocator}
+    {}
+
+    // clang-format off
+    MPSCQueue             (const MPSCQueue&)  = delete;
+    MPSCQueue& operator = (const MPSCQueue&)  = delete;
+    MPSCQueue             (      MPSCQueue&&) = delete;
+    MPSCQueue& operator = (      MPSCQueue&&) = delete;
+    // clang-format on
+
+    ~MPSCQueue()
+    {
+        DeleteList(m_Head.exchange(nullptr, std::memory_order_acquire));
+    }
+
+    /// Adds an item to the queue. Can be called by multiple threads simultaneously.
+    template <typename... ArgsType>
+    void Push(ArgsType&&... Args)
+    {
+        Node* pNode = CreateNode(std::forward<ArgsType>(Args)...);
+        // Increment the size first so that it never underflows when the item is popped
+        // by the consumer before the counter is updated.
+        m_Size.fetch_add(1, std::memory_order_relaxed);
+
+        pNode->pNext = m_Head.load(std::memory_order_relaxed);
+        while (!m_Head.compare_exchange_weak(pNode->pNext, pNode, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    /// Removes all items from the queue and calls Handler(T&&) for each item in the order
+    /// in which the items were pushed. Must only be called by one thread at a time.
+
+    /// \return     The number of items that were removed.
+    template <typename HandlerType>
+    size_t PopAll(HandlerType&& Handler)
+    {
+        Node* pHead = m_Head.exchange(nullptr, std::memory_order_acquire);
+        if (pHead == nullptr)
+            return 0;
+
+        // Reverse the list to restore the push order
+        Node*  pFirst   = nullptr;
+        size_t NumItems = 0;
+        while (pHead != nullptr)
+        {
+            Node* pNext  = pHead->pNext;
+            pHead->pNext = pFirst;
+            pFirst       = pHead;
+            pHead        = pNext;
+            ++NumItems;
+        }
+        m_Size.fetch_sub(NumItems, std::memory_order_relaxed);
+
+        while (pFirst != nullptr)
+        {
+            Node* pNext = pFirst->pNext;
+            Handler(std::move(pFirst->Value));
+            DestroyNode(pFirst);
+            pFirst = pNext;
+        }
+
+        return NumItems;
+    }
+
+    /// Returns the number of items in the queue.
+    /// The value may be outdated by the time the method returns.
+    size_t GetSize() const
+    {
+        return m_Size.load(std::memory_order_relaxed);
+    }
+
+    bool IsEmpty() const
+    {
+        return m_Head.load(std::memory_order_relaxed) == nullptr;
+    }
+
+private:
+    struct Node
+    {
+        template <typename... ArgsType>
+        explicit Node(ArgsType&&... Args) :
+            Value{std::forward<ArgsType>(Args)...}
+        {}
+
+        T     Value;
+        Node* pNext = nullptr;
+    };
+
+    template <typename... ArgsType>
+    Node* CreateNode(ArgsType&&... Args)
+    {
+        void* pRawMem = m_Allocator.Allocate(sizeof(Node), "MPSCQueue node", __FILE__, __LINE__);
+        try
+        {
+            return new (pRawMem) Node{std::forward<ArgsType>(Args)...};
+        }
+        catch (...)
+        {
+            m_Allocator.Free(pRawMem);
+            throw;
+        }
+    }
+
+    void DestroyNode(Node* pNode)
+    {
+        pNode->~Node();
+        m_Allocator.Free(pNode);
+    }
+
+    void DeleteList(Node* pNode)
+    {
+        while (pNode != nullptr)
+        {
+            Node* pNext = pNode->pNext;
+            DestroyNode(pNode);
+            pNode = pNext;
+        }
+    }
+
+    Diligent::IMemoryAllocator& m_Allocator;
+
+    std::atomic<Node*>  m_Head{nullptr};
+    std::atomic<size_t> m_Size{0};
+};
+
+} // namespace Threading
@@ -218,6 +218,12 @@ DILIGENT_BEGIN_INTERFACE(IThreadPool, IObject)
     /// Returns the number of currently running tasks
     VIRTUAL Uint32 METHOD(GetRunningTaskCount)(THIS) CONST PURE;
 
+    /// Returns the number of worker threads.
+
+    /// \remarks   The number is zero if the pool was created without worker threads
+    ///            or after the threads have been stopped by StopThreads().
+    VIRTUAL Uint32 METHOD(GetThreadCount)(THIS) CONST PURE;
+
 
     /// Stops all worker threads.
 
@@ -294,6 +300,7 @@ DILIGENT_END_INTERFACE
 #    define IThreadPool_WaitForAllTasks(This)       CALL_IFACE_METHOD(ThreadPool, WaitForAllTasks, This)
 #    define IThreadPool_GetQueueSize(This)          CALL_IFACE_METHOD(ThreadPool, GetQueueSize, This)
 #    define IThreadPool_GetRunningTaskCount(This)   CALL_IFACE_METHOD(ThreadPool, GetRunningTaskCount, This)
+#    define IThreadPool_GetThreadCount(This)        CALL_IFACE_METHOD(ThreadPool, GetThreadCount, This)
 #    define IThreadPool_StopThreads(This)           CALL_IFACE_METHOD(ThreadPool, StopThreads, This)
 #    define IThreadPool_ProcessTask(This, ...)      CALL_IFACE_METHOD(ThreadPool, ProcessTask, This, __VA_ARGS__)
 
@@ -49,6 +49,7 @@ public:
                    const ThreadPoolCreateInfo& PoolCI) :
         TBase{pRefCounters}
     {
+        m_NumThreads.store(PoolCI.NumThreads);
         m_WorkerThreads.reserve(PoolCI.NumThreads);
         for (Uint32 i = 0; i < PoolCI.NumThreads; ++i)
         {
@@ -222,6 +223,7 @@ public:
             //     in order to correctly publish the modification to the waiting thread.
             m_Stop.store(true);
         }
+        m_NumThreads.store(0);
         // Note that if there are outstanding tasks in the queue, the threads may be woken up
         // by the corresponding notify_one() as notify*() and wait*() take place in a single
         // total order.
@@ -310,6 +312,11 @@ public:
         return m_NumRunningTasks.load();
     }
 
+    virtual Uint32 DILIGENT_CALL_TYPE GetThreadCount() const override final
+    {
+        return m_NumThreads.load();
+    }
+
     ~ThreadPoolImpl()
     {
         StopThreads();
@@ -336,6 +343,9 @@ private:
     std::atomic<bool>       m_Stop{false};
 
     std::atomic<int> m_NumRunningTasks{0};
+
+    // m_WorkerThreads is modified by StopThreads(), so the count is kept separately
+    std::atomic<Uint32> m_NumThreads{0};
 };
 
 RefCntAutoPtr<IThreadPool> CreateThreadPool(const ThreadPoolCreateInfo& ThreadPoolCI)
@@ -40,6 +40,18 @@ namespace Diligent
 namespace
 {
 
+// Appends the shader resources to the byte code so that the device does not need
+// to parse the SPIR-V with SPIRV-Cross when the shader is unpacked from the archive.
+std::vector<uint32_t> AppendShaderResources(std::vector<uint32_t> SPIRV, const ShaderVkImpl& ShaderVk)
+{
+    if (const auto& pResources = ShaderVk.GetShaderResources())
+    {
+        const auto Resources = pResources->Serialize(ShaderVk.GetEntryPoint(), GetRawAllocator());
+        SPIRVShaderResources::AppendSerializedResources(SPIRV, Resources);
+    }
+    return SPIRV;
+}
+
 struct CompiledShaderVk : SerializedShaderImpl::CompiledShader
 {
     ShaderVkImpl ShaderVk;
@@ -53,7 +65,7 @@ struct CompiledShaderVk : SerializedShaderImpl::CompiledShader
 
     virtual SerializedData Serialize(ShaderCreateInfo ShaderCI) const override final
     {
-        const auto& SPIRV = ShaderVk.GetSPIRV();
+        const auto SPIRV = AppendShaderResources(ShaderVk.GetSPIRV(), ShaderVk);
 
         ShaderCI.Source       = nullptr;
         ShaderCI.FilePath     = nullptr;
@@ -174,7 +186,8 @@ void SerializedPipelineStateImpl::PatchShadersVk(const CreateInfoType& CreateInf
                                                           BindIndexToDescSetIndex,
                                                           false, // bVerifyOnly
                                                           bStripReflection,
-                                                          CreateInfo.PSODesc.Name);
+                                                          CreateInfo.PSODesc.Name,
+                                                          m_pSerializationDevice->GetShaderCompilationThreadPool());
     }
 
     VERIFY_EXPR(m_Data.Shaders[static_cast<size_t>(DeviceType::Vulkan)].empty());
@@ -183,8 +196,14 @@ void SerializedPipelineStateImpl::PatchShadersVk(const CreateInfoType& CreateInf
         const auto& Stage = ShaderStagesVk[j];
         for (size_t i = 0; i < Stage.Count(); ++i)
         {
-            const auto& SPIRV     = Stage.SPIRVs[i];
-            auto        ShaderCI  = ShaderStages[j].Serialized[i]->GetCreateInfo();
+            // Stripping the reflection invalidates the decoration offsets, so the resources
+            // can only be attached to the byte code that retains it. Note that remapping
+            // only patches the binding values, and keeps the offsets intact.
+            const auto SPIRV = m_Data.Aux.NoShaderReflection ?
+                Stage.SPIRVs[i] :
+                AppendShaderResources(Stage.SPIRVs[i], *Stage.Shaders[i]);
+
+            auto ShaderCI         = ShaderStages[j].Serialized[i]->GetCreateInfo();
             ShaderCI.Source       = nullptr;
             ShaderCI.FilePath     = nullptr;
             ShaderCI.Macros       = {};
@@ -183,8 +183,11 @@ SerializedData SerializedShaderImpl::GetDeviceData(DeviceType Type) const
 
 IShader* SerializedShaderImpl::GetDeviceShader(RENDER_DEVICE_TYPE Type) const
 {
-    const auto  ArchiveDeviceType = RenderDeviceTypeToArchiveDeviceType(Type);
-    const auto& pCompiledShader   = m_Shaders[static_cast<size_t>(ArchiveDeviceType)];
+    const auto ArchiveDeviceType = RenderDeviceTypeToArchiveDeviceType(Type);
+    if (ArchiveDeviceType == DeviceType::Count)
+        return nullptr;
+
+    const auto& pCompiledShader = m_Shaders[static_cast<size_t>(ArchiveDeviceType)];
     return pCompiledShader ?
         pCompiledShader->GetDeviceShader() :
         nullptr;
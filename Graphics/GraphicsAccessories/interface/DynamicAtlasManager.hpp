@@ -33,6 +33,9 @@
 
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <memory>
 
 #include "../../../Primitives/interface/BasicTypes.h"
 #include "../../../Common/interface/HashUtils.hpp"
@@ -44,6 +47,22 @@ namespace Diligent
 class DynamicAtlasManager
 {
 public:
+    /// Packing algorithm
+    enum class PackingMode : Uint8
+    {
+        /// Free space is kept in a guillotine tree of rectangles. Free regions are merged
+        /// back with their siblings, so this mode works best for long-lived allocations
+        /// of varying sizes.
+        Guillotine,
+
+        /// Regions are placed on top of the skyline (the upper envelope of the allocated
+        /// regions) using the bottom-left rule. No bookkeeping nodes are needed, which makes
+        /// this mode fast for many small regions such as glyphs. Freed regions are reused
+        /// for allocations that fit into them, and are returned to the skyline once nothing
+        /// is allocated above them.
+        Skyline
+    };
+
     struct Region
     {
         Uint32 x = 0;
@@ -98,7 +117,13 @@ public:
         };
     };
 
-    DynamicAtlasManager(Uint32 Width, Uint32 Height);
+    struct RegionSize
+    {
+        Uint32 width  = 0;
+        Uint32 height = 0;
+    };
+
+    DynamicAtlasManager(Uint32 Width, Uint32 Height, PackingMode Mode = PackingMode::Guillotine);
     ~DynamicAtlasManager();
 
     // clang-format off
@@ -109,23 +134,41 @@ public:
     // clang-format on
 
     Region Allocate(Uint32 Width, Uint32 Height);
-    void   Free(Region&& R);
 
+    /// Allocates NumRegions regions at once.
+
+    /// The regions are packed from the tallest to the shortest, which gives noticeably
+    /// better occupancy than allocating them in arbitrary order.
+    /// The region for pSizes[i] is written to pRegions[i]; regions that could not
+    /// be allocated are empty. Returns the number of allocated regions.
+    Uint32 Allocate(const RegionSize* pSizes, Uint32 NumRegions, Region* pRegions);
+
+    void Free(Region&& R);
+
+    /// Returns the number of free regions.
+
+    /// In skyline mode, this is the number of skyline segments plus the number
+    /// of freed regions that are waiting to be reused.
     Uint32 GetFreeRegionCount() const
     {
+        if (m_Mode == PackingMode::Skyline)
+            return static_cast<Uint32>(m_Skyline.size() + m_SkylineFreeRegions.size());
+
         VERIFY_EXPR(m_FreeRegionsByWidth.size() == m_FreeRegionsByHeight.size());
         return static_cast<Uint32>(m_FreeRegionsByWidth.size());
     }
 
-    Uint32 GetWidth() const { return m_Width; }
-    Uint32 GetHeight() const { return m_Height; }
-    Uint64 GetTotalFreeArea() const { return m_TotalFreeArea; }
+    Uint32      GetWidth() const { return m_Width; }
+    Uint32      GetHeight() const { return m_Height; }
+    Uint64      GetTotalFreeArea() const { return m_TotalFreeArea; }
+    PackingMode GetPackingMode() const { return m_Mode; }
 
     bool IsEmpty() const
     {
-        VERIFY_EXPR(m_AllocatedRegions.empty() && (m_TotalFreeArea == Uint64{m_Width} * Uint64{m_Height}) ||
-                    !m_AllocatedRegions.empty() && (m_TotalFreeArea < Uint64{m_Width} * Uint64{m_Height}));
-        return m_AllocatedRegions.empty();
+        const auto NumAllocations = m_Mode == PackingMode::Skyline ? m_SkylineAllocatedRegions.size() : m_AllocatedRegions.size();
+        VERIFY_EXPR((NumAllocations == 0 && m_TotalFreeArea == Uint64{m_Width} * Uint64{m_Height}) ||
+                    (NumAllocations != 0 && m_TotalFreeArea < Uint64{m_Width} * Uint64{m_Height}));
+        return NumAllocations == 0;
     }
 
 #define CMP(Member)                 \
@@ -166,20 +209,38 @@ private:
     void DbgRecursiveVerifyConsistency(const Node& N, Uint32& Area) const;
 #endif
 
-    const Uint32 m_Width;
-    const Uint32 m_Height;
+    Region AllocateGuillotine(Uint32 Width, Uint32 Height);
+    void   FreeGuillotine(Region&& R);
+
+    Region AllocateSkyline(Uint32 Width, Uint32 Height);
+    void   FreeSkyline(Region&& R);
+    void   SetSkylineLevel(Uint32 x, Uint32 Width, Uint32 y);
+    bool   IsOnSkyline(const Region& R) const;
+    void   AddSkylineFreeRegion(const Region& R);
+    void   ReclaimSkylineFreeRegions(Uint32 Level);
+    void   ResetSkyline();
+
+    const Uint32      m_Width;
+    const Uint32      m_Height;
+    const PackingMode m_Mode;
 
     Uint64 m_TotalFreeArea = 0;
 
+    struct Node;
+    // Recycled child node arrays, see Node::Split()
+    using NodePool = std::vector<std::unique_ptr<Node[]>>;
+
     struct Node
     {
+        static constexpr Uint32 MaxChildren = 3;
+
         Region R;
         bool   IsAllocated = false;
         Node*  Parent      = nullptr;
 
-        void Split(const std::initializer_list<Region>& Regions);
+        void Split(const std::initializer_list<Region>& Regions, NodePool& Pool);
         bool CanMergeChildren() const;
-        void MergeChildren();
+        void MergeChildren(NodePool& Pool);
         bool HasChildren() const
         {
             VERIFY_EXPR(NumChildren == 0 && !Children || NumChildren != 0 && Children);
@@ -218,7 +279,8 @@ private:
         Uint32                  NumChildren = 0;
         std::unique_ptr<Node[]> Children;
     };
-    std::unique_ptr<Node> m_Root{new Node};
+    // Guillotine tree root, null in skyline mode
+    std::unique_ptr<Node> m_Root;
 
     void RegisterNode(Node& N);
     void UnregisterNode(const Node& N);
@@ -229,6 +291,22 @@ private:
     std::map<Region, Node*, HeightFirstCompare> m_FreeRegionsByHeight;
     // Allocated regions
     std::unordered_map<Region, Node*, Region::Hasher> m_AllocatedRegions;
+
+    NodePool m_NodePool;
+
+    // Skyline segment covers [x, x + width) and has height y
+    struct SkylineSegment
+    {
+        Uint32 x     = 0;
+        Uint32 y     = 0;
+        Uint32 width = 0;
+    };
+    // Skyline segments sorted by x that cover the entire atlas width
+    std::vector<SkylineSegment> m_Skyline;
+    // Freed regions below the skyline sorted by top boundary, then by x
+    std::vector<Region> m_SkylineFreeRegions;
+    // Allocated regions in skyline mode
+    std::unordered_set<Region, Region::Hasher> m_SkylineAllocatedRegions;
 };
 
 } // namespace Diligent
@@ -35,7 +35,10 @@
 
 #include <mutex>
 #include <deque>
+#include <vector>
 #include <atomic>
+#include <chrono>
+#include <new>
 
 #include "../../../Primitives/interface/MemoryAllocator.h"
 #include "../../../Common/interface/STDAllocator.hpp"
@@ -211,6 +214,28 @@ private:
     ResourceType m_StaleResource;
 };
 
+/// Release queue statistics, see ResourceReleaseQueue::GetStats().
+struct ResourceReleaseQueueStats
+{
+    /// The number of stale resources waiting for the command list to be submitted.
+    size_t StaleResourceCount = 0;
+
+    /// The number of resources waiting for the fence to be signaled.
+    size_t PendingReleaseResourceCount = 0;
+
+    /// The total number of resources released by Purge().
+    Uint64 ReleasedResourceCount = 0;
+
+    /// The number of resources released by the last Purge() call.
+    size_t LastPurgeReleasedCount = 0;
+
+    /// The time, in nanoseconds, spent by the last Purge() call.
+    Uint64 LastPurgeTimeNs = 0;
+
+    /// The total time, in nanoseconds, spent by all Purge() calls.
+    Uint64 TotalPurgeTimeNs = 0;
+};
+
 /// Facilitates safe resource destruction in D3D12 and Vulkan
 
 /// Resource destruction is a two-stage process:
@@ -220,6 +245,10 @@ private:
 ///   the command list
 /// * Resources are removed and actually destroyed from the queue when fence is signaled and the queue is Purged
 ///
+/// Releasing a resource does not take a lock: stale resources are pushed to a lock-free staging list
+/// that is merged into the stale objects queue by DiscardStaleResources(). Purge() moves all releasable
+/// resources out of the release queue in one batch and destroys them after the lock is released.
+///
 /// \tparam ResourceWrapperType -  Type of the resource wrapper used by the release queue.
 template <typename ResourceWrapperType>
 class ResourceReleaseQueue
@@ -227,13 +256,25 @@ class ResourceReleaseQueue
 public:
     // clang-format off
     ResourceReleaseQueue(IMemoryAllocator& Allocator) :
+        m_Allocator     {Allocator},
         m_ReleaseQueue  (STD_ALLOCATOR_RAW_MEM(ReleaseQueueElemType, Allocator, "Allocator for deque<ReleaseQueueElemType>")),
         m_StaleResources(STD_ALLOCATOR_RAW_MEM(ReleaseQueueElemType, Allocator, "Allocator for deque<ReleaseQueueElemType>"))
     {}
     // clang-format on
 
+    // clang-format off
+    ResourceReleaseQueue             (const ResourceReleaseQueue&)  = delete;
+    ResourceReleaseQueue             (      ResourceReleaseQueue&&) = delete;
+    ResourceReleaseQueue& operator = (const ResourceReleaseQueue&)  = delete;
+    ResourceReleaseQueue& operator = (      ResourceReleaseQueue&&) = delete;
+    // clang-format on
+
     ~ResourceReleaseQueue()
     {
+        {
+            std::lock_guard<std::mutex> StaleObjectsLock(m_StaleObjectsMutex);
+            MergeStagedResources();
+        }
         DEV_CHECK_ERR(m_StaleResources.empty(), "Not all stale objects were destroyed");
         DEV_CHECK_ERR(m_ReleaseQueue.empty(), "Release queue is not empty");
     }
@@ -261,8 +302,7 @@ public:
     /// \param [in] NextCommandListNumber - Number of the command list that will be submitted to the queue next
     void SafeReleaseResource(ResourceWrapperType&& Wrapper, Uint64 NextCommandListNumber)
     {
-        std::lock_guard<std::mutex> LockGuard(m_StaleObjectsMutex);
-        m_StaleResources.emplace_back(NextCommandListNumber, std::move(Wrapper));
+        StageResource(NextCommandListNumber, std::move(Wrapper));
     }
 
     /// Moves a copy of the resource wrapper to the stale resources queue
@@ -270,8 +310,7 @@ public:
     /// \param [in] NextCommandListNumber - Number of the command list that will be submitted to the queue next
     void SafeReleaseResource(const ResourceWrapperType& Wrapper, Uint64 NextCommandListNumber)
     {
-        std::lock_guard<std::mutex> LockGuard(m_StaleObjectsMutex);
-        m_StaleResources.emplace_back(NextCommandListNumber, Wrapper);
+        StageResource(NextCommandListNumber, Wrapper);
     }
 
     /// Adds a resource directly to the release queue
@@ -290,6 +329,7 @@ public:
     {
         std::lock_guard<std::mutex> ReleaseQueueLock(m_ReleaseQueueMutex);
         m_ReleaseQueue.emplace_back(FenceValue, std::move(Wrapper));
+        m_PendingReleaseCount.fetch_add(1);
     }
 
     /// Adds a copy of the resource wrapper directly to the release queue
@@ -299,6 +339,7 @@ public:
     {
         std::lock_guard<std::mutex> ReleaseQueueLock(m_ReleaseQueueMutex);
         m_ReleaseQueue.emplace_back(FenceValue, Wrapper);
+        m_PendingReleaseCount.fetch_add(1);
     }
 
     /// Adds multiple resources directly to the release queue
@@ -312,6 +353,7 @@ public:
         while (Iterator(Resource))
         {
             m_ReleaseQueue.emplace_back(FenceValue, CreateWrapper(std::move(Resource), 1));
+            m_PendingReleaseCount.fetch_add(1);
         }
     }
 
@@ -324,62 +366,174 @@ public:
     ///                                      is greater or equal to the fence value associated with the resource
     void DiscardStaleResources(Uint64 SubmittedCmdBuffNumber, Uint64 FenceValue)
     {
+        std::lock_guard<std::mutex> StaleObjectsLock(m_StaleObjectsMutex);
+        MergeStagedResources();
+
         // Only discard these stale objects that were released before CmdBuffNumber
         // was executed
-        std::lock_guard<std::mutex> StaleObjectsLock(m_StaleObjectsMutex);
-        std::lock_guard<std::mutex> ReleaseQueueLock(m_ReleaseQueueMutex);
-        while (!m_StaleResources.empty())
+        size_t NumToDiscard = 0;
+        while (NumToDiscard < m_StaleResources.size() && m_StaleResources[NumToDiscard].first <= SubmittedCmdBuffNumber)
+            ++NumToDiscard;
+        if (NumToDiscard == 0)
+            return;
+
         {
-            auto& FirstStaleObj = m_StaleResources.front();
-            if (FirstStaleObj.first <= SubmittedCmdBuffNumber)
-            {
-                m_ReleaseQueue.emplace_back(FenceValue, std::move(FirstStaleObj.second));
-                m_StaleResources.pop_front();
-            }
-            else
-                break;
+            std::lock_guard<std::mutex> ReleaseQueueLock(m_ReleaseQueueMutex);
+            for (size_t i = 0; i < NumToDiscard; ++i)
+                m_ReleaseQueue.emplace_back(FenceValue, std::move(m_StaleResources[i].second));
+            m_PendingReleaseCount.fetch_add(NumToDiscard);
         }
+
+        for (size_t i = 0; i < NumToDiscard; ++i)
+            m_StaleResources.pop_front();
+        m_StaleResourceCount.fetch_sub(NumToDiscard);
     }
 
 
     /// Removes all objects from the release queue whose fence value is
     /// less than or equal to CompletedFenceValue
-    /// \param [in] CompletedFenceValue  -  Value of the fence that has been completed by the GPU
-    void Purge(Uint64 CompletedFenceValue)
+    /// \param [in] CompletedFenceValue  - Value of the fence that has been completed by the GPU
+    /// \param [in] MaxResourceCount     - The maximum number of resources to release. This can be used
+    ///                                    to limit the amount of release work done per frame.
+    ///
+    /// \return     The number of released resources.
+    ///
+    /// \remarks    Resources are moved out of the queue while the lock is held and
+    ///             are destroyed after it is released, so that threads that add
+    ///             resources to the queue are not blocked by the destruction.
+    size_t Purge(Uint64 CompletedFenceValue, size_t MaxResourceCount = ~size_t{0})
     {
-        std::lock_guard<std::mutex> LockGuard(m_ReleaseQueueMutex);
+        const auto StartTime = std::chrono::steady_clock::now();
 
-        // Release all objects whose associated fence value is at most CompletedFenceValue
-        // See http://diligentgraphics.com/diligent-engine/architecture/d3d12/managing-resource-lifetimes/
-        while (!m_ReleaseQueue.empty())
+        std::vector<ReleaseQueueElemType> ReleaseBatch;
         {
-            auto& FirstObj = m_ReleaseQueue.front();
-            if (FirstObj.first <= CompletedFenceValue)
+            std::lock_guard<std::mutex> LockGuard(m_ReleaseQueueMutex);
+
+            // Release all objects whose associated fence value is at most CompletedFenceValue
+            // See http://diligentgraphics.com/diligent-engine/architecture/d3d12/managing-resource-lifetimes/
+            size_t NumToRelease = 0;
+            while (NumToRelease < m_ReleaseQueue.size() && NumToRelease < MaxResourceCount && m_ReleaseQueue[NumToRelease].first <= CompletedFenceValue)
+                ++NumToRelease;
+            if (NumToRelease == 0)
+                return 0;
+
+            ReleaseBatch.reserve(NumToRelease);
+            for (size_t i = 0; i < NumToRelease; ++i)
+            {
+                ReleaseBatch.emplace_back(std::move(m_ReleaseQueue.front()));
                 m_ReleaseQueue.pop_front();
-            else
-                break;
+            }
+            m_PendingReleaseCount.fetch_sub(NumToRelease);
         }
+
+        const auto NumReleased = ReleaseBatch.size();
+        // Destroy the resources outside of the lock
+        ReleaseBatch.clear();
+
+        const auto PurgeTimeNs = static_cast<Uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - StartTime).count());
+        m_ReleasedResourceCount.fetch_add(NumReleased);
+        m_LastPurgeReleasedCount.store(NumReleased);
+        m_LastPurgeTimeNs.store(PurgeTimeNs);
+        m_TotalPurgeTimeNs.fetch_add(PurgeTimeNs);
+
+        return NumReleased;
     }
 
     /// Returns the number of stale resources
     size_t GetStaleResourceCount() const
     {
-        return m_StaleResources.size();
+        return m_StaleResourceCount.load();
     }
 
     /// Returns the number of resources pending release
     size_t GetPendingReleaseResourceCount() const
     {
-        return m_ReleaseQueue.size();
+        return m_PendingReleaseCount.load();
+    }
+
+    /// Returns the release queue statistics
+    ResourceReleaseQueueStats GetStats() const
+    {
+        ResourceReleaseQueueStats Stats;
+        Stats.StaleResourceCount          = m_StaleResourceCount.load();
+        Stats.PendingReleaseResourceCount = m_PendingReleaseCount.load();
+        Stats.ReleasedResourceCount       = m_ReleasedResourceCount.load();
+        Stats.LastPurgeReleasedCount      = m_LastPurgeReleasedCount.load();
+        Stats.LastPurgeTimeNs             = m_LastPurgeTimeNs.load();
+        Stats.TotalPurgeTimeNs            = m_TotalPurgeTimeNs.load();
+        return Stats;
     }
 
 private:
-    std::mutex m_ReleaseQueueMutex;
     using ReleaseQueueElemType = std::pair<Uint64, ResourceWrapperType>;
+
+    // Node of the lock-free staging list
+    struct StagedResource
+    {
+        template <typename WrapperType>
+        StagedResource(Uint64 CmdListNumber, WrapperType&& Wrapper) :
+            Elem{CmdListNumber, std::forward<WrapperType>(Wrapper)}
+        {}
+
+        ReleaseQueueElemType Elem;
+        StagedResource*      pNext = nullptr;
+    };
+
+    template <typename WrapperType>
+    void StageResource(Uint64 NextCommandListNumber, WrapperType&& Wrapper)
+    {
+        void* pRawMem = m_Allocator.Allocate(sizeof(StagedResource), "Staged stale resource", __FILE__, __LINE__);
+        auto* pNode   = new (pRawMem) StagedResource{NextCommandListNumber, std::forward<WrapperType>(Wrapper)};
+
+        pNode->pNext = m_pStagedResources.load(std::memory_order_relaxed);
+        while (!m_pStagedResources.compare_exchange_weak(pNode->pNext, pNode, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+        m_StaleResourceCount.fetch_add(1);
+    }
+
+    // Moves all staged resources to the stale objects queue.
+    // m_StaleObjectsMutex must be locked.
+    void MergeStagedResources()
+    {
+        auto* pNode = m_pStagedResources.exchange(nullptr, std::memory_order_acquire);
+
+        // The staging list is LIFO - reverse it to preserve the release order
+        StagedResource* pReversed = nullptr;
+        while (pNode != nullptr)
+        {
+            auto* pNext  = pNode->pNext;
+            pNode->pNext = pReversed;
+            pReversed    = pNode;
+            pNode        = pNext;
+        }
+
+        while (pReversed != nullptr)
+        {
+            auto* pNext = pReversed->pNext;
+            m_StaleResources.emplace_back(pReversed->Elem.first, std::move(pReversed->Elem.second));
+            pReversed->~StagedResource();
+            m_Allocator.Free(pReversed);
+            pReversed = pNext;
+        }
+    }
+
+    IMemoryAllocator& m_Allocator;
+
+    std::mutex                                                                 m_ReleaseQueueMutex;
     std::deque<ReleaseQueueElemType, STDAllocatorRawMem<ReleaseQueueElemType>> m_ReleaseQueue;
 
+    std::atomic<StagedResource*> m_pStagedResources{nullptr};
+
     std::mutex                                                                 m_StaleObjectsMutex;
     std::deque<ReleaseQueueElemType, STDAllocatorRawMem<ReleaseQueueElemType>> m_StaleResources;
+
+    std::atomic<size_t> m_StaleResourceCount{0};
+    std::atomic<size_t> m_PendingReleaseCount{0};
+    std::atomic<Uint64> m_ReleasedResourceCount{0};
+    std::atomic<size_t> m_LastPurgeReleasedCount{0};
+    std::atomic<Uint64> m_LastPurgeTimeNs{0};
+    std::atomic<Uint64> m_TotalPurgeTimeNs{0};
 };
 
 } // namespace Diligent
@@ -32,6 +32,7 @@
 
 
 #include <deque>
+#include <atomic>
 #include "../../../Primitives/interface/MemoryAllocator.h"
 #include "../../../Platforms/Basic/interface/DebugUtilities.hpp"
 #include "../../../Common/interface/Align.hpp"
@@ -237,4 +238,135 @@ private:
     OffsetType m_UsedSize      = 0;
     OffsetType m_CurrFrameSize = 0;
 };
+
+/// Multi-producer variant of the ring buffer.
+
+/// Allocate() is lock-free and may be called by multiple threads simultaneously:
+/// the head is advanced with an atomic compare-exchange (bump pointer).
+/// FinishCurrentFrame() and ReleaseCompletedFrames() must be externally synchronized with
+/// each other, but may run concurrently with Allocate(). An allocation belongs to the frame
+/// that is finished first after the allocation returns.
+///
+/// Unlike RingBuffer, the head is never reset when the buffer becomes empty, and the
+/// buffer is never filled completely when the head wraps around, so that equal head
+/// and tail always indicate an empty buffer.
+class AtomicRingBuffer
+{
+public:
+    using OffsetType       = RingBuffer::OffsetType;
+    using FrameHeadAttribs = RingBuffer::FrameHeadAttribs;
+
+    static constexpr const OffsetType InvalidOffset = RingBuffer::InvalidOffset;
+
+    AtomicRingBuffer(OffsetType MaxSize, IMemoryAllocator& Allocator) noexcept :
+        m_CompletedFrameHeads(STD_ALLOCATOR_RAW_MEM(FrameHeadAttribs, Allocator, "Allocator for deque<FrameHeadAttribs>")),
+        m_MaxSize{MaxSize}
+    {}
+
+    // clang-format off
+    AtomicRingBuffer             (const AtomicRingBuffer&)  = delete;
+    AtomicRingBuffer             (      AtomicRingBuffer&&) = delete;
+    AtomicRingBuffer& operator = (const AtomicRingBuffer&)  = delete;
+    AtomicRingBuffer& operator = (      AtomicRingBuffer&&) = delete;
+    // clang-format on
+
+    ~AtomicRingBuffer()
+    {
+        VERIFY(IsEmpty(), "All space in the ring buffer must be released");
+    }
+
+    OffsetType Allocate(OffsetType Size, OffsetType Alignment)
+    {
+        VERIFY_EXPR(Size > 0);
+        VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be power of 2");
+        Size = AlignUp(Size, Alignment);
+
+        auto Head = m_Head.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            // The tail only moves towards the head, so a stale value is always conservative
+            const auto Tail        = m_Tail.load(std::memory_order_acquire);
+            const auto AlignedHead = AlignUp(Head, Alignment);
+
+            OffsetType Offset  = InvalidOffset;
+            OffsetType NewHead = 0;
+            if (Head >= Tail)
+            {
+                if (AlignedHead + Size <= m_MaxSize)
+                {
+                    Offset  = AlignedHead;
+                    NewHead = AlignedHead + Size;
+                }
+                else if (Size < Tail)
+                {
+                    // Allocate from the beginning of the buffer. The new head must not reach the tail.
+                    Offset  = 0;
+                    NewHead = Size;
+                }
+            }
+            else if (AlignedHead + Size < Tail)
+            {
+                Offset  = AlignedHead;
+                NewHead = AlignedHead + Size;
+            }
+
+            if (Offset == InvalidOffset)
+                return InvalidOffset;
+
+            if (m_Head.compare_exchange_weak(Head, NewHead, std::memory_order_acq_rel, std::memory_order_relaxed))
+                return Offset;
+        }
+    }
+
+    // FenceValue is the fence value associated with the command list in which the head
+    // could have been referenced last time
+    void FinishCurrentFrame(Uint64 FenceValue)
+    {
+#ifdef DILIGENT_DEBUG
+        if (!m_CompletedFrameHeads.empty())
+            VERIFY(FenceValue >= m_CompletedFrameHeads.back().FenceValue, "Current frame fence value (", FenceValue, ") is lower than the fence value of the previous frame (", m_CompletedFrameHeads.back().FenceValue, ")");
+#endif
+        const auto Head = m_Head.load(std::memory_order_acquire);
+        // Ignore zero-size frames
+        if (Head != m_LastFrameHead)
+        {
+            const auto FrameSize = Head >= m_LastFrameHead ? Head - m_LastFrameHead : m_MaxSize - m_LastFrameHead + Head;
+            m_CompletedFrameHeads.emplace_back(FenceValue, Head, FrameSize);
+            m_LastFrameHead = Head;
+        }
+    }
+
+    // CompletedFenceValue indicates GPU progress
+    void ReleaseCompletedFrames(Uint64 CompletedFenceValue)
+    {
+        while (!m_CompletedFrameHeads.empty() && m_CompletedFrameHeads.front().FenceValue <= CompletedFenceValue)
+        {
+            m_Tail.store(m_CompletedFrameHeads.front().Offset, std::memory_order_release);
+            m_CompletedFrameHeads.pop_front();
+        }
+    }
+
+    OffsetType GetMaxSize() const { return m_MaxSize; }
+
+    /// Returns the used size. The value may be inaccurate if other threads are allocating memory.
+    OffsetType GetUsedSize() const
+    {
+        const auto Tail = m_Tail.load();
+        const auto Head = m_Head.load();
+        return Head >= Tail ? Head - Tail : m_MaxSize - Tail + Head;
+    }
+
+    bool IsEmpty() const { return m_Head.load() == m_Tail.load(); }
+
+private:
+    // Only accessed by FinishCurrentFrame() and ReleaseCompletedFrames()
+    std::deque<FrameHeadAttribs, STDAllocatorRawMem<FrameHeadAttribs>> m_CompletedFrameHeads;
+    OffsetType                                                         m_LastFrameHead = 0;
+
+    std::atomic<OffsetType> m_Head{0};
+    std::atomic<OffsetType> m_Tail{0};
+
+    const OffsetType m_MaxSize;
+};
+
 } // namespace Diligent
@@ -0,0 +1,175 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Implementation of Diligent::SizeClassIndex class
+
+#include <array>
+#include <vector>
+#include "../../../Primitives/interface/BasicTypes.h"
+#include "../../../Platforms/interface/PlatformMisc.hpp"
+#include "../../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "../../../Common/interface/Align.hpp"
+
+namespace Diligent
+{
+
+/// Index that groups items (e.g. memory pages) into power-of-two size classes by the size
+/// of their largest free block.
+
+/// An item whose largest free block is S bytes belongs to size class floor(log2(S)).
+/// Every item in size class ceil(log2(Size)) or higher is guaranteed to have a free block
+/// of at least Size bytes, which allows finding a fitting item in constant time instead of
+/// trying every item in turn. Items with no free space are not tracked.
+///
+/// The index does not own the items. Every item has an associated Location that
+/// the index uses to remove and move the item in constant time; the location must stay at
+/// the same address while the item is in the index. The class is not thread-safe.
+template <typename ItemType>
+class SizeClassIndex
+{
+public:
+    static constexpr Uint32 NumSizeClasses   = 64;
+    static constexpr Uint32 InvalidSizeClass = ~Uint32{0};
+
+    /// Position of an item in the index
+    struct Location
+    {
+        Uint32 SizeClass = InvalidSizeClass;
+        Uint32 Pos       = 0;
+
+        bool IsValid() const { return SizeClass != InvalidSizeClass; }
+    };
+
+    SizeClassIndex() noexcept {}
+
+    // clang-format off
+    SizeClassIndex           (const SizeClassIndex&) = delete;
+    SizeClassIndex& operator=(const SizeClassIndex&) = delete;
+    // clang-format on
+
+    SizeClassIndex(SizeClassIndex&&) = default;
+    SizeClassIndex& operator=(SizeClassIndex&&) = default;
+
+    /// Returns the size class of the block of the given size, i.e. floor(log2(Size)).
+    static Uint32 GetSizeClass(Uint64 Size)
+    {
+        VERIFY_EXPR(Size > 0);
+        return PlatformMisc::GetMSB(Size);
+    }
+
+    /// Adds the item to the index or moves it to the size class that corresponds to
+    /// its largest free block size. If MaxFreeBlockSize is zero, the item is removed.
+    void Update(ItemType& Item, Location& Loc, Uint64 MaxFreeBlockSize)
+    {
+        const Uint32 NewSizeClass = MaxFreeBlockSize > 0 ? GetSizeClass(MaxFreeBlockSize) : InvalidSizeClass;
+        if (NewSizeClass == Loc.SizeClass)
+            return;
+
+        Remove(Loc);
+        if (NewSizeClass == InvalidSizeClass)
+            return;
+
+        auto& Bucket  = m_Buckets[NewSizeClass];
+        Loc.SizeClass = NewSizeClass;
+        Loc.Pos       = static_cast<Uint32>(Bucket.size());
+        Bucket.push_back({&Item, &Loc});
+        m_NonEmptyMask |= Uint64{1} << NewSizeClass;
+    }
+
+    /// Removes the item from the index. Does nothing if the item is not in the index.
+    void Remove(Location& Loc)
+    {
+        if (!Loc.IsValid())
+            return;
+
+        auto& Bucket = m_Buckets[Loc.SizeClass];
+        VERIFY_EXPR(Loc.Pos < Bucket.size() && Bucket[Loc.Pos].pLoc == &Loc);
+        if (Loc.Pos + 1 != Bucket.size())
+        {
+            Bucket[Loc.Pos]           = Bucket.back();
+            Bucket[Loc.Pos].pLoc->Pos = Loc.Pos;
+        }
+        Bucket.pop_back();
+        if (Bucket.empty())
+            m_NonEmptyMask &= ~(Uint64{1} << Loc.SizeClass);
+
+        Loc = Location{};
+    }
+
+    /// Returns an item whose largest free block is guaranteed to be at least Size bytes,
+    /// or null if there is no such item. The item is taken from the smallest size class
+    /// that satisfies the request to preserve larger blocks.
+    ItemType* FindGuaranteed(Uint64 Size) const
+    {
+        VERIFY_EXPR(Size > 0);
+        // ceil(log2(Size))
+        const Uint32 MinSizeClass = GetSizeClass(Size) + (IsPowerOfTwo(Size) ? 0 : 1);
+        if (MinSizeClass >= NumSizeClasses)
+            return nullptr;
+
+        const Uint64 Mask = m_NonEmptyMask & ~((Uint64{1} << MinSizeClass) - 1);
+        if (Mask == 0)
+            return nullptr;
+
+        return m_Buckets[PlatformMisc::GetLSB(Mask)].back().pItem;
+    }
+
+    /// Returns an item from the size class of the requested size, or null if the class is empty.
+    /// The item's largest free block may or may not be large enough to accommodate Size bytes,
+    /// so the caller needs to try it and fall back to FindGuaranteed() if it does not fit.
+    ItemType* FindCandidate(Uint64 Size) const
+    {
+        const Uint32 SizeClass = GetSizeClass(Size);
+        return (m_NonEmptyMask & (Uint64{1} << SizeClass)) != 0 ? m_Buckets[SizeClass].back().pItem : nullptr;
+    }
+
+    bool IsEmpty() const { return m_NonEmptyMask == 0; }
+
+    /// Returns the total number of items in the index.
+    size_t GetSize() const
+    {
+        size_t Size = 0;
+        for (const auto& Bucket : m_Buckets)
+            Size += Bucket.size();
+        return Size;
+    }
+
+private:
+    struct Entry
+    {
+        ItemType* pItem;
+        Location* pLoc;
+    };
+    std::array<std::vector<Entry>, NumSizeClasses> m_Buckets;
+
+    // Bit N is set when size class N is not empty
+    Uint64 m_NonEmptyMask = 0;
+};
+
+} // namespace Diligent
@@ -223,49 +223,29 @@ public:
         VERIFY_EXPR(Size + AlignmentReserve <= SmallestBlockIt->second.Size);
         VERIFY_EXPR(SmallestBlockIt->second.Size == SmallestBlockItIt->first);
 
-        //     SmallestBlockIt.Offset
-        //        |                                  |
-        //        |<------SmallestBlockIt.Size------>|
-        //        |<------Size------>|<---NewSize--->|
-        //        |                  |
-        //      Offset              NewOffset
-        //
-        auto Offset = SmallestBlockIt->first;
-        VERIFY_EXPR(Offset % m_CurrAlignment == 0);
-        auto AlignedOffset = AlignUp(Offset, Alignment);
-        auto AdjustedSize  = Size + (AlignedOffset - Offset);
-        VERIFY_EXPR(AdjustedSize <= Size + AlignmentReserve);
-        auto NewOffset = Offset + AdjustedSize;
-        auto NewSize   = SmallestBlockIt->second.Size - AdjustedSize;
-        VERIFY_EXPR(SmallestBlockItIt == SmallestBlockIt->second.OrderBySizeIt);
-        m_FreeBlocksBySize.erase(SmallestBlockItIt);
-        m_FreeBlocksByOffset.erase(SmallestBlockIt);
-        if (NewSize > 0)
-        {
-            AddNewBlock(NewOffset, NewSize);
-        }
+        return AllocateFromBlock(SmallestBlockIt, Size, Alignment);
+    }
 
-        m_FreeSize -= AdjustedSize;
+    // Allocates a block that starts below the given offset, taking the free block with the
+    // lowest offset that is large enough. Unlike Allocate(), this is a first-fit search that
+    // is intended for compaction: moving an allocation into the returned block never
+    // increases the offset of the data.
+    Allocation AllocateBelow(OffsetType Size, OffsetType Alignment, OffsetType Offset)
+    {
+        VERIFY_EXPR(Size > 0);
+        VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be power of 2");
+        Size = AlignUp(Size, Alignment);
+        if (m_FreeSize < Size)
+            return Allocation::InvalidAllocation();
 
-        if ((Size & (m_CurrAlignment - 1)) != 0)
+        auto AlignmentReserve = (Alignment > m_CurrAlignment) ? Alignment - m_CurrAlignment : 0;
+        for (auto BlockIt = m_FreeBlocksByOffset.begin(); BlockIt != m_FreeBlocksByOffset.end() && BlockIt->first < Offset; ++BlockIt)
         {
-            if (IsPowerOfTwo(Size))
-            {
-                VERIFY_EXPR(Size >= Alignment && Size < m_CurrAlignment);
-                m_CurrAlignment = Size;
-            }
-            else
-            {
-                m_CurrAlignment = (std::min)(m_CurrAlignment, Alignment);
-            }
+            if (BlockIt->second.Size >= Size + AlignmentReserve)
+                return AllocateFromBlock(BlockIt, Size, Alignment);
         }
 
-#ifdef DILIGENT_DEBUG
-        VERIFY_EXPR(m_FreeBlocksByOffset.size() == m_FreeBlocksBySize.size());
-        if (!m_DbgDisableDebugValidation)
-            DbgVerifyList();
-#endif
-        return Allocation{Offset, AdjustedSize};
+        return Allocation::InvalidAllocation();
     }
 
     void Free(Allocation&& allocation)
@@ -421,6 +401,51 @@ public:
         m_MaxSize += ExtraSize;
         m_FreeSize += ExtraSize;
 
+#ifdef DILIGENT_DEBUG
+        VERIFY_EXPR(m_FreeBlocksByOffset.size() == m_FreeBlocksBySize.size());
+        if (!m_DbgDisableDebugValidation)
+            DbgVerifyList();
+#endif
+    }
+
+    // Returns the size of the free block at the end of the managed space, if any
+    OffsetType GetTailFreeSize() const
+    {
+        if (m_FreeBlocksByOffset.empty())
+            return 0;
+
+        const auto LastBlockIt = m_FreeBlocksByOffset.rbegin();
+        return LastBlockIt->first + LastBlockIt->second.Size == m_MaxSize ? LastBlockIt->second.Size : 0;
+    }
+
+    // Removes ReleaseSize bytes from the end of the managed space.
+    // The released range must be entirely free, see GetTailFreeSize().
+    void Shrink(OffsetType ReleaseSize)
+    {
+        if (ReleaseSize == 0)
+            return;
+
+        VERIFY(ReleaseSize <= GetTailFreeSize(), "Only free space at the end of the managed range can be released");
+
+        auto LastBlockIt = m_FreeBlocksByOffset.end();
+        --LastBlockIt;
+
+        const auto LastBlockOffset = LastBlockIt->first;
+        const auto NewBlockSize    = LastBlockIt->second.Size - ReleaseSize;
+        m_FreeBlocksBySize.erase(LastBlockIt->second.OrderBySizeIt);
+        m_FreeBlocksByOffset.erase(LastBlockIt);
+        if (NewBlockSize > 0)
+        {
+            AddNewBlock(LastBlockOffset, NewBlockSize);
+        }
+
+        m_MaxSize -= ReleaseSize;
+        m_FreeSize -= ReleaseSize;
+        if (IsEmpty())
+        {
+            ResetCurrAlignment();
+        }
+
 #ifdef DILIGENT_DEBUG
         VERIFY_EXPR(m_FreeBlocksByOffset.size() == m_FreeBlocksBySize.size());
         if (!m_DbgDisableDebugValidation)
@@ -429,6 +454,54 @@ public:
     }
 
 private:
+    // Allocates Size bytes aligned by Alignment from the beginning of the given free block.
+    // The block must be large enough to accommodate the allocation with the alignment reserve.
+    Allocation AllocateFromBlock(TFreeBlocksByOffsetMap::iterator BlockIt, OffsetType Size, OffsetType Alignment)
+    {
+        //     BlockIt.Offset
+        //        |                                  |
+        //        |<-----------BlockIt.Size--------->|
+        //        |<------Size------>|<---NewSize--->|
+        //        |                  |
+        //      Offset              NewOffset
+        //
+        auto Offset = BlockIt->first;
+        VERIFY_EXPR(Offset % m_CurrAlignment == 0);
+        auto AlignedOffset = AlignUp(Offset, Alignment);
+        auto AdjustedSize  = Size + (AlignedOffset - Offset);
+        VERIFY_EXPR(AdjustedSize <= BlockIt->second.Size);
+        auto NewOffset = Offset + AdjustedSize;
+        auto NewSize   = BlockIt->second.Size - AdjustedSize;
+        m_FreeBlocksBySize.erase(BlockIt->second.OrderBySizeIt);
+        m_FreeBlocksByOffset.erase(BlockIt);
+        if (NewSize > 0)
+        {
+            AddNewBlock(NewOffset, NewSize);
+        }
+
+        m_FreeSize -= AdjustedSize;
+
+        if ((Size & (m_CurrAlignment - 1)) != 0)
+        {
+            if (IsPowerOfTwo(Size))
+            {
+                VERIFY_EXPR(Size >= Alignment && Size < m_CurrAlignment);
+                m_CurrAlignment = Size;
+            }
+            else
+            {
+                m_CurrAlignment = (std::min)(m_CurrAlignment, Alignment);
+            }
+        }
+
+#ifdef DILIGENT_DEBUG
+        VERIFY_EXPR(m_FreeBlocksByOffset.size() == m_FreeBlocksBySize.size());
+        if (!m_DbgDisableDebugValidation)
+            DbgVerifyList();
+#endif
+        return Allocation{Offset, AdjustedSize};
+    }
+
     void AddNewBlock(OffsetType Offset, OffsetType Size)
     {
         auto NewBlockIt = m_FreeBlocksByOffset.emplace(Offset, Size);
@@ -28,6 +28,8 @@
 #include "DynamicAtlasManager.hpp"
 
 #include <climits>
+#include <algorithm>
+#include <numeric>
 
 #include "AdvancedMath.hpp"
 
@@ -71,18 +73,30 @@ void DynamicAtlasManager::Node::Validate() const
 }
 #endif
 
-void DynamicAtlasManager::Node::Split(const std::initializer_list<Region>& Regions)
+void DynamicAtlasManager::Node::Split(const std::initializer_list<Region>& Regions, NodePool& Pool)
 {
-    VERIFY(Regions.size() >= 2, "There must be at least two regions");
+    VERIFY(Regions.size() >= 2 && Regions.size() <= MaxChildren, "There must be two or three regions");
     VERIFY(!HasChildren(), "This node already has children and can't be split");
     VERIFY(!IsAllocated, "Allocated region can't be split");
 
-    Children.reset(new Node[Regions.size()]);
+    if (!Pool.empty())
+    {
+        Children = std::move(Pool.back());
+        Pool.pop_back();
+    }
+    else
+    {
+        Children.reset(new Node[MaxChildren]);
+    }
+
     NumChildren = 0;
     for (const auto& ChildR : Regions)
     {
-        Children[NumChildren].Parent = this;
-        Children[NumChildren].R      = ChildR;
+        auto& Child = Children[NumChildren];
+        VERIFY(Child.NumChildren == 0 && !Child.Children, "Recycled nodes must not have children");
+        Child.Parent      = this;
+        Child.R           = ChildR;
+        Child.IsAllocated = false;
         ++NumChildren;
     }
     VERIFY_EXPR(NumChildren == Regions.size());
@@ -101,28 +115,41 @@ bool DynamicAtlasManager::Node::CanMergeChildren() const
     return CanMerge;
 }
 
-void DynamicAtlasManager::Node::MergeChildren()
+void DynamicAtlasManager::Node::MergeChildren(NodePool& Pool)
 {
     VERIFY_EXPR(HasChildren());
     VERIFY_EXPR(CanMergeChildren());
-    Children.reset();
+    Pool.emplace_back(std::move(Children));
     NumChildren = 0;
 }
 
 
-DynamicAtlasManager::DynamicAtlasManager(Uint32 Width, Uint32 Height) :
+DynamicAtlasManager::DynamicAtlasManager(Uint32 Width, Uint32 Height, PackingMode Mode) :
     m_Width{Width},
     m_Height{Height},
+    m_Mode{Mode},
     m_TotalFreeArea{Uint64{Width} * Uint64{Height}}
 {
-    m_Root->R = Region{0, 0, Width, Height};
-    RegisterNode(*m_Root);
+    if (m_Mode == PackingMode::Skyline)
+    {
+        ResetSkyline();
+    }
+    else
+    {
+        m_Root.reset(new Node);
+        m_Root->R = Region{0, 0, Width, Height};
+        RegisterNode(*m_Root);
+    }
 }
 
 
 DynamicAtlasManager::~DynamicAtlasManager()
 {
-    if (m_Root)
+    if (m_Mode == PackingMode::Skyline)
+    {
+        DEV_CHECK_ERR(m_SkylineAllocatedRegions.empty(), "There must be no allocated regions");
+    }
+    else if (m_Root)
     {
 #if DILIGENT_DEBUG
         DbgVerifyConsistency();
@@ -183,6 +210,54 @@ void DynamicAtlasManager::UnregisterNode(const Node& N)
 
 
 DynamicAtlasManager::Region DynamicAtlasManager::Allocate(Uint32 Width, Uint32 Height)
+{
+    return m_Mode == PackingMode::Skyline ?
+        AllocateSkyline(Width, Height) :
+        AllocateGuillotine(Width, Height);
+}
+
+Uint32 DynamicAtlasManager::Allocate(const RegionSize* pSizes, Uint32 NumRegions, Region* pRegions)
+{
+    if (NumRegions == 0)
+        return 0;
+
+    VERIFY_EXPR(pSizes != nullptr && pRegions != nullptr);
+
+    std::vector<Uint32> Order(NumRegions);
+    std::iota(Order.begin(), Order.end(), 0u);
+    // Pack taller regions first, and wider regions first among regions of the same height,
+    // so that the shorter regions fill the gaps left by the taller ones.
+    std::sort(Order.begin(), Order.end(),
+              [pSizes](Uint32 i0, Uint32 i1) {
+                  const auto& S0 = pSizes[i0];
+                  const auto& S1 = pSizes[i1];
+                  if (S0.height != S1.height)
+                      return S0.height > S1.height;
+                  if (S0.width != S1.width)
+                      return S0.width > S1.width;
+                  return i0 < i1;
+              });
+
+    Uint32 NumAllocated = 0;
+    for (auto Idx : Order)
+    {
+        pRegions[Idx] = Allocate(pSizes[Idx].width, pSizes[Idx].height);
+        if (!pRegions[Idx].IsEmpty())
+            ++NumAllocated;
+    }
+
+    return NumAllocated;
+}
+
+void DynamicAtlasManager::Free(Region&& R)
+{
+    if (m_Mode == PackingMode::Skyline)
+        FreeSkyline(std::move(R));
+    else
+        FreeGuillotine(std::move(R));
+}
+
+DynamicAtlasManager::Region DynamicAtlasManager::AllocateGuillotine(Uint32 Width, Uint32 Height)
 {
     auto it_w = m_FreeRegionsByWidth.lower_bound(Region{0, 0, Width, 0});
     while (it_w != m_FreeRegionsByWidth.end() && it_w->first.height < Height)
@@ -240,7 +315,8 @@ DynamicAtlasManager::Region DynamicAtlasManager::Allocate(Uint32 Width, Uint32 H
                     Region{R.x + Width, R.y,          R.width - Width, R.height         }, // A
                     Region{R.x,         R.y + Height, Width,           R.height - Height}  // B
                     // clang-format on
-                });
+                },
+                m_NodePool);
         }
         else
         {
@@ -261,7 +337,8 @@ DynamicAtlasManager::Region DynamicAtlasManager::Allocate(Uint32 Width, Uint32 H
                     Region{R.x,         R.y + Height, R.width,         R.height - Height}, // A
                     Region{R.x + Width, R.y,          R.width - Width, Height           }  // B
                     // clang-format on
-                });
+                },
+                m_NodePool);
         }
     }
     else if (R.width > Width)
@@ -277,7 +354,8 @@ DynamicAtlasManager::Region DynamicAtlasManager::Allocate(Uint32 Width, Uint32 H
                 Region{R.x,         R.y, Width,           Height  }, // R
                 Region{R.x + Width, R.y, R.width - Width, R.height}  // A
                 // clang-format on
-            });
+            },
+            m_NodePool);
     }
     else if (R.height > Height)
     {
@@ -295,7 +373,8 @@ DynamicAtlasManager::Region DynamicAtlasManager::Allocate(Uint32 Width, Uint32 H
                 Region{R.x,          R.y,   Width, Height           }, // R
                 Region{R.x, R.y + Height, R.width, R.height - Height}  // A
                 // clang-format on
-            });
+            },
+            m_NodePool);
     }
 
     R.width  = Width;
@@ -327,7 +406,7 @@ DynamicAtlasManager::Region DynamicAtlasManager::Allocate(Uint32 Width, Uint32 H
 }
 
 
-void DynamicAtlasManager::Free(Region&& R)
+void DynamicAtlasManager::FreeGuillotine(Region&& R)
 {
 #if DILIGENT_DEBUG
     DbgVerifyRegion(R);
@@ -354,7 +433,7 @@ void DynamicAtlasManager::Free(Region&& R)
                            {
                                UnregisterNode(Child);
                            });
-        N->MergeChildren();
+        N->MergeChildren(m_NodePool);
         RegisterNode(*N);
 
         N = N->Parent;
@@ -370,6 +449,267 @@ void DynamicAtlasManager::Free(Region&& R)
 }
 
 
+void DynamicAtlasManager::ResetSkyline()
+{
+    m_Skyline.clear();
+    m_Skyline.emplace_back(SkylineSegment{0, 0, m_Width});
+    m_SkylineFreeRegions.clear();
+}
+
+void DynamicAtlasManager::SetSkylineLevel(Uint32 x, Uint32 Width, Uint32 y)
+{
+    VERIFY_EXPR(Width > 0 && x + Width <= m_Width);
+    const auto End = x + Width;
+
+    // Find the first segment that ends after x
+    size_t i = 0;
+    while (m_Skyline[i].x + m_Skyline[i].width <= x)
+        ++i;
+
+    if (m_Skyline[i].x < x)
+    {
+        // Split the segment that starts before x
+        //
+        //   |<---------Seg[i]--------->|
+        //   |<----Left---->|<-Seg[i]-->|
+        //                  x
+        const SkylineSegment Left{m_Skyline[i].x, m_Skyline[i].y, x - m_Skyline[i].x};
+        m_Skyline[i].x = x;
+        m_Skyline[i].width -= Left.width;
+        m_Skyline.insert(m_Skyline.begin() + i, Left);
+        ++i;
+    }
+
+    // Find the first segment that ends after End and trim it
+    auto j = i;
+    while (j < m_Skyline.size() && m_Skyline[j].x + m_Skyline[j].width <= End)
+        ++j;
+    if (j < m_Skyline.size() && m_Skyline[j].x < End)
+    {
+        m_Skyline[j].width -= End - m_Skyline[j].x;
+        m_Skyline[j].x = End;
+    }
+
+    // Replace all segments in [x, End) with the new one
+    VERIFY_EXPR(j > i || j == m_Skyline.size() || m_Skyline[j].x == End);
+    if (j > i)
+    {
+        m_Skyline[i] = SkylineSegment{x, y, Width};
+        m_Skyline.erase(m_Skyline.begin() + i + 1, m_Skyline.begin() + j);
+    }
+    else
+    {
+        m_Skyline.insert(m_Skyline.begin() + i, SkylineSegment{x, y, Width});
+    }
+
+    // Merge with neighbors of the same height
+    if (i + 1 < m_Skyline.size() && m_Skyline[i + 1].y == y)
+    {
+        m_Skyline[i].width += m_Skyline[i + 1].width;
+        m_Skyline.erase(m_Skyline.begin() + i + 1);
+    }
+    if (i > 0 && m_Skyline[i - 1].y == y)
+    {
+        m_Skyline[i - 1].width += m_Skyline[i].width;
+        m_Skyline.erase(m_Skyline.begin() + i);
+    }
+
+#if DILIGENT_DEBUG
+    Uint32 TotalWidth = 0;
+    for (size_t s = 0; s < m_Skyline.size(); ++s)
+    {
+        VERIFY_EXPR(m_Skyline[s].width > 0 && m_Skyline[s].x == TotalWidth);
+        VERIFY(s == 0 || m_Skyline[s - 1].y != m_Skyline[s].y, "Adjacent segments of the same height must be merged");
+        TotalWidth += m_Skyline[s].width;
+    }
+    VERIFY(TotalWidth == m_Width, "Skyline must cover the entire atlas width");
+#endif
+}
+
+bool DynamicAtlasManager::IsOnSkyline(const Region& R) const
+{
+    // The region is on the skyline if nothing is allocated above it,
+    // i.e. the skyline is exactly at the region top over its entire width.
+    const auto End = R.x + R.width;
+
+    // Find the segment that contains R.x
+    auto it = std::upper_bound(m_Skyline.begin(), m_Skyline.end(), R.x,
+                               [](Uint32 x, const SkylineSegment& Seg) { return x < Seg.x; });
+    VERIFY_EXPR(it != m_Skyline.begin());
+    for (--it; it != m_Skyline.end() && it->x < End; ++it)
+    {
+        if (it->y != R.y + R.height)
+            return false;
+    }
+    return true;
+}
+
+static bool FreeRegionTopLess(const DynamicAtlasManager::Region& R0, const DynamicAtlasManager::Region& R1)
+{
+    const auto Top0 = R0.y + R0.height;
+    const auto Top1 = R1.y + R1.height;
+    return Top0 < Top1 || (Top0 == Top1 && R0.x < R1.x);
+}
+
+void DynamicAtlasManager::AddSkylineFreeRegion(const Region& R)
+{
+    m_SkylineFreeRegions.insert(std::upper_bound(m_SkylineFreeRegions.begin(), m_SkylineFreeRegions.end(), R, FreeRegionTopLess), R);
+}
+
+void DynamicAtlasManager::ReclaimSkylineFreeRegions(Uint32 Level)
+{
+    // When the skyline is lowered to Level, only free regions whose top is
+    // exactly at Level may become exposed. Reclaiming such a region lowers
+    // the skyline further to its bottom, so process levels with a stack.
+    std::vector<Uint32> Levels{Level};
+    while (!Levels.empty())
+    {
+        const auto CurrLevel = Levels.back();
+        Levels.pop_back();
+
+        auto it = std::lower_bound(m_SkylineFreeRegions.begin(), m_SkylineFreeRegions.end(), CurrLevel,
+                                   [](const Region& R, Uint32 Top) { return R.y + R.height < Top; });
+        while (it != m_SkylineFreeRegions.end() && it->y + it->height == CurrLevel)
+        {
+            if (IsOnSkyline(*it))
+            {
+                const auto FreeR = *it;
+                it               = m_SkylineFreeRegions.erase(it);
+                SetSkylineLevel(FreeR.x, FreeR.width, FreeR.y);
+                Levels.push_back(FreeR.y);
+                // Lowering the skyline may expose regions at the current level that were skipped
+                // earlier, so start over from the first region at this level.
+                it = std::lower_bound(m_SkylineFreeRegions.begin(), m_SkylineFreeRegions.end(), CurrLevel,
+                                      [](const Region& R, Uint32 Top) { return R.y + R.height < Top; });
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+}
+
+DynamicAtlasManager::Region DynamicAtlasManager::AllocateSkyline(Uint32 Width, Uint32 Height)
+{
+    VERIFY_EXPR(Width > 0 && Height > 0);
+
+    Region R;
+
+    // Try to reuse the smallest freed region first
+    auto BestFreeIt = m_SkylineFreeRegions.end();
+    for (auto it = m_SkylineFreeRegions.begin(); it != m_SkylineFreeRegions.end(); ++it)
+    {
+        if (it->width >= Width && it->height >= Height &&
+            (BestFreeIt == m_SkylineFreeRegions.end() ||
+             Uint64{it->width} * Uint64{it->height} < Uint64{BestFreeIt->width} * Uint64{BestFreeIt->height}))
+        {
+            BestFreeIt = it;
+            if (it->width == Width && it->height == Height)
+                break;
+        }
+    }
+
+    if (BestFreeIt != m_SkylineFreeRegions.end())
+    {
+        const auto FreeR = *BestFreeIt;
+        m_SkylineFreeRegions.erase(BestFreeIt);
+
+        //   _____________
+        //  |             |
+        //  |      A      |
+        //  |_____ _______|
+        //  |     |       |
+        //  |  R  |   B   |
+        //  |_____|_______|
+        //
+        R = Region{FreeR.x, FreeR.y, Width, Height};
+        if (FreeR.height > Height)
+            AddSkylineFreeRegion(Region{FreeR.x, FreeR.y + Height, FreeR.width, FreeR.height - Height}); // A
+        if (FreeR.width > Width)
+            AddSkylineFreeRegion(Region{FreeR.x + Width, FreeR.y, FreeR.width - Width, Height}); // B
+    }
+    else
+    {
+        // Find the position with the lowest top, using the narrowest segment to break ties
+        Uint32 BestTop   = UINT_MAX;
+        Uint32 BestWidth = UINT_MAX;
+        for (size_t i = 0; i < m_Skyline.size() && m_Skyline[i].x + Width <= m_Width; ++i)
+        {
+            // The region rests on the highest segment it spans
+            Uint32 y = 0;
+            for (size_t j = i; j < m_Skyline.size() && m_Skyline[j].x < m_Skyline[i].x + Width; ++j)
+            {
+                y = std::max(y, m_Skyline[j].y);
+                // Stop as soon as this position can't beat the best one
+                if (y + Height > std::min(BestTop, m_Height))
+                    break;
+            }
+
+            const auto Top = y + Height;
+            if (Top > m_Height || Top > BestTop)
+                continue;
+
+            if (Top < BestTop || (Top == BestTop && m_Skyline[i].width < BestWidth))
+            {
+                BestTop   = Top;
+                BestWidth = m_Skyline[i].width;
+                R         = Region{m_Skyline[i].x, y, Width, Height};
+            }
+        }
+
+        if (R.IsEmpty())
+            return Region{};
+
+        SetSkylineLevel(R.x, R.width, R.y + R.height);
+    }
+
+#if DILIGENT_DEBUG
+    DbgVerifyRegion(R);
+#endif
+
+    VERIFY_EXPR(m_TotalFreeArea >= Uint64{R.width} * Uint64{R.height});
+    m_TotalFreeArea -= Uint64{R.width} * Uint64{R.height};
+    m_SkylineAllocatedRegions.emplace(R);
+
+    return R;
+}
+
+void DynamicAtlasManager::FreeSkyline(Region&& R)
+{
+#if DILIGENT_DEBUG
+    DbgVerifyRegion(R);
+#endif
+
+    auto region_it = m_SkylineAllocatedRegions.find(R);
+    if (region_it == m_SkylineAllocatedRegions.end())
+    {
+        UNEXPECTED("Unable to find region [", R.x, ", ", R.x + R.width, ") x [", R.y, ", ", R.y + R.height, ") among allocated regions. Have you ever allocated it?");
+        return;
+    }
+    m_SkylineAllocatedRegions.erase(region_it);
+
+    m_TotalFreeArea += Uint64{R.width} * Uint64{R.height};
+    if (m_SkylineAllocatedRegions.empty())
+    {
+        // Return all wasted space
+        ResetSkyline();
+    }
+    else if (IsOnSkyline(R))
+    {
+        SetSkylineLevel(R.x, R.width, R.y);
+        // Lowering the skyline may expose freed regions that now have nothing above them
+        ReclaimSkylineFreeRegions(R.y);
+    }
+    else
+    {
+        AddSkylineFreeRegion(R);
+    }
+
+    R = InvalidRegion;
+}
+
+
 #if DILIGENT_DEBUG
 
 void DynamicAtlasManager::DbgVerifyRegion(const Region& R) const
@@ -49,6 +49,7 @@
 #include "BasicMath.hpp"
 #include "PlatformMisc.hpp"
 #include "Align.hpp"
+#include "ShaderResourceCacheCommon.hpp"
 
 namespace Diligent
 {
@@ -381,6 +382,9 @@ protected:
         // buffers with dynamic offsets in all backends).
         SRBMaskType DynamicSRBMask = 0;
 
+        // Tracks committed resource caches to eliminate redundant commits
+        ShaderResourceCommitTracker<MAX_RESOURCE_SIGNATURES> CommitTracker;
+
         void Set(Uint32 Index, ShaderResourceBindingImplType* pSRB)
         {
             VERIFY_EXPR(Index < MAX_RESOURCE_SIGNATURES);
@@ -398,11 +402,13 @@ protected:
             else
                 DynamicSRBMask &= ~SRBBit;
 
+            CommitTracker.Commit(Index, pResourceCache, pSRB != nullptr ? pSRB->GetSignature() : nullptr);
+
 #ifdef DILIGENT_DEVELOPMENT
             SRBs[Index] = pSRB;
             if (pSRB != nullptr)
                 ResourcesValidated = false;
-            CacheRevisions[Index] = pResourceCache != nullptr ? pResourceCache->DvpGetRevision() : 0;
+            CacheRevisions[Index] = pResourceCache != nullptr ? pResourceCache->GetRevision() : 0;
 #endif
         }
 
@@ -439,7 +445,7 @@ protected:
                 const auto* pCache = ResourceCaches[Idx];
                 if (pCache != nullptr)
                 {
-                    DEV_CHECK_ERR(CacheRevisions[Idx] == pCache->DvpGetRevision(),
+                    DEV_CHECK_ERR(CacheRevisions[Idx] == pCache->GetRevision(),
                                   "Revision of the shader resource cache at index ", Idx,
                                   " does not match the revision recorded when the SRB was committed. "
                                   "This indicates that resources have been changed since that time, but "
@@ -497,6 +503,13 @@ protected:
 
     void PrepareCommittedResources(CommittedShaderResources& Resources, Uint32& DvpCompatibleSRBCount);
 
+    /// Checks if the SRB has already been committed to its slot in Resources during the current frame
+    /// and its resources have not changed since then. If this is the case, the commit is redundant:
+    /// the method updates the statistics and returns true, and the backend may skip the commit.
+    /// Dynamic buffer offsets are not part of the resource cache revision and are read when the SRB
+    /// is bound, so the slot of an SRB with dynamic resources is still marked stale.
+    inline bool IsRedundantSRBCommit(CommittedShaderResources& Resources, ShaderResourceBindingImplType* pSRB);
+
     bool IsRecordingDeferredCommands() const
     {
         DEV_CHECK_ERR(IsDeferred(), "Only deferred contexts may record deferred commands.");
@@ -2126,6 +2139,25 @@ void DeviceContextBase<ImplementationTraits>::BindSparseResourceMemory(const Bin
     ++m_Stats.CommandCounters.BindSparseResourceMemory;
 }
 
+template <typename ImplementationTraits>
+inline bool DeviceContextBase<ImplementationTraits>::IsRedundantSRBCommit(CommittedShaderResources& Resources, ShaderResourceBindingImplType* pSRB)
+{
+    VERIFY_EXPR(pSRB != nullptr);
+
+    Resources.CommitTracker.SetFrameNumber(m_FrameNumber);
+
+    const Uint32 SRBIndex      = pSRB->GetBindingIndex();
+    const auto&  ResourceCache = pSRB->GetResourceCache();
+    if (Resources.ResourceCaches[SRBIndex] != &ResourceCache || !Resources.CommitTracker.IsCommitted(SRBIndex, ResourceCache))
+        return false;
+
+    if (ResourceCache.HasDynamicResources())
+        Resources.StaleSRBMask |= static_cast<typename CommittedShaderResources::SRBMaskType>(1u << SRBIndex);
+
+    ++m_Stats.SkippedCommitShaderResources;
+    return true;
+}
+
 template <typename ImplementationTraits>
 inline void DeviceContextBase<ImplementationTraits>::PrepareCommittedResources(CommittedShaderResources& Resources, Uint32& DvpCompatibleSRBCount)
 {
@@ -2141,6 +2173,11 @@ inline void DeviceContextBase<ImplementationTraits>::PrepareCommittedResources(C
         Resources.ActiveSRBMask |= 1u << i;
     }
 
+    // SRBs committed for a different signature can't be reused without committing them again
+    Resources.CommitTracker.OnPipelineChanged(SignCount, [this](Uint32 i) -> const void* {
+        return m_pPipelineState->GetResourceSignature(i);
+    });
+
     DvpCompatibleSRBCount = 0;
 
 #ifdef DILIGENT_DEVELOPMENT
@@ -0,0 +1,166 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::PipelineResourceNameIndex class
+
+#include <vector>
+#include <cstring>
+
+#include "GraphicsTypes.h"
+#include "PipelineResourceSignature.h"
+#include "HashUtils.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+/// Name index of the pipeline resource signature resources.
+
+/// The index is an open-addressing hash table that maps resource names to indices in the
+/// PipelineResourceDesc array. It is built once when the signature is created and is shared
+/// by all shader resource bindings, so that resource lookups by name do not scan all resources
+/// and never allocate memory.
+/// The index references resource names and does not copy them, so the resource array must
+/// outlive the index.
+class PipelineResourceNameIndex
+{
+public:
+    static constexpr Uint32 InvalidIndex = ~0u;
+
+    PipelineResourceNameIndex() noexcept {}
+
+    // clang-format off
+    PipelineResourceNameIndex           (const PipelineResourceNameIndex&)  = delete;
+    PipelineResourceNameIndex& operator=(const PipelineResourceNameIndex&)  = delete;
+    PipelineResourceNameIndex           (PipelineResourceNameIndex&&)       = default;
+    PipelineResourceNameIndex& operator=(PipelineResourceNameIndex&&)       = default;
+    // clang-format on
+
+    void Initialize(const PipelineResourceDesc* Resources, Uint32 NumResources) noexcept(false)
+    {
+        m_Entries.clear();
+        m_Mask  = 0;
+        m_Shift = 32;
+        if (NumResources == 0)
+            return;
+
+        // Keep the load factor at or below 0.5 so that probe chains stay short
+        // and every chain is terminated by an empty slot.
+        Uint32 Log2TableSize = 2;
+        while ((size_t{1} << Log2TableSize) < size_t{NumResources} * 2)
+            ++Log2TableSize;
+
+        const size_t TableSize = size_t{1} << Log2TableSize;
+        m_Entries.resize(TableSize);
+        m_Mask  = TableSize - 1;
+        m_Shift = 32 - Log2TableSize;
+
+        // Resources are inserted in ascending order. With linear probing and no deletions,
+        // resources with the same name are thus found in the order of their indices.
+        for (Uint32 r = 0; r < NumResources; ++r)
+        {
+            const char* Name = Resources[r].Name;
+            VERIFY_EXPR(Name != nullptr);
+
+            const Uint32 Hash = ComputeNameHash(Name);
+            size_t       Slot = GetHomeSlot(Hash);
+            while (m_Entries[Slot].ResIndex != InvalidIndex)
+                Slot = (Slot + 1) & m_Mask;
+
+            Entry& NewEntry   = m_Entries[Slot];
+            NewEntry.Name     = Name;
+            NewEntry.Hash     = Hash;
+            NewEntry.ResIndex = r;
+        }
+    }
+
+    /// Calls Handler(ResIndex) for every resource with the given name in ascending index order
+    /// until the handler returns true.
+
+    /// \return     true if the handler returned true, and false otherwise.
+    template <typename HandlerType>
+    bool Find(const char* Name, HandlerType&& Handler) const
+    {
+        if (m_Entries.empty() || Name == nullptr)
+            return false;
+
+        const Uint32 Hash = ComputeNameHash(Name);
+        for (size_t Slot = GetHomeSlot(Hash);; Slot = (Slot + 1) & m_Mask)
+        {
+            const Entry& E = m_Entries[Slot];
+            if (E.ResIndex == InvalidIndex)
+                return false;
+
+            if (E.Hash == Hash && strcmp(E.Name, Name) == 0 && Handler(E.ResIndex))
+                return true;
+        }
+    }
+
+    /// Finds a resource with the given name in the specified shader stage and returns its
+    /// index, or InvalidIndex if the resource is not found.
+    Uint32 FindResource(const PipelineResourceDesc* Resources, SHADER_TYPE ShaderStage, const char* Name) const
+    {
+        Uint32 ResIndex = InvalidIndex;
+        Find(Name, [&](Uint32 Idx) {
+            if ((Resources[Idx].ShaderStages & ShaderStage) == 0)
+                return false;
+            ResIndex = Idx;
+            return true;
+        });
+        return ResIndex;
+    }
+
+    bool IsEmpty() const { return m_Entries.empty(); }
+
+private:
+    static Uint32 ComputeNameHash(const char* Name)
+    {
+        return static_cast<Uint32>(CStringHash<char>{}(Name));
+    }
+
+    size_t GetHomeSlot(Uint32 Hash) const
+    {
+        // Fibonacci hashing: take the high bits of the product so that names that
+        // only differ in the last characters do not end up in adjacent slots.
+        return static_cast<size_t>((Hash * 2654435769u) >> m_Shift);
+    }
+
+    struct Entry
+    {
+        const char* Name     = nullptr;
+        Uint32      Hash     = 0;
+        Uint32      ResIndex = InvalidIndex;
+    };
+    std::vector<Entry> m_Entries;
+
+    size_t m_Mask  = 0;
+    Uint32 m_Shift = 32;
+};
+
+} // namespace Diligent
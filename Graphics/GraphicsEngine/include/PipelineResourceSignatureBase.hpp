@@ -47,6 +47,7 @@
 #include "StringTools.hpp"
 #include "PlatformMisc.hpp"
 #include "SRBMemoryAllocator.hpp"
+#include "PipelineResourceNameIndex.hpp"
 #include "ShaderResourceCacheCommon.hpp"
 #include "HashUtils.hpp"
 
@@ -672,7 +673,17 @@ public:
     /// index in m_Desc.Resources[], or InvalidPipelineResourceIndex if the resource is not found.
     Uint32 FindResource(SHADER_TYPE ShaderStage, const char* ResourceName) const
     {
-        return Diligent::FindResource(this->m_Desc.Resources, this->m_Desc.NumResources, ShaderStage, ResourceName);
+        static_assert(PipelineResourceNameIndex::InvalidIndex == InvalidPipelineResourceIndex, "Invalid resource index values do not match");
+        VERIFY_EXPR(ResourceName != nullptr && ResourceName[0] != '\0');
+        return m_ResourceNameIndex.FindResource(this->m_Desc.Resources, ShaderStage, ResourceName);
+    }
+
+    /// Calls Handler(ResIndex) for every resource with the given name in ascending index order
+    /// until the handler returns true. Returns true if the handler returned true, and false otherwise.
+    template <typename HandlerType>
+    bool FindResourcesByName(const char* ResourceName, HandlerType&& Handler) const
+    {
+        return m_ResourceNameIndex.Find(ResourceName, std::forward<HandlerType>(Handler));
     }
 
     /// Finds an immutable with the given name in the specified shader stage and returns its
@@ -817,6 +828,7 @@ protected:
         m_pRawMemory = decltype(m_pRawMemory){Allocator.ReleaseOwnership(), STDDeleterRawMem<void>{RawAllocator}};
 
         CopyPipelineResourceSignatureDesc(Allocator, Desc, this->m_Desc, m_ResourceOffsets);
+        m_ResourceNameIndex.Initialize(this->m_Desc.Resources, this->m_Desc.NumResources);
 
 #ifdef DILIGENT_DEBUG
         VERIFY_EXPR(m_ResourceOffsets[SHADER_RESOURCE_VARIABLE_TYPE_NUM_TYPES] == this->m_Desc.NumResources);
@@ -1077,6 +1089,9 @@ protected:
     // Resource offsets (e.g. index of the first resource), for each variable type.
     std::array<Uint16, SHADER_RESOURCE_VARIABLE_TYPE_NUM_TYPES + 1> m_ResourceOffsets = {};
 
+    // Resource name -> index in m_Desc.Resources, shared by all SRBs
+    PipelineResourceNameIndex m_ResourceNameIndex;
+
     // Shader stages that have resources.
     SHADER_TYPE m_ShaderStages = SHADER_TYPE_UNKNOWN;
 
@@ -30,9 +30,12 @@
 /// \file
 /// Definition of the common share resource cache constants
 
+#include <array>
 #include <atomic>
 
 #include "BasicTypes.h"
+#include "UniqueIdentifier.hpp"
+#include "DebugUtilities.hpp"
 
 namespace Diligent
 {
@@ -50,24 +53,113 @@ enum class ResourceCacheContentType : Uint8
 class ShaderResourceCacheBase
 {
 public:
-#ifdef DILIGENT_DEVELOPMENT
-    uint32_t DvpGetRevision() const
+    /// Returns the identifier that is unique for every cache object.
+    UniqueIdentifier GetUniqueID() const
     {
-        return m_DvpRevision.load();
+        return m_UniqueID.GetID();
+    }
+
+    /// Returns the revision of the cache contents. The revision is incremented
+    /// every time a resource in the cache changes.
+    Uint32 GetRevision() const
+    {
+        return m_Revision.load(std::memory_order_relaxed);
     }
-#endif
 
 protected:
     void UpdateRevision()
     {
-#ifdef DILIGENT_DEVELOPMENT
-        m_DvpRevision.fetch_add(1);
-#endif
+        m_Revision.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::atomic<Uint32> m_Revision{0};
+
+    UniqueIdHelper<ShaderResourceCacheBase> m_UniqueID;
+};
+
+
+/// Keeps track of the shader resource caches committed to every resource signature slot
+/// of the device context and detects redundant commits, i.e. commits of the same cache
+/// whose contents have not changed since the last time it was committed.
+///
+/// \remarks    A cache is identified by its unique ID rather than by its address,
+///             so that a new cache allocated at the same address is never mistaken for
+///             the old one.
+template <Uint32 NumSlots>
+class ShaderResourceCommitTracker
+{
+public:
+    /// Returns true if Cache is committed to the given slot and has not been modified since then.
+    bool IsCommitted(Uint32 Slot, const ShaderResourceCacheBase& Cache) const
+    {
+        VERIFY_EXPR(Slot < NumSlots);
+        const SlotInfo& Info = m_Slots[Slot];
+        return Info.CacheID != 0 && Info.CacheID == Cache.GetUniqueID() && Info.Revision == Cache.GetRevision();
+    }
+
+    /// Records the cache committed to the given slot. pSignature is the resource signature
+    /// of the SRB that owns the cache. If pCache is null, the slot is reset.
+    void Commit(Uint32 Slot, const ShaderResourceCacheBase* pCache, const void* pSignature)
+    {
+        VERIFY_EXPR(Slot < NumSlots);
+        SlotInfo& Info = m_Slots[Slot];
+        if (pCache != nullptr)
+        {
+            Info.CacheID    = pCache->GetUniqueID();
+            Info.Revision   = pCache->GetRevision();
+            Info.pSignature = pSignature;
+        }
+        else
+        {
+            Info = {};
+        }
     }
 
-#ifdef DILIGENT_DEVELOPMENT
-    std::atomic<uint32_t> m_DvpRevision{0};
-#endif
+    /// Resets all slots starting with FirstSlot.
+    void Reset(Uint32 FirstSlot = 0)
+    {
+        for (Uint32 Slot = FirstSlot; Slot < NumSlots; ++Slot)
+            m_Slots[Slot] = {};
+    }
+
+    /// Called when a new pipeline is bound. Resets all slots starting with the first
+    /// one whose committed signature does not match the signature of the pipeline.
+    template <typename GetSignatureType>
+    void OnPipelineChanged(Uint32 SignatureCount, GetSignatureType&& GetSignature)
+    {
+        VERIFY_EXPR(SignatureCount <= NumSlots);
+        for (Uint32 Slot = 0; Slot < SignatureCount; ++Slot)
+        {
+            if (m_Slots[Slot].pSignature != GetSignature(Slot))
+            {
+                Reset(Slot);
+                return;
+            }
+        }
+    }
+
+    /// Resets all slots if the frame number has changed since the last call.
+    /// Resources committed in one frame may reference objects (e.g. dynamic
+    /// descriptor sets) that are only valid within that frame.
+    void SetFrameNumber(Uint64 FrameNumber)
+    {
+        if (FrameNumber != m_FrameNumber)
+        {
+            Reset();
+            m_FrameNumber = FrameNumber;
+        }
+    }
+
+private:
+    struct SlotInfo
+    {
+        UniqueIdentifier CacheID    = 0;
+        Uint32           Revision   = 0;
+        const void*      pSignature = nullptr;
+    };
+    std::array<SlotInfo, NumSlots> m_Slots = {};
+
+    Uint64 m_FrameNumber = 0;
 };
 
 } // namespace Diligent
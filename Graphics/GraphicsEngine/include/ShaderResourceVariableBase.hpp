@@ -31,6 +31,7 @@
 /// Implementation of the Diligent::ShaderBase template class
 
 #include <vector>
+#include <algorithm>
 
 #include "ShaderResourceVariable.h"
 #include "PipelineState.h"
@@ -804,6 +805,8 @@ struct ShaderVariableBase : public ResourceVariableBaseInterface
 
     const PipelineResourceDesc& GetDesc() const { return m_ParentManager.GetResourceDesc(m_ResIndex); }
 
+    Uint32 GetResourceIndex() const { return m_ResIndex; }
+
 protected:
     // Variable manager that owns this variable
     VarManagerType& m_ParentManager;
@@ -812,6 +815,21 @@ protected:
     const Uint32 m_ResIndex;
 };
 
+/// Finds the variable that corresponds to the resource with index ResIndex in the
+/// signature. Variables must be sorted by the resource index.
+/// Returns null if there is no such variable.
+template <typename VariableType>
+VariableType* FindVariableByResourceIndex(VariableType* Variables, Uint32 NumVariables, Uint32 ResIndex)
+{
+    VariableType* const pEnd = Variables + NumVariables;
+
+    VariableType* pVar = std::lower_bound(Variables, pEnd, ResIndex,
+                                          [](const VariableType& Var, Uint32 Idx) {
+                                              return Var.GetResourceIndex() < Idx;
+                                          });
+    return (pVar != pEnd && pVar->GetResourceIndex() == ResIndex) ? pVar : nullptr;
+}
+
 template <class EngineImplTraits, typename VariableType>
 class ShaderVariableManagerBase
 {
@@ -890,8 +908,30 @@ protected:
         }
     }
 
-
 protected:
+    // Finds the variable with the given name using the resource name index of the signature,
+    // which is shared by all managers created from it. Variables are created in the order of
+    // resource indices, so every candidate resource is found with a binary search.
+    VariableType* FindVariableByName(const Char* Name) const
+    {
+        if (m_pSignature == nullptr)
+            return nullptr;
+
+        const Uint32 NumVariables = static_cast<const ThisImplType*>(this)->m_NumVariables;
+        VERIFY(std::is_sorted(m_pVariables, m_pVariables + NumVariables,
+                              [](const VariableType& Var0, const VariableType& Var1) {
+                                  return Var0.GetResourceIndex() < Var1.GetResourceIndex();
+                              }),
+               "Variables must be sorted by the resource index");
+
+        VariableType* pVar = nullptr;
+        m_pSignature->FindResourcesByName(Name, [&](Uint32 ResIndex) {
+            pVar = FindVariableByResourceIndex(m_pVariables, NumVariables, ResIndex);
+            return pVar != nullptr;
+        });
+        return pVar;
+    }
+
     IObject& m_Owner;
 
     // Variable manager is owned by either Pipeline Resource Signature (in which case m_ResourceCache references
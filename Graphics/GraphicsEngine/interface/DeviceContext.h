@@ -2345,6 +2345,26 @@ struct DeviceContextCommandCounters
 };
 typedef struct DeviceContextCommandCounters DeviceContextCommandCounters;
 
+/// Pipeline barrier statistics.
+struct DeviceContextBarrierStats
+{
+    /// The number of pipeline barrier commands recorded by the context.
+    /// Resource state transitions are accumulated and recorded by a single
+    /// command before the next draw, dispatch or copy command.
+    Uint32 PipelineBarriers DEFAULT_INITIALIZER(0);
+
+    /// The total number of texture barriers in all pipeline barrier commands.
+    Uint32 TextureBarriers DEFAULT_INITIALIZER(0);
+
+    /// The total number of global memory barriers in all pipeline barrier commands.
+    Uint32 MemoryBarriers DEFAULT_INITIALIZER(0);
+
+    /// The number of texture transitions that were merged with pending transitions
+    /// of adjacent subresources or folded into a pending transition of the same subresources.
+    Uint32 MergedTextureBarriers DEFAULT_INITIALIZER(0);
+};
+typedef struct DeviceContextBarrierStats DeviceContextBarrierStats;
+
 /// Device context statistics.
 struct DeviceContextStats
 {
@@ -2354,6 +2374,14 @@ struct DeviceContextStats
     /// Command counters, see Diligent::DeviceContextCommandCounters.
     DeviceContextCommandCounters CommandCounters DEFAULT_INITIALIZER({});
 
+    /// The number of CommitShaderResources calls that were skipped because the same
+    /// shader resource binding with unchanged resources had already been committed.
+    Uint32 SkippedCommitShaderResources DEFAULT_INITIALIZER(0);
+
+    /// Pipeline barrier statistics, see Diligent::DeviceContextBarrierStats.
+    /// Currently only reported by the Vulkan backend.
+    DeviceContextBarrierStats Barriers DEFAULT_INITIALIZER({});
+
 #if DILIGENT_CPP_INTERFACE
     constexpr Uint32 GetTotalTriangleCount() const noexcept
     {
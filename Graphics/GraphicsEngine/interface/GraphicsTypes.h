@@ -1587,6 +1587,7 @@ enum RENDER_DEVICE_TYPE
     RENDER_DEVICE_TYPE_VULKAN,         ///< Vulkan device
     RENDER_DEVICE_TYPE_METAL,          ///< Metal device
     RENDER_DEVICE_TYPE_WEBGPU,         ///< WebGPU device
+    RENDER_DEVICE_TYPE_NULL,           ///< Null device that executes no GPU work
     RENDER_DEVICE_TYPE_COUNT           ///< The total number of device types
 };
 
@@ -2506,6 +2507,10 @@ struct RenderDeviceInfo
     {
         return Type == RENDER_DEVICE_TYPE_WEBGPU;
     }
+    constexpr bool IsNullDevice() const
+    {
+        return Type == RENDER_DEVICE_TYPE_NULL;
+    }
 
     // for backward compatibility
     const NDCAttribs& GetNDCAttribs()const
@@ -3380,6 +3385,33 @@ struct ImmediateContextCreateInfo
 typedef struct ImmediateContextCreateInfo ImmediateContextCreateInfo;
 
 
+/// Statistics of the release queue of a command queue.
+
+/// Released resources are kept in the queue until the GPU has finished using them,
+/// see EngineCreateInfo::MaxResourcesReleasedPerPurge.
+struct ReleaseQueueStats
+{
+    /// The number of released resources waiting for the command list to be submitted.
+    Uint64 StaleResourceCount          DEFAULT_INITIALIZER(0);
+
+    /// The number of released resources waiting for the GPU to finish using them.
+    Uint64 PendingReleaseResourceCount DEFAULT_INITIALIZER(0);
+
+    /// The total number of resources destroyed by the queue.
+    Uint64 ReleasedResourceCount       DEFAULT_INITIALIZER(0);
+
+    /// The number of resources destroyed by the last purge of the queue.
+    Uint64 LastPurgeReleasedCount      DEFAULT_INITIALIZER(0);
+
+    /// The time, in nanoseconds, spent by the last purge of the queue.
+    Uint64 LastPurgeTimeNs             DEFAULT_INITIALIZER(0);
+
+    /// The total time, in nanoseconds, spent by all purges of the queue.
+    Uint64 TotalPurgeTimeNs            DEFAULT_INITIALIZER(0);
+};
+typedef struct ReleaseQueueStats ReleaseQueueStats;
+
+
 /// Engine creation information
 struct EngineCreateInfo
 {
@@ -3473,6 +3505,19 @@ struct EngineCreateInfo
     ///             function.
     Uint32 NumAsyncShaderCompilationThreads DEFAULT_INITIALIZER(0xFFFFFFFFu);
 
+    /// The maximum number of released resources that are destroyed by one purge of a release queue.
+
+    /// \remarks   Direct3D12 and Vulkan backends keep released resources in the release queue of every
+    ///             command queue until the GPU has finished using them. The queue is purged when a command
+    ///             list is submitted and when IRenderDevice::ReleaseStaleResources() is called.
+    ///             Destroying many resources at once (e.g. when a level is unloaded) may cause a frame
+    ///             time spike. When this value is not zero, every purge destroys at most this many
+    ///             resources, and the rest are destroyed by subsequent purges.
+    ///
+    ///             IRenderDevice::ReleaseStaleResources(true) and device destruction always destroy
+    ///             all resources. Other backends ignore this value.
+    Uint32 MaxResourcesReleasedPerPurge DEFAULT_INITIALIZER(0);
+
 #if DILIGENT_CPP_INTERFACE
     EngineCreateInfo() noexcept
     {
@@ -4032,6 +4077,38 @@ struct EngineVkCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     ///               DynamicHeapPageSize.
     Uint32 DynamicHeapPageSize              DEFAULT_INITIALIZER(256 << 10);
 
+    /// Size of the staging buffer that is used to batch initial data uploads
+    /// of buffers and textures.
+    ///
+    /// \remarks    By default, every buffer or texture created with initial data
+    ///             uses its own staging memory and is uploaded by a separate
+    ///             command buffer submission. When this value is not zero, the copy commands
+    ///             are recorded into a command buffer shared by all resources created for
+    ///             the same queue, and are submitted together before the next command buffer
+    ///             is submitted to any queue, or when the batch staging buffer is full.
+    ///             Resources whose initial data is larger than the batch size are
+    ///             uploaded individually.
+    Uint32 InitialDataUploadBatchSize       DEFAULT_INITIALIZER(0);
+
+    /// Whether to bind shader resources through descriptor buffers (VK_EXT_descriptor_buffer).
+    ///
+    /// \remarks    When enabled, descriptors of the committed shader resource bindings are written
+    ///             directly into the dynamic heap when a draw or dispatch command is issued, and no
+    ///             descriptor sets are allocated from descriptor pools.
+    ///             The engine transparently falls back to descriptor pools if the device does not
+    ///             support descriptor buffers or buffer device address, or if the dynamic heap
+    ///             (see DynamicHeapSize) exceeds the maximum descriptor buffer range.
+    Bool EnableDescriptorBuffers            DEFAULT_INITIALIZER(False);
+
+    /// The maximum number of GPU profiler scopes measured in one frame of each immediate context.
+    ///
+    /// \remarks    When not zero, every debug group begun in an immediate context is measured with
+    ///             a pair of timestamp queries, and the per-frame timings are returned by
+    ///             IDeviceContextVk::GetProfilerFrame(). Scopes beyond this limit are not measured.
+    ///             The timestamp query pool of every queue is enlarged to accommodate the profiler queries.
+    ///             The profiler is not available in queues that do not support timestamp queries.
+    Uint32 GPUProfilerMaxScopesPerFrame     DEFAULT_INITIALIZER(0);
+
     /// Query pool size for each query type.
     ///
     /// \remarks    In Vulkan, queries are allocated from the pool, and
@@ -4057,6 +4134,18 @@ struct EngineVkCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// features when compiling shaders from HLSL.
     const Char* pDxCompilerPath DEFAULT_INITIALIZER(nullptr);
 
+    /// Directory where the engine keeps the device pipeline cache.
+    ///
+    /// \remarks    When not null, the engine creates a Vulkan pipeline cache that is used by all
+    ///             pipeline states created without an explicit pipeline state cache object
+    ///             (see PipelineStateCreateInfo::pPSOCache). The cache is loaded from a file in this
+    ///             directory whose name is derived from the vendor ID, device ID, driver version and
+    ///             pipeline cache UUID of the device, so that caches of different devices and drivers
+    ///             never mix. The cache is written back when the device is destroyed, or when
+    ///             IRenderDeviceVk::SavePipelineCache() is called.
+    ///             The directory must exist and be writable.
+    const Char* PipelineCacheDirectory DEFAULT_INITIALIZER(nullptr);
+
 #if DILIGENT_CPP_INTERFACE
     EngineVkCreateInfo() noexcept :
         EngineVkCreateInfo{EngineCreateInfo{}}
@@ -39,7 +39,7 @@ namespace Diligent
 
 DeviceObjectArchive::DeviceType RenderDeviceTypeToArchiveDeviceType(RENDER_DEVICE_TYPE Type)
 {
-    static_assert(RENDER_DEVICE_TYPE_COUNT == 8, "Did you add a new render device type? Please handle it here.");
+    static_assert(RENDER_DEVICE_TYPE_COUNT == 9, "Did you add a new render device type? Please handle it here.");
     switch (Type)
     {
             // clang-format off
@@ -56,6 +56,10 @@ DeviceObjectArchive::DeviceType RenderDeviceTypeToArchiveDeviceType(RENDER_DEVIC
         case RENDER_DEVICE_TYPE_WEBGPU:
             return DeviceObjectArchive::DeviceType::WebGPU;
 
+        case RENDER_DEVICE_TYPE_NULL:
+            // Null backend does not compile shaders, so archives contain no device-specific data for it
+            return DeviceObjectArchive::DeviceType::Count;
+
         // clang-format on
         default:
             UNEXPECTED("Unexpected device type");
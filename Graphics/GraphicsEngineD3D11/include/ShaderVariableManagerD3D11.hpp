@@ -254,8 +254,10 @@ private:
         return reinterpret_cast<const ResourceType*>(reinterpret_cast<const Uint8*>(m_pVariables) + Offset)[ResIndex];
     }
 
+    // Finds the variable of the given type that corresponds to the resource with
+    // index ResIndex in the signature.
     template <typename ResourceType>
-    IShaderResourceVariable* GetResourceByName(const Char* Name) const;
+    IShaderResourceVariable* GetResourceBySignatureIndex(Uint32 ResIndex) const;
 
     template <typename THandleCB,
               typename THandleTexSRV,
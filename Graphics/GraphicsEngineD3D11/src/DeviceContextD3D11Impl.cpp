@@ -224,7 +224,8 @@ void DeviceContextD3D11Impl::CommitShaderResources(IShaderResourceBinding* pShad
     const auto  SRBIndex               = pShaderResBindingD3D11->GetBindingIndex();
     auto&       ResourceCache          = pShaderResBindingD3D11->GetResourceCache();
 
-    m_BindInfo.Set(SRBIndex, pShaderResBindingD3D11);
+    if (!IsRedundantSRBCommit(m_BindInfo, pShaderResBindingD3D11))
+        m_BindInfo.Set(SRBIndex, pShaderResBindingD3D11);
 
     if (StateTransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
     {
@@ -1394,6 +1395,7 @@ void DeviceContextD3D11Impl::UnbindResourceView(TD3D11ResourceViewType Committed
                                                 ID3D11Resource*        pd3d11ResToUndind,
                                                 TSetD3D11View          SetD3D11ViewMethods[])
 {
+    bool ViewUnbound = false;
     for (Int32 ShaderTypeInd = 0; ShaderTypeInd < NumShaderTypes; ++ShaderTypeInd)
     {
         auto* CommittedD3D11Views     = CommittedD3D11ViewsArr[ShaderTypeInd];
@@ -1406,6 +1408,7 @@ void DeviceContextD3D11Impl::UnbindResourceView(TD3D11ResourceViewType Committed
             {
                 CommittedD3D11Resources[Slot] = nullptr;
                 CommittedD3D11Views[Slot]     = nullptr;
+                ViewUnbound                   = true;
 
                 auto SetViewMethod = SetD3D11ViewMethods[ShaderTypeInd];
                 VERIFY(SetViewMethod != nullptr, "No appropriate ID3D11DeviceContext method");
@@ -1425,6 +1428,13 @@ void DeviceContextD3D11Impl::UnbindResourceView(TD3D11ResourceViewType Committed
             --NumCommittedSlots;
         }
     }
+
+    if (ViewUnbound)
+    {
+        // The view may belong to one of the committed SRBs. Committing that SRB again
+        // must rebind the view, so it can't be treated as a redundant commit.
+        m_BindInfo.CommitTracker.Reset();
+    }
 }
 
 void DeviceContextD3D11Impl::UnbindTextureFromInput(TextureBaseD3D11& Texture, ID3D11Resource* pd3d11Resource)
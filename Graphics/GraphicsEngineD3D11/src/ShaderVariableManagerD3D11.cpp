@@ -525,44 +525,47 @@ void ShaderVariableManagerD3D11::BindResources(IResourceMapping* pResourceMappin
 }
 
 template <typename ResourceType>
-IShaderResourceVariable* ShaderVariableManagerD3D11::GetResourceByName(const Char* Name) const
+IShaderResourceVariable* ShaderVariableManagerD3D11::GetResourceBySignatureIndex(Uint32 ResIndex) const
 {
-    auto NumResources = GetNumResources<ResourceType>();
-    for (Uint32 res = 0; res < NumResources; ++res)
-    {
-        auto& Resource = GetResource<ResourceType>(res);
-        if (strcmp(Resource.GetDesc().Name, Name) == 0)
-            return &Resource;
-    }
+    const auto NumResources = GetNumResources<ResourceType>();
+    if (NumResources == 0)
+        return nullptr;
 
-    return nullptr;
+    // Resources of every type are sorted by the signature resource index
+    return FindVariableByResourceIndex(&GetResource<ResourceType>(0), NumResources, ResIndex);
 }
 
 IShaderResourceVariable* ShaderVariableManagerD3D11::GetVariable(const Char* Name) const
 {
-    if (auto* pCB = GetResourceByName<ConstBuffBindInfo>(Name))
-        return pCB;
-
-    if (auto* pTexSRV = GetResourceByName<TexSRVBindInfo>(Name))
-        return pTexSRV;
-
-    if (auto* pTexUAV = GetResourceByName<TexUAVBindInfo>(Name))
-        return pTexUAV;
-
-    if (auto* pBuffSRV = GetResourceByName<BuffSRVBindInfo>(Name))
-        return pBuffSRV;
+    if (m_pSignature == nullptr)
+        return nullptr;
 
-    if (auto* pBuffUAV = GetResourceByName<BuffUAVBindInfo>(Name))
-        return pBuffUAV;
-
-    if (!m_pSignature->IsUsingCombinedSamplers())
-    {
-        // Immutable samplers are never initialized as variables
-        if (auto* pSampler = GetResourceByName<SamplerBindInfo>(Name))
-            return pSampler;
-    }
+    IShaderResourceVariable* pVar = nullptr;
+    m_pSignature->FindResourcesByName(
+        Name,
+        [&](Uint32 ResIndex) //
+        {
+            const auto& ResDesc = m_pSignature->GetResourceDesc(ResIndex);
+            static_assert(SHADER_RESOURCE_TYPE_LAST == 8, "Please update the switch below to handle the new shader resource range");
+            switch (ResDesc.ResourceType)
+            {
+                // clang-format off
+                case SHADER_RESOURCE_TYPE_CONSTANT_BUFFER:  pVar = GetResourceBySignatureIndex<ConstBuffBindInfo>(ResIndex); break;
+                case SHADER_RESOURCE_TYPE_TEXTURE_SRV:      pVar = GetResourceBySignatureIndex<TexSRVBindInfo>   (ResIndex); break;
+                case SHADER_RESOURCE_TYPE_BUFFER_SRV:       pVar = GetResourceBySignatureIndex<BuffSRVBindInfo>  (ResIndex); break;
+                case SHADER_RESOURCE_TYPE_TEXTURE_UAV:      pVar = GetResourceBySignatureIndex<TexUAVBindInfo>   (ResIndex); break;
+                case SHADER_RESOURCE_TYPE_BUFFER_UAV:       pVar = GetResourceBySignatureIndex<BuffUAVBindInfo>  (ResIndex); break;
+                case SHADER_RESOURCE_TYPE_INPUT_ATTACHMENT: pVar = GetResourceBySignatureIndex<TexSRVBindInfo>   (ResIndex); break;
+                // Samplers combined with textures and immutable samplers are never initialized as variables
+                case SHADER_RESOURCE_TYPE_SAMPLER:          pVar = GetResourceBySignatureIndex<SamplerBindInfo>  (ResIndex); break;
+                // clang-format on
+                default:
+                    UNEXPECTED("Unsupported resource type.");
+            }
+            return pVar != nullptr;
+        });
 
-    return nullptr;
+    return pVar;
 }
 
 class ShaderVariableIndexLocator
@@ -200,6 +200,13 @@ public:
                                                               RESOURCE_STATE        InitialState,
                                                               ITopLevelAS**         ppTLAS) override final;
 
+    /// Implementation of IRenderDeviceD3D12::GetReleaseQueueStats().
+    virtual ReleaseQueueStats DILIGENT_CALL_TYPE GetReleaseQueueStats(Uint32 QueueIndex) const override final
+    {
+        DEV_CHECK_ERR(QueueIndex < GetCommandQueueCount(), "Command queue index (", QueueIndex, ") is out of range");
+        return QueueIndex < GetCommandQueueCount() ? QueryReleaseQueueStats(SoftwareQueueIndex{QueueIndex}) : ReleaseQueueStats{};
+    }
+
     void CreateRootSignature(const RefCntAutoPtr<class PipelineResourceSignatureD3D12Impl>* ppSignatures, Uint32 SignatureCount, size_t Hash, RootSignatureD3D12** ppRootSig);
 
     RootSignatureCacheD3D12& GetRootSignatureCache() { return m_RootSignatureCache; }
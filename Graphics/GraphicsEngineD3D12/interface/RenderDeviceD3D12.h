@@ -117,6 +117,15 @@ DILIGENT_BEGIN_INTERFACE(IRenderDeviceD3D12, IRenderDevice)
                                                    const TopLevelASDesc REF Desc,
                                                    RESOURCE_STATE           InitialState,
                                                    ITopLevelAS**            ppTLAS) PURE;
+
+    /// Returns the statistics of the release queue of the given command queue.
+
+    /// \param [in]  QueueIndex - Index of the command queue, which is the same as the
+    ///                           ContextId of the immediate context that uses the queue.
+    ///
+    /// \remarks  The statistics can be used to tune EngineCreateInfo::MaxResourcesReleasedPerPurge.
+    VIRTUAL ReleaseQueueStats METHOD(GetReleaseQueueStats)(THIS_
+                                                           Uint32 QueueIndex) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -131,6 +140,7 @@ DILIGENT_END_INTERFACE
 #    define IRenderDeviceD3D12_CreateBufferFromD3DResource(This, ...)  CALL_IFACE_METHOD(RenderDeviceD3D12, CreateBufferFromD3DResource,  This, __VA_ARGS__)
 #    define IRenderDeviceD3D12_CreateBLASFromD3DResource(This, ...)    CALL_IFACE_METHOD(RenderDeviceD3D12, CreateBLASFromD3DResource,    This, __VA_ARGS__)
 #    define IRenderDeviceD3D12_CreateTLASFromD3DResource(This, ...)    CALL_IFACE_METHOD(RenderDeviceD3D12, CreateTLASFromD3DResource,    This, __VA_ARGS__)
+#    define IRenderDeviceD3D12_GetReleaseQueueStats(This, ...)         CALL_IFACE_METHOD(RenderDeviceD3D12, GetReleaseQueueStats,         This, __VA_ARGS__)
 
 // clang-format on
 
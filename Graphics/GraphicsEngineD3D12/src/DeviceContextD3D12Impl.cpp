@@ -461,6 +461,8 @@ void DeviceContextD3D12Impl::CommitShaderResources(IShaderResourceBinding* pShad
 
     const auto SRBIndex = pResBindingD3D12Impl->GetBindingIndex();
     auto&      RootInfo = GetRootTableInfo(pSignature->GetPipelineType());
+    if (IsRedundantSRBCommit(RootInfo, pResBindingD3D12Impl))
+        return;
 
     RootInfo.Set(SRBIndex, pResBindingD3D12Impl);
 }
@@ -34,8 +34,10 @@
 #include <deque>
 #include <vector>
 #include <atomic>
+#include <memory>
+#include <algorithm>
+#include <iterator>
 #include "VariableSizeAllocationsManager.hpp"
-#include "RingBuffer.hpp"
 
 namespace Diligent
 {
@@ -44,62 +46,57 @@ namespace DynamicHeap
 {
 
 
-// Having global ring buffer shared between all contexts is inconvenient because all contexts
-// must share the same frame. Having individual ring buffer per context may result in a lot of unused
-// memory. As a result, ring buffer is not currently used for dynamic memory management.
-// Instead, every dynamic heap allocates pages from the global dynamic memory manager.
-class MasterBlockRingBufferBasedManager
+class MasterBlockListBasedManager
 {
 public:
-    using OffsetType                                = RingBuffer::OffsetType;
-    using MasterBlock                               = RingBuffer::OffsetType;
-    static constexpr const OffsetType InvalidOffset = RingBuffer::InvalidOffset;
-
-    MasterBlockRingBufferBasedManager(IMemoryAllocator& Allocator,
-                                      Uint32            Size) :
-        m_RingBuffer{Size, Allocator}
-    {}
-
-    // clang-format off
-    MasterBlockRingBufferBasedManager            (const MasterBlockRingBufferBasedManager&)  = delete;
-    MasterBlockRingBufferBasedManager            (      MasterBlockRingBufferBasedManager&&) = delete;
-    MasterBlockRingBufferBasedManager& operator= (const MasterBlockRingBufferBasedManager&)  = delete;
-    MasterBlockRingBufferBasedManager& operator= (      MasterBlockRingBufferBasedManager&&) = delete;
-    // clang-format on
-
-    void DiscardMasterBlocks(std::vector<MasterBlock>& /*Blocks*/, Uint64 FenceValue)
-    {
-        std::lock_guard<std::mutex> Lock{m_RingBufferMtx};
-        m_RingBuffer.FinishCurrentFrame(FenceValue);
-    }
+    using OffsetType  = VariableSizeAllocationsManager::OffsetType;
+    using MasterBlock = VariableSizeAllocationsManager::Allocation;
 
-    void ReleaseStaleBlocks(Uint64 LastCompletedFenceValue)
+    // Per-context cache of master blocks.
+    // Master blocks released by a context are returned to its cache once they are no longer
+    // used by the GPU, and the context then reuses them without taking the global lock.
+    // Caches are owned by the manager, so that stale blocks can be safely returned after
+    // the context has been destroyed.
+    class MasterBlockCache
     {
-        std::lock_guard<std::mutex> Lock{m_RingBufferMtx};
-        m_RingBuffer.ReleaseCompletedFrames(LastCompletedFenceValue);
-    }
+    public:
+        explicit MasterBlockCache(OffsetType BlockSize) noexcept :
+            m_BlockSize{BlockSize}
+        {}
 
-    OffsetType GetSize() const { return m_RingBuffer.GetMaxSize(); }
-    OffsetType GetUsedSize() const { return m_RingBuffer.GetUsedSize(); }
+        OffsetType GetBlockSize() const { return m_BlockSize; }
 
-protected:
-    MasterBlock AllocateMasterBlock(OffsetType SizeInBytes, OffsetType Alignment)
-    {
-        std::lock_guard<std::mutex> Lock{m_RingBufferMtx};
-        return m_RingBuffer.Allocate(SizeInBytes, Alignment);
-    }
+    private:
+        friend MasterBlockListBasedManager;
 
-private:
-    std::mutex m_RingBufferMtx;
-    RingBuffer m_RingBuffer;
-};
+        // Returns true if the block can be reused as a block of this cache
+        // without wasting more than one block size
+        bool IsCompatible(const MasterBlock& Block) const
+        {
+            return Block.Size >= m_BlockSize && Block.Size < m_BlockSize * 2;
+        }
 
+        // Removes and returns a cached block that can hold SizeInBytes bytes aligned by Alignment
+        MasterBlock TakeBlock(OffsetType SizeInBytes, OffsetType Alignment)
+        {
+            std::lock_guard<std::mutex> Lock{m_Mtx};
+            for (auto it = m_Blocks.rbegin(); it != m_Blocks.rend(); ++it)
+            {
+                const OffsetType AlignedOffset = AlignUp(it->UnalignedOffset, Alignment);
+                if (AlignedOffset + SizeInBytes <= it->UnalignedOffset + it->Size)
+                {
+                    MasterBlock Block = std::move(*it);
+                    m_Blocks.erase(std::next(it).base());
+                    return Block;
+                }
+            }
+            return MasterBlock{};
+        }
 
-class MasterBlockListBasedManager
-{
-public:
-    using OffsetType  = VariableSizeAllocationsManager::OffsetType;
-    using MasterBlock = VariableSizeAllocationsManager::Allocation;
+        const OffsetType         m_BlockSize;
+        std::mutex               m_Mtx;
+        std::vector<MasterBlock> m_Blocks;
+    };
 
     MasterBlockListBasedManager(IMemoryAllocator& Allocator,
                                 Uint32            Size) :
@@ -119,21 +116,60 @@ public:
 
     ~MasterBlockListBasedManager()
     {
+        ReleaseCachedBlocks();
         DEV_CHECK_ERR(m_MasterBlockCounter == 0, m_MasterBlockCounter, " master block(s) have not been returned to the manager");
     }
 
+    // Creates a master block cache for a context. The cache is owned by the manager.
+    MasterBlockCache* CreateMasterBlockCache(OffsetType BlockSize)
+    {
+        std::lock_guard<std::mutex> Lock{m_CachesMtx};
+        m_Caches.emplace_back(new MasterBlockCache{BlockSize});
+        return m_Caches.back().get();
+    }
+
+    // Returns all cached master blocks to the manager.
+    // Cached blocks are not counted as allocated by the master block counter.
+    // Returns the number of released blocks.
+    size_t ReleaseCachedBlocks()
+    {
+        std::vector<MasterBlock> Blocks;
+        {
+            std::lock_guard<std::mutex> CachesLock{m_CachesMtx};
+            for (auto& pCache : m_Caches)
+            {
+                std::lock_guard<std::mutex> CacheLock{pCache->m_Mtx};
+                std::move(pCache->m_Blocks.begin(), pCache->m_Blocks.end(), std::back_inserter(Blocks));
+                pCache->m_Blocks.clear();
+            }
+        }
+
+        if (!Blocks.empty())
+        {
+            std::lock_guard<std::mutex> Lock{m_AllocationsMgrMtx};
+            for (auto& Block : Blocks)
+                m_AllocationsMgr.Free(std::move(Block));
+        }
+
+        return Blocks.size();
+    }
+
+    // Releases master blocks. If pCache is not null, the blocks that are compatible with the
+    // cache are returned to it rather than to the manager.
     template <typename RenderDeviceImplType>
-    void ReleaseMasterBlocks(std::vector<MasterBlock>& Blocks, RenderDeviceImplType& Device, Uint64 CmdQueueMask)
+    void ReleaseMasterBlocks(std::vector<MasterBlock>& Blocks, RenderDeviceImplType& Device, Uint64 CmdQueueMask, MasterBlockCache* pCache = nullptr)
     {
         struct StaleMasterBlock
         {
             MasterBlock                  Block;
             MasterBlockListBasedManager* Mgr;
+            MasterBlockCache*            pCache;
 
             // clang-format off
-            StaleMasterBlock(MasterBlock&& _Block, MasterBlockListBasedManager* _Mgr)noexcept :
+            StaleMasterBlock(MasterBlock&& _Block, MasterBlockListBasedManager* _Mgr, MasterBlockCache* _pCache)noexcept :
                 Block {std::move(_Block)},
-                Mgr   {_Mgr             }
+                Mgr   {_Mgr             },
+                pCache{_pCache          }
             {
             }
 
@@ -143,29 +179,25 @@ public:
 
             StaleMasterBlock(StaleMasterBlock&& rhs)noexcept :
                 Block {std::move(rhs.Block)},
-                Mgr   {rhs.Mgr             }
+                Mgr   {rhs.Mgr             },
+                pCache{rhs.pCache          }
             {
-                rhs.Block = MasterBlock{};
-                rhs.Mgr   = nullptr;
+                rhs.Block  = MasterBlock{};
+                rhs.Mgr    = nullptr;
+                rhs.pCache = nullptr;
             }
             // clang-format on
 
             ~StaleMasterBlock()
             {
                 if (Mgr != nullptr)
-                {
-                    std::lock_guard<std::mutex> Lock{Mgr->m_AllocationsMgrMtx};
-#ifdef DILIGENT_DEVELOPMENT
-                    --Mgr->m_MasterBlockCounter;
-#endif
-                    Mgr->m_AllocationsMgr.Free(std::move(Block));
-                }
+                    Mgr->ReturnMasterBlock(std::move(Block), pCache);
             }
         };
         for (auto& Block : Blocks)
         {
             DEV_CHECK_ERR(Block.IsValid(), "Attempting to release invalid master block");
-            Device.SafeReleaseDeviceObject(StaleMasterBlock{std::move(Block), this}, CmdQueueMask);
+            Device.SafeReleaseDeviceObject(StaleMasterBlock{std::move(Block), this, pCache}, CmdQueueMask);
         }
     }
 
@@ -182,7 +214,31 @@ public:
 #endif
 
 protected:
-    MasterBlock AllocateMasterBlock(OffsetType SizeInBytes, OffsetType Alignment)
+    MasterBlock AllocateMasterBlock(OffsetType SizeInBytes, OffsetType Alignment, MasterBlockCache* pCache = nullptr)
+    {
+        if (pCache != nullptr && SizeInBytes < pCache->m_BlockSize * 2)
+        {
+            auto Block = pCache->TakeBlock(SizeInBytes, Alignment);
+            if (Block.IsValid())
+            {
+#ifdef DILIGENT_DEVELOPMENT
+                ++m_MasterBlockCounter;
+#endif
+                return Block;
+            }
+        }
+
+        auto NewBlock = AllocateFromManager(SizeInBytes, Alignment);
+        if (!NewBlock.IsValid() && ReleaseCachedBlocks() > 0)
+        {
+            // Other contexts may hold enough free space in their caches
+            NewBlock = AllocateFromManager(SizeInBytes, Alignment);
+        }
+        return NewBlock;
+    }
+
+private:
+    MasterBlock AllocateFromManager(OffsetType SizeInBytes, OffsetType Alignment)
     {
         std::lock_guard<std::mutex> Lock{m_AllocationsMgrMtx};
         auto                        NewBlock = m_AllocationsMgr.Allocate(SizeInBytes, Alignment);
@@ -195,10 +251,28 @@ protected:
         return NewBlock;
     }
 
-private:
+    void ReturnMasterBlock(MasterBlock&& Block, MasterBlockCache* pCache)
+    {
+#ifdef DILIGENT_DEVELOPMENT
+        --m_MasterBlockCounter;
+#endif
+        if (pCache != nullptr && pCache->IsCompatible(Block))
+        {
+            std::lock_guard<std::mutex> Lock{pCache->m_Mtx};
+            pCache->m_Blocks.emplace_back(std::move(Block));
+            return;
+        }
+
+        std::lock_guard<std::mutex> Lock{m_AllocationsMgrMtx};
+        m_AllocationsMgr.Free(std::move(Block));
+    }
+
     std::mutex                     m_AllocationsMgrMtx;
     VariableSizeAllocationsManager m_AllocationsMgr;
 
+    std::mutex                                     m_CachesMtx;
+    std::vector<std::unique_ptr<MasterBlockCache>> m_Caches;
+
 #ifdef DILIGENT_DEVELOPMENT
     std::atomic<Int32> m_MasterBlockCounter;
 #endif
@@ -61,7 +61,8 @@ public:
                             const EngineCreateInfo&    EngineCI,
                             const GraphicsAdapterInfo& AdapterInfo) :
         TBase{pRefCounters, RawMemAllocator, pEngineFactory, EngineCI, AdapterInfo},
-        m_CmdQueueCount{CmdQueueCount}
+        m_CmdQueueCount{CmdQueueCount},
+        m_MaxResourcesReleasedPerPurge{EngineCI.MaxResourcesReleasedPerPurge != 0 ? size_t{EngineCI.MaxResourcesReleasedPerPurge} : ~size_t{0}}
     {
         VERIFY(m_CmdQueueCount < MAX_COMMAND_QUEUES, "The number of command queue is greater than maximum allowed value (", MAX_COMMAND_QUEUES, ")");
 
@@ -153,7 +154,22 @@ public:
         VERIFY_EXPR(QueueInd < m_CmdQueueCount);
         auto& Queue               = m_CommandQueues[QueueInd];
         auto  CompletedFenceValue = ForceRelease ? std::numeric_limits<Uint64>::max() : Queue.CmdQueue->GetCompletedFenceValue();
-        Queue.ReleaseQueue.Purge(CompletedFenceValue);
+        Queue.ReleaseQueue.Purge(CompletedFenceValue, ForceRelease ? ~size_t{0} : m_MaxResourcesReleasedPerPurge);
+    }
+
+    ReleaseQueueStats QueryReleaseQueueStats(SoftwareQueueIndex QueueInd) const
+    {
+        VERIFY_EXPR(QueueInd < m_CmdQueueCount);
+        const auto QueueStats = m_CommandQueues[QueueInd].ReleaseQueue.GetStats();
+
+        ReleaseQueueStats Stats;
+        Stats.StaleResourceCount          = QueueStats.StaleResourceCount;
+        Stats.PendingReleaseResourceCount = QueueStats.PendingReleaseResourceCount;
+        Stats.ReleasedResourceCount       = QueueStats.ReleasedResourceCount;
+        Stats.LastPurgeReleasedCount      = QueueStats.LastPurgeReleasedCount;
+        Stats.LastPurgeTimeNs             = QueueStats.LastPurgeTimeNs;
+        Stats.TotalPurgeTimeNs            = QueueStats.TotalPurgeTimeNs;
+        return Stats;
     }
 
     void IdleCommandQueue(SoftwareQueueIndex QueueInd, bool ReleaseResources)
@@ -181,7 +197,7 @@ public:
         if (ReleaseResources)
         {
             Queue.ReleaseQueue.DiscardStaleResources(CmdBufferNumber, FenceValue);
-            Queue.ReleaseQueue.Purge(Queue.CmdQueue->GetCompletedFenceValue());
+            Queue.ReleaseQueue.Purge(Queue.CmdQueue->GetCompletedFenceValue(), m_MaxResourcesReleasedPerPurge);
         }
     }
 
@@ -321,6 +337,9 @@ protected:
     };
     const size_t  m_CmdQueueCount = 0;
     CommandQueue* m_CommandQueues = nullptr;
+
+    // The maximum number of resources destroyed by one purge, see EngineCreateInfo::MaxResourcesReleasedPerPurge
+    const size_t m_MaxResourcesReleasedPerPurge;
 };
 
 } // namespace Diligent
@@ -0,0 +1,84 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::CommandQueueNullImpl class
+
+#include <atomic>
+
+#include "CommandQueue.h"
+#include "ObjectBase.hpp"
+
+namespace Diligent
+{
+
+/// Implementation of the Diligent::ICommandQueue interface in Null backend.
+
+/// The queue does not execute any work: every submitted command buffer
+/// is considered complete as soon as it is submitted.
+class CommandQueueNullImpl final : public ObjectBase<ICommandQueue>
+{
+public:
+    using TBase = ObjectBase<ICommandQueue>;
+
+    explicit CommandQueueNullImpl(IReferenceCounters* pRefCounters) noexcept :
+        TBase{pRefCounters}
+    {}
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_CommandQueue, TBase)
+
+    // Implementation of ICommandQueue::GetNextFenceValue().
+    virtual Uint64 DILIGENT_CALL_TYPE GetNextFenceValue() const override final { return m_NextFenceValue.load(); }
+
+    // Implementation of ICommandQueue::GetCompletedFenceValue().
+    virtual Uint64 DILIGENT_CALL_TYPE GetCompletedFenceValue() override final { return m_LastCompletedFenceValue.load(); }
+
+    // Implementation of ICommandQueue::WaitForIdle().
+    virtual Uint64 DILIGENT_CALL_TYPE WaitForIdle() override final { return m_LastCompletedFenceValue.load(); }
+
+    // Submits an empty command buffer and returns its fence value.
+    Uint64 Submit()
+    {
+        const Uint64 FenceValue = m_NextFenceValue.fetch_add(1);
+        // Nothing is executed, so the command buffer is complete right away.
+        Uint64 LastCompleted = m_LastCompletedFenceValue.load();
+        while (LastCompleted < FenceValue && !m_LastCompletedFenceValue.compare_exchange_weak(LastCompleted, FenceValue))
+        {
+        }
+        return FenceValue;
+    }
+
+private:
+    // A value that will be signaled by the command queue next
+    std::atomic<Uint64> m_NextFenceValue{1};
+
+    // Last completed fence value
+    std::atomic<Uint64> m_LastCompletedFenceValue{0};
+};
+
+} // namespace Diligent
@@ -0,0 +1,73 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::TextureNullImpl class
+
+#include <vector>
+
+#include "EngineNullImplTraits.hpp"
+#include "TextureBase.hpp"
+#include "TextureViewNullImpl.hpp" // Required by TextureBase
+
+namespace Diligent
+{
+
+/// Texture implementation in Null backend.
+
+/// Only staging textures keep a copy of their contents so that mapping them
+/// returns valid memory. The data is laid out the same way as staging textures
+/// in other backends (see GetStagingTextureLocationOffset()).
+class TextureNullImpl final : public TextureBase<EngineNullImplTraits>
+{
+public:
+    using TTextureBase = TextureBase<EngineNullImplTraits>;
+
+    // Alignment of subresources in the CPU copy of staging texture data
+    static constexpr Uint32 StagingDataAlignment = 4;
+
+    TextureNullImpl(IReferenceCounters*        pRefCounters,
+                    FixedBlockMemoryAllocator& TexViewObjAllocator,
+                    RenderDeviceNullImpl*      pDevice,
+                    const TextureDesc&         Desc,
+                    const TextureData*         pInitData,
+                    bool                       bIsDeviceInternal);
+
+    /// Implementation of ITexture::GetNativeHandle() in Null backend.
+    Uint64 DILIGENT_CALL_TYPE GetNativeHandle() override final { return 0; }
+
+    /// Returns a pointer to the CPU copy of the texture data, or null if the texture does not have one.
+    Uint8* GetCPUData() { return !m_CPUData.empty() ? m_CPUData.data() : nullptr; }
+
+private:
+    void CreateViewInternal(const TextureViewDesc& ViewDesc, ITextureView** ppView, bool bIsDefaultView) override;
+
+    std::vector<Uint8> m_CPUData;
+};
+
+} // namespace Diligent
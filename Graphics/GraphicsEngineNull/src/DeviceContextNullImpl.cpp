@@ -0,0 +1,663 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "DeviceContextNullImpl.hpp"
+
+#include <cstring>
+
+#include "RenderDeviceNullImpl.hpp"
+#include "BufferNullImpl.hpp"
+#include "TextureNullImpl.hpp"
+#include "PipelineStateNullImpl.hpp"
+#include "PipelineResourceSignatureNullImpl.hpp"
+#include "ShaderResourceBindingNullImpl.hpp"
+#include "FenceNullImpl.hpp"
+#include "QueryNullImpl.hpp"
+#include "CommandListNullImpl.hpp"
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+DeviceContextNullImpl::DeviceContextNullImpl(IReferenceCounters*      pRefCounters,
+                                             RenderDeviceNullImpl*    pDevice,
+                                             const DeviceContextDesc& Desc) :
+    // clang-format off
+    TDeviceContextBase
+    {
+        pRefCounters,
+        pDevice,
+        Desc
+    },
+    m_CmdListAllocator{GetRawAllocator(), sizeof(CommandListNullImpl), 64}
+// clang-format on
+{
+}
+
+DeviceContextNullImpl::~DeviceContextNullImpl()
+{
+    if (!IsDeferred())
+    {
+        Flush();
+    }
+
+    // For deferred contexts, m_SubmittedBuffersCmdQueueMask is reset to 0 after every call to FinishFrame().
+    // In this case there are no resources to release, so there will be no issues.
+    FinishFrame();
+}
+
+void DeviceContextNullImpl::Begin(Uint32 ImmediateContextId)
+{
+    TDeviceContextBase::Begin(DeviceContextIndex{ImmediateContextId}, COMMAND_QUEUE_TYPE_GRAPHICS);
+}
+
+void DeviceContextNullImpl::SetPipelineState(IPipelineState* pPipelineState)
+{
+    RefCntAutoPtr<PipelineStateNullImpl> pPipelineStateNull{pPipelineState, PipelineStateNullImpl::IID_InternalImpl};
+    VERIFY(pPipelineState == nullptr || pPipelineStateNull != nullptr, "Unknown pipeline state object implementation");
+    if (PipelineStateNullImpl::IsSameObject(m_pPipelineState, pPipelineStateNull))
+        return;
+
+    TDeviceContextBase::SetPipelineState(std::move(pPipelineStateNull), 0 /*Dummy*/);
+
+    Uint32 DvpCompatibleSRBCount = 0;
+    PrepareCommittedResources(m_BindInfo, DvpCompatibleSRBCount);
+    // Commit all SRBs when PSO changes
+    m_BindInfo.StaleSRBMask |= m_BindInfo.ActiveSRBMask;
+}
+
+void DeviceContextNullImpl::TransitionShaderResources(IShaderResourceBinding* pShaderResourceBinding)
+{
+    DEV_CHECK_ERR(pShaderResourceBinding != nullptr, "Shader resource binding must not be null");
+}
+
+void DeviceContextNullImpl::CommitShaderResources(IShaderResourceBinding*        pShaderResourceBinding,
+                                                  RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::CommitShaderResources(pShaderResourceBinding, StateTransitionMode, 0 /*Dummy*/);
+
+    ShaderResourceBindingNullImpl* pResBindingNull = ClassPtrCast<ShaderResourceBindingNullImpl>(pShaderResourceBinding);
+    if (pResBindingNull->GetResourceCache().GetNumResources() == 0)
+    {
+        // Ignore SRBs that contain no resources
+        return;
+    }
+
+    if (!IsRedundantSRBCommit(m_BindInfo, pResBindingNull))
+        m_BindInfo.Set(pResBindingNull->GetBindingIndex(), pResBindingNull);
+}
+
+void DeviceContextNullImpl::CommitStaleShaderResources()
+{
+    DEV_CHECK_ERR(m_pPipelineState != nullptr, "No pipeline state is bound");
+    if (!m_pPipelineState)
+        return;
+
+#ifdef DILIGENT_DEVELOPMENT
+    DvpValidateCommittedShaderResources();
+#endif
+
+    // There is nothing to bind, but the SRBs are processed the same way
+    // other backends do so that the CPU cost of the bookkeeping is preserved.
+    if (const Uint32 CommitSRBMask = m_BindInfo.GetCommitMask())
+        m_BindInfo.StaleSRBMask &= ~CommitSRBMask;
+}
+
+#ifdef DILIGENT_DEVELOPMENT
+void DeviceContextNullImpl::DvpValidateCommittedShaderResources()
+{
+    if (m_BindInfo.ResourcesValidated)
+        return;
+
+    DvpVerifySRBCompatibility(m_BindInfo);
+
+    m_BindInfo.ResourcesValidated = true;
+}
+#endif
+
+void DeviceContextNullImpl::InvalidateState()
+{
+    TDeviceContextBase::InvalidateState();
+    m_BindInfo = {};
+}
+
+void DeviceContextNullImpl::SetStencilRef(Uint32 StencilRef)
+{
+    TDeviceContextBase::SetStencilRef(StencilRef, 0);
+}
+
+void DeviceContextNullImpl::SetBlendFactors(const float* pBlendFactors)
+{
+    TDeviceContextBase::SetBlendFactors(pBlendFactors, 0);
+}
+
+void DeviceContextNullImpl::SetVertexBuffers(Uint32                         StartSlot,
+                                             Uint32                         NumBuffersSet,
+                                             IBuffer* const*                ppBuffers,
+                                             const Uint64*                  pOffsets,
+                                             RESOURCE_STATE_TRANSITION_MODE StateTransitionMode,
+                                             SET_VERTEX_BUFFERS_FLAGS       Flags)
+{
+    TDeviceContextBase::SetVertexBuffers(StartSlot, NumBuffersSet, ppBuffers, pOffsets, StateTransitionMode, Flags);
+}
+
+void DeviceContextNullImpl::SetIndexBuffer(IBuffer*                       pIndexBuffer,
+                                           Uint64                         ByteOffset,
+                                           RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::SetIndexBuffer(pIndexBuffer, ByteOffset, StateTransitionMode);
+}
+
+void DeviceContextNullImpl::SetViewports(Uint32          NumViewports,
+                                         const Viewport* pViewports,
+                                         Uint32          RTWidth,
+                                         Uint32          RTHeight)
+{
+    TDeviceContextBase::SetViewports(NumViewports, pViewports, RTWidth, RTHeight);
+}
+
+void DeviceContextNullImpl::SetScissorRects(Uint32 NumRects, const Rect* pRects, Uint32 RTWidth, Uint32 RTHeight)
+{
+    TDeviceContextBase::SetScissorRects(NumRects, pRects, RTWidth, RTHeight);
+}
+
+void DeviceContextNullImpl::SetRenderTargetsExt(const SetRenderTargetsAttribs& Attribs)
+{
+    if (TDeviceContextBase::SetRenderTargets(Attribs))
+        SetViewports(1, nullptr, 0, 0);
+}
+
+void DeviceContextNullImpl::BeginRenderPass(const BeginRenderPassAttribs& Attribs)
+{
+    TDeviceContextBase::BeginRenderPass(Attribs);
+}
+
+void DeviceContextNullImpl::NextSubpass()
+{
+    TDeviceContextBase::NextSubpass();
+}
+
+void DeviceContextNullImpl::EndRenderPass()
+{
+    TDeviceContextBase::EndRenderPass();
+}
+
+void DeviceContextNullImpl::Draw(const DrawAttribs& Attribs)
+{
+    TDeviceContextBase::Draw(Attribs, 0);
+    CommitStaleShaderResources();
+}
+
+void DeviceContextNullImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
+{
+    TDeviceContextBase::DrawIndexed(Attribs, 0);
+    CommitStaleShaderResources();
+}
+
+void DeviceContextNullImpl::DrawIndirect(const DrawIndirectAttribs& Attribs)
+{
+    TDeviceContextBase::DrawIndirect(Attribs, 0);
+    CommitStaleShaderResources();
+}
+
+void DeviceContextNullImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs& Attribs)
+{
+    TDeviceContextBase::DrawIndexedIndirect(Attribs, 0);
+    CommitStaleShaderResources();
+}
+
+void DeviceContextNullImpl::DrawMesh(const DrawMeshAttribs& Attribs)
+{
+    TDeviceContextBase::DrawMesh(Attribs, 0);
+    CommitStaleShaderResources();
+}
+
+void DeviceContextNullImpl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attribs)
+{
+    TDeviceContextBase::DrawMeshIndirect(Attribs, 0);
+    CommitStaleShaderResources();
+}
+
+void DeviceContextNullImpl::MultiDraw(const MultiDrawAttribs& Attribs)
+{
+    TDeviceContextBase::MultiDraw(Attribs, 0);
+    CommitStaleShaderResources();
+}
+
+void DeviceContextNullImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attribs)
+{
+    TDeviceContextBase::MultiDrawIndexed(Attribs, 0);
+    CommitStaleShaderResources();
+}
+
+void DeviceContextNullImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
+{
+    TDeviceContextBase::DispatchCompute(Attribs, 0);
+    CommitStaleShaderResources();
+}
+
+void DeviceContextNullImpl::DispatchComputeIndirect(const DispatchComputeIndirectAttribs& Attribs)
+{
+    TDeviceContextBase::DispatchComputeIndirect(Attribs, 0);
+    CommitStaleShaderResources();
+}
+
+void DeviceContextNullImpl::ClearDepthStencil(ITextureView*                  pView,
+                                              CLEAR_DEPTH_STENCIL_FLAGS      ClearFlags,
+                                              float                          fDepth,
+                                              Uint8                          Stencil,
+                                              RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::ClearDepthStencil(pView);
+}
+
+void DeviceContextNullImpl::ClearRenderTarget(ITextureView*                  pView,
+                                              const void*                    RGBA,
+                                              RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::ClearRenderTarget(pView);
+}
+
+void DeviceContextNullImpl::UpdateBuffer(IBuffer*                       pBuffer,
+                                         Uint64                         Offset,
+                                         Uint64                         Size,
+                                         const void*                    pData,
+                                         RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
+{
+    TDeviceContextBase::UpdateBuffer(pBuffer, Offset, Size, pData, StateTransitionMode);
+
+    BufferNullImpl* const pBufferNull = ClassPtrCast<BufferNullImpl>(pBuffer);
+    if (Uint8* pCPUData = pBufferNull->GetCPUData())
+        memcpy(pCPUData + Offset, pData, StaticCast<size_t>(Size));
+}
+
+void DeviceContextNullImpl::CopyBuffer(IBuffer*                       pSrcBuffer,
+                                       Uint64                         SrcOffset,
+                                       RESOURCE_STATE_TRANSITION_MODE SrcBufferTransitionMode,
+                                       IBuffer*                       pDstBuffer,
+                                       Uint64                         DstOffset,
+                                       Uint64                         Size,
+                                       RESOURCE_STATE_TRANSITION_MODE DstBufferTransitionMode)
+{
+    TDeviceContextBase::CopyBuffer(pSrcBuffer, SrcOffset, SrcBufferTransitionMode, pDstBuffer, DstOffset, Size, DstBufferTransitionMode);
+
+    // Only buffers with CPU access keep their contents, so the copy is only
+    // performed when both buffers have CPU-side storage.
+    const Uint8* pSrcData = ClassPtrCast<BufferNullImpl>(pSrcBuffer)->GetCPUData();
+    Uint8*       pDstData = ClassPtrCast<BufferNullImpl>(pDstBuffer)->GetCPUData();
+    if (pSrcData != nullptr && pDstData != nullptr)
+        memmove(pDstData + DstOffset, pSrcData + SrcOffset, StaticCast<size_t>(Size));
+}
+
+void DeviceContextNullImpl::MapBuffer(IBuffer*  pBuffer,
+                                      MAP_TYPE  MapType,
+                                      MAP_FLAGS MapFlags,
+                                      PVoid&    pMappedData)
+{
+    TDeviceContextBase::MapBuffer(pBuffer, MapType, MapFlags, pMappedData);
+
+    BufferNullImpl* const pBufferNull = ClassPtrCast<BufferNullImpl>(pBuffer);
+    pMappedData                       = pBufferNull->GetCPUData();
+    DEV_CHECK_ERR(pMappedData != nullptr, "Buffer '", pBufferNull->GetDesc().Name, "' does not have CPU-side storage and can't be mapped");
+}
+
+void DeviceContextNullImpl::UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType)
+{
+    TDeviceContextBase::UnmapBuffer(pBuffer, MapType);
+}
+
+void DeviceContextNullImpl::UpdateTexture(ITexture*                      pTexture,
+                                          Uint32                         MipLevel,
+                                          Uint32                         Slice,
+                                          const Box&                     DstBox,
+                                          const TextureSubResData&       SubresData,
+                                          RESOURCE_STATE_TRANSITION_MODE SrcBufferTransitionMode,
+                                          RESOURCE_STATE_TRANSITION_MODE TextureTransitionMode)
+{
+    // Only default and sparse textures can be updated, and these
+    // do not keep a copy of their data in Null backend.
+    TDeviceContextBase::UpdateTexture(pTexture, MipLevel, Slice, DstBox, SubresData, SrcBufferTransitionMode, TextureTransitionMode);
+}
+
+void DeviceContextNullImpl::CopyTexture(const CopyTextureAttribs& CopyAttribs)
+{
+    // Texture data is only kept for staging textures, and copying staging textures
+    // to each other is not a common use case, so the copy is not performed.
+    TDeviceContextBase::CopyTexture(CopyAttribs);
+}
+
+void DeviceContextNullImpl::MapTextureSubresource(ITexture*                 pTexture,
+                                                  Uint32                    MipLevel,
+                                                  Uint32                    ArraySlice,
+                                                  MAP_TYPE                  MapType,
+                                                  MAP_FLAGS                 MapFlags,
+                                                  const Box*                pMapRegion,
+                                                  MappedTextureSubresource& MappedData)
+{
+    TDeviceContextBase::MapTextureSubresource(pTexture, MipLevel, ArraySlice, MapType, MapFlags, pMapRegion, MappedData);
+
+    TextureNullImpl* const pTextureNull = ClassPtrCast<TextureNullImpl>(pTexture);
+    const TextureDesc&     TexDesc      = pTextureNull->GetDesc();
+
+    Box FullExtentBox;
+    if (pMapRegion == nullptr)
+    {
+        const MipLevelProperties MipLevelAttribs = GetMipLevelProperties(TexDesc, MipLevel);
+
+        FullExtentBox.MaxX = MipLevelAttribs.LogicalWidth;
+        FullExtentBox.MaxY = MipLevelAttribs.LogicalHeight;
+        FullExtentBox.MaxZ = MipLevelAttribs.Depth;
+        pMapRegion         = &FullExtentBox;
+    }
+
+    if (TexDesc.Usage == USAGE_STAGING)
+    {
+        Uint8* const pCPUData = pTextureNull->GetCPUData();
+        VERIFY(pCPUData != nullptr, "Staging texture must have CPU-side storage");
+
+        const Uint64 LocationOffset = GetStagingTextureLocationOffset(TexDesc, ArraySlice, MipLevel, TextureNullImpl::StagingDataAlignment,
+                                                                      pMapRegion->MinX, pMapRegion->MinY, pMapRegion->MinZ);
+
+        const MipLevelProperties MipLevelAttribs = GetMipLevelProperties(TexDesc, MipLevel);
+
+        MappedData.pData       = pCPUData + LocationOffset;
+        MappedData.Stride      = MipLevelAttribs.RowSize;
+        MappedData.DepthStride = MipLevelAttribs.DepthSliceSize;
+    }
+    else if (TexDesc.Usage == USAGE_DYNAMIC)
+    {
+        const BufferToTextureCopyInfo CopyInfo = GetBufferToTextureCopyInfo(TexDesc.Format, *pMapRegion, TextureNullImpl::StagingDataAlignment);
+
+        auto it = m_MappedTextures.emplace(MappedTextureKey{pTextureNull, MipLevel, ArraySlice}, std::vector<Uint8>(StaticCast<size_t>(CopyInfo.MemorySize)));
+        if (!it.second)
+            LOG_ERROR_MESSAGE("Mip level ", MipLevel, ", slice ", ArraySlice, " of texture '", TexDesc.Name, "' has already been mapped");
+
+        MappedData.pData       = it.first->second.data();
+        MappedData.Stride      = CopyInfo.RowStride;
+        MappedData.DepthStride = CopyInfo.DepthStride;
+    }
+    else
+    {
+        LOG_ERROR_MESSAGE("Only USAGE_DYNAMIC and USAGE_STAGING textures can be mapped in Null backend");
+        MappedData = MappedTextureSubresource{};
+    }
+}
+
+void DeviceContextNullImpl::UnmapTextureSubresource(ITexture* pTexture, Uint32 MipLevel, Uint32 ArraySlice)
+{
+    TDeviceContextBase::UnmapTextureSubresource(pTexture, MipLevel, ArraySlice);
+
+    TextureNullImpl* const pTextureNull = ClassPtrCast<TextureNullImpl>(pTexture);
+    if (pTextureNull->GetDesc().Usage == USAGE_DYNAMIC)
+    {
+        auto it = m_MappedTextures.find(MappedTextureKey{pTextureNull, MipLevel, ArraySlice});
+        if (it != m_MappedTextures.end())
+            m_MappedTextures.erase(it);
+        else
+            LOG_ERROR_MESSAGE("Failed to unmap mip level ", MipLevel, ", slice ", ArraySlice, " of texture '", pTextureNull->GetDesc().Name, "'. The texture has either been unmapped already or has not been mapped");
+    }
+}
+
+void DeviceContextNullImpl::FinishCommandList(ICommandList** ppCommandList)
+{
+    DEV_CHECK_ERR(IsDeferred(), "Only deferred context can record command list");
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Finishing command list inside an active render pass.");
+
+    CommandListNullImpl* pCmdListNull{NEW_RC_OBJ(m_CmdListAllocator, "CommandListNullImpl instance", CommandListNullImpl)(m_pDevice, this)};
+    pCmdListNull->QueryInterface(IID_CommandList, reinterpret_cast<IObject**>(ppCommandList));
+
+    InvalidateState();
+
+    TDeviceContextBase::FinishCommandList();
+}
+
+void DeviceContextNullImpl::ExecuteCommandLists(Uint32               NumCommandLists,
+                                                ICommandList* const* ppCommandLists)
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Only immediate context can execute command list");
+
+    if (NumCommandLists == 0)
+        return;
+    DEV_CHECK_ERR(ppCommandLists != nullptr, "ppCommandLists must not be null when NumCommandLists is not zero");
+
+    Flush(NumCommandLists, ppCommandLists);
+
+    InvalidateState();
+}
+
+void DeviceContextNullImpl::EnqueueSignal(IFence* pFence, Uint64 Value)
+{
+    TDeviceContextBase::EnqueueSignal(pFence, Value, 0);
+
+    FenceNullImpl* pFenceNull = ClassPtrCast<FenceNullImpl>(pFence);
+    pFenceNull->DvpSignal(Value);
+    m_SignalFences.emplace_back(std::make_pair(Value, pFenceNull));
+}
+
+void DeviceContextNullImpl::DeviceWaitForFence(IFence* pFence, Uint64 Value)
+{
+    TDeviceContextBase::DeviceWaitForFence(pFence, Value, 0);
+    ClassPtrCast<FenceNullImpl>(pFence)->DvpDeviceWait(Value);
+}
+
+void DeviceContextNullImpl::WaitForIdle()
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Only immediate contexts can be idled");
+    Flush();
+    m_pDevice->IdleCommandQueue(GetCommandQueueId(), true);
+}
+
+void DeviceContextNullImpl::BeginQuery(IQuery* pQuery)
+{
+    TDeviceContextBase::BeginQuery(pQuery, 0);
+
+    QueryNullImpl* pQueryNull = ClassPtrCast<QueryNullImpl>(pQuery);
+    if (pQueryNull->OnBeginQuery(this))
+        ++m_ActiveQueriesCounter;
+}
+
+void DeviceContextNullImpl::EndQuery(IQuery* pQuery)
+{
+    TDeviceContextBase::EndQuery(pQuery, 0);
+
+    QueryNullImpl* pQueryNull = ClassPtrCast<QueryNullImpl>(pQuery);
+    if (pQueryNull->OnEndQuery(this) && pQueryNull->GetDesc().Type != QUERY_TYPE_TIMESTAMP)
+    {
+        VERIFY(m_ActiveQueriesCounter > 0, "Active query counter is 0 which means there was a mismatch between BeginQuery() / EndQuery() calls");
+        --m_ActiveQueriesCounter;
+    }
+}
+
+void DeviceContextNullImpl::Flush()
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Flush() should only be called for immediate contexts.");
+    Flush(0, nullptr);
+}
+
+void DeviceContextNullImpl::Flush(Uint32               NumCommandLists,
+                                  ICommandList* const* ppCommandLists)
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Flush() should only be called for immediate contexts.");
+
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr,
+                  "Flushing device context inside an active render pass.");
+
+    std::vector<RefCntAutoPtr<IDeviceContext>> DeferredCtxs(NumCommandLists);
+    for (Uint32 i = 0; i < NumCommandLists; ++i)
+    {
+        CommandListNullImpl* pCmdListNull = ClassPtrCast<CommandListNullImpl>(ppCommandLists[i]);
+        DEV_CHECK_ERR(pCmdListNull != nullptr, "Command list must not be null");
+        DEV_CHECK_ERR(pCmdListNull->GetQueueId() == GetDesc().QueueId, "Command list recorded for QueueId ", pCmdListNull->GetQueueId(), ", but executed on QueueId ", GetDesc().QueueId, ".");
+        pCmdListNull->Close(DeferredCtxs[i]);
+        VERIFY_EXPR(DeferredCtxs[i] != nullptr);
+    }
+
+    // Submit empty command buffer even if there are no commands to release stale resources.
+    // The Null command queue completes it immediately.
+    m_pDevice->SubmitCommandBuffer(GetCommandQueueId(), true);
+
+    for (auto& val_fence : m_SignalFences)
+        val_fence.second->SetCompletedValue(val_fence.first);
+    m_SignalFences.clear();
+
+    for (RefCntAutoPtr<IDeviceContext>& pDeferredCtx : DeferredCtxs)
+    {
+        // Set the bit in the deferred context cmd queue mask corresponding to cmd queue of this context
+        pDeferredCtx.RawPtr<DeviceContextNullImpl>()->UpdateSubmittedBuffersCmdQueueMask(GetCommandQueueId());
+    }
+
+    m_BindInfo          = {};
+    m_pPipelineState    = nullptr;
+    m_pActiveRenderPass = nullptr;
+    m_pBoundFramebuffer = nullptr;
+}
+
+void DeviceContextNullImpl::BuildBLAS(const BuildBLASAttribs& Attribs)
+{
+    UNSUPPORTED("BuildBLAS is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::BuildTLAS(const BuildTLASAttribs& Attribs)
+{
+    UNSUPPORTED("BuildTLAS is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::CopyBLAS(const CopyBLASAttribs& Attribs)
+{
+    UNSUPPORTED("CopyBLAS is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::CopyTLAS(const CopyTLASAttribs& Attribs)
+{
+    UNSUPPORTED("CopyTLAS is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::WriteBLASCompactedSize(const WriteBLASCompactedSizeAttribs& Attribs)
+{
+    UNSUPPORTED("WriteBLASCompactedSize is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::WriteTLASCompactedSize(const WriteTLASCompactedSizeAttribs& Attribs)
+{
+    UNSUPPORTED("WriteTLASCompactedSize is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::TraceRays(const TraceRaysAttribs& Attribs)
+{
+    UNSUPPORTED("TraceRays is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::TraceRaysIndirect(const TraceRaysIndirectAttribs& Attribs)
+{
+    UNSUPPORTED("TraceRaysIndirect is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::UpdateSBT(IShaderBindingTable*                 pSBT,
+                                      const UpdateIndirectRTBufferAttribs* pUpdateIndirectBufferAttribs)
+{
+    UNSUPPORTED("UpdateSBT is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::SetShadingRate(SHADING_RATE          BaseRate,
+                                           SHADING_RATE_COMBINER PrimitiveCombiner,
+                                           SHADING_RATE_COMBINER TextureCombiner)
+{
+    UNSUPPORTED("SetShadingRate is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::BindSparseResourceMemory(const BindSparseResourceMemoryAttribs& Attribs)
+{
+    UNSUPPORTED("BindSparseResourceMemory is not supported in Null backend");
+}
+
+void DeviceContextNullImpl::BeginDebugGroup(const Char* Name, const float* pColor)
+{
+    TDeviceContextBase::BeginDebugGroup(Name, pColor, 0);
+}
+
+void DeviceContextNullImpl::EndDebugGroup()
+{
+    TDeviceContextBase::EndDebugGroup(0);
+}
+
+void DeviceContextNullImpl::InsertDebugLabel(const Char* Label, const float* pColor)
+{
+    TDeviceContextBase::InsertDebugLabel(Label, pColor, 0);
+}
+
+void DeviceContextNullImpl::GenerateMips(ITextureView* pTexView)
+{
+    TDeviceContextBase::GenerateMips(pTexView);
+}
+
+void DeviceContextNullImpl::FinishFrame()
+{
+    if (m_ActiveQueriesCounter > 0)
+    {
+        LOG_ERROR_MESSAGE("There are ", m_ActiveQueriesCounter,
+                          " active queries in the device context when finishing the frame. "
+                          "All queries must be ended before the frame is finished.");
+    }
+
+    if (m_pActiveRenderPass != nullptr)
+        LOG_ERROR_MESSAGE("Finishing frame inside an active render pass.");
+
+    if (!m_MappedTextures.empty())
+        LOG_ERROR_MESSAGE("There are mapped textures in the device context when finishing the frame. All dynamic resources must be used in the same frame in which they are mapped.");
+
+    EndFrame();
+}
+
+void DeviceContextNullImpl::TransitionResourceStates(Uint32 BarrierCount, const StateTransitionDesc* pResourceBarriers)
+{
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
+
+    for (Uint32 i = 0; i < BarrierCount; ++i)
+    {
+        const StateTransitionDesc& Barrier = pResourceBarriers[i];
+#ifdef DILIGENT_DEVELOPMENT
+        DvpVerifyStateTransitionDesc(Barrier);
+#endif
+        if (Barrier.TransitionType == STATE_TRANSITION_TYPE_BEGIN || (Barrier.Flags & STATE_TRANSITION_FLAG_UPDATE_STATE) == 0)
+            continue;
+
+        if (RefCntAutoPtr<TextureNullImpl> pTexture{Barrier.pResource, IID_Texture})
+            pTexture->SetState(Barrier.NewState);
+        else if (RefCntAutoPtr<BufferNullImpl> pBuffer{Barrier.pResource, IID_Buffer})
+            pBuffer->SetState(Barrier.NewState);
+    }
+}
+
+void DeviceContextNullImpl::ResolveTextureSubresource(ITexture*                               pSrcTexture,
+                                                      ITexture*                               pDstTexture,
+                                                      const ResolveTextureSubresourceAttribs& ResolveAttribs)
+{
+    TDeviceContextBase::ResolveTextureSubresource(pSrcTexture, pDstTexture, ResolveAttribs);
+}
+
+} // namespace Diligent
@@ -0,0 +1,359 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+/// \file
+/// Routines that initialize Null-based engine implementation
+
+#include "pch.h"
+
+#include <array>
+#include <vector>
+
+#include "EngineFactoryNull.h"
+
+#include "EngineFactoryBase.hpp"
+#include "RenderDeviceNullImpl.hpp"
+#include "DeviceContextNullImpl.hpp"
+#include "CommandQueueNullImpl.hpp"
+
+#if PLATFORM_ANDROID
+#    include "FileSystem.hpp"
+#endif
+
+namespace Diligent
+{
+
+/// Engine factory for Null implementation
+class EngineFactoryNullImpl final : public EngineFactoryBase<IEngineFactoryNull>
+{
+public:
+    static EngineFactoryNullImpl* GetInstance()
+    {
+        static EngineFactoryNullImpl TheFactory;
+        return &TheFactory;
+    }
+
+    using TBase = EngineFactoryBase<IEngineFactoryNull>;
+
+    EngineFactoryNullImpl() :
+        TBase{IID_EngineFactoryNull}
+    {}
+
+    void DILIGENT_CALL_TYPE EnumerateAdapters(Version              MinVersion,
+                                              Uint32&              NumAdapters,
+                                              GraphicsAdapterInfo* Adapters) const override final;
+
+    void DILIGENT_CALL_TYPE CreateDearchiver(const DearchiverCreateInfo& CreateInfo,
+                                             IDearchiver**               ppDearchiver) const override final;
+
+    void DILIGENT_CALL_TYPE CreateDeviceAndContextsNull(const EngineCreateInfo& EngineCI,
+                                                        IRenderDevice**         ppDevice,
+                                                        IDeviceContext**        ppContexts) override final;
+
+#if PLATFORM_ANDROID
+    virtual void InitAndroidFileSystem(struct AAssetManager* AssetManager,
+                                       const char*           ExternalFilesDir,
+                                       const char*           OutputFilesDir) const override final;
+#endif
+};
+
+namespace
+{
+
+GraphicsAdapterInfo GetNullAdapterInfo()
+{
+    GraphicsAdapterInfo AdapterInfo;
+
+    // Set graphics adapter properties
+    {
+        static constexpr char AdapterName[] = "Diligent Null Adapter";
+        static_assert(sizeof(AdapterName) <= sizeof(AdapterInfo.Description), "Adapter name is too long");
+        memcpy(AdapterInfo.Description, AdapterName, sizeof(AdapterName));
+
+        AdapterInfo.Type       = ADAPTER_TYPE_SOFTWARE;
+        AdapterInfo.Vendor     = ADAPTER_VENDOR_UNKNOWN;
+        AdapterInfo.NumOutputs = 0;
+    }
+
+    // Enable features
+    {
+        // Null backend validates API usage only, so all features that do not
+        // require backend-specific object implementations are reported as enabled.
+        DeviceFeatures& Features{AdapterInfo.Features};
+        Features = DeviceFeatures{DEVICE_FEATURE_STATE_ENABLED};
+
+        Features.MeshShaders                   = DEVICE_FEATURE_STATE_DISABLED;
+        Features.RayTracing                    = DEVICE_FEATURE_STATE_DISABLED;
+        Features.WaveOp                        = DEVICE_FEATURE_STATE_DISABLED;
+        Features.NativeFence                   = DEVICE_FEATURE_STATE_DISABLED;
+        Features.TileShaders                   = DEVICE_FEATURE_STATE_DISABLED;
+        Features.TransferQueueTimestampQueries = DEVICE_FEATURE_STATE_DISABLED;
+        Features.VariableRateShading           = DEVICE_FEATURE_STATE_DISABLED;
+        Features.SparseResources               = DEVICE_FEATURE_STATE_DISABLED;
+        Features.SubpassFramebufferFetch       = DEVICE_FEATURE_STATE_DISABLED;
+        Features.NativeMultiDraw               = DEVICE_FEATURE_STATE_DISABLED;
+    }
+    ASSERT_SIZEOF(DeviceFeatures, 46, "Did you add a new feature to DeviceFeatures? Please handle its status here.");
+
+    // Set memory properties
+    {
+        AdapterMemoryInfo& MemoryInfo{AdapterInfo.Memory};
+        MemoryInfo.UnifiedMemory          = 0;
+        MemoryInfo.UnifiedMemoryCPUAccess = CPU_ACCESS_NONE;
+    }
+
+    // Draw command properties
+    {
+        DrawCommandProperties& DrawCommandInfo{AdapterInfo.DrawCommand};
+        DrawCommandInfo.MaxIndexValue        = ~0u;
+        DrawCommandInfo.MaxDrawIndirectCount = ~0u;
+        DrawCommandInfo.CapFlags =
+            DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT |
+            DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT_FIRST_INSTANCE |
+            DRAW_COMMAND_CAP_FLAG_BASE_VERTEX |
+            DRAW_COMMAND_CAP_FLAG_DRAW_INDIRECT_COUNTER_BUFFER;
+    }
+
+    // Set queue info
+    {
+        AdapterInfo.NumQueues = 1;
+
+        CommandQueueInfo& Queue{AdapterInfo.Queues[0]};
+        Queue.QueueType                 = COMMAND_QUEUE_TYPE_GRAPHICS;
+        Queue.MaxDeviceContexts         = MAX_COMMAND_QUEUES - 1;
+        Queue.TextureCopyGranularity[0] = 1;
+        Queue.TextureCopyGranularity[1] = 1;
+        Queue.TextureCopyGranularity[2] = 1;
+    }
+
+    // Set compute shader info
+    {
+        ComputeShaderProperties& ComputeShaderInfo{AdapterInfo.ComputeShader};
+
+        ComputeShaderInfo.SharedMemorySize          = 32u << 10;
+        ComputeShaderInfo.MaxThreadGroupInvocations = 1024;
+        ComputeShaderInfo.MaxThreadGroupSizeX       = 1024;
+        ComputeShaderInfo.MaxThreadGroupSizeY       = 1024;
+        ComputeShaderInfo.MaxThreadGroupSizeZ       = 64;
+        ComputeShaderInfo.MaxThreadGroupCountX      = 65535;
+        ComputeShaderInfo.MaxThreadGroupCountY      = 65535;
+        ComputeShaderInfo.MaxThreadGroupCountZ      = 65535;
+    }
+
+    // Set texture info
+    {
+        TextureProperties& TextureInfo{AdapterInfo.Texture};
+
+        TextureInfo.MaxTexture1DDimension      = 16384;
+        TextureInfo.MaxTexture1DArraySlices    = 2048;
+        TextureInfo.MaxTexture2DDimension      = 16384;
+        TextureInfo.MaxTexture2DArraySlices    = 2048;
+        TextureInfo.MaxTexture3DDimension      = 2048;
+        TextureInfo.MaxTextureCubeDimension    = 16384;
+        TextureInfo.Texture2DMSSupported       = True;
+        TextureInfo.Texture2DMSArraySupported  = True;
+        TextureInfo.TextureViewSupported       = True;
+        TextureInfo.CubemapArraysSupported     = True;
+        TextureInfo.TextureView2DOn3DSupported = True;
+    }
+
+    // Set buffer info
+    {
+        BufferProperties& BufferInfo{AdapterInfo.Buffer};
+
+        BufferInfo.ConstantBufferOffsetAlignment   = 256;
+        BufferInfo.StructuredBufferOffsetAlignment = 16;
+    }
+
+    // Set sampler info
+    {
+        SamplerProperties& SamplerInfo{AdapterInfo.Sampler};
+
+        SamplerInfo.BorderSamplingModeSupported = True;
+        SamplerInfo.MaxAnisotropy               = 16;
+        SamplerInfo.LODBiasSupported            = True;
+    }
+
+    return AdapterInfo;
+}
+
+} // namespace
+
+void EngineFactoryNullImpl::EnumerateAdapters(Version              MinVersion,
+                                              Uint32&              NumAdapters,
+                                              GraphicsAdapterInfo* Adapters) const
+{
+    if (Adapters == nullptr)
+        NumAdapters = 1;
+    else
+    {
+        NumAdapters = std::min(NumAdapters, 1u);
+        if (NumAdapters > 0)
+            Adapters[0] = GetNullAdapterInfo();
+    }
+}
+
+void EngineFactoryNullImpl::CreateDearchiver(const DearchiverCreateInfo& CreateInfo,
+                                             IDearchiver**               ppDearchiver) const
+{
+    DEV_CHECK_ERR(ppDearchiver != nullptr, "ppDearchiver must not be null");
+    if (ppDearchiver != nullptr)
+        *ppDearchiver = nullptr;
+
+    LOG_ERROR_MESSAGE("Dearchiver is not supported in Null backend");
+}
+
+void EngineFactoryNullImpl::CreateDeviceAndContextsNull(const EngineCreateInfo& EngineCI,
+                                                        IRenderDevice**         ppDevice,
+                                                        IDeviceContext**        ppContexts)
+{
+    if (EngineCI.EngineAPIVersion != DILIGENT_API_VERSION)
+    {
+        LOG_ERROR_MESSAGE("Diligent Engine runtime (", DILIGENT_API_VERSION, ") is not compatible with the client API version (", EngineCI.EngineAPIVersion, ")");
+        return;
+    }
+
+    VERIFY(ppDevice && ppContexts, "Null pointer provided");
+    if (!ppDevice || !ppContexts)
+        return;
+
+    if (EngineCI.AdapterId != DEFAULT_ADAPTER_ID && EngineCI.AdapterId != 0)
+    {
+        LOG_ERROR_MESSAGE(EngineCI.AdapterId, " is not a valid adapter id. Null backend only exposes a single adapter.");
+        return;
+    }
+
+    ImmediateContextCreateInfo DefaultImmediateCtxCI;
+    DefaultImmediateCtxCI.QueueId = 0;
+
+    const Uint32                            NumImmediateContexts  = EngineCI.NumImmediateContexts > 0 ? EngineCI.NumImmediateContexts : 1;
+    const ImmediateContextCreateInfo* const pImmediateContextInfo = EngineCI.NumImmediateContexts > 0 ? EngineCI.pImmediateContextInfo : &DefaultImmediateCtxCI;
+
+    *ppDevice = nullptr;
+    memset(ppContexts, 0, sizeof(*ppContexts) * (size_t{NumImmediateContexts} + size_t{EngineCI.NumDeferredContexts}));
+
+    try
+    {
+        const GraphicsAdapterInfo AdapterInfo = GetNullAdapterInfo();
+        VerifyEngineCreateInfo(EngineCI, AdapterInfo);
+
+        SetRawAllocator(EngineCI.pRawMemAllocator);
+        IMemoryAllocator& RawMemAllocator = GetRawAllocator();
+
+        std::vector<RefCntAutoPtr<CommandQueueNullImpl>> CommandQueuesNull(NumImmediateContexts);
+        std::vector<CommandQueueNullImpl*>               CommandQueues(NumImmediateContexts);
+        for (Uint32 CtxInd = 0; CtxInd < NumImmediateContexts; ++CtxInd)
+        {
+            CommandQueuesNull[CtxInd] = NEW_RC_OBJ(RawMemAllocator, "CommandQueueNull instance", CommandQueueNullImpl)();
+            CommandQueues[CtxInd]     = CommandQueuesNull[CtxInd];
+        }
+
+        RenderDeviceNullImpl* pRenderDeviceNull{
+            NEW_RC_OBJ(RawMemAllocator, "RenderDeviceNullImpl instance", RenderDeviceNullImpl)(
+                RawMemAllocator, this, EngineCI, AdapterInfo, CommandQueues.size(), CommandQueues.data()) //
+        };
+        pRenderDeviceNull->QueryInterface(IID_RenderDevice, reinterpret_cast<IObject**>(ppDevice));
+
+        for (Uint32 CtxInd = 0; CtxInd < NumImmediateContexts; ++CtxInd)
+        {
+            RefCntAutoPtr<DeviceContextNullImpl> pImmediateCtxNull{
+                NEW_RC_OBJ(RawMemAllocator, "DeviceContextNullImpl instance", DeviceContextNullImpl)(
+                    pRenderDeviceNull,
+                    DeviceContextDesc{
+                        pImmediateContextInfo[CtxInd].Name,
+                        AdapterInfo.Queues[0].QueueType,
+                        false,  // IsDeferred
+                        CtxInd, // Context id
+                        0       // Queue id
+                    }           //
+                    )};
+            // We must call AddRef() (implicitly through QueryInterface()) because pRenderDeviceNull will
+            // keep a weak reference to the context
+            pImmediateCtxNull->QueryInterface(IID_DeviceContext, reinterpret_cast<IObject**>(ppContexts + CtxInd));
+            pRenderDeviceNull->SetImmediateContext(CtxInd, pImmediateCtxNull);
+        }
+
+        for (Uint32 DeferredCtx = 0; DeferredCtx < EngineCI.NumDeferredContexts; ++DeferredCtx)
+        {
+            RefCntAutoPtr<DeviceContextNullImpl> pDeferredCtxNull{
+                NEW_RC_OBJ(RawMemAllocator, "DeviceContextNullImpl instance", DeviceContextNullImpl)(
+                    pRenderDeviceNull,
+                    DeviceContextDesc{
+                        nullptr,
+                        COMMAND_QUEUE_TYPE_UNKNOWN,
+                        true,                              // IsDeferred
+                        NumImmediateContexts + DeferredCtx // Context id
+                    }                                      //
+                    )};
+            // We must call AddRef() (implicitly through QueryInterface()) because pRenderDeviceNull will
+            // keep a weak reference to the context
+            pDeferredCtxNull->QueryInterface(IID_DeviceContext, reinterpret_cast<IObject**>(ppContexts + NumImmediateContexts + DeferredCtx));
+            pRenderDeviceNull->SetDeferredContext(DeferredCtx, pDeferredCtxNull);
+        }
+    }
+    catch (const std::runtime_error&)
+    {
+        if (*ppDevice)
+        {
+            (*ppDevice)->Release();
+            *ppDevice = nullptr;
+        }
+        for (Uint32 ctx = 0; ctx < NumImmediateContexts + EngineCI.NumDeferredContexts; ++ctx)
+        {
+            if (ppContexts[ctx] != nullptr)
+            {
+                ppContexts[ctx]->Release();
+                ppContexts[ctx] = nullptr;
+            }
+        }
+
+        LOG_ERROR("Failed to create Null render device and contexts");
+    }
+}
+
+#if PLATFORM_ANDROID
+void EngineFactoryNullImpl::InitAndroidFileSystem(struct AAssetManager* AssetManager,
+                                                  const char*           ExternalFilesDir,
+                                                  const char*           OutputFilesDir) const
+{
+    AndroidFileSystem::Init(AssetManager, ExternalFilesDir, OutputFilesDir);
+}
+#endif
+
+API_QUALIFIER IEngineFactoryNull* GetEngineFactoryNull()
+{
+    return EngineFactoryNullImpl::GetInstance();
+}
+
+} // namespace Diligent
+
+extern "C"
+{
+    API_QUALIFIER Diligent::IEngineFactoryNull* Diligent_GetEngineFactoryNull()
+    {
+        return Diligent::GetEngineFactoryNull();
+    }
+}
@@ -0,0 +1,214 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "PipelineResourceSignatureNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+
+namespace Diligent
+{
+
+PipelineResourceSignatureNullImpl::PipelineResourceSignatureNullImpl(IReferenceCounters*                  pRefCounters,
+                                                                     RenderDeviceNullImpl*                pDevice,
+                                                                     const PipelineResourceSignatureDesc& Desc,
+                                                                     SHADER_TYPE                          ShaderStages,
+                                                                     bool                                 bIsDeviceInternal) :
+    TPipelineResourceSignatureBase{pRefCounters, pDevice, Desc, ShaderStages, bIsDeviceInternal}
+{
+    try
+    {
+        Initialize(
+            GetRawAllocator(), DecoupleCombinedSamplers(Desc), /*CreateImmutableSamplers = */ true,
+            [this]() //
+            {
+                CreateLayout(/*IsSerialized*/ false);
+            },
+            [this]() //
+            {
+                return ShaderResourceCacheNull::GetRequiredMemorySize(m_SRBCacheSize);
+            });
+    }
+    catch (...)
+    {
+        Destruct();
+        throw;
+    }
+}
+
+PipelineResourceSignatureNullImpl::PipelineResourceSignatureNullImpl(IReferenceCounters*                              pRefCounters,
+                                                                     RenderDeviceNullImpl*                            pDevice,
+                                                                     const PipelineResourceSignatureDesc&             Desc,
+                                                                     const PipelineResourceSignatureInternalDataNull& InternalData) :
+    TPipelineResourceSignatureBase{pRefCounters, pDevice, Desc, InternalData}
+{
+    try
+    {
+        Deserialize(
+            GetRawAllocator(), DecoupleCombinedSamplers(Desc), InternalData, /*CreateImmutableSamplers = */ true,
+            [this]() //
+            {
+                CreateLayout(/*IsSerialized*/ true);
+            },
+            [this]() //
+            {
+                return ShaderResourceCacheNull::GetRequiredMemorySize(m_SRBCacheSize);
+            });
+    }
+    catch (...)
+    {
+        Destruct();
+        throw;
+    }
+}
+
+PipelineResourceSignatureNullImpl::~PipelineResourceSignatureNullImpl()
+{
+    Destruct();
+}
+
+void PipelineResourceSignatureNullImpl::CreateLayout(const bool IsSerialized)
+{
+    // Current offsets in the SRB and static resource caches
+    Uint32 SRBCacheOffset    = 0;
+    Uint32 StaticCacheOffset = 0;
+
+    for (Uint32 i = 0; i < m_Desc.NumResources; ++i)
+    {
+        const PipelineResourceDesc& ResDesc = m_Desc.Resources[i];
+        VERIFY(i == 0 || ResDesc.VarType >= m_Desc.Resources[i - 1].VarType, "Resources must be sorted by variable type");
+
+        Uint32 AssignedSamplerInd     = ResourceAttribs::InvalidSamplerInd;
+        Uint32 SrcImmutableSamplerInd = InvalidImmutableSamplerIndex;
+        if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_TEXTURE_SRV)
+        {
+            AssignedSamplerInd = FindAssignedSampler(ResDesc, ResourceAttribs::InvalidSamplerInd);
+            if (AssignedSamplerInd != ResourceAttribs::InvalidSamplerInd)
+            {
+                const PipelineResourceDesc& SamplerResDesc = m_Desc.Resources[AssignedSamplerInd];
+                SrcImmutableSamplerInd                     = FindImmutableSampler(SamplerResDesc.ShaderStages, SamplerResDesc.Name);
+            }
+        }
+        else if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER)
+        {
+            SrcImmutableSamplerInd = FindImmutableSampler(ResDesc.ShaderStages, ResDesc.Name);
+        }
+
+        // Immutable samplers do not occupy space in the resource cache
+        const bool IsImmutableSampler = (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER && SrcImmutableSamplerInd != InvalidImmutableSamplerIndex);
+        const bool IsStaticResource   = (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC && !IsImmutableSampler);
+
+        const Uint32 ResSRBCacheOffset    = IsImmutableSampler ? ~0u : SRBCacheOffset;
+        const Uint32 ResStaticCacheOffset = IsStaticResource ? StaticCacheOffset : ~0u;
+
+        auto* const pAttribs = m_pResourceAttribs + i;
+        if (!IsSerialized)
+        {
+            new (pAttribs) ResourceAttribs{
+                AssignedSamplerInd,
+                SrcImmutableSamplerInd != InvalidImmutableSamplerIndex,
+                ResSRBCacheOffset,
+                ResStaticCacheOffset,
+            };
+        }
+        else
+        {
+            DEV_CHECK_ERR(pAttribs->SamplerInd == AssignedSamplerInd,
+                          "Deserialized sampler index (", pAttribs->SamplerInd, ") is invalid: ", AssignedSamplerInd, " is expected.");
+            DEV_CHECK_ERR(pAttribs->IsImmutableSamplerAssigned() == (SrcImmutableSamplerInd != InvalidImmutableSamplerIndex), "Deserialized immutable sampler flag is invalid");
+            DEV_CHECK_ERR(pAttribs->SRBCacheOffset == ResSRBCacheOffset,
+                          "Deserialized SRB cache offset (", pAttribs->SRBCacheOffset, ") is invalid: ", ResSRBCacheOffset, " is expected.");
+            DEV_CHECK_ERR(pAttribs->StaticCacheOffset == ResStaticCacheOffset,
+                          "Deserialized static cache offset (", pAttribs->StaticCacheOffset, ") is invalid: ", ResStaticCacheOffset, " is expected.");
+        }
+
+        if (!IsImmutableSampler)
+            SRBCacheOffset += ResDesc.ArraySize;
+        if (IsStaticResource)
+            StaticCacheOffset += ResDesc.ArraySize;
+    }
+
+    m_SRBCacheSize = SRBCacheOffset;
+
+    if (m_pStaticResCache != nullptr)
+    {
+        m_pStaticResCache->Initialize(GetRawAllocator(), StaticCacheOffset);
+    }
+}
+
+void PipelineResourceSignatureNullImpl::InitSRBResourceCache(ShaderResourceCacheNull& ResourceCache)
+{
+    auto& CacheMemAllocator = m_SRBMemAllocator.GetResourceCacheDataAllocator(0);
+    ResourceCache.Initialize(CacheMemAllocator, m_SRBCacheSize);
+}
+
+void PipelineResourceSignatureNullImpl::CopyStaticResources(ShaderResourceCacheNull& DstResourceCache) const
+{
+    if (m_pStaticResCache == nullptr)
+        return;
+
+    // SrcResourceCache contains only static resources.
+    // In case of SRB, DstResourceCache contains static, mutable and dynamic resources.
+    // In case of Signature, DstResourceCache contains only static resources.
+    const ShaderResourceCacheNull&  SrcResourceCache = *m_pStaticResCache;
+    const std::pair<Uint32, Uint32> ResIdxRange      = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+    const ResourceCacheContentType  SrcCacheType     = SrcResourceCache.GetContentType();
+    const ResourceCacheContentType  DstCacheType     = DstResourceCache.GetContentType();
+
+    for (Uint32 r = ResIdxRange.first; r < ResIdxRange.second; ++r)
+    {
+        const PipelineResourceDesc& ResDesc = GetResourceDesc(r);
+        const ResourceAttribs&      Attr    = GetResourceAttribs(r);
+        VERIFY_EXPR(ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+
+        if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER && Attr.IsImmutableSamplerAssigned())
+            continue; // Skip immutable samplers
+
+        for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
+        {
+            const ShaderResourceCacheNull::Resource& SrcCachedRes = SrcResourceCache.GetResource(Attr.CacheOffset(SrcCacheType) + ArrInd);
+            if (!SrcCachedRes)
+            {
+                if (DstCacheType == ResourceCacheContentType::SRB)
+                    LOG_ERROR_MESSAGE("No resource is assigned to static shader variable '", GetShaderResourcePrintName(ResDesc, ArrInd), "' in pipeline resource signature '", m_Desc.Name, "'.");
+                continue;
+            }
+
+            const Uint32                             DstCacheOffset = Attr.CacheOffset(DstCacheType) + ArrInd;
+            const ShaderResourceCacheNull::Resource& DstCachedRes   = const_cast<const ShaderResourceCacheNull&>(DstResourceCache).GetResource(DstCacheOffset);
+            if (DstCachedRes.pObject != SrcCachedRes.pObject)
+            {
+                DEV_CHECK_ERR(!DstCachedRes, "Static resource has already been initialized, and the new resource does not match previously assigned resource");
+                DstResourceCache.SetResource(DstCacheOffset,
+                                             SrcCachedRes.pObject,
+                                             SrcCachedRes.BufferBaseOffset,
+                                             SrcCachedRes.BufferRangeSize);
+            }
+        }
+    }
+}
+
+} // namespace Diligent
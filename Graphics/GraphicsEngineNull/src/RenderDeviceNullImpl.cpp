@@ -0,0 +1,329 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "RenderDeviceNullImpl.hpp"
+#include "DeviceContextNullImpl.hpp"
+#include "BufferNullImpl.hpp"
+#include "BufferViewNullImpl.hpp"
+#include "TextureNullImpl.hpp"
+#include "TextureViewNullImpl.hpp"
+#include "SamplerNullImpl.hpp"
+#include "ShaderNullImpl.hpp"
+#include "PipelineStateNullImpl.hpp"
+#include "PipelineResourceSignatureNullImpl.hpp"
+#include "ShaderResourceBindingNullImpl.hpp"
+#include "FenceNullImpl.hpp"
+#include "QueryNullImpl.hpp"
+#include "RenderPassNullImpl.hpp"
+#include "FramebufferNullImpl.hpp"
+
+namespace Diligent
+{
+
+class BottomLevelASNullImpl
+{};
+
+class TopLevelASNullImpl
+{};
+
+class ShaderBindingTableNullImpl
+{};
+
+class DeviceMemoryNullImpl
+{};
+
+RenderDeviceNullImpl::RenderDeviceNullImpl(IReferenceCounters*        pRefCounters,
+                                           IMemoryAllocator&          RawMemAllocator,
+                                           IEngineFactory*            pEngineFactory,
+                                           const EngineCreateInfo&    EngineCI,
+                                           const GraphicsAdapterInfo& AdapterInfo,
+                                           size_t                     CommandQueueCount,
+                                           CommandQueueNullImpl**     ppCmdQueues) :
+    // clang-format off
+    TRenderDeviceBase
+    {
+        pRefCounters,
+        RawMemAllocator,
+        pEngineFactory,
+        CommandQueueCount,
+        ppCmdQueues,
+        EngineCI,
+        AdapterInfo
+    }
+// clang-format on
+{
+    m_DeviceInfo.Type = RENDER_DEVICE_TYPE_NULL;
+    m_DeviceInfo.NDC  = NDCAttribs{0.0f, 1.0f, -0.5f};
+
+    m_DeviceInfo.Features = EnableDeviceFeatures(m_AdapterInfo.Features, EngineCI.Features);
+
+    InitTextureFormats();
+
+    InitShaderCompilationThreadPool(EngineCI.pAsyncShaderCompilationThreadPool, EngineCI.NumAsyncShaderCompilationThreads);
+}
+
+RenderDeviceNullImpl::~RenderDeviceNullImpl()
+{
+    // There is no GPU work to wait for, but all stale resources
+    // must be released before the command queues are destroyed.
+    IdleGPU();
+
+    ReleaseStaleResources(true);
+}
+
+void RenderDeviceNullImpl::CreateBuffer(const BufferDesc& BuffDesc,
+                                        const BufferData* pBuffData,
+                                        IBuffer**         ppBuffer,
+                                        bool              IsDeviceInternal)
+{
+    CreateBufferImpl(ppBuffer, BuffDesc, pBuffData, IsDeviceInternal);
+}
+
+void RenderDeviceNullImpl::CreateBuffer(const BufferDesc& BuffDesc,
+                                        const BufferData* pBuffData,
+                                        IBuffer**         ppBuffer)
+{
+    CreateBuffer(BuffDesc, pBuffData, ppBuffer, false);
+}
+
+void RenderDeviceNullImpl::CreateTexture(const TextureDesc& TexDesc,
+                                         const TextureData* pData,
+                                         ITexture**         ppTexture)
+{
+    CreateTexture(TexDesc, pData, ppTexture, false);
+}
+
+void RenderDeviceNullImpl::CreateTexture(const TextureDesc& TexDesc,
+                                         const TextureData* pData,
+                                         ITexture**         ppTexture,
+                                         bool               IsDeviceInternal)
+{
+    CreateTextureImpl(ppTexture, TexDesc, pData, IsDeviceInternal);
+}
+
+void RenderDeviceNullImpl::CreateSampler(const SamplerDesc& SamplerDesc,
+                                         ISampler**         ppSampler,
+                                         bool               IsDeviceInternal)
+{
+    CreateSamplerImpl(ppSampler, SamplerDesc, IsDeviceInternal);
+}
+
+void RenderDeviceNullImpl::CreateSampler(const SamplerDesc& SamplerDesc,
+                                         ISampler**         ppSampler)
+{
+    CreateSampler(SamplerDesc, ppSampler, false);
+}
+
+void RenderDeviceNullImpl::CreateShader(const ShaderCreateInfo& ShaderCI,
+                                        IShader**               ppShader,
+                                        IDataBlob**             ppCompilerOutput)
+{
+    const ShaderNullImpl::CreateInfo NullShaderCI{
+        GetDeviceInfo(),
+        GetAdapterInfo(),
+        ppCompilerOutput,
+        m_pShaderCompilationThreadPool,
+    };
+    CreateShaderImpl(ppShader, ShaderCI, NullShaderCI);
+}
+
+void RenderDeviceNullImpl::CreatePipelineResourceSignature(const PipelineResourceSignatureDesc& Desc,
+                                                           IPipelineResourceSignature**         ppSignature)
+{
+    CreatePipelineResourceSignature(Desc, ppSignature, SHADER_TYPE_UNKNOWN, false);
+}
+
+void RenderDeviceNullImpl::CreatePipelineResourceSignature(const PipelineResourceSignatureDesc& Desc,
+                                                           IPipelineResourceSignature**         ppSignature,
+                                                           SHADER_TYPE                          ShaderStages,
+                                                           bool                                 IsDeviceInternal)
+{
+    CreatePipelineResourceSignatureImpl(ppSignature, Desc, ShaderStages, IsDeviceInternal);
+}
+
+void RenderDeviceNullImpl::CreatePipelineResourceSignature(const PipelineResourceSignatureDesc&             Desc,
+                                                           const PipelineResourceSignatureInternalDataNull& InternalData,
+                                                           IPipelineResourceSignature**                     ppSignature)
+{
+    CreatePipelineResourceSignatureImpl(ppSignature, Desc, InternalData);
+}
+
+void RenderDeviceNullImpl::CreateGraphicsPipelineState(const GraphicsPipelineStateCreateInfo& PSOCreateInfo,
+                                                       IPipelineState**                       ppPipelineState)
+{
+    CreatePipelineStateImpl(ppPipelineState, PSOCreateInfo);
+}
+
+void RenderDeviceNullImpl::CreateComputePipelineState(const ComputePipelineStateCreateInfo& PSOCreateInfo,
+                                                      IPipelineState**                      ppPipelineState)
+{
+    CreatePipelineStateImpl(ppPipelineState, PSOCreateInfo);
+}
+
+void RenderDeviceNullImpl::CreateRayTracingPipelineState(const RayTracingPipelineStateCreateInfo& PSOCreateInfo,
+                                                         IPipelineState**                         ppPipelineState)
+{
+    UNSUPPORTED("Ray tracing is not supported in Null backend");
+    *ppPipelineState = nullptr;
+}
+
+void RenderDeviceNullImpl::CreateFence(const FenceDesc& Desc,
+                                       IFence**         ppFence)
+{
+    CreateFenceImpl(ppFence, Desc);
+}
+
+void RenderDeviceNullImpl::CreateQuery(const QueryDesc& Desc,
+                                       IQuery**         ppQuery)
+{
+    CreateQueryImpl(ppQuery, Desc);
+}
+
+void RenderDeviceNullImpl::CreateRenderPass(const RenderPassDesc& Desc,
+                                            IRenderPass**         ppRenderPass)
+{
+    CreateRenderPassImpl(ppRenderPass, Desc);
+}
+
+void RenderDeviceNullImpl::CreateFramebuffer(const FramebufferDesc& Desc,
+                                             IFramebuffer**         ppFramebuffer)
+{
+    CreateFramebufferImpl(ppFramebuffer, Desc);
+}
+
+void RenderDeviceNullImpl::CreateBLAS(const BottomLevelASDesc& Desc,
+                                      IBottomLevelAS**         ppBLAS)
+{
+    UNSUPPORTED("CreateBLAS is not supported in Null backend");
+    *ppBLAS = nullptr;
+}
+
+void RenderDeviceNullImpl::CreateTLAS(const TopLevelASDesc& Desc,
+                                      ITopLevelAS**         ppTLAS)
+{
+    UNSUPPORTED("CreateTLAS is not supported in Null backend");
+    *ppTLAS = nullptr;
+}
+
+void RenderDeviceNullImpl::CreateSBT(const ShaderBindingTableDesc& Desc,
+                                     IShaderBindingTable**         ppSBT)
+{
+    UNSUPPORTED("CreateSBT is not supported in Null backend");
+    *ppSBT = nullptr;
+}
+
+void RenderDeviceNullImpl::CreateDeviceMemory(const DeviceMemoryCreateInfo& CreateInfo,
+                                              IDeviceMemory**               ppMemory)
+{
+    UNSUPPORTED("CreateDeviceMemory is not supported in Null backend");
+    *ppMemory = nullptr;
+}
+
+void RenderDeviceNullImpl::CreatePipelineStateCache(const PipelineStateCacheCreateInfo& CreateInfo,
+                                                    IPipelineStateCache**               ppPSOCache)
+{
+    *ppPSOCache = nullptr;
+}
+
+SparseTextureFormatInfo RenderDeviceNullImpl::GetSparseTextureFormatInfo(TEXTURE_FORMAT     TexFormat,
+                                                                         RESOURCE_DIMENSION Dimension,
+                                                                         Uint32             SampleCount) const
+{
+    UNSUPPORTED("GetSparseTextureFormatInfo is not supported in Null backend");
+    return {};
+}
+
+void RenderDeviceNullImpl::ReleaseStaleResources(bool ForceRelease)
+{
+    PurgeReleaseQueues(ForceRelease);
+}
+
+void RenderDeviceNullImpl::IdleGPU()
+{
+    IdleAllCommandQueues(true);
+    ReleaseStaleResources();
+}
+
+void RenderDeviceNullImpl::FlushStaleResources(SoftwareQueueIndex CmdQueueIndex)
+{
+    // Null command queue completes every submission immediately, so
+    // stale resources can be purged right after they are discarded.
+    TRenderDeviceBase::SubmitCommandBuffer(CmdQueueIndex, true);
+    PurgeReleaseQueue(CmdQueueIndex);
+}
+
+void RenderDeviceNullImpl::TestTextureFormat(TEXTURE_FORMAT TexFormat)
+{
+    VERIFY(m_TextureFormatsInfo[TexFormat].Supported, "Texture format is not supported");
+}
+
+void RenderDeviceNullImpl::InitTextureFormats()
+{
+    constexpr SAMPLE_COUNT SupportedSampleCounts = SAMPLE_COUNT_1 | SAMPLE_COUNT_2 | SAMPLE_COUNT_4 | SAMPLE_COUNT_8;
+
+    // Null device does not store texel data, so every format is reported as supported
+    // with the widest set of capabilities allowed by the format's component type.
+    for (Uint32 Fmt = TEX_FORMAT_UNKNOWN + 1; Fmt < TEX_FORMAT_NUM_FORMATS; ++Fmt)
+    {
+        TextureFormatInfoExt& FmtInfo = m_TextureFormatsInfo[Fmt];
+
+        FmtInfo.Supported = true;
+
+        // clang-format off
+        FmtInfo.Dimensions =
+            RESOURCE_DIMENSION_SUPPORT_TEX_2D       |
+            RESOURCE_DIMENSION_SUPPORT_TEX_2D_ARRAY |
+            RESOURCE_DIMENSION_SUPPORT_TEX_CUBE     |
+            RESOURCE_DIMENSION_SUPPORT_TEX_CUBE_ARRAY;
+        // clang-format on
+
+        if (FmtInfo.ComponentType == COMPONENT_TYPE_COMPRESSED)
+        {
+            FmtInfo.BindFlags    = BIND_SHADER_RESOURCE;
+            FmtInfo.SampleCounts = SAMPLE_COUNT_1;
+        }
+        else if (FmtInfo.IsDepthStencil())
+        {
+            FmtInfo.BindFlags    = BIND_SHADER_RESOURCE | BIND_DEPTH_STENCIL;
+            FmtInfo.SampleCounts = SupportedSampleCounts;
+        }
+        else
+        {
+            FmtInfo.BindFlags    = BIND_SHADER_RESOURCE | BIND_RENDER_TARGET | BIND_UNORDERED_ACCESS;
+            FmtInfo.SampleCounts = SupportedSampleCounts;
+            // clang-format off
+            FmtInfo.Dimensions |=
+                RESOURCE_DIMENSION_SUPPORT_TEX_1D       |
+                RESOURCE_DIMENSION_SUPPORT_TEX_1D_ARRAY |
+                RESOURCE_DIMENSION_SUPPORT_TEX_3D;
+            // clang-format on
+        }
+    }
+}
+
+} // namespace Diligent
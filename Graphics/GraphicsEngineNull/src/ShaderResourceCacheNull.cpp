@@ -0,0 +1,119 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "ShaderResourceCacheNull.hpp"
+#include "EngineMemory.h"
+#include "Buffer.h"
+#include "BufferView.h"
+
+namespace Diligent
+{
+
+namespace
+{
+
+bool IsDynamicBuffer(IDeviceObject* pObject)
+{
+    if (pObject == nullptr)
+        return false;
+
+    RefCntAutoPtr<IBuffer> pBuffer{pObject, IID_Buffer};
+    if (!pBuffer)
+    {
+        if (RefCntAutoPtr<IBufferView> pBuffView{pObject, IID_BufferView})
+            pBuffer = pBuffView->GetBuffer();
+    }
+    return pBuffer && pBuffer->GetDesc().Usage == USAGE_DYNAMIC;
+}
+
+} // namespace
+
+ShaderResourceCacheNull::~ShaderResourceCacheNull()
+{
+    if (m_pMemory)
+    {
+        for (Uint32 res = 0; res < m_NumResources; ++res)
+            m_pResources[res].~Resource();
+    }
+}
+
+void ShaderResourceCacheNull::Initialize(IMemoryAllocator& MemAllocator, Uint32 NumResources)
+{
+    VERIFY(!m_pMemory, "Memory has already been allocated");
+
+    m_NumResources = NumResources;
+
+    const size_t MemorySize = GetRequiredMemorySize(NumResources);
+    if (MemorySize > 0)
+    {
+        m_pMemory = decltype(m_pMemory){
+            ALLOCATE_RAW(MemAllocator, "Memory for shader resource cache data", MemorySize),
+            STDDeleter<void, IMemoryAllocator>(MemAllocator),
+        };
+        memset(m_pMemory.get(), 0, MemorySize);
+
+        m_pResources = reinterpret_cast<Resource*>(m_pMemory.get());
+        for (Uint32 res = 0; res < m_NumResources; ++res)
+            new (m_pResources + res) Resource{};
+    }
+}
+
+void ShaderResourceCacheNull::SetResource(Uint32                       CacheOffset,
+                                          RefCntAutoPtr<IDeviceObject> pObject,
+                                          Uint64                       BufferBaseOffset,
+                                          Uint64                       BufferRangeSize)
+{
+    VERIFY(CacheOffset < m_NumResources, "Offset ", CacheOffset, " is out of range");
+    Resource& DstRes = m_pResources[CacheOffset];
+
+    if (IsDynamicBuffer(DstRes.pObject))
+    {
+        VERIFY_EXPR(m_NumDynamicBuffers > 0);
+        --m_NumDynamicBuffers;
+    }
+
+    DstRes.pObject             = std::move(pObject);
+    DstRes.BufferBaseOffset    = BufferBaseOffset;
+    DstRes.BufferRangeSize     = BufferRangeSize;
+    DstRes.BufferDynamicOffset = 0;
+
+    if (IsDynamicBuffer(DstRes.pObject))
+        ++m_NumDynamicBuffers;
+
+    UpdateRevision();
+}
+
+void ShaderResourceCacheNull::SetDynamicBufferOffset(Uint32 CacheOffset, Uint32 DynamicBufferOffset)
+{
+    VERIFY(CacheOffset < m_NumResources, "Offset ", CacheOffset, " is out of range");
+    Resource& DstRes = m_pResources[CacheOffset];
+    VERIFY(DstRes.pObject, "Setting dynamic offset when no object is bound");
+    DstRes.BufferDynamicOffset = DynamicBufferOffset;
+}
+
+} // namespace Diligent
@@ -0,0 +1,119 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "TextureNullImpl.hpp"
+#include "RenderDeviceNullImpl.hpp"
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+TextureNullImpl::TextureNullImpl(IReferenceCounters*        pRefCounters,
+                                 FixedBlockMemoryAllocator& TexViewObjAllocator,
+                                 RenderDeviceNullImpl*      pDevice,
+                                 const TextureDesc&         Desc,
+                                 const TextureData*         pInitData,
+                                 bool                       bIsDeviceInternal) :
+    TTextureBase{pRefCounters, TexViewObjAllocator, pDevice, Desc, bIsDeviceInternal}
+{
+    if (m_Desc.Usage == USAGE_SPARSE)
+        LOG_ERROR_AND_THROW("Sparse textures are not supported in Null backend");
+
+    if (m_Desc.Usage == USAGE_STAGING)
+    {
+        const Uint32                ArraySize  = m_Desc.GetArraySize();
+        const TextureFormatAttribs& FmtAttribs = GetTextureFormatAttribs(m_Desc.Format);
+        m_CPUData.resize(StaticCast<size_t>(GetStagingTextureSubresourceOffset(m_Desc, ArraySize, 0, StagingDataAlignment)));
+
+        if (pInitData != nullptr && pInitData->pSubResources != nullptr)
+        {
+            Uint32 SubRes = 0;
+            for (Uint32 Slice = 0; Slice < ArraySize; ++Slice)
+            {
+                for (Uint32 Mip = 0; Mip < m_Desc.MipLevels; ++Mip, ++SubRes)
+                {
+                    if (SubRes >= pInitData->NumSubresources)
+                        break;
+
+                    const TextureSubResData& SubResData = pInitData->pSubResources[SubRes];
+                    if (SubResData.pData == nullptr)
+                        continue;
+
+                    const MipLevelProperties MipProps  = GetMipLevelProperties(m_Desc, Mip);
+                    const Uint32             RowCount  = MipProps.StorageHeight / FmtAttribs.BlockHeight;
+                    const Uint64             DstOffset = GetStagingTextureSubresourceOffset(m_Desc, Slice, Mip, StagingDataAlignment);
+                    for (Uint32 z = 0; z < MipProps.Depth; ++z)
+                    {
+                        for (Uint32 row = 0; row < RowCount; ++row)
+                        {
+                            const Uint8* pSrc = static_cast<const Uint8*>(SubResData.pData) + z * SubResData.DepthStride + row * SubResData.Stride;
+                            Uint8*       pDst = m_CPUData.data() + DstOffset + z * MipProps.DepthSliceSize + row * MipProps.RowSize;
+                            memcpy(pDst, pSrc, StaticCast<size_t>(MipProps.RowSize));
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    SetState(RESOURCE_STATE_UNDEFINED);
+}
+
+void TextureNullImpl::CreateViewInternal(const TextureViewDesc& ViewDesc, ITextureView** ppView, bool bIsDefaultView)
+{
+    VERIFY(ppView != nullptr, "View pointer address is null");
+    if (!ppView) return;
+    VERIFY(*ppView == nullptr, "Overwriting reference to existing object may cause memory leaks");
+
+    *ppView = nullptr;
+
+    try
+    {
+        auto& TexViewAllocator = m_pDevice->GetTexViewObjAllocator();
+        VERIFY(&TexViewAllocator == &m_dbgTexViewObjAllocator, "Texture view allocator does not match allocator provided during texture initialization");
+
+        TextureViewDesc UpdatedViewDesc = ViewDesc;
+        ValidatedAndCorrectTextureViewDesc(m_Desc, UpdatedViewDesc);
+
+        TextureViewNullImpl* pViewNull = NEW_RC_OBJ(TexViewAllocator, "TextureViewNullImpl instance", TextureViewNullImpl, bIsDefaultView ? this : nullptr)(
+            GetDevice(), UpdatedViewDesc, this, bIsDefaultView, m_bIsDeviceInternal);
+        VERIFY(pViewNull->GetDesc().ViewType == ViewDesc.ViewType, "Incorrect view type");
+
+        if (bIsDefaultView)
+            *ppView = pViewNull;
+        else
+            pViewNull->QueryInterface(IID_TextureView, reinterpret_cast<IObject**>(ppView));
+    }
+    catch (const std::runtime_error&)
+    {
+        const char* ViewTypeName = GetTexViewTypeLiteralName(ViewDesc.ViewType);
+        LOG_ERROR("Failed to create view \"", ViewDesc.Name ? ViewDesc.Name : "", "\" (", ViewTypeName, ") for texture \"", m_Desc.Name ? m_Desc.Name : "", "\"");
+    }
+}
+
+} // namespace Diligent
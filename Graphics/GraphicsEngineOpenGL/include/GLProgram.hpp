@@ -42,9 +42,24 @@ class GLContextState;
 class GLProgram
 {
 public:
+    /// Program binary retrieved with glGetProgramBinary.
+    struct Binary
+    {
+        GLenum             Format = 0;
+        std::vector<Uint8> Data;
+    };
+
+    /// \param [in] ppShaders          - Shaders to link the program from.
+    /// \param [in] NumShaders         - The number of shaders.
+    /// \param [in] IsSeparableProgram - Whether the program is separable.
+    /// \param [in] pBinary            - Optional program binary. If the driver accepts it,
+    ///                                  the program is not linked from the shaders.
+    /// \param [in] RetrievableBinary  - Whether the program binary will be retrieved with GetBinary().
     GLProgram(ShaderGLImpl* const* ppShaders,
               Uint32               NumShaders,
-              bool                 IsSeparableProgram) noexcept;
+              bool                 IsSeparableProgram,
+              const Binary*        pBinary           = nullptr,
+              bool                 RetrievableBinary = false) noexcept;
     ~GLProgram();
 
     const GLObjectWrappers::GLProgramObj& GetGLHandle() const { return m_GLProg; }
@@ -77,13 +92,20 @@ public:
         return m_pResources;
     }
 
+    /// Retrieves the binary of a successfully linked program.
+    bool GetBinary(Binary& ProgBinary) const;
+
+    /// Returns true if the program was loaded from a binary rather than linked from the shaders.
+    bool IsLoadedFromBinary() const { return m_LoadedFromBinary; }
+
 private:
     GLObjectWrappers::GLProgramObj   m_GLProg{true};
     std::vector<const ShaderGLImpl*> m_AttachedShaders;
     std::string                      m_InfoLog;
 
-    LinkStatus m_LinkStatus      = LinkStatus::Undefined;
-    bool       m_BindingsApplied = false;
+    LinkStatus m_LinkStatus       = LinkStatus::Undefined;
+    bool       m_BindingsApplied  = false;
+    bool       m_LoadedFromBinary = false;
 
     std::shared_ptr<const ShaderResourcesGL> m_pResources;
 
@@ -38,6 +38,7 @@ namespace Diligent
 {
 
 class ShaderGLImpl;
+class PipelineStateCacheGLImpl;
 
 /// Program cached contains linked programs for the given combination of shaders and resource layouts.
 class GLProgramCache
@@ -63,6 +64,7 @@ public:
         PipelineResourceLayoutDesc*  pResourceLayout    = nullptr;
         IPipelineResourceSignature** ppSignatures       = nullptr;
         Uint32                       NumSignatures      = 0;
+        PipelineStateCacheGLImpl*    pPSOCache          = nullptr;
     };
 
     SharedGLProgramObjPtr GetProgram(const GetProgramAttribs& Attribs);
@@ -708,4 +708,6 @@ static void (*glGetQueryObjectui64v)(GLuint id, GLenum pname, GLuint64* params)
 #define glBindImageTexture(...)        UnsupportedGLFunctionStub("glBindImageTexture", __VA_ARGS__)
 #define glDispatchCompute(...)         UnsupportedGLFunctionStub("glDispatchCompute", __VA_ARGS__)
 #define glPatchParameteri(...)         UnsupportedGLFunctionStub("glPatchParameteri", __VA_ARGS__)
+#define glGetProgramBinary(...)        UnsupportedGLFunctionStub("glGetProgramBinary", __VA_ARGS__)
+#define glProgramBinary(...)           UnsupportedGLFunctionStub("glProgramBinary", __VA_ARGS__)
 #define glTexStorage2DMultisample(...) UnsupportedGLFunctionStub("glTexStorage2DMultisample", __VA_ARGS__)
@@ -0,0 +1,113 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::PipelineStateCacheGLImpl class
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "EngineGLImplTraits.hpp"
+#include "PipelineStateCacheBase.hpp"
+#include "GLProgram.hpp"
+
+namespace Diligent
+{
+
+/// Pipeline state cache implementation in OpenGL backend.
+
+/// The cache stores program binaries retrieved with glGetProgramBinary, keyed by the
+/// hash of the GLSL source of all program shaders. Binaries are only valid for the same
+/// driver, so the cache data is discarded if the GL vendor, renderer or version differ.
+class PipelineStateCacheGLImpl final : public PipelineStateCacheBase<EngineGLImplTraits>
+{
+public:
+    using TPipelineStateCacheBase = PipelineStateCacheBase<EngineGLImplTraits>;
+
+    PipelineStateCacheGLImpl(IReferenceCounters*                 pRefCounters,
+                             RenderDeviceGLImpl*                 pDeviceGL,
+                             const PipelineStateCacheCreateInfo& CreateInfo);
+    ~PipelineStateCacheGLImpl();
+
+    /// Implementation of IPipelineStateCache::GetData().
+    virtual void DILIGENT_CALL_TYPE GetData(IDataBlob** ppBlob) override final;
+
+    struct ProgramKey
+    {
+        Uint64 Hash       = 0;
+        Uint64 SourceSize = 0;
+
+        ProgramKey() noexcept {}
+        ProgramKey(ShaderGLImpl* const* ppShaders, Uint32 NumShaders, bool IsSeparableProgram) noexcept;
+
+        bool IsValid() const noexcept { return SourceSize != 0; }
+
+        bool operator==(const ProgramKey& Rhs) const noexcept
+        {
+            return Hash == Rhs.Hash && SourceSize == Rhs.SourceSize;
+        }
+
+        struct Hasher
+        {
+            size_t operator()(const ProgramKey& Key) const noexcept
+            {
+                return static_cast<size_t>(Key.Hash ^ (Key.Hash >> 32));
+            }
+        };
+    };
+
+    /// Returns the program binary for the given key, or null if the binary is not found
+    /// or the cache is not in the load mode.
+    std::shared_ptr<const GLProgram::Binary> LoadProgram(const ProgramKey& Key) const;
+
+    /// Retrieves the binary of the linked program and adds it to the cache
+    /// if the cache is in the store mode.
+    bool StoreProgram(const ProgramKey& Key, const GLProgram& Program);
+
+    /// Returns true if the program binaries will be stored in the cache.
+    bool IsStoreEnabled() const { return m_BinariesSupported && (m_Desc.Mode & PSO_CACHE_MODE_STORE) != 0; }
+
+private:
+    void Load(const void* pData, size_t DataSize);
+
+private:
+    // Program binaries are not supported if the driver reports no binary formats (e.g. WebGL).
+    bool m_BinariesSupported = false;
+
+    // Driver identity
+    std::string m_GLVendor;
+    std::string m_GLRenderer;
+    std::string m_GLVersion;
+
+    mutable std::mutex                                                                           m_ProgramsMtx;
+    std::unordered_map<ProgramKey, std::shared_ptr<const GLProgram::Binary>, ProgramKey::Hasher> m_Programs;
+};
+
+} // namespace Diligent
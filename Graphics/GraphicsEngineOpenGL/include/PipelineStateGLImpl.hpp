@@ -70,6 +70,9 @@ public:
     /// Implementation of IPipelineStateGL::GetGLProgramHandle()
     virtual GLuint DILIGENT_CALL_TYPE GetGLProgramHandle(SHADER_TYPE Stage) const override final;
 
+    /// Implementation of IPipelineStateGL::IsGLProgramLoadedFromBinary()
+    virtual Bool DILIGENT_CALL_TYPE IsGLProgramLoadedFromBinary(SHADER_TYPE Stage) const override final;
+
     void CommitProgram(GLContextState& State);
 
     using TBindings = PipelineResourceSignatureGLImpl::TBindings;
@@ -63,6 +63,15 @@ DILIGENT_BEGIN_INTERFACE(IPipelineStateGL, IPipelineState)
     VIRTUAL GLuint METHOD(GetGLProgramHandle)(THIS_
                                               SHADER_TYPE Stage) CONST PURE;
 
+    /// Checks if the OpenGL program for the specified shader stage was loaded from a binary.
+    ///
+    /// \param [in] Stage - Shader stage.
+    /// \return true if the program was created from the binary stored in the pipeline
+    ///         state cache, and false if it was linked from the shaders or if
+    ///         Stage is not one of the active shader stages.
+    VIRTUAL Bool METHOD(IsGLProgramLoadedFromBinary)(THIS_
+                                                     SHADER_TYPE Stage) CONST PURE;
+
     // clang-format on
 };
 DILIGENT_END_INTERFACE
@@ -73,7 +82,8 @@ DILIGENT_END_INTERFACE
 
 // clang-format off
 
-#    define IPipelineStateGL_GetGLProgramHandle(This, ...) CALL_IFACE_METHOD(PipelineStateGL, GetGLProgramHandle, This, __VA_ARGS__)
+#    define IPipelineStateGL_GetGLProgramHandle(This, ...)          CALL_IFACE_METHOD(PipelineStateGL, GetGLProgramHandle,          This, __VA_ARGS__)
+#    define IPipelineStateGL_IsGLProgramLoadedFromBinary(This, ...) CALL_IFACE_METHOD(PipelineStateGL, IsGLProgramLoadedFromBinary, This, __VA_ARGS__)
 
 // clang-format on
 
@@ -181,6 +181,8 @@ void DeviceContextGLImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
     auto* const pShaderResBindingGL = ClassPtrCast<ShaderResourceBindingGLImpl>(pShaderResourceBinding);
     const auto  SRBIndex            = pShaderResBindingGL->GetBindingIndex();
 
+    // Redundant commits are not skipped in OpenGL: binding the resources sets up
+    // memory barriers and collects writable resources, which must be done every time.
     m_BindInfo.Set(SRBIndex, pShaderResBindingGL);
 
 #ifdef DILIGENT_DEBUG
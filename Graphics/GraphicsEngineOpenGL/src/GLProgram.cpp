@@ -35,7 +35,9 @@ namespace Diligent
 
 GLProgram::GLProgram(ShaderGLImpl* const* ppShaders,
                      Uint32               NumShaders,
-                     bool                 IsSeparableProgram) noexcept :
+                     bool                 IsSeparableProgram,
+                     const Binary*        pBinary,
+                     bool                 RetrievableBinary) noexcept :
     m_AttachedShaders{ppShaders, ppShaders + NumShaders}
 {
     VERIFY(!IsSeparableProgram || NumShaders == 1, "Number of shaders must be 1 when separable program is created");
@@ -47,6 +49,36 @@ GLProgram::GLProgram(ShaderGLImpl* const* ppShaders,
         DEV_CHECK_GL_ERROR("glProgramParameteri(GL_PROGRAM_SEPARABLE) failed");
     }
 
+    if (pBinary != nullptr && !pBinary->Data.empty())
+    {
+        // The driver may reject the binary, e.g. after a driver update, in which case
+        // the program is left unlinked and we link it from the shaders as usual.
+        // Drain errors generated by previous commands so that they are not taken for a rejected binary.
+        while (glGetError() != GL_NO_ERROR)
+        {
+        }
+        glProgramBinary(m_GLProg, pBinary->Format, pBinary->Data.data(), static_cast<GLsizei>(pBinary->Data.size()));
+        if (glGetError() == GL_NO_ERROR)
+        {
+            GLint IsLinked = GL_FALSE;
+            glGetProgramiv(m_GLProg, GL_LINK_STATUS, &IsLinked);
+            DEV_CHECK_GL_ERROR("glGetProgramiv(GL_LINK_STATUS) failed");
+            if (IsLinked)
+            {
+                m_AttachedShaders.clear();
+                m_LinkStatus       = LinkStatus::Succeeded;
+                m_LoadedFromBinary = true;
+                return;
+            }
+        }
+    }
+
+    if (RetrievableBinary)
+    {
+        glProgramParameteri(m_GLProg, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        DEV_CHECK_GL_ERROR("glProgramParameteri(GL_PROGRAM_BINARY_RETRIEVABLE_HINT) failed");
+    }
+
     for (Uint32 i = 0; i < NumShaders; ++i)
     {
         auto* pCurrShader = ppShaders[i];
@@ -172,6 +204,36 @@ void GLProgram::SetResources(std::shared_ptr<const ShaderResourcesGL> pResources
     }
 }
 
+bool GLProgram::GetBinary(Binary& ProgBinary) const
+{
+    DEV_CHECK_ERR(m_LinkStatus == LinkStatus::Succeeded, "Program must be successfully linked to retrieve its binary");
+
+    // Drain errors generated by previous commands so that they are not taken for a failure to get the binary
+    while (glGetError() != GL_NO_ERROR)
+    {
+    }
+
+    GLint BinaryLength = 0;
+    glGetProgramiv(m_GLProg, GL_PROGRAM_BINARY_LENGTH, &BinaryLength);
+    if (glGetError() != GL_NO_ERROR || BinaryLength <= 0)
+        return false;
+
+    ProgBinary.Data.resize(static_cast<size_t>(BinaryLength));
+
+    GLsizei BytesWritten = 0;
+    GLenum  Format       = 0;
+    glGetProgramBinary(m_GLProg, BinaryLength, &BytesWritten, &Format, ProgBinary.Data.data());
+    if (glGetError() != GL_NO_ERROR || BytesWritten <= 0)
+    {
+        ProgBinary.Data.clear();
+        return false;
+    }
+
+    ProgBinary.Data.resize(static_cast<size_t>(BytesWritten));
+    ProgBinary.Format = Format;
+    return true;
+}
+
 void GLProgram::ApplyBindings(const PipelineResourceSignatureGLImpl*            pSignature,
                               GLContextState&                                   State,
                               const PipelineResourceSignatureGLImpl::TBindings& BaseBindings)
@@ -30,6 +30,7 @@
 #include "ShaderGLImpl.hpp"
 #include "RenderDeviceGLImpl.hpp"
 #include "PipelineResourceSignatureGLImpl.hpp"
+#include "PipelineStateCacheGLImpl.hpp"
 #include "HashUtils.hpp"
 
 namespace Diligent
@@ -115,8 +116,17 @@ GLProgramCache::SharedGLProgramObjPtr GLProgramCache::GetProgram(const GetProgra
     // multiple threads will create the same program. Only one program will be added to the cache
     // and the rest will be destroyed.
 
-    // Linking the program may take a considerable amount of time.
-    std::shared_ptr<GLProgram> NewProgram = std::make_shared<GLProgram>(Attribs.ppShaders, Attribs.NumShaders, Attribs.IsSeparableProgram);
+    // Linking the program may take a considerable amount of time, so try to load
+    // the program binary from the pipeline state cache first.
+    std::shared_ptr<const GLProgram::Binary> pBinary;
+    bool                                     RetrievableBinary = false;
+    if (Attribs.pPSOCache != nullptr)
+    {
+        pBinary           = Attribs.pPSOCache->LoadProgram({Attribs.ppShaders, Attribs.NumShaders, Attribs.IsSeparableProgram});
+        RetrievableBinary = !pBinary && Attribs.pPSOCache->IsStoreEnabled();
+    }
+
+    std::shared_ptr<GLProgram> NewProgram = std::make_shared<GLProgram>(Attribs.ppShaders, Attribs.NumShaders, Attribs.IsSeparableProgram, pBinary.get(), RetrievableBinary);
 
     std::lock_guard<std::mutex> Lock{m_CacheMtx};
 
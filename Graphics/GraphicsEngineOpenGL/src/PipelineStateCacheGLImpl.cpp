@@ -0,0 +1,270 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "PipelineStateCacheGLImpl.hpp"
+#include "RenderDeviceGLImpl.hpp"
+#include "ShaderGLImpl.hpp"
+#include "DataBlobImpl.hpp"
+#include "Serializer.hpp"
+
+#include "xxhash.h"
+
+namespace Diligent
+{
+
+namespace
+{
+
+constexpr Uint32 CacheDataMagic   = 0x43505347; // 'GSPC'
+constexpr Uint32 CacheDataVersion = 2;
+
+std::string GetGLString(GLenum Name)
+{
+    const auto* Str = reinterpret_cast<const char*>(glGetString(Name));
+    return Str != nullptr ? Str : "";
+}
+
+} // namespace
+
+PipelineStateCacheGLImpl::ProgramKey::ProgramKey(ShaderGLImpl* const* ppShaders, Uint32 NumShaders, bool IsSeparableProgram) noexcept
+{
+    // Program binaries are stored across runs and identified by the hash only, so use
+    // a 64-bit hash on all platforms to make collisions between programs unlikely.
+    const Uint32 Header[] = {IsSeparableProgram ? 1u : 0u, NumShaders};
+    Uint64       KeyHash  = XXH3_64bits(Header, sizeof(Header));
+    for (Uint32 i = 0; i < NumShaders; ++i)
+    {
+        const void* pSource          = nullptr;
+        Uint64      ShaderSourceSize = 0;
+        ppShaders[i]->GetBytecode(&pSource, ShaderSourceSize);
+        if (pSource == nullptr || ShaderSourceSize == 0)
+        {
+            // The program can't be identified without the source
+            *this = {};
+            return;
+        }
+
+        const Uint32 ShaderType = ppShaders[i]->GetDesc().ShaderType;
+        KeyHash                 = XXH3_64bits_withSeed(&ShaderType, sizeof(ShaderType), KeyHash);
+        KeyHash                 = XXH3_64bits_withSeed(pSource, static_cast<size_t>(ShaderSourceSize), KeyHash);
+        SourceSize += ShaderSourceSize;
+    }
+    Hash = KeyHash;
+}
+
+PipelineStateCacheGLImpl::PipelineStateCacheGLImpl(IReferenceCounters*                 pRefCounters,
+                                                   RenderDeviceGLImpl*                 pDeviceGL,
+                                                   const PipelineStateCacheCreateInfo& CreateInfo) :
+    // clang-format off
+    TPipelineStateCacheBase
+    {
+        pRefCounters,
+        pDeviceGL,
+        CreateInfo,
+        false
+    }
+// clang-format on
+{
+    // Drain errors generated by previous commands so that they are not taken for a missing binary support
+    while (glGetError() != GL_NO_ERROR)
+    {
+    }
+
+    GLint NumBinaryFormats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &NumBinaryFormats);
+    m_BinariesSupported = glGetError() == GL_NO_ERROR && NumBinaryFormats > 0;
+    if (!m_BinariesSupported)
+    {
+        if ((m_Desc.Flags & PSO_CACHE_FLAG_VERBOSE) != 0)
+            LOG_INFO_MESSAGE("Program binaries are not supported by the driver. Pipeline state cache '", m_Desc.Name, "' will not be used.");
+        return;
+    }
+
+    m_GLVendor   = GetGLString(GL_VENDOR);
+    m_GLRenderer = GetGLString(GL_RENDERER);
+    m_GLVersion  = GetGLString(GL_VERSION);
+
+    if (CreateInfo.pCacheData != nullptr && CreateInfo.CacheDataSize != 0)
+        Load(CreateInfo.pCacheData, CreateInfo.CacheDataSize);
+}
+
+PipelineStateCacheGLImpl::~PipelineStateCacheGLImpl()
+{
+}
+
+void PipelineStateCacheGLImpl::Load(const void* pData, size_t DataSize)
+{
+    const bool Verbose = (m_Desc.Flags & PSO_CACHE_FLAG_VERBOSE) != 0;
+
+    Serializer<SerializerMode::Read> Ser{SerializedData{const_cast<void*>(pData), DataSize}};
+
+    Uint32 Magic   = 0;
+    Uint32 Version = 0;
+    if (!Ser(Magic, Version) || Magic != CacheDataMagic || Version != CacheDataVersion)
+    {
+        if (Verbose)
+            LOG_WARNING_MESSAGE("Pipeline state cache data is invalid or was created by an incompatible engine version.");
+        return;
+    }
+
+    const char* Vendor    = nullptr;
+    const char* Renderer  = nullptr;
+    const char* GLVersion = nullptr;
+    if (!Ser(Vendor, Renderer, GLVersion))
+    {
+        if (Verbose)
+            LOG_WARNING_MESSAGE("Failed to read pipeline state cache header.");
+        return;
+    }
+
+    // Program binaries are only guaranteed to be compatible with the same driver
+    if (m_GLVendor != Vendor || m_GLRenderer != Renderer || m_GLVersion != GLVersion)
+    {
+        if (Verbose)
+            LOG_INFO_MESSAGE("Pipeline state cache data was created by a different driver (", Renderer, ", ", GLVersion, ") and will be ignored.");
+        return;
+    }
+
+    Uint32 NumPrograms = 0;
+    if (!Ser(NumPrograms))
+        return;
+
+    std::lock_guard<std::mutex> Lock{m_ProgramsMtx};
+    for (Uint32 i = 0; i < NumPrograms; ++i)
+    {
+        ProgramKey  Key;
+        Uint32      Format     = 0;
+        const void* pBinData   = nullptr;
+        size_t      BinarySize = 0;
+        if (!Ser(Key.Hash, Key.SourceSize, Format) || !Ser.SerializeBytes(pBinData, BinarySize))
+        {
+            if (Verbose)
+                LOG_WARNING_MESSAGE("Pipeline state cache data is corrupted. ", i, " out of ", NumPrograms, " program binaries were loaded.");
+            return;
+        }
+
+        auto pBinary    = std::make_shared<GLProgram::Binary>();
+        pBinary->Format = static_cast<GLenum>(Format);
+        pBinary->Data.assign(static_cast<const Uint8*>(pBinData), static_cast<const Uint8*>(pBinData) + BinarySize);
+        m_Programs.emplace(Key, std::move(pBinary));
+    }
+}
+
+std::shared_ptr<const GLProgram::Binary> PipelineStateCacheGLImpl::LoadProgram(const ProgramKey& Key) const
+{
+    if (!m_BinariesSupported || (m_Desc.Mode & PSO_CACHE_MODE_LOAD) == 0 || !Key.IsValid())
+        return {};
+
+    {
+        std::lock_guard<std::mutex> Lock{m_ProgramsMtx};
+
+        auto it = m_Programs.find(Key);
+        if (it != m_Programs.end())
+            return it->second;
+    }
+
+    if ((m_Desc.Flags & PSO_CACHE_FLAG_VERBOSE) != 0)
+        LOG_INFO_MESSAGE("Program binary is not found in the pipeline state cache '", m_Desc.Name, "'.");
+
+    return {};
+}
+
+bool PipelineStateCacheGLImpl::StoreProgram(const ProgramKey& Key, const GLProgram& Program)
+{
+    if (!IsStoreEnabled() || !Key.IsValid())
+        return false;
+
+    {
+        std::lock_guard<std::mutex> Lock{m_ProgramsMtx};
+        if (m_Programs.find(Key) != m_Programs.end())
+            return true;
+    }
+
+    auto pBinary = std::make_shared<GLProgram::Binary>();
+    if (!Program.GetBinary(*pBinary))
+    {
+        if ((m_Desc.Flags & PSO_CACHE_FLAG_VERBOSE) != 0)
+            LOG_WARNING_MESSAGE("Failed to retrieve the program binary. The program will not be added to the pipeline state cache '", m_Desc.Name, "'.");
+        return false;
+    }
+
+    std::lock_guard<std::mutex> Lock{m_ProgramsMtx};
+    m_Programs.emplace(Key, std::move(pBinary));
+    return true;
+}
+
+void PipelineStateCacheGLImpl::GetData(IDataBlob** ppBlob)
+{
+    DEV_CHECK_ERR(ppBlob != nullptr, "ppBlob must not be null");
+    *ppBlob = nullptr;
+
+    if (!m_BinariesSupported)
+        return;
+
+    std::lock_guard<std::mutex> Lock{m_ProgramsMtx};
+
+    auto SerializeAll = [this](auto& Ser) {
+        const Uint32 Magic       = CacheDataMagic;
+        const Uint32 Version     = CacheDataVersion;
+        const char*  Vendor      = m_GLVendor.c_str();
+        const char*  Renderer    = m_GLRenderer.c_str();
+        const char*  GLVersion   = m_GLVersion.c_str();
+        const Uint32 NumPrograms = static_cast<Uint32>(m_Programs.size());
+        if (!Ser(Magic, Version, Vendor, Renderer, GLVersion, NumPrograms))
+            return false;
+
+        for (const auto& it : m_Programs)
+        {
+            const ProgramKey& Key     = it.first;
+            const auto&       Binary  = *it.second;
+            const Uint32      Format  = Binary.Format;
+            const void*       pData   = Binary.Data.data();
+            const size_t      BinSize = Binary.Data.size();
+            if (!Ser(Key.Hash, Key.SourceSize, Format) || !Ser.SerializeBytes(pData, BinSize))
+                return false;
+        }
+        return true;
+    };
+
+    Serializer<SerializerMode::Measure> MSer;
+    SerializeAll(MSer);
+
+    auto pDataBlob = DataBlobImpl::Create(MSer.GetSize());
+
+    Serializer<SerializerMode::Write> WSer{SerializedData{pDataBlob->GetDataPtr(), pDataBlob->GetSize()}};
+    if (!SerializeAll(WSer))
+    {
+        UNEXPECTED("Failed to serialize pipeline state cache data");
+        return;
+    }
+    VERIFY_EXPR(WSer.IsEnded());
+
+    *ppBlob = pDataBlob.Detach();
+}
+
+} // namespace Diligent
@@ -35,6 +35,7 @@
 #include "DeviceContextGLImpl.hpp"
 #include "ShaderResourceBindingGLImpl.hpp"
 #include "GLTypeConversions.hpp"
+#include "PipelineStateCacheGLImpl.hpp"
 
 #include "EngineMemory.h"
 #include "Align.hpp"
@@ -399,6 +400,7 @@ private:
                         m_CreateInfo.ResourceSignaturesCount == 0 ? &m_CreateInfo.PSODesc.ResourceLayout : nullptr,
                         m_CreateInfo.ppResourceSignatures,
                         m_CreateInfo.ResourceSignaturesCount,
+                        GetPSOCache(),
                     };
                     m_Pipeline.m_GLPrograms[i]  = m_Pipeline.GetDevice()->GetProgramCache().GetProgram(ProgAttribs);
                     m_Pipeline.m_ShaderTypes[i] = m_Shaders[i]->GetDesc().ShaderType;
@@ -416,6 +418,7 @@ private:
                     m_CreateInfo.ResourceSignaturesCount == 0 ? &m_CreateInfo.PSODesc.ResourceLayout : nullptr,
                     m_CreateInfo.ppResourceSignatures,
                     m_CreateInfo.ResourceSignaturesCount,
+                    GetPSOCache(),
                 };
                 m_Pipeline.m_GLPrograms[0]  = m_Pipeline.GetDevice()->GetProgramCache().GetProgram(ProgAttribs);
                 m_Pipeline.m_ShaderTypes[0] = ActiveStages;
@@ -447,10 +450,36 @@ private:
             }
         }
 
+        StoreProgramBinaries();
+
         m_Pipeline.InitResourceLayout(GetInternalCreateFlags(m_CreateInfo), m_Shaders, ActiveStages);
         m_State = State::Complete;
     }
 
+    PipelineStateCacheGLImpl* GetPSOCache() const
+    {
+        return ClassPtrCast<PipelineStateCacheGLImpl>(m_CreateInfo.pPSOCache);
+    }
+
+    void StoreProgramBinaries()
+    {
+        PipelineStateCacheGLImpl* pPSOCache = GetPSOCache();
+        if (pPSOCache == nullptr || !pPSOCache->IsStoreEnabled())
+            return;
+
+        for (Uint32 i = 0; i < m_Pipeline.m_NumPrograms; ++i)
+        {
+            const GLProgram& Program = *m_Pipeline.m_GLPrograms[i];
+            if (Program.IsLoadedFromBinary())
+                continue;
+
+            const PipelineStateCacheGLImpl::ProgramKey Key = m_Pipeline.m_IsProgramPipelineSupported ?
+                PipelineStateCacheGLImpl::ProgramKey{&m_Shaders[i], 1, true} :
+                PipelineStateCacheGLImpl::ProgramKey{m_Shaders.data(), static_cast<Uint32>(m_Shaders.size()), false};
+            pPSOCache->StoreProgram(Key, Program);
+        }
+    }
+
 private:
     PSOCreateInfoTypeX m_CreateInfo;
 };
@@ -666,6 +695,18 @@ GLuint PipelineStateGLImpl::GetGLProgramHandle(SHADER_TYPE Stage) const
     return 0;
 }
 
+Bool PipelineStateGLImpl::IsGLProgramLoadedFromBinary(SHADER_TYPE Stage) const
+{
+    DEV_CHECK_ERR(IsPowerOfTwo(Stage), "Exactly one shader stage must be specified");
+
+    for (size_t i = 0; i < m_NumPrograms; ++i)
+    {
+        if ((m_ShaderTypes[i] & Stage) != 0)
+            return m_GLPrograms[i]->IsLoadedFromBinary();
+    }
+    return False;
+}
+
 void PipelineStateGLImpl::ValidateShaderResources(std::shared_ptr<const ShaderResourcesGL> pShaderResources, const char* ShaderName, SHADER_TYPE ShaderStages)
 {
     const auto HandleResource = [&](const ShaderResourcesGL::GLResourceAttribs& Attribs,
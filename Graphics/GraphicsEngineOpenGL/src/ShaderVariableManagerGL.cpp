@@ -446,36 +446,48 @@ void ShaderVariableManagerGL::CheckResources(IResourceMapping*
 }
 
 template <typename ResourceType>
-IShaderResourceVariable* ShaderVariableManagerGL::GetResourceByName(const Char* Name) const
+IShaderResourceVariable* ShaderVariableManagerGL::GetResourceBySignatureIndex(Uint32 ResIndex) const
 {
-    auto NumResources = GetNumResources<ResourceType>();
-    for (Uint32 res = 0; res < NumResources; ++res)
-    {
-        auto&       Resource = GetResource<ResourceType>(res);
-        const auto& ResDesc  = Resource.GetDesc();
-        if (strcmp(ResDesc.Name, Name) == 0)
-            return &Resource;
-    }
+    const auto NumResources = GetNumResources<ResourceType>();
+    if (NumResources == 0)
+        return nullptr;
 
-    return nullptr;
+    // Resources of every type are sorted by the signature resource index
+    return FindVariableByResourceIndex(&GetResource<ResourceType>(0), NumResources, ResIndex);
 }
 
 
 IShaderResourceVariable* ShaderVariableManagerGL::GetVariable(const Char* Name) const
 {
-    if (auto* pUB = GetResourceByName<UniformBuffBindInfo>(Name))
-        return pUB;
-
-    if (auto* pTexture = GetResourceByName<TextureBindInfo>(Name))
-        return pTexture;
+    if (m_pSignature == nullptr)
+        return nullptr;
 
-    if (auto* pImage = GetResourceByName<ImageBindInfo>(Name))
-        return pImage;
+    IShaderResourceVariable* pVar = nullptr;
+    m_pSignature->FindResourcesByName(
+        Name,
+        [&](Uint32 ResIndex) //
+        {
+            const auto& ResDesc = m_pSignature->GetResourceDesc(ResIndex);
+            // Samplers are never initialized as variables
+            if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER)
+                return false;
 
-    if (auto* pSSBO = GetResourceByName<StorageBufferBindInfo>(Name))
-        return pSSBO;
+            static_assert(BINDING_RANGE_COUNT == 4, "Please update the switch below to handle the new shader resource range");
+            switch (PipelineResourceToBindingRange(ResDesc))
+            {
+                // clang-format off
+                case BINDING_RANGE_UNIFORM_BUFFER: pVar = GetResourceBySignatureIndex<UniformBuffBindInfo>  (ResIndex); break;
+                case BINDING_RANGE_TEXTURE:        pVar = GetResourceBySignatureIndex<TextureBindInfo>      (ResIndex); break;
+                case BINDING_RANGE_IMAGE:          pVar = GetResourceBySignatureIndex<ImageBindInfo>        (ResIndex); break;
+                case BINDING_RANGE_STORAGE_BUFFER: pVar = GetResourceBySignatureIndex<StorageBufferBindInfo>(ResIndex); break;
+                // clang-format on
+                default:
+                    UNEXPECTED("Unsupported resource type.");
+            }
+            return pVar != nullptr;
+        });
 
-    return nullptr;
+    return pVar;
 }
 
 class ShaderVariableLocator
@@ -46,11 +46,15 @@ public:
     CommandListVkImpl(IReferenceCounters*  pRefCounters,
                       RenderDeviceVkImpl*  pDevice,
                       DeviceContextVkImpl* pDeferredCtx,
-                      VkCommandBuffer      vkCmdBuff) :
+                      VkCommandBuffer      vkCmdBuff,
+                      bool                 IsSecondary  = false,
+                      Uint32               SubpassIndex = 0) :
         // clang-format off
         TCommandListBase {pRefCounters, pDevice, pDeferredCtx},
         m_pDeferredCtx   {pDeferredCtx},
-        m_vkCmdBuff      {vkCmdBuff   }
+        m_vkCmdBuff      {vkCmdBuff   },
+        m_IsSecondary    {IsSecondary },
+        m_SubpassIndex   {SubpassIndex}
     // clang-format on
     {
     }
@@ -67,9 +71,18 @@ public:
         m_vkCmdBuff    = VK_NULL_HANDLE;
     }
 
+    // Returns true if the command list was recorded into a secondary command buffer
+    // by IDeviceContextVk::BeginSecondaryCommandList().
+    bool IsSecondary() const { return m_IsSecondary; }
+
+    // Index of the subpass the secondary command list was recorded for.
+    Uint32 GetSubpassIndex() const { return m_SubpassIndex; }
+
 private:
     RefCntAutoPtr<IDeviceContext> m_pDeferredCtx;
     VkCommandBuffer               m_vkCmdBuff;
+    const bool                    m_IsSecondary;
+    const Uint32                  m_SubpassIndex;
 };
 
 } // namespace Diligent
@@ -27,10 +27,9 @@
 
 #pragma once
 
-#include <deque>
-#include <mutex>
 #include <atomic>
-#include "STDAllocator.hpp"
+#include <string>
+#include "LockFreeStack.hpp"
 #include "VulkanUtilities/VulkanObjectWrappers.hpp"
 #include "VulkanUtilities/VulkanLogicalDevice.hpp"
 
@@ -74,6 +73,15 @@ public:
     // Returns command pool to the list of available pools. The GPU must have finished using the pool
     void RecycleCommandPool(VulkanUtilities::CommandPoolWrapper&& CmdPool);
 
+    struct PoolStats
+    {
+        // The total number of command pools created by the manager
+        Uint32 CreatedPoolCount = 0;
+        // The number of times a pool was taken from the list of available pools
+        Uint64 ReusedPoolCount = 0;
+    };
+    PoolStats GetStats() const;
+
 private:
     const VulkanUtilities::VulkanLogicalDevice& m_LogicalDevice;
 
@@ -81,8 +89,12 @@ private:
     const HardwareQueueIndex       m_QueueFamilyIndex;
     const VkCommandPoolCreateFlags m_CmdPoolFlags;
 
-    std::mutex                                                                                               m_Mutex;
-    std::deque<VulkanUtilities::CommandPoolWrapper, STDAllocatorRawMem<VulkanUtilities::CommandPoolWrapper>> m_CmdPools;
+    // Available pools. Command pools are allocated and recycled by multiple threads,
+    // so the list is lock-free to avoid serializing them.
+    Threading::LockFreeStack<VulkanUtilities::CommandPoolWrapper> m_CmdPools;
+
+    std::atomic<Uint32> m_CreatedPoolCount{0};
+    std::atomic<Uint64> m_ReusedPoolCount{0};
 
 #ifdef DILIGENT_DEVELOPMENT
     std::atomic<Int32> m_AllocatedPoolCounter{0};
@@ -142,6 +142,9 @@ public:
     /// Implementation of ICommandQueueVk::EnqueueSignal().
     virtual void DILIGENT_CALL_TYPE EnqueueSignal(VkSemaphore vkTimelineSemaphore, Uint64 Value) override final;
 
+    /// Implementation of ICommandQueueVk::GetVkTimelineSemaphore().
+    virtual VkSemaphore DILIGENT_CALL_TYPE GetVkTimelineSemaphore() const override final { return m_vkTimelineSemaphore; }
+
     void SetFence(RefCntAutoPtr<FenceVkImpl> pFence)
     {
         VERIFY_EXPR(pFence->GetDesc().Type == FENCE_TYPE_CPU_WAIT_ONLY);
@@ -168,6 +171,11 @@ private:
     const bool               m_SupportedTimelineSemaphore;
     const Uint8              m_NumCommandQueues;
 
+    // Timeline semaphore that is signaled with the fence value of every submission.
+    // Other queues wait for it to synchronize with this queue on the GPU.
+    // Only created when timeline semaphores are supported.
+    VulkanUtilities::SemaphoreWrapper m_vkTimelineSemaphore;
+
     // Fence is signaled right after a command buffer has been
     // submitted to the command queue for execution.
     // All command buffers with fence value less than or equal to the signaled value
@@ -35,6 +35,7 @@
 #include <mutex>
 #include <atomic>
 
+#include "LockFreeStack.hpp"
 #include "VulkanUtilities/VulkanObjectWrappers.hpp"
 
 namespace Diligent
@@ -127,9 +128,11 @@ private:
 //     |   | Pool[0] | Pool[1] | ...  |
 //     |______________________________|
 //             |            A
-//   GetPool() |            | FreePool()
+//  GetPools() |            | FreePool()
 //             V            |
 //
+// Free pools are kept in a lock-free stack, so that device contexts recording commands
+// in parallel do not serialize when they acquire pools or when their pools are recycled.
 class DescriptorPoolManager
 {
 public:
@@ -149,10 +152,31 @@ public:
 
     VulkanUtilities::DescriptorPoolWrapper GetPool(const char* DebugName);
 
+    // Moves up to MaxCount free pools to the end of the Pools vector.
+    // If there are no free pools, creates one new pool.
+    void GetPools(std::vector<VulkanUtilities::DescriptorPoolWrapper>& Pools, Uint32 MaxCount, const char* DebugName);
+
     void DisposePool(VulkanUtilities::DescriptorPoolWrapper&& Pool, Uint64 QueueMask);
 
+    // Disposes all pools with a single release queue entry.
+    void DisposePools(std::vector<VulkanUtilities::DescriptorPoolWrapper>&& Pools, Uint64 QueueMask);
+
+    // Returns pools that are not used by the GPU directly to the free list.
+    void ReturnPools(std::vector<VulkanUtilities::DescriptorPoolWrapper>&& Pools);
+
     RenderDeviceVkImpl& GetDeviceVkImpl() { return m_DeviceVkImpl; }
 
+    struct PoolStats
+    {
+        // The total number of pools created by the manager
+        Uint32 CreatedPoolCount = 0;
+        // The number of times a pool was taken from the free list
+        Uint64 ReusedPoolCount = 0;
+        // The number of times a pool was returned to the free list
+        Uint64 RecycledPoolCount = 0;
+    };
+    PoolStats GetStats() const;
+
 #ifdef DILIGENT_DEVELOPMENT
     Int32 GetAllocatedPoolCounter() const
     {
@@ -161,7 +185,7 @@ public:
 #endif
 
 protected:
-    VulkanUtilities::DescriptorPoolWrapper CreateDescriptorPool(const char* DebugName) const;
+    VulkanUtilities::DescriptorPoolWrapper CreateDescriptorPool(const char* DebugName);
 
     RenderDeviceVkImpl& m_DeviceVkImpl;
     const std::string   m_PoolName;
@@ -170,12 +194,15 @@ protected:
     const uint32_t                          m_MaxSets;
     const bool                              m_AllowFreeing;
 
-    std::mutex                                         m_Mutex;
-    std::deque<VulkanUtilities::DescriptorPoolWrapper> m_Pools;
-
 private:
     void FreePool(VulkanUtilities::DescriptorPoolWrapper&& Pool);
 
+    Threading::LockFreeStack<VulkanUtilities::DescriptorPoolWrapper> m_FreePools;
+
+    std::atomic<Uint32> m_CreatedPoolCount{0};
+    std::atomic<Uint64> m_ReusedPoolCount{0};
+    std::atomic<Uint64> m_RecycledPoolCount{0};
+
 #ifdef DILIGENT_DEVELOPMENT
     std::atomic<Int32> m_AllocatedPoolCounter;
 #endif
@@ -223,6 +250,9 @@ public:
 private:
     void FreeDescriptorSet(VkDescriptorSet Set, VkDescriptorPool Pool, Uint64 QueueMask);
 
+    std::mutex                                         m_Mutex;
+    std::deque<VulkanUtilities::DescriptorPoolWrapper> m_Pools;
+
 #ifdef DILIGENT_DEVELOPMENT
     std::atomic<Int32> m_AllocatedSetCounter;
 #endif
@@ -231,7 +261,8 @@ private:
 
 // DynamicDescriptorSetAllocator manages dynamic descriptor sets. It first requests descriptor pool from
 // the global manager and allocates descriptor sets from this pool. When space in the pool is exhausted,
-// the class requests a new pool.
+// the class requests a new pool. Pools are requested from the global manager in batches and are kept
+// in a local free list.
 // The class is not thread-safe as device contexts must not be used in multiple threads simultaneously.
 // All allocated pools are recycled at the end of every frame.
 //   ____________________________________________________________________________
@@ -271,9 +302,13 @@ public:
     size_t GetAllocatedPoolCount() const { return m_AllocatedPools.size(); }
 
 private:
+    // The number of pools requested from the global manager at once
+    static constexpr Uint32 PoolBatchSize = 4;
+
     DescriptorPoolManager&                              m_GlobalPoolMgr;
     const std::string                                   m_Name;
     std::vector<VulkanUtilities::DescriptorPoolWrapper> m_AllocatedPools;
+    std::vector<VulkanUtilities::DescriptorPoolWrapper> m_FreePools;
     size_t                                              m_PeakPoolCount = 0;
 };
 
@@ -63,6 +63,7 @@ namespace Diligent
 {
 
 class QueryManagerVk;
+class GPUProfilerVk;
 
 /// Device context implementation in Vulkan backend.
 class DeviceContextVkImpl final : public DeviceContextNextGenBase<EngineVkImplTraits>
@@ -321,6 +322,25 @@ public:
     /// Implementation of IDeviceContextVk::GetVkCommandBuffer().
     virtual VkCommandBuffer DILIGENT_CALL_TYPE GetVkCommandBuffer() override final;
 
+    /// Implementation of IDeviceContextVk::BeginSecondaryRenderPass().
+    virtual void DILIGENT_CALL_TYPE BeginSecondaryRenderPass(const BeginRenderPassAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContextVk::BeginSecondaryCommandList().
+    virtual void DILIGENT_CALL_TYPE BeginSecondaryCommandList(const SecondaryCommandListAttribsVk& Attribs) override final;
+
+    /// Implementation of IDeviceContextVk::ExecuteSecondaryCommandLists().
+    virtual void DILIGENT_CALL_TYPE ExecuteSecondaryCommandLists(Uint32               NumCommandLists,
+                                                                 ICommandList* const* ppCommandLists) override final;
+
+    /// Implementation of IDeviceContextVk::GetProfilerFrame().
+    virtual GPUProfilerFrameVk DILIGENT_CALL_TYPE GetProfilerFrame() const override final;
+
+    /// Implementation of IDeviceContextVk::DeviceWaitForQueue().
+    virtual void DILIGENT_CALL_TYPE DeviceWaitForQueue(Uint32 ImmediateContextId, Uint64 FenceValue) override final;
+
+    /// Implementation of IDeviceContextVk::GetLastSubmittedFenceValue().
+    virtual Uint64 DILIGENT_CALL_TYPE GetLastSubmittedFenceValue() const override final { return m_LastSubmittedFenceValue; }
+
     // Transitions BLAS state from OldState to NewState, and optionally updates internal state.
     // If OldState == RESOURCE_STATE_UNKNOWN, internal BLAS state is used as old state.
     void TransitionBLASState(BottomLevelASVkImpl& BLAS,
@@ -454,7 +474,7 @@ private:
         }
     }
 
-    inline void DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkCommandBuffer vkCmdBuff, Uint64 FenceValue);
+    inline void DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkCommandBuffer vkCmdBuff, Uint64 FenceValue, VkCommandBufferLevel Level);
     inline void DisposeCurrentCmdBuffer(SoftwareQueueIndex CmdQueue, Uint64 FenceValue);
 
     void CopyBufferToTexture(VkBuffer                       vkSrcBuffer,
@@ -483,6 +503,10 @@ private:
 
     void DvpLogRenderPass_PSOMismatch();
 
+    // Returns false in a subpass begun by BeginSecondaryRenderPass(). The contents of such subpass
+    // can only be recorded in secondary command lists, so no other commands are allowed.
+    bool IsInlineSubpass() const { return m_vkSubpassContents == VK_SUBPASS_CONTENTS_INLINE; }
+
     void CreateASCompactedSizeQueryPool();
 
     void PrepareCommandPool(SoftwareQueueIndex CommandQueueId);
@@ -530,6 +554,11 @@ private:
             // Note that this is not the actual number of dynamic buffers in the resource cache.
             Uint32 DynamicOffsetCount = 0;
 
+            // When descriptor buffers are used: the signature of the committed SRB and the offsets
+            // of its descriptor sets in the dynamic heap written by the last CommitDescriptorBuffers() call.
+            const PipelineResourceSignatureVkImpl*                pSignature         = nullptr;
+            std::array<VkDeviceSize, MAX_DESCR_SET_PER_SIGNATURE> DescrBufferOffsets = {};
+
 #ifdef DILIGENT_DEVELOPMENT
             // The descriptor set base index that was used in the last BindDescriptorSets() call
             Uint32 LastBoundBaseInd = ~0u;
@@ -547,6 +576,7 @@ private:
     __forceinline ResourceBindInfo& GetBindInfo(PIPELINE_TYPE Type);
 
     __forceinline void CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask);
+    void               CommitDescriptorBuffers(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask);
 #ifdef DILIGENT_DEVELOPMENT
     void DvpValidateCommittedShaderResources(ResourceBindInfo& BindInfo);
 #endif
@@ -554,6 +584,16 @@ private:
     /// Resource binding information for each pipeline type (graphics/mesh, compute, ray tracing)
     std::array<ResourceBindInfo, NUM_PIPELINE_BIND_POINTS> m_BindInfo;
 
+    struct DescrBufferSetInfo
+    {
+        VkDeviceSize Offset   = 0;
+        VkDeviceSize Size     = 0;
+        Uint32       Revision = 0;
+    };
+    /// Static/mutable descriptor sets of SRB resource caches written to the dynamic heap
+    /// in the current frame by CommitDescriptorBuffers(), indexed by the cache unique ID.
+    std::unordered_map<UniqueIdentifier, DescrBufferSetInfo> m_StaticDescrBufferSets;
+
     /// Memory to store dynamic buffer offsets for descriptor sets.
     std::vector<Uint32> m_DynamicBufferOffsets;
 
@@ -568,6 +608,21 @@ private:
     /// This framebuffer may or may not be currently set in the command buffer
     VkFramebuffer m_vkFramebuffer = VK_NULL_HANDLE;
 
+    /// Contents of the subpasses of the active render pass (immediate contexts only).
+    /// VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS if the pass was begun by BeginSecondaryRenderPass().
+    VkSubpassContents m_vkSubpassContents = VK_SUBPASS_CONTENTS_INLINE;
+
+    /// Deferred contexts only: true if the context is recording a secondary command buffer
+    /// that was begun by BeginSecondaryCommandList().
+    bool m_IsRecordingSecondary = false;
+
+    /// Secondary command buffers executed by ExecuteSecondaryCommandLists() that will be
+    /// disposed by the deferred contexts that recorded them when the context is flushed.
+    std::vector<std::pair<RefCntAutoPtr<IDeviceContext>, VkCommandBuffer>> m_ExecutedSecondaryCmdBuffers;
+
+    /// Temporary array used by ExecuteSecondaryCommandLists()
+    std::vector<VkCommandBuffer> m_vkSecondaryCmdBuffs;
+
     FixedBlockMemoryAllocator m_CmdListAllocator;
 
     // Semaphores are not owned by the command context
@@ -587,6 +642,12 @@ private:
     std::vector<std::pair<Uint64, RefCntAutoPtr<FenceVkImpl>>> m_SignalFences;
     std::vector<std::pair<Uint64, RefCntAutoPtr<FenceVkImpl>>> m_WaitFences;
 
+    // List of queues whose timeline semaphores to wait for next time the command context is flushed
+    std::vector<std::pair<Uint64, SoftwareQueueIndex>> m_WaitQueues;
+
+    // Fence value of the last command buffer submitted by the immediate context
+    Uint64 m_LastSubmittedFenceValue = 0;
+
     std::unordered_map<BufferVkImpl*, VulkanUploadAllocation> m_UploadAllocations;
 
     struct MappedTextureKey
@@ -631,6 +692,9 @@ private:
     QueryManagerVk* m_pQueryMgr            = nullptr;
     Int32           m_ActiveQueriesCounter = 0;
 
+    // GPU profiler that measures debug groups, only created for immediate contexts
+    std::unique_ptr<GPUProfilerVk> m_pProfiler;
+
     std::vector<VkClearValue> m_vkClearValues;
 
     VulkanUtilities::QueryPoolWrapper m_ASQueryPool;
@@ -0,0 +1,165 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::GPUProfilerVk class
+
+#include <array>
+#include <vector>
+
+#include "DeviceContextVk.h"
+#include "VulkanUtilities/VulkanObjectWrappers.hpp"
+#include "VulkanUtilities/VulkanCommandBuffer.hpp"
+#include "VulkanUtilities/VulkanMemoryManager.hpp"
+
+namespace Diligent
+{
+
+class RenderDeviceVkImpl;
+class QueryManagerVk;
+
+/// GPU frame profiler of an immediate context.
+
+/// Every debug group begun in the context is a profiler scope whose beginning and end
+/// are marked with timestamp queries. Timestamp queries of a frame are allocated from the
+/// query manager as one contiguous range and are used in the order they are written, so that
+/// the queries written since the last flush always form a contiguous subrange whose results
+/// are copied into the readback buffer by a single vkCmdCopyQueryPoolResults command.
+/// The results are read by the CPU when the frame has been completed by the GPU.
+class GPUProfilerVk
+{
+public:
+    GPUProfilerVk(RenderDeviceVkImpl* pDeviceVk,
+                  QueryManagerVk&     QueryMgr,
+                  Uint32              MaxScopesPerFrame);
+    ~GPUProfilerVk();
+
+    // clang-format off
+    GPUProfilerVk           (const GPUProfilerVk&)  = delete;
+    GPUProfilerVk           (      GPUProfilerVk&&) = delete;
+    GPUProfilerVk& operator=(const GPUProfilerVk&)  = delete;
+    GPUProfilerVk& operator=(      GPUProfilerVk&&) = delete;
+    // clang-format on
+
+    // The maximum number of frames that may be profiled while the GPU has not completed them.
+    // If the GPU falls further behind, the following frames are not profiled.
+    static constexpr Uint32 MaxFramesInFlight = 4;
+
+    // Returns the number of timestamp queries the profiler allocates from the query manager.
+    // The range of a frame that has just been read back is stale until the next flush,
+    // so one more frame range is required.
+    static Uint32 GetRequiredQueryCount(Uint32 MaxScopesPerFrame)
+    {
+        return MaxScopesPerFrame * 2 * (MaxFramesInFlight + 1);
+    }
+
+    void BeginScope(VulkanUtilities::VulkanCommandBuffer& CmdBuffer, const Char* Name);
+    void EndScope(VulkanUtilities::VulkanCommandBuffer& CmdBuffer);
+
+    // Records the commands that copy the results of all queries written since the last call
+    // into the readback buffer. Returns the number of recorded commands.
+    Uint32 ResolveQueries(VulkanUtilities::VulkanCommandBuffer& CmdBuffer);
+
+    // Must be called after the command buffer passed to ResolveQueries() has been submitted.
+    void OnCommandBufferSubmitted(Uint64 FenceValue);
+
+    // Finishes the current frame and reads back the results of all frames completed by the GPU.
+    void EndFrame(Uint64 CompletedFenceValue);
+
+    GPUProfilerFrameVk GetLastFrame() const;
+
+private:
+    static constexpr Uint32 InvalidIndex = ~0u;
+
+    struct ScopeData
+    {
+        Uint32 NameOffset  = 0;
+        Uint32 ParentIndex = InvalidIndex;
+        Uint32 Depth       = 0;
+        Uint32 BeginQuery  = InvalidIndex;
+        Uint32 EndQuery    = InvalidIndex;
+    };
+
+    struct FrameData
+    {
+        Uint64 FrameNumber = 0;
+
+        // The first query of the frame's query range, or InvalidIndex if the range could not be allocated.
+        Uint32 FirstQuery = InvalidIndex;
+
+        Uint32 NumWrittenQueries  = 0;
+        Uint32 NumResolvedQueries = 0;
+        Uint32 NumDroppedScopes   = 0;
+
+        // Fence value of the last submission that copies the frame's query results.
+        Uint64 ResolveFenceValue = 0;
+
+        bool IsInUse  = false;
+        bool IsEnded  = false;
+        bool IsQueued = false; // Resolve commands have been recorded, but not submitted
+
+        std::vector<ScopeData> Scopes;
+        std::vector<char>      Names;
+    };
+
+    bool IsReadyForReadback(const FrameData& Frame, Uint64 CompletedFenceValue) const;
+    void ReadBack(FrameData& Frame, Uint32 Slot);
+    void BeginFrame();
+
+    RenderDeviceVkImpl* const m_pDevice;
+    QueryManagerVk&           m_QueryMgr;
+
+    const VkQueryPool m_vkQueryPool;
+    const Uint32      m_MaxScopesPerFrame;
+    const Uint32      m_QueriesPerFrame;
+    const double      m_TimestampPeriod; // Seconds per tick
+
+    VulkanUtilities::BufferWrapper          m_ReadbackBuffer;
+    VulkanUtilities::VulkanMemoryAllocation m_ReadbackMemory;
+    const Uint64*                           m_pReadbackData = nullptr;
+
+    std::array<FrameData, MaxFramesInFlight> m_Frames;
+
+    // Slot of the current frame, or of the last profiled frame if the current frame is not profiled.
+    Uint32     m_CurrSlot    = 0;
+    FrameData* m_pCurrFrame  = nullptr;
+    Uint64     m_FrameNumber = 0;
+
+    // Indices of the open scopes in the current frame. Scopes that are not recorded are InvalidIndex.
+    std::vector<Uint32> m_OpenScopes;
+    // The number of scopes left open when the frame was finished.
+    size_t m_NumOrphanedScopes = 0;
+
+    Uint64                          m_LastFrameNumber       = 0;
+    Uint32                          m_LastDroppedScopeCount = 0;
+    Float64                         m_LastTotalTime         = 0;
+    std::vector<GPUProfilerScopeVk> m_LastScopes;
+    std::vector<char>               m_LastNames;
+};
+
+} // namespace Diligent
@@ -0,0 +1,138 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::PipelineCacheManagerVk class
+
+#include <mutex>
+#include <vector>
+#include <string>
+
+#include "RenderDeviceVk.h"
+#include "Timer.hpp"
+#include "VulkanUtilities/VulkanLogicalDevice.hpp"
+#include "VulkanUtilities/VulkanObjectWrappers.hpp"
+
+namespace Diligent
+{
+
+/// Device-wide Vulkan pipeline cache that is persisted in a directory on disk.
+
+/// Pipelines may be created by multiple threads in parallel (e.g. by the asynchronous
+/// compilation thread pool). To avoid contention on a single cache object, every thread
+/// acquires its own VkPipelineCache from the pool. All caches are seeded with the data loaded
+/// from disk and are merged with vkMergePipelineCaches() when the cache is saved.
+class PipelineCacheManagerVk
+{
+public:
+    PipelineCacheManagerVk(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice,
+                           const VkPhysicalDeviceProperties&           DeviceProps,
+                           const char*                                 CacheDirectory);
+    ~PipelineCacheManagerVk();
+
+    // clang-format off
+    PipelineCacheManagerVk           (const PipelineCacheManagerVk&)  = delete;
+    PipelineCacheManagerVk           (      PipelineCacheManagerVk&&) = delete;
+    PipelineCacheManagerVk& operator=(const PipelineCacheManagerVk&)  = delete;
+    PipelineCacheManagerVk& operator=(      PipelineCacheManagerVk&&) = delete;
+    // clang-format on
+
+    /// Pipeline cache that is exclusively used by one thread while it creates a pipeline.
+    /// The cache is returned to the pool and the creation time is recorded when the object is destroyed.
+    class ScopedCache
+    {
+    public:
+        ScopedCache(PipelineCacheManagerVk* pMgr, VkPipelineCache vkCache) noexcept :
+            m_pMgr{pMgr},
+            m_vkCache{vkCache}
+        {}
+
+        // clang-format off
+        ScopedCache           (const ScopedCache&) = delete;
+        ScopedCache& operator=(const ScopedCache&) = delete;
+        ScopedCache& operator=(      ScopedCache&&) = delete;
+        // clang-format on
+
+        ScopedCache(ScopedCache&& Other) noexcept :
+            m_pMgr{Other.m_pMgr},
+            m_vkCache{Other.m_vkCache},
+            m_Timer{Other.m_Timer}
+        {
+            Other.m_pMgr    = nullptr;
+            Other.m_vkCache = VK_NULL_HANDLE;
+        }
+
+        ~ScopedCache()
+        {
+            if (m_pMgr != nullptr)
+                m_pMgr->Release(m_vkCache, m_Timer.GetElapsedTime());
+        }
+
+        operator VkPipelineCache() const { return m_vkCache; }
+
+    private:
+        PipelineCacheManagerVk* m_pMgr    = nullptr;
+        VkPipelineCache         m_vkCache = VK_NULL_HANDLE;
+        Timer                   m_Timer;
+    };
+
+    /// Returns a cache that the calling thread may use until the returned object is destroyed.
+    ScopedCache Acquire();
+
+    /// Merges all caches and atomically writes the result to the cache file.
+    bool Save();
+
+    PipelineCacheStatsVk GetStats() const;
+
+    const std::string& GetFilePath() const { return m_FilePath; }
+
+private:
+    void Release(VkPipelineCache vkCache, double CreationTime);
+
+    VulkanUtilities::PipelineCacheWrapper CreateCache(const char* DebugName) const;
+
+    const VulkanUtilities::VulkanLogicalDevice& m_LogicalDevice;
+
+    // Path to the cache file, e.g. "<CacheDirectory>/VkPipelineCache_10de_2484_...bin"
+    std::string m_FilePath;
+
+    // Cache data loaded from disk. Every cache in the pool is initialized with this data.
+    std::vector<Uint8> m_InitialData;
+
+    // Target of vkMergePipelineCaches(). Access is protected by m_SaveMtx.
+    std::mutex                            m_SaveMtx;
+    VulkanUtilities::PipelineCacheWrapper m_MergedCache;
+
+    mutable std::mutex                                 m_PoolMtx;
+    std::vector<VulkanUtilities::PipelineCacheWrapper> m_Caches;
+    std::vector<VkPipelineCache>                       m_AvailableCaches;
+
+    PipelineCacheStatsVk m_Stats;
+};
+
+} // namespace Diligent
@@ -31,6 +31,7 @@
 /// Declaration of Diligent::PipelineResourceSignatureVkImpl class
 
 #include <array>
+#include <vector>
 
 #include "EngineVkImplTraits.hpp"
 #include "PipelineResourceSignatureBase.hpp"
@@ -134,6 +135,18 @@ public:
     void CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
                                 VkDescriptorSet              vkDynamicDescriptorSet) const;
 
+    // Returns the size of the descriptor set in the descriptor buffer.
+    // Only valid when descriptor buffers are used.
+    VkDeviceSize GetDescriptorBufferSetSize(DESCRIPTOR_SET_ID SetId) const { return m_DescrBufferSets[SetId].Size; }
+
+    // Writes descriptors of all resources in the given set from ResourceCache to pDescriptors,
+    // which must point to at least GetDescriptorBufferSetSize(SetId) bytes of the descriptor buffer.
+    // Dynamic buffer offsets of the context CtxId are applied to buffer addresses.
+    void WriteDescriptorBuffer(const ShaderResourceCacheVk& ResourceCache,
+                               DESCRIPTOR_SET_ID            SetId,
+                               DeviceContextIndex           CtxId,
+                               void*                        pDescriptors) const;
+
 #ifdef DILIGENT_DEVELOPMENT
     /// Verifies committed resource using the SPIRV resource attributes from the PSO.
     bool DvpValidateCommittedResource(const DeviceContextVkImpl*        pDeviceCtx,
@@ -178,15 +191,54 @@ private:
 
     void CreateSetLayouts(bool IsSerialized);
 
+    void CreateDescriptorUpdateTemplates(const std::array<std::vector<VkDescriptorUpdateTemplateEntry>, DESCRIPTOR_SET_ID_NUM_SETS>& TemplateEntries);
+
+    void InitDescriptorBufferData(const std::array<std::vector<VkDescriptorSetLayoutBinding>, DESCRIPTOR_SET_ID_NUM_SETS>& SetLayoutBindings);
+
     static inline CACHE_GROUP       GetResourceCacheGroup(const PipelineResourceDesc& Res);
     static inline DESCRIPTOR_SET_ID VarTypeToDescriptorSetId(SHADER_RESOURCE_VARIABLE_TYPE VarType);
 
 private:
     std::array<VulkanUtilities::DescriptorSetLayoutWrapper, DESCRIPTOR_SET_ID_NUM_SETS> m_VkDescrSetLayouts;
 
+    // Descriptor update templates that write static resources of the static/mutable set and all resources
+    // of the dynamic set from the descriptor data of the SRB resource cache with a single call.
+    // Null if VK_KHR_descriptor_update_template is not enabled.
+    std::array<VulkanUtilities::DescrUpdateTemplateWrapper, DESCRIPTOR_SET_ID_NUM_SETS> m_VkDescrUpdateTemplates;
+
+    // The number of descriptors written by each update template
+    std::array<Uint32, DESCRIPTOR_SET_ID_NUM_SETS> m_DescrUpdateTemplateSizes = {};
+
+    // Indices of dynamic combined image samplers without immutable samplers. Their samplers are
+    // read from the texture views every time the dynamic set is written with the update template.
+    std::vector<Uint32> m_DynamicCombinedSamplers;
+
     // Descriptor set sizes indexed by the set index in the layout (not DESCRIPTOR_SET_ID!)
     std::array<Uint32, MAX_DESCRIPTOR_SETS> m_DescriptorSetSizes = {~0U, ~0U};
 
+    // Descriptor buffer layout of each descriptor set. Only initialized when descriptor buffers are used.
+    struct DescriptorBufferSetData
+    {
+        // The size of the set layout in the descriptor buffer
+        VkDeviceSize Size = 0;
+
+        // Descriptors of immutable separate samplers that must be written by the application.
+        // Empty if the set has no immutable separate samplers.
+        std::vector<Uint8> InitData;
+    };
+    std::array<DescriptorBufferSetData, DESCRIPTOR_SET_ID_NUM_SETS> m_DescrBufferSets;
+
+    struct DescriptorBufferBinding
+    {
+        // Offset of the binding in the set layout
+        VkDeviceSize Offset = 0;
+
+        // Immutable sampler of a combined image sampler, which must be provided when the descriptor is written
+        VkSampler vkImmutableSampler = VK_NULL_HANDLE;
+    };
+    // Descriptor buffer bindings indexed by the resource index. Only initialized when descriptor buffers are used.
+    std::vector<DescriptorBufferBinding> m_DescrBufferBindings;
+
     // The total number of uniform buffers with dynamic offsets in both descriptor sets,
     // accounting for array size.
     Uint16 m_DynamicUniformBufferCount = 0;
@@ -111,6 +111,7 @@ public:
         bool                                                 bVerifyOnly,
         bool                                                 bStripReflection,
         const char*                                          PipelineName,
+        IThreadPool*                                         pThreadPool,
         TShaderResources*                                    pShaderResources     = nullptr,
         TResourceAttibutions*                                pResourceAttibutions = nullptr) noexcept(false);
 
@@ -62,6 +62,12 @@ public:
     Uint32 AllocateQuery(QUERY_TYPE Type);
     void   DiscardQuery(QUERY_TYPE Type, Uint32 Index);
 
+    // Allocates Count queries with consecutive indices, so that their results can be
+    // read with a single vkCmdCopyQueryPoolResults command.
+    // Returns the index of the first query, or InvalidIndex if there is no free range of the requested size.
+    Uint32 AllocateQueryRange(QUERY_TYPE Type, Uint32 Count);
+    void   DiscardQueryRange(QUERY_TYPE Type, Uint32 FirstIndex, Uint32 Count);
+
     VkQueryPool GetQueryPool(QUERY_TYPE Type) const
     {
         return m_Pools[Type].GetVkQueryPool();
@@ -100,6 +106,8 @@ private:
 
         Uint32 Allocate();
         void   Discard(Uint32 Index);
+        Uint32 AllocateRange(Uint32 Count);
+        void   DiscardRange(Uint32 FirstIndex, Uint32 Count);
         Uint32 ResetStaleQueries(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice, VulkanUtilities::VulkanCommandBuffer& CmdBuff);
 
         QUERY_TYPE GetType() const
@@ -131,7 +139,7 @@ private:
         Uint32     m_MaxAllocatedQueries = 0;
 
         std::mutex          m_QueriesMtx;
-        std::vector<Uint32> m_AvailableQueries;
+        std::vector<Uint32> m_AvailableQueries; // Sorted in descending order, so Allocate() takes the lowest index
         std::vector<Uint32> m_StaleQueries;
     };
 
@@ -29,7 +29,9 @@
 
 /// \file
 /// Declaration of Diligent::RenderDeviceVkImpl class
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -53,6 +55,7 @@
 #include "RenderPassCache.hpp"
 #include "CommandPoolManager.hpp"
 #include "DXCompiler.hpp"
+#include "PipelineCacheManagerVk.hpp"
 
 namespace Diligent
 {
@@ -201,6 +204,22 @@ public:
                                                                   const FenceDesc& Desc,
                                                                   IFence**         ppFence) override final;
 
+    /// Implementation of IRenderDeviceVk::GetMemoryBudget().
+    virtual MemoryBudgetVk DILIGENT_CALL_TYPE GetMemoryBudget() override final;
+
+    /// Implementation of IRenderDeviceVk::SavePipelineCache().
+    virtual Bool DILIGENT_CALL_TYPE SavePipelineCache() override final;
+
+    /// Implementation of IRenderDeviceVk::GetPipelineCacheStats().
+    virtual PipelineCacheStatsVk DILIGENT_CALL_TYPE GetPipelineCacheStats() override final;
+
+    /// Implementation of IRenderDeviceVk::GetReleaseQueueStats().
+    virtual ReleaseQueueStats DILIGENT_CALL_TYPE GetReleaseQueueStats(Uint32 QueueIndex) const override final
+    {
+        DEV_CHECK_ERR(QueueIndex < GetCommandQueueCount(), "Command queue index (", QueueIndex, ") is out of range");
+        return QueueIndex < GetCommandQueueCount() ? QueryReleaseQueueStats(SoftwareQueueIndex{QueueIndex}) : ReleaseQueueStats{};
+    }
+
     /// Implementation of IRenderDevice::IdleGPU() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE IdleGPU() override final;
 
@@ -214,6 +233,27 @@ public:
                                   const Char*                           DebugPoolName = nullptr);
     void ExecuteAndDisposeTransientCmdBuff(SoftwareQueueIndex CommandQueueId, VkCommandBuffer vkCmdBuff, VulkanUtilities::CommandPoolWrapper&& CmdPool);
 
+    // Writes the initial data to pStagingData and records the commands that copy
+    // it from vkStagingBuffer at StagingOffset to the resource.
+    using InitialDataUploadCallbackType = std::function<void(VulkanUtilities::VulkanCommandBuffer& CmdBuffer,
+                                                             VkBuffer                              vkStagingBuffer,
+                                                             VkDeviceSize                          StagingOffset,
+                                                             Uint8*                                pStagingData)>;
+
+    // Appends the initial-data upload to the upload batch of the given command queue.
+    // Returns false if upload batching is disabled or the data does not fit into a batch,
+    // in which case the caller must upload the data through a transient command buffer.
+    bool EnqueueInitialDataUpload(SoftwareQueueIndex                   CommandQueueId,
+                                  VkDeviceSize                         Size,
+                                  VkDeviceSize                         Alignment,
+                                  const InitialDataUploadCallbackType& Callback);
+
+    // Submits all pending initial-data uploads of the given command queue.
+    void FlushInitialDataUploads(SoftwareQueueIndex CommandQueueId);
+
+    // Submits pending initial-data uploads of all command queues.
+    void FlushAllInitialDataUploads();
+
     /// Implementation of IRenderDevice::ReleaseStaleResources() in Vulkan backend.
     virtual void DILIGENT_CALL_TYPE ReleaseStaleResources(bool ForceRelease = false) override final;
 
@@ -233,6 +273,10 @@ public:
     const VulkanUtilities::VulkanPhysicalDevice& GetPhysicalDevice() const { return *m_PhysicalDevice; }
     const VulkanUtilities::VulkanLogicalDevice&  GetLogicalDevice() const { return *m_LogicalVkDevice; }
 
+    // Returns true if shader resources are bound through descriptor buffers rather than descriptor sets
+    // allocated from descriptor pools (see EngineVkCreateInfo::EnableDescriptorBuffers).
+    bool UseDescriptorBuffers() const { return m_LogicalVkDevice->GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE; }
+
     FramebufferCache& GetFramebufferCache() { return m_FramebufferCache; }
     RenderPassCache&  GetImplicitRenderPassCache() { return m_ImplicitRenderPassCache; }
 
@@ -247,6 +291,17 @@ public:
         const auto MemoryFlags = MemoryProps.memoryTypes[MemoryTypeIndex].propertyFlags;
         return m_MemoryMgr.Allocate(Size, Alignment, MemoryTypeIndex, (MemoryFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0, AllocateFlags);
     }
+    VulkanUtilities::VulkanMemoryAllocation AllocateDedicatedMemory(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProperties, const VkMemoryDedicatedAllocateInfo& DedicatedAllocInfo, VkMemoryAllocateFlags AllocateFlags = 0)
+    {
+        return m_MemoryMgr.AllocateDedicated(MemReqs, MemoryProperties, AllocateFlags, DedicatedAllocInfo);
+    }
+    VulkanUtilities::VulkanMemoryAllocation AllocateDedicatedMemory(VkDeviceSize Size, uint32_t MemoryTypeIndex, const VkMemoryDedicatedAllocateInfo& DedicatedAllocInfo, VkMemoryAllocateFlags AllocateFlags = 0)
+    {
+        const auto& MemoryProps = m_PhysicalDevice->GetMemoryProperties();
+        VERIFY_EXPR(MemoryTypeIndex < MemoryProps.memoryTypeCount);
+        const auto MemoryFlags = MemoryProps.memoryTypes[MemoryTypeIndex].propertyFlags;
+        return m_MemoryMgr.AllocateDedicated(Size, MemoryTypeIndex, (MemoryFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0, AllocateFlags, DedicatedAllocInfo);
+    }
     VulkanUtilities::VulkanMemoryManager& GetGlobalMemoryManager() { return m_MemoryMgr; }
 
     VulkanDynamicMemoryManager& GetDynamicMemoryManager() { return m_DynamicMemoryManager; }
@@ -255,6 +310,9 @@ public:
 
     IDXCompiler* GetDxCompiler() const { return m_pDxCompiler.get(); }
 
+    // Returns null if the device pipeline cache is not enabled
+    PipelineCacheManagerVk* GetPipelineCacheManager() { return m_pPipelineCacheMgr.get(); }
+
     struct Properties
     {
         const Uint32 ShaderGroupHandleSize;
@@ -308,11 +366,35 @@ private:
     // Each command queue needs its own query manager to avoid race conditions.
     std::vector<std::unique_ptr<QueryManagerVk>> m_QueryMgrs;
 
+    // Initial-data uploads of buffers and textures that are recorded into a shared
+    // command buffer and submitted together with a single fence.
+    struct InitialDataUploadBatch
+    {
+        std::mutex Mtx;
+
+        VulkanUtilities::CommandPoolWrapper     CmdPool;
+        VulkanUtilities::VulkanCommandBuffer    CmdBuffer;
+        VulkanUtilities::BufferWrapper          StagingBuffer;
+        VulkanUtilities::VulkanMemoryAllocation StagingMemory;
+
+        Uint8*       pStagingData = nullptr;
+        VkDeviceSize Offset       = 0;
+    };
+    void SubmitInitialDataUploadBatch(SoftwareQueueIndex CommandQueueId, InitialDataUploadBatch& Batch);
+
     VulkanUtilities::VulkanMemoryManager m_MemoryMgr;
 
     VulkanDynamicMemoryManager m_DynamicMemoryManager;
 
+    const Uint32 m_InitialDataUploadBatchSize;
+
+    // Every command queue has its own upload batch.
+    std::vector<std::unique_ptr<InitialDataUploadBatch>> m_InitialDataUploadBatches;
+
     std::unique_ptr<IDXCompiler> m_pDxCompiler;
+
+    // Device pipeline cache, see EngineVkCreateInfo::PipelineCacheDirectory
+    std::unique_ptr<PipelineCacheManagerVk> m_pPipelineCacheMgr;
 };
 
 } // namespace Diligent
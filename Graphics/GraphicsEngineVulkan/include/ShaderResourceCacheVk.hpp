@@ -37,7 +37,7 @@
 //  m_pMemory                                |   |              m_pResources, m_NumResources == m            |
 //  |               m_DescriptorSetAllocation|   |                                                           |
 //  V                                        |   |                                                           V
-//  |  DescriptorSet[0]  |   ....    |  DescriptorSet[Ns-1]  |  Res[0]  |  ... |  Res[n-1]  |    ....     | Res[0]  |  ... |  Res[m-1]  |
+//  |  DescriptorSet[0]  |   ....    |  DescriptorSet[Ns-1]  |  Res[0]  |  ... |  Res[n-1]  |    ....     | Res[0]  |  ... |  Res[m-1]  |  Data[0]  |  ... |  Data[n+m-1]  |
 //         |    |                                                A \
 //         |    |                                                |  \
 //         |    |________________________________________________|   \RefCntAutoPtr
@@ -52,6 +52,10 @@
 //
 // Descriptor set for static and mutable resources is assigned during cache initialization
 // Descriptor set for dynamic resources is assigned at every draw call
+//
+// Data[] is the array of DescriptorData elements, one for every resource (m_pDescriptorData in
+// each set points to its first element). In SRB caches, it holds the Vulkan descriptor info
+// packed in the layout expected by the descriptor update templates of the resource signature.
 
 #include <vector>
 #include <memory>
@@ -140,14 +144,26 @@ public:
         explicit operator bool() const { return !IsNull(); }
     };
 
-    // sizeof(DescriptorSet) == 48 (x64, msvc, Release)
+    // Vulkan descriptor info of a single resource. Descriptor update templates read
+    // descriptors from arrays of this union with the stride of sizeof(DescriptorData).
+    // sizeof(DescriptorData) == 24 (x64)
+    union DescriptorData
+    {
+        VkDescriptorImageInfo      ImageInfo;
+        VkDescriptorBufferInfo     BufferInfo;
+        VkBufferView               BufferView;
+        VkAccelerationStructureKHR AccelStruct;
+    };
+
+    // sizeof(DescriptorSet) == 56 (x64, msvc, Release)
     class DescriptorSet
     {
     public:
         // clang-format off
-        DescriptorSet(Uint32 NumResources, Resource *pResources) :
-            m_NumResources  {NumResources},
-            m_pResources    {pResources  }
+        DescriptorSet(Uint32 NumResources, Resource *pResources, DescriptorData* pDescriptorData) :
+            m_NumResources   {NumResources   },
+            m_pResources     {pResources     },
+            m_pDescriptorData{pDescriptorData}
         {}
 
         DescriptorSet             (const DescriptorSet&) = delete;
@@ -164,6 +180,13 @@ public:
 
         Uint32 GetSize() const { return m_NumResources; }
 
+        // Returns the number of non-null resources in the set
+        Uint32 GetNumBoundResources() const { return m_NumBoundResources; }
+
+        // Returns the packed descriptor data of all resources in the set, in the cache order.
+        // The data is only maintained by SRB caches.
+        const DescriptorData* GetDescriptorData() const { return m_pDescriptorData; }
+
         VkDescriptorSet GetVkDescriptorSet() const
         {
             return m_DescriptorSetAllocation.GetVkDescriptorSet();
@@ -171,10 +194,12 @@ public:
 
     private:
         // clang-format off
-/* 0 */ const Uint32            m_NumResources = 0;
-/* 8 */ Resource* const         m_pResources   = nullptr;
-/*16 */ DescriptorSetAllocation m_DescriptorSetAllocation;
-/*48 */ // End of structure
+/* 0 */ const Uint32            m_NumResources      = 0;
+/* 4 */ Uint32                  m_NumBoundResources = 0;
+/* 8 */ Resource* const         m_pResources        = nullptr;
+/*16 */ DescriptorData* const   m_pDescriptorData   = nullptr;
+/*24 */ DescriptorSetAllocation m_DescriptorSetAllocation;
+/*56 */ // End of structure
         // clang-format on
 
     private:
@@ -229,7 +254,9 @@ public:
         {
         }
     };
-    // Sets the resource at the given descriptor set index and offset
+    // Sets the resource at the given descriptor set index and offset.
+    // If pLogicalDevice is null, the descriptor is not written to the Vulkan descriptor set,
+    // and the caller is responsible for updating the set from the descriptor data.
     const Resource& SetResource(const VulkanUtilities::VulkanLogicalDevice* pLogicalDevice,
                                 Uint32                                      DescrSetIndex,
                                 Uint32                                      CacheOffset,
@@ -245,6 +272,12 @@ public:
                                 Uint32 CacheOffset,
                                 Uint32 DynamicBufferOffset);
 
+    // Re-reads the samplers of the combined image samplers in the given range from their texture views
+    // into the descriptor data, since a sampler may be assigned to a view after the view has been bound.
+    void UpdateCombinedSamplers(Uint32 DescrSetIndex,
+                                Uint32 CacheOffset,
+                                Uint32 ArraySize) const;
+
 
     Uint32 GetNumDescriptorSets() const { return m_NumSets; }
     bool   HasDynamicResources() const { return m_NumDynamicBuffers > 0; }
@@ -32,7 +32,12 @@
 
 #include "EngineVkImplTraits.hpp"
 #include "ShaderBase.hpp"
+#include <atomic>
+#include <memory>
+#include <mutex>
+
 #include "SPIRVShaderResources.hpp"
+#include "SPIRVUtils.hpp"
 #include "ThreadPool.h"
 #include "RefCntAutoPtr.hpp"
 
@@ -110,15 +115,49 @@ public:
         Size        = m_SPIRV.size() * sizeof(m_SPIRV[0]);
     }
 
+    /// SPIRV code with reflection instructions stripped and the decoration
+    /// offsets of the shader resources in this code.
+    struct StrippedSPIRVInfo
+    {
+        std::vector<uint32_t> SPIRV;
+
+        /// Decoration offsets in SPIRV, indexed by the resource index in SPIRVShaderResources.
+        std::vector<SPIRVResourceDecorationOffsets> ResourceOffsets;
+    };
+
+    /// Returns the shader code with reflection instructions stripped.
+
+    /// \remarks   The code and the offsets are computed once, when the method is first called,
+    ///            so that pipelines only need to copy the code and patch the bindings.
+    ///            The method returns null if the code contains no reflection instructions
+    ///            or if stripping failed, in which case the original code should be used.
+    const StrippedSPIRVInfo* GetStrippedSPIRV() const;
+
+    /// Computes the stripped code of multiple shaders at once.
+
+    /// \remarks   The shaders are processed in parallel by the thread pool, see OptimizeSPIRVBatch().
+    ///            Shaders whose stripped code has already been computed are skipped.
+    ///            The results are returned by GetStrippedSPIRV().
+    static void StripReflection(const ShaderVkImpl* const* ppShaders,
+                                size_t                     NumShaders,
+                                IThreadPool*               pThreadPool);
+
 private:
     void Initialize(const ShaderCreateInfo& ShaderCI,
                     const CreateInfo&       VkShaderCI) noexcept(false);
 
+    bool HasReflectionToStrip() const;
+    void InitStrippedSPIRV(std::vector<uint32_t>&& StrippedSPIRV) const;
+
 private:
     std::shared_ptr<const SPIRVShaderResources> m_pShaderResources;
 
     std::string           m_EntryPoint;
     std::vector<uint32_t> m_SPIRV;
+
+    mutable std::once_flag                           m_StrippedSPIRVFlag;
+    mutable std::unique_ptr<const StrippedSPIRVInfo> m_pStrippedSPIRV;
+    mutable std::atomic<bool>                        m_StrippedSPIRVReady{false};
 };
 
 } // namespace Diligent
@@ -126,9 +126,10 @@ struct VulkanDynamicAllocation
 class VulkanDynamicMemoryManager : public DynamicHeap::MasterBlockListBasedManager
 {
 public:
-    using TBase       = DynamicHeap::MasterBlockListBasedManager;
-    using OffsetType  = TBase::OffsetType;
-    using MasterBlock = TBase::MasterBlock;
+    using TBase            = DynamicHeap::MasterBlockListBasedManager;
+    using OffsetType       = TBase::OffsetType;
+    using MasterBlock      = TBase::MasterBlock;
+    using MasterBlockCache = TBase::MasterBlockCache;
 
     VulkanDynamicMemoryManager(IMemoryAllocator&         Allocator,
                                class RenderDeviceVkImpl& DeviceVk,
@@ -142,20 +143,23 @@ public:
     VulkanDynamicMemoryManager& operator= (const VulkanDynamicMemoryManager&)  = delete;
     VulkanDynamicMemoryManager& operator= (      VulkanDynamicMemoryManager&&) = delete;
 
-    VkBuffer GetVkBuffer()  const{return m_VkBuffer;}
-    Uint8*   GetCPUAddress()const{return m_CPUAddress;}
+    VkBuffer        GetVkBuffer()       const{return m_VkBuffer;}
+    Uint8*          GetCPUAddress()     const{return m_CPUAddress;}
+    // Only valid when descriptor buffers are used
+    VkDeviceAddress GetVkDeviceAddress()const{return m_VkDeviceAddress;}
     // clang-format on
 
     void Destroy();
 
     static constexpr const Uint32 MasterBlockAlignment = 1024;
-    MasterBlock                   AllocateMasterBlock(OffsetType SizeInBytes, OffsetType Alignment);
+    MasterBlock                   AllocateMasterBlock(OffsetType SizeInBytes, OffsetType Alignment, MasterBlockCache* pCache = nullptr);
 
 private:
     RenderDeviceVkImpl&                  m_DeviceVk;
     VulkanUtilities::BufferWrapper       m_VkBuffer;
     VulkanUtilities::DeviceMemoryWrapper m_BufferMemory;
     Uint8*                               m_CPUAddress;
+    VkDeviceAddress                      m_VkDeviceAddress = 0;
     const VkDeviceSize                   m_DefaultAlignment;
     const Uint64                         m_CommandQueueMask;
     OffsetType                           m_TotalPeakSize = 0;
@@ -169,7 +173,9 @@ private:
 // upload heap uses global memory manager.
 //
 // The heap allocates master blocks from the global dynamic memory manager.
-// The pages are released and returned to the manager at the end of every frame.
+// The pages are released at the end of every frame and are returned to the heap's
+// master block cache once the GPU is done with them, so that they can be reused
+// without locking the global manager.
 //
 //   _______________________________________________________________________________________________________________________________
 //  |                                                                                                                               |
@@ -195,6 +201,7 @@ public:
     VulkanDynamicHeap(VulkanDynamicMemoryManager& DynamicMemMgr, std::string HeapName, Uint32 PageSize) :
         m_GlobalDynamicMemMgr{DynamicMemMgr},
         m_HeapName           {std::move(HeapName)},
+        m_pMasterBlockCache  {DynamicMemMgr.CreateMasterBlockCache(PageSize)},
         m_MasterBlockSize    (PageSize)
     {}
 
@@ -223,8 +230,9 @@ public:
     size_t GetAllocatedMasterBlockCount() const { return m_MasterBlocks.size(); }
 
 private:
-    VulkanDynamicMemoryManager& m_GlobalDynamicMemMgr;
-    const std::string           m_HeapName;
+    VulkanDynamicMemoryManager&                   m_GlobalDynamicMemMgr;
+    const std::string                             m_HeapName;
+    VulkanDynamicMemoryManager::MasterBlockCache* m_pMasterBlockCache = nullptr;
 
     std::vector<MasterBlock> m_MasterBlocks;
 
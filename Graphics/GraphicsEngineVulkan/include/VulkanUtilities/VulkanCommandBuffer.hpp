@@ -31,6 +31,11 @@
 #include "VulkanHeaders.h"
 #include "DebugUtilities.hpp"
 
+namespace Diligent
+{
+struct DeviceContextBarrierStats;
+}
+
 namespace VulkanUtilities
 {
 
@@ -266,7 +271,8 @@ public:
                                        uint32_t            FramebufferWidth,
                                        uint32_t            FramebufferHeight,
                                        uint32_t            ClearValueCount = 0,
-                                       const VkClearValue* pClearValues    = nullptr)
+                                       const VkClearValue* pClearValues    = nullptr,
+                                       VkSubpassContents   Contents        = VK_SUBPASS_CONTENTS_INLINE)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
         VERIFY(m_State.RenderPass == VK_NULL_HANDLE, "Current pass has not been ended");
@@ -291,9 +297,10 @@ public:
                                                       // ignored (7.4)
 
             vkCmdBeginRenderPass(m_VkCmdBuffer, &BeginInfo,
-                                 VK_SUBPASS_CONTENTS_INLINE // the contents of the subpass will be recorded inline in the
-                                                            // primary command buffer, and secondary command buffers must not
-                                                            // be executed within the subpass
+                                 Contents // VK_SUBPASS_CONTENTS_INLINE: the contents of the subpass will be recorded inline in the
+                                          // primary command buffer, and secondary command buffers must not be executed within the subpass.
+                                          // VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS: the contents are recorded in secondary command
+                                          // buffers, and vkCmdExecuteCommands is the only valid command in the subpass (7.4)
             );
             m_State.RenderPass        = RenderPass;
             m_State.Framebuffer       = Framebuffer;
@@ -320,11 +327,43 @@ public:
         }
     }
 
-    __forceinline void NextSubpass()
+    __forceinline void NextSubpass(VkSubpassContents Contents = VK_SUBPASS_CONTENTS_INLINE)
     {
         VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "Render pass has not been started");
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        vkCmdNextSubpass(m_VkCmdBuffer, VK_SUBPASS_CONTENTS_INLINE);
+        vkCmdNextSubpass(m_VkCmdBuffer, Contents);
+    }
+
+    // Sets the render pass state that a secondary command buffer inherits from the primary
+    // command buffer it will be executed in. No commands are recorded.
+    __forceinline void SetInheritedRenderPass(VkRenderPass  RenderPass,
+                                              VkFramebuffer Framebuffer,
+                                              uint32_t      FramebufferWidth,
+                                              uint32_t      FramebufferHeight)
+    {
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        VERIFY(m_State.RenderPass == VK_NULL_HANDLE, "Render pass has already been set");
+        m_State.RenderPass        = RenderPass;
+        m_State.Framebuffer       = Framebuffer;
+        m_State.FramebufferWidth  = FramebufferWidth;
+        m_State.FramebufferHeight = FramebufferHeight;
+    }
+
+    __forceinline void ExecuteCommands(uint32_t CommandBufferCount, const VkCommandBuffer* pCommandBuffers)
+    {
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "Secondary command buffers must be executed inside a render pass");
+        vkCmdExecuteCommands(m_VkCmdBuffer, CommandBufferCount, pCommandBuffers);
+
+        // After vkCmdExecuteCommands, the state of the primary command buffer that was
+        // set before the command is undefined (6.7)
+        m_State.GraphicsPipeline        = VK_NULL_HANDLE;
+        m_State.ComputePipeline         = VK_NULL_HANDLE;
+        m_State.RayTracingPipeline      = VK_NULL_HANDLE;
+        m_State.IndexBuffer             = VK_NULL_HANDLE;
+        m_State.IndexBufferOffset       = 0;
+        m_State.IndexType               = VK_INDEX_TYPE_MAX_ENUM;
+        m_State.DescriptorBufferAddress = 0;
     }
 
     __forceinline void EndCommandBuffer()
@@ -446,6 +485,41 @@ public:
         vkCmdBindDescriptorSets(m_VkCmdBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     }
 
+    // Binds a single buffer that holds both resource and sampler descriptors (VK_EXT_descriptor_buffer).
+    __forceinline void BindDescriptorBuffer(VkDeviceAddress Address, VkBufferUsageFlags Usage)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        if (m_State.DescriptorBufferAddress != Address)
+        {
+            VkDescriptorBufferBindingInfoEXT BindingInfo{};
+            BindingInfo.sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT;
+            BindingInfo.address = Address;
+            BindingInfo.usage   = Usage;
+            vkCmdBindDescriptorBuffersEXT(m_VkCmdBuffer, 1, &BindingInfo);
+            m_State.DescriptorBufferAddress = Address;
+        }
+#else
+        UNSUPPORTED("Descriptor buffers are not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDescriptorBufferOffsets(VkPipelineBindPoint pipelineBindPoint,
+                                                  VkPipelineLayout    layout,
+                                                  uint32_t            firstSet,
+                                                  uint32_t            setCount,
+                                                  const uint32_t*     pBufferIndices,
+                                                  const VkDeviceSize* pOffsets)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        VERIFY(m_State.DescriptorBufferAddress != 0, "No descriptor buffer bound");
+        vkCmdSetDescriptorBufferOffsetsEXT(m_VkCmdBuffer, pipelineBindPoint, layout, firstSet, setCount, pBufferIndices, pOffsets);
+#else
+        UNSUPPORTED("Descriptor buffers are not supported when vulkan library is linked statically");
+#endif
+    }
+
     __forceinline void CopyBuffer(VkBuffer            srcBuffer,
                                   VkBuffer            dstBuffer,
                                   uint32_t            regionCount,
@@ -784,6 +858,9 @@ public:
     }
     VkCommandBuffer GetVkCmdBuffer() const { return m_VkCmdBuffer; }
 
+    // Sets the statistics that are updated when barriers are recorded. May be null.
+    void SetBarrierStats(Diligent::DeviceContextBarrierStats* pStats) { m_pBarrierStats = pStats; }
+
     VkPipelineStageFlags GetSupportedStagesMask() const { return m_Barrier.SupportedStagesMask; }
     VkAccessFlags        GetSupportedAccessMask() const { return m_Barrier.SupportedAccessMask; }
 
@@ -801,6 +878,8 @@ public:
         uint32_t      FramebufferHeight  = 0;
         uint32_t      InsidePassQueries  = 0;
         uint32_t      OutsidePassQueries = 0;
+
+        VkDeviceAddress DescriptorBufferAddress = 0;
     };
 
     const StateCache& GetState() const { return m_State; }
@@ -825,6 +904,8 @@ private:
     PipelineBarrier m_Barrier;
 
     std::vector<VkImageMemoryBarrier> m_ImageBarriers;
+
+    Diligent::DeviceContextBarrierStats* m_pBarrierStats = nullptr;
 };
 
 } // namespace VulkanUtilities
@@ -32,8 +32,11 @@
 #include <unordered_map>
 #include <atomic>
 #include <string>
+#include <vector>
+#include <memory>
 #include "MemoryAllocator.h"
 #include "VariableSizeAllocationsManager.hpp"
+#include "SizeClassIndex.hpp"
 #include "VulkanUtilities/VulkanPhysicalDevice.hpp"
 #include "VulkanUtilities/VulkanLogicalDevice.hpp"
 #include "VulkanUtilities/VulkanObjectWrappers.hpp"
@@ -44,6 +47,7 @@ namespace VulkanUtilities
 
 class VulkanMemoryPage;
 class VulkanMemoryManager;
+struct VulkanMemoryPool;
 
 struct VulkanMemoryAllocation
 {
@@ -104,34 +108,33 @@ struct VulkanMemoryAllocation
 class VulkanMemoryPage
 {
 public:
-    VulkanMemoryPage(VulkanMemoryManager&  ParentMemoryMgr,
-                     VkDeviceSize          PageSize,
-                     uint32_t              MemoryTypeIndex,
-                     bool                  IsHostVisible,
-                     VkMemoryAllocateFlags AllocateFlags);
+    VulkanMemoryPage(VulkanMemoryManager&                 ParentMemoryMgr,
+                     VulkanMemoryPool&                    ParentPool,
+                     VkDeviceSize                         PageSize,
+                     uint32_t                             MemoryTypeIndex,
+                     bool                                 IsHostVisible,
+                     VkMemoryAllocateFlags                AllocateFlags,
+                     const VkMemoryDedicatedAllocateInfo* pDedicatedAllocInfo = nullptr);
     ~VulkanMemoryPage();
 
     // clang-format off
-    VulkanMemoryPage(VulkanMemoryPage&& rhs)noexcept :
-        m_ParentMemoryMgr {rhs.m_ParentMemoryMgr         },
-        m_AllocationMgr   {std::move(rhs.m_AllocationMgr)},
-        m_VkMemory        {std::move(rhs.m_VkMemory)     },
-        m_CPUMemory       {rhs.m_CPUMemory               }
-    {
-        rhs.m_CPUMemory = nullptr;
-    }
-
-    VulkanMemoryPage            (const VulkanMemoryPage&) = delete;
-    VulkanMemoryPage& operator= (VulkanMemoryPage&)       = delete;
-    VulkanMemoryPage& operator= (VulkanMemoryPage&& rhs)  = delete;
+    VulkanMemoryPage            (const VulkanMemoryPage&)  = delete;
+    VulkanMemoryPage            (VulkanMemoryPage&&)       = delete;
+    VulkanMemoryPage& operator= (const VulkanMemoryPage&)  = delete;
+    VulkanMemoryPage& operator= (VulkanMemoryPage&& rhs)   = delete;
 
     bool IsEmpty() const { return m_AllocationMgr.IsEmpty(); }
     bool IsFull()  const { return m_AllocationMgr.IsFull();  }
-    VkDeviceSize GetPageSize() const { return m_AllocationMgr.GetMaxSize();  }
-    VkDeviceSize GetUsedSize() const { return m_AllocationMgr.GetUsedSize(); }
+    VkDeviceSize GetPageSize()         const { return m_AllocationMgr.GetMaxSize();          }
+    VkDeviceSize GetUsedSize()         const { return m_AllocationMgr.GetUsedSize();         }
+    VkDeviceSize GetMaxFreeBlockSize() const { return m_AllocationMgr.GetMaxFreeBlockSize(); }
 
+    // Dedicated pages contain the memory of a single buffer or image and are
+    // destroyed as soon as the allocation is released.
+    bool IsDedicated() const { return m_IsDedicated; }
     // clang-format on
 
+    // The method is not thread-safe; the parent pool mutex must be locked.
     VulkanMemoryAllocation Allocate(VkDeviceSize size, VkDeviceSize alignment);
 
     VkDeviceMemory GetVkMemory() const { return m_VkMemory; }
@@ -141,15 +144,38 @@ private:
     using AllocationsMgrOffsetType = Diligent::VariableSizeAllocationsManager::OffsetType;
 
     friend struct VulkanMemoryAllocation;
+    friend class VulkanMemoryManager;
 
     // Memory is reclaimed immediately. The application is responsible to ensure it is not in use by the GPU
     void Free(VulkanMemoryAllocation&& Allocation);
 
     VulkanMemoryManager&                     m_ParentMemoryMgr;
-    std::mutex                               m_Mutex;
+    VulkanMemoryPool&                        m_ParentPool;
     Diligent::VariableSizeAllocationsManager m_AllocationMgr;
     VulkanUtilities::DeviceMemoryWrapper     m_VkMemory;
     void*                                    m_CPUMemory = nullptr;
+    const bool                               m_IsDedicated;
+
+    // Index of this page in VulkanMemoryPool::Pages
+    size_t m_PoolPos = 0;
+    // Index of the memory heap the page is allocated from
+    uint32_t m_HeapIndex = 0;
+    // Location of this page in VulkanMemoryPool::FreeSpaceIndex
+    Diligent::SizeClassIndex<VulkanMemoryPage>::Location m_SizeClassLoc;
+};
+
+// Memory pages that have the same memory type, host visibility and allocation flags.
+// All pages in the pool are protected by the pool mutex.
+struct VulkanMemoryPool
+{
+    std::mutex Mtx;
+
+    std::vector<std::unique_ptr<VulkanMemoryPage>> Pages;
+
+    // Pages indexed by the size of their largest free block, which allows finding a page
+    // that can accommodate an allocation without trying every page in turn.
+    // Dedicated pages and pages that have no free space are not indexed.
+    Diligent::SizeClassIndex<VulkanMemoryPage> FreeSpaceIndex;
 };
 
 class VulkanMemoryManager
@@ -172,7 +198,9 @@ public:
         m_HostVisiblePageSize   {HostVisiblePageSize   },
         m_DeviceLocalReserveSize{DeviceLocalReserveSize},
         m_HostVisibleReserveSize{HostVisibleReserveSize}
-    {}
+    {
+        UpdateMemoryBudget();
+    }
 
 
     // We have to write this constructor because on msvc default
@@ -183,21 +211,24 @@ public:
         m_LogicalDevice   {rhs.m_LogicalDevice     },
         m_PhysicalDevice  {rhs.m_PhysicalDevice    },
         m_Allocator       {rhs.m_Allocator         },
-        m_Pages           {std::move(rhs.m_Pages)  },
+        m_Pools           {std::move(rhs.m_Pools)  },
 
         m_DeviceLocalPageSize    {rhs.m_DeviceLocalPageSize   },
         m_HostVisiblePageSize    {rhs.m_HostVisiblePageSize   },
         m_DeviceLocalReserveSize {rhs.m_DeviceLocalReserveSize},
         m_HostVisibleReserveSize {rhs.m_HostVisibleReserveSize},
-
-        //m_CurrUsedSize      {rhs.m_CurrUsedSize},
-        m_PeakUsedSize      {rhs.m_PeakUsedSize     },
-        m_CurrAllocatedSize {rhs.m_CurrAllocatedSize},
-        m_PeakAllocatedSize {rhs.m_PeakAllocatedSize}
+        m_HeapBudgets            {rhs.m_HeapBudgets           }
     {
         // clang-format on
         for (size_t i = 0; i < m_CurrUsedSize.size(); ++i)
+        {
             m_CurrUsedSize[i].store(rhs.m_CurrUsedSize[i].load());
+            m_PeakUsedSize[i].store(rhs.m_PeakUsedSize[i].load());
+            m_CurrAllocatedSize[i].store(rhs.m_CurrAllocatedSize[i].load());
+            m_PeakAllocatedSize[i].store(rhs.m_PeakAllocatedSize[i].load());
+        }
+        for (size_t i = 0; i < m_HeapAllocatedSize.size(); ++i)
+            m_HeapAllocatedSize[i].store(rhs.m_HeapAllocatedSize[i].load());
     }
 
     ~VulkanMemoryManager();
@@ -210,7 +241,53 @@ public:
 
     VulkanMemoryAllocation Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags);
     VulkanMemoryAllocation Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags);
-    void                   ShrinkMemory();
+
+    // Allocates a separate device memory object for a single buffer or image (VK_KHR_dedicated_allocation).
+    // DedicatedAllocInfo is chained to VkMemoryAllocateInfo and must specify the resource.
+    // The memory is released to the driver as soon as the allocation is destroyed.
+    VulkanMemoryAllocation AllocateDedicated(VkDeviceSize                         Size,
+                                             uint32_t                             MemoryTypeIndex,
+                                             bool                                 HostVisible,
+                                             VkMemoryAllocateFlags                AllocateFlags,
+                                             const VkMemoryDedicatedAllocateInfo& DedicatedAllocInfo);
+    VulkanMemoryAllocation AllocateDedicated(const VkMemoryRequirements&          MemReqs,
+                                             VkMemoryPropertyFlags                MemoryProps,
+                                             VkMemoryAllocateFlags                AllocateFlags,
+                                             const VkMemoryDedicatedAllocateInfo& DedicatedAllocInfo);
+
+    // Returns true if a resource should use a dedicated allocation, which is the case when
+    // the implementation prefers it or when the resource would take a large part of a page.
+    bool ShouldUseDedicatedAllocation(VkDeviceSize Size, bool PrefersDedicatedAllocation) const;
+
+    // Releases empty pages that exceed the reserve sizes. Refreshes the memory budget first and
+    // releases all empty pages of the heaps that are under memory pressure.
+    void ShrinkMemory();
+
+    struct HeapBudget
+    {
+        VkDeviceSize Budget        = 0; // Estimated amount of memory the process can use
+        VkDeviceSize Usage         = 0; // Estimated amount of memory currently used by the process
+        VkDeviceSize AllocatedSize = 0; // Memory allocated by this manager
+        bool         UnderPressure = false;
+    };
+
+    // Queries the heap budget and usage from the driver if VK_EXT_memory_budget is enabled.
+    // Otherwise, the budget is estimated as a fraction of the heap size and the usage as
+    // the size of the memory allocated by this manager.
+    void UpdateMemoryBudget();
+
+    // Returns the budget of the heap with the usage adjusted by the allocations made since the last update
+    HeapBudget GetHeapBudget(uint32_t HeapIndex);
+
+    struct MemoryStats
+    {
+        // 0 == Device local, 1 == Host-visible
+        std::array<VkDeviceSize, 2> UsedSize          = {};
+        std::array<VkDeviceSize, 2> PeakUsedSize      = {};
+        std::array<VkDeviceSize, 2> AllocatedSize     = {};
+        std::array<VkDeviceSize, 2> PeakAllocatedSize = {};
+    };
+    MemoryStats GetMemoryStats() const;
 
 protected:
     friend class VulkanMemoryPage;
@@ -225,7 +302,8 @@ protected:
 
     Diligent::IMemoryAllocator& m_Allocator;
 
-    std::mutex m_PagesMtx;
+    // Only protects the map; every pool has its own mutex
+    std::mutex m_PoolsMtx;
     struct MemoryPageIndex
     {
         const uint32_t              MemoryTypeIndex;
@@ -257,20 +335,51 @@ protected:
             }
         };
     };
-    std::unordered_multimap<MemoryPageIndex, VulkanMemoryPage, MemoryPageIndex::Hasher> m_Pages;
+    std::unordered_map<MemoryPageIndex, std::unique_ptr<VulkanMemoryPool>, MemoryPageIndex::Hasher> m_Pools;
+
+    VulkanMemoryPool& GetPool(const MemoryPageIndex& PageIdx);
+    uint32_t          GetMemoryTypeIndex(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps) const;
+
+    // The pool mutex must be locked
+    VulkanMemoryPage& CreatePage(VulkanMemoryPool&                    Pool,
+                                 VkDeviceSize                         PageSize,
+                                 uint32_t                             MemoryTypeIndex,
+                                 bool                                 HostVisible,
+                                 VkMemoryAllocateFlags                AllocateFlags,
+                                 const VkMemoryDedicatedAllocateInfo* pDedicatedAllocInfo);
+    void              DestroyPage(VulkanMemoryPool& Pool, VulkanMemoryPage& Page);
 
     const VkDeviceSize m_DeviceLocalPageSize;
     const VkDeviceSize m_HostVisiblePageSize;
     const VkDeviceSize m_DeviceLocalReserveSize;
     const VkDeviceSize m_HostVisibleReserveSize;
 
+    bool IsHeapUnderPressure(uint32_t HeapIndex);
+
+    void OnNewAllocation(VkDeviceSize Size, bool IsHostVisible);
     void OnFreeAllocation(VkDeviceSize Size, bool IsHostVisible);
 
     // 0 == Device local, 1 == Host-visible
-    std::array<std::atomic<int64_t>, 2> m_CurrUsedSize      = {};
-    std::array<VkDeviceSize, 2>         m_PeakUsedSize      = {};
-    std::array<VkDeviceSize, 2>         m_CurrAllocatedSize = {};
-    std::array<VkDeviceSize, 2>         m_PeakAllocatedSize = {};
+    // Pools are updated under different locks, so all stats are atomic
+    std::array<std::atomic<int64_t>, 2>      m_CurrUsedSize      = {};
+    std::array<std::atomic<VkDeviceSize>, 2> m_PeakUsedSize      = {};
+    std::array<std::atomic<VkDeviceSize>, 2> m_CurrAllocatedSize = {};
+    std::array<std::atomic<VkDeviceSize>, 2> m_PeakAllocatedSize = {};
+
+    // Memory allocated by this manager from every heap
+    std::array<std::atomic<VkDeviceSize>, VK_MAX_MEMORY_HEAPS> m_HeapAllocatedSize = {};
+
+    struct HeapBudgetState
+    {
+        VkDeviceSize Budget = 0;
+        VkDeviceSize Usage  = 0;
+        // Size of the memory allocated by this manager from the heap when the budget was updated.
+        // Allocations made since then are added to the usage reported by the driver.
+        VkDeviceSize AllocatedAtUpdate = 0;
+        bool         UnderPressure     = false;
+    };
+    std::mutex                                       m_BudgetMtx;
+    std::array<HeapBudgetState, VK_MAX_MEMORY_HEAPS> m_HeapBudgets = {};
 
     // If adding new member, do not forget to update move ctor
 };
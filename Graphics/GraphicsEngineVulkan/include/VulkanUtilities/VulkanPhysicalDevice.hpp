@@ -67,6 +67,7 @@ public:
         VkPhysicalDeviceMultiviewFeaturesKHR              Multiview              = {}; // Required for RenderPass2
         VkPhysicalDeviceMultiDrawFeaturesEXT              MultiDraw              = {};
         VkPhysicalDeviceShaderDrawParametersFeatures      ShaderDrawParameters   = {};
+        VkPhysicalDeviceDescriptorBufferFeaturesEXT       DescriptorBuffer       = {};
 
         bool Spirv14              = false; // Ray tracing requires Vulkan 1.2 or SPIRV 1.4 extension
         bool Spirv15              = false; // DXC shaders with ray tracing requires Vulkan 1.2 with SPIRV 1.5
@@ -74,6 +75,9 @@ public:
         bool HasPortabilitySubset = false;
         bool RenderPass2          = false;
         bool DrawIndirectCount    = false;
+        bool DedicatedAllocation  = false; // Requires VK_KHR_dedicated_allocation and VK_KHR_get_memory_requirements2
+        bool MemoryBudget         = false; // VK_EXT_memory_budget
+        bool DescrUpdateTemplate  = false; // VK_KHR_descriptor_update_template
     };
 
     struct ExtensionProperties
@@ -92,6 +96,7 @@ public:
         VkPhysicalDeviceMaintenance3Properties              Maintenance3           = {};
         VkPhysicalDeviceFragmentDensityMap2PropertiesEXT    FragmentDensityMap2    = {};
         VkPhysicalDeviceMultiDrawPropertiesEXT              MultiDraw              = {};
+        VkPhysicalDeviceDescriptorBufferPropertiesEXT       DescriptorBuffer       = {};
     };
 
 public:
@@ -123,6 +128,9 @@ public:
     VkFormatProperties                          GetPhysicalDeviceFormatProperties(VkFormat imageFormat) const;
     const std::vector<VkQueueFamilyProperties>& GetQueueProperties() const { return m_QueueFamilyProperties; }
 
+    // Queries the current heap budget and usage. VK_EXT_memory_budget must be enabled.
+    void QueryMemoryBudget(VkPhysicalDeviceMemoryBudgetPropertiesEXT& Budget) const;
+
 private:
     VulkanPhysicalDevice(const CreateInfo& CI);
 
@@ -26,11 +26,11 @@
 
 #pragma once
 
-#include <vector>
-#include <mutex>
+#include <atomic>
 
 #include "VulkanLogicalDevice.hpp"
 #include "DebugUtilities.hpp"
+#include "LockFreeStack.hpp"
 
 namespace VulkanUtilities
 {
@@ -66,14 +66,29 @@ public:
     void Recycle(VkSemaphoreType Semaphore, bool IsUnsignaled);
     void Recycle(VkFenceType Fence, bool IsUnsignaled);
 
+    struct Stats
+    {
+        // The total number of semaphores and fences created by the manager
+        uint32_t CreatedSemaphoreCount = 0;
+        uint32_t CreatedFenceCount     = 0;
+        // The number of times a semaphore or a fence was taken from the pool
+        uint64_t ReusedSemaphoreCount = 0;
+        uint64_t ReusedFenceCount     = 0;
+    };
+    Stats GetStats() const;
+
 private:
     VulkanLogicalDevice& m_LogicalDevice;
 
-    std::mutex               m_SemaphorePoolGuard;
-    std::vector<VkSemaphore> m_SemaphorePool;
+    // Sync objects are created and recycled by every queue submission,
+    // so the pools are lock-free to avoid serializing submissions.
+    Threading::LockFreeStack<VkSemaphore> m_SemaphorePool;
+    Threading::LockFreeStack<VkFence>     m_FencePool;
 
-    std::mutex           m_FencePoolGuard;
-    std::vector<VkFence> m_FencePool;
+    std::atomic<uint32_t> m_CreatedSemaphoreCount{0};
+    std::atomic<uint32_t> m_CreatedFenceCount{0};
+    std::atomic<uint64_t> m_ReusedSemaphoreCount{0};
+    std::atomic<uint64_t> m_ReusedFenceCount{0};
 };
 
 using VulkanRecycledSemaphore = VulkanSyncObjectManager::RecycledSyncObject<VkSemaphoreType>;
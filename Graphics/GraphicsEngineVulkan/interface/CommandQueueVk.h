@@ -92,6 +92,17 @@ DILIGENT_BEGIN_INTERFACE(ICommandQueueVk, ICommandQueue)
     VIRTUAL void METHOD(EnqueueSignal)(THIS_
                                        VkSemaphore vkTimelineSemaphore,
                                        Uint64      Value) PURE;
+
+    /// Returns the timeline semaphore that is signaled with the fence value of every submission to the queue.
+    ///
+    /// \remarks  When the semaphore reaches a value, all commands submitted to the queue with
+    ///           this or a smaller fence value are complete. Other queues and external code
+    ///           may wait for the semaphore to synchronize with the queue on the GPU,
+    ///           see IDeviceContextVk::DeviceWaitForQueue().
+    ///
+    /// \note  Requires NativeFence feature, see Diligent::DeviceFeatures.
+    ///        If the feature is not enabled, the method returns VK_NULL_HANDLE.
+    VIRTUAL VkSemaphore METHOD(GetVkTimelineSemaphore)(THIS) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -109,6 +120,7 @@ DILIGENT_END_INTERFACE
 #    define ICommandQueueVk_EnqueueSignalFence(This, ...)     CALL_IFACE_METHOD(CommandQueueVk, EnqueueSignalFence,     This, __VA_ARGS__)
 #    define ICommandQueueVk_EnqueueSignal(This, ...)          CALL_IFACE_METHOD(CommandQueueVk, EnqueueSignal,          This, __VA_ARGS__)
 #    define ICommandQueueVk_BindSparse(This, ...)             CALL_IFACE_METHOD(CommandQueueVk, BindSparse,             This, __VA_ARGS__)
+#    define ICommandQueueVk_GetVkTimelineSemaphore(This)      CALL_IFACE_METHOD(CommandQueueVk, GetVkTimelineSemaphore, This)
 
 // clang-format on
 
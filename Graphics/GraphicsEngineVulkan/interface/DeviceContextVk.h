@@ -48,6 +48,76 @@ static DILIGENT_CONSTEXPR INTERFACE_ID IID_DeviceContextVk =
 
 // clang-format off
 
+/// Attributes of the IDeviceContextVk::BeginSecondaryCommandList() command.
+struct SecondaryCommandListAttribsVk
+{
+    /// Index of the immediate context that will execute the command list.
+    Uint32        ImmediateContextId DEFAULT_INITIALIZER(0);
+
+    /// Render pass in which the command list will be executed.
+
+    /// The render pass must be compatible with the render pass that is active in the
+    /// immediate context when IDeviceContextVk::ExecuteSecondaryCommandLists() is called.
+    IRenderPass*  pRenderPass        DEFAULT_INITIALIZER(nullptr);
+
+    /// Index of the subpass in which the command list will be executed.
+    Uint32        SubpassIndex       DEFAULT_INITIALIZER(0);
+
+    /// Framebuffer that is bound in the immediate context when the command list is executed.
+    IFramebuffer* pFramebuffer       DEFAULT_INITIALIZER(nullptr);
+};
+typedef struct SecondaryCommandListAttribsVk SecondaryCommandListAttribsVk;
+
+
+/// GPU profiler scope, see IDeviceContextVk::GetProfilerFrame().
+struct GPUProfilerScopeVk
+{
+    /// Name of the debug group that defines the scope.
+    const Char* Name        DEFAULT_INITIALIZER(nullptr);
+
+    /// Index of the parent scope in GPUProfilerFrameVk::pScopes, or ~0u for top-level scopes.
+    Uint32      ParentIndex DEFAULT_INITIALIZER(~0u);
+
+    /// Nesting depth of the scope. Top-level scopes have depth 0.
+    Uint32      Depth       DEFAULT_INITIALIZER(0);
+
+    /// Start time of the scope relative to the start of the first scope in the frame, in seconds.
+    Float64     StartTime   DEFAULT_INITIALIZER(0);
+
+    /// GPU time spent in the scope, in seconds.
+
+    /// Scopes that were not ended in the frame in which they were begun have zero duration.
+    Float64     Duration    DEFAULT_INITIALIZER(0);
+};
+typedef struct GPUProfilerScopeVk GPUProfilerScopeVk;
+
+
+/// GPU profiler frame timings returned by IDeviceContextVk::GetProfilerFrame().
+struct GPUProfilerFrameVk
+{
+    /// Frame number, i.e. the number of IDeviceContext::FinishFrame() calls before the frame was begun.
+    Uint64                    FrameNumber       DEFAULT_INITIALIZER(0);
+
+    /// The number of scopes in pScopes array.
+    Uint32                    ScopeCount        DEFAULT_INITIALIZER(0);
+
+    /// The number of scopes that were not measured because the frame query range was exhausted
+    /// (see EngineVkCreateInfo::GPUProfilerMaxScopesPerFrame), or because the query range
+    /// could not be allocated.
+    Uint32                    DroppedScopeCount DEFAULT_INITIALIZER(0);
+
+    /// Scopes in the order in which they were begun.
+
+    /// This is the pre-order traversal of the scope tree: children of a scope
+    /// immediately follow it and have a greater depth.
+    const GPUProfilerScopeVk* pScopes           DEFAULT_INITIALIZER(nullptr);
+
+    /// GPU time between the start of the first scope and the end of the last scope in the frame, in seconds.
+    Float64                   TotalTime         DEFAULT_INITIALIZER(0);
+};
+typedef struct GPUProfilerFrameVk GPUProfilerFrameVk;
+
+
 /// Exposes Vulkan-specific functionality of a device context.
 DILIGENT_BEGIN_INTERFACE(IDeviceContextVk, IDeviceContext)
 {
@@ -84,6 +154,94 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContextVk, IDeviceContext)
     ///           calling IDeviceContext::InvalidateState() and then manually restore all required states via
     ///           appropriate Diligent API calls.
     VIRTUAL VkCommandBuffer METHOD(GetVkCommandBuffer)(THIS) PURE;
+
+    /// Begins a render pass whose subpass contents are recorded in secondary command lists.
+
+    /// \param [in] Attribs - The command attributes, see Diligent::BeginRenderPassAttribs for details.
+    ///
+    /// \remarks This method may only be called for immediate contexts. Inside the render pass,
+    ///          the only commands that may be recorded are IDeviceContextVk::ExecuteSecondaryCommandLists(),
+    ///          IDeviceContext::NextSubpass() and IDeviceContext::EndRenderPass(). The contents of all
+    ///          subpasses are taken from secondary command lists.
+    VIRTUAL void METHOD(BeginSecondaryRenderPass)(THIS_
+                                                  const BeginRenderPassAttribs REF Attribs) PURE;
+
+    /// Begins recording a secondary command list that continues a render pass.
+
+    /// \param [in] Attribs - The command attributes, see Diligent::SecondaryCommandListAttribsVk for details.
+    ///
+    /// \remarks This method may only be called for deferred contexts and replaces IDeviceContext::Begin().
+    ///          The context records commands into a Vulkan secondary command buffer that inherits the
+    ///          render pass and the framebuffer. Only draw commands and the commands that set the states
+    ///          they use may be recorded; all resources must be transitioned to the required states before
+    ///          the render pass begins, and RESOURCE_STATE_TRANSITION_MODE_TRANSITION must not be used.
+    ///          Pipeline states must be created with the render pass that is compatible with the
+    ///          inherited render pass.
+    ///          Call IDeviceContext::FinishCommandList() to finish recording, and
+    ///          IDeviceContextVk::ExecuteSecondaryCommandLists() to execute the command list.
+    ///
+    ///          Multiple deferred contexts may record secondary command lists for the same subpass
+    ///          in parallel.
+    VIRTUAL void METHOD(BeginSecondaryCommandList)(THIS_
+                                                   const SecondaryCommandListAttribsVk REF Attribs) PURE;
+
+    /// Executes secondary command lists in the current subpass of the active render pass.
+
+    /// \param [in] NumCommandLists - The number of command lists to execute.
+    /// \param [in] ppCommandLists  - Pointer to the array of NumCommandLists command lists recorded
+    ///                               by IDeviceContextVk::BeginSecondaryCommandList() for the current subpass.
+    ///
+    /// \remarks This method may only be called for immediate contexts inside a render pass begun by
+    ///          IDeviceContextVk::BeginSecondaryRenderPass(). The command lists are executed
+    ///          with vkCmdExecuteCommands in the given order.
+    ///
+    ///          After a command list is executed, it is no longer valid and must be released.
+    ///
+    ///          The pipeline state, vertex and index buffers and committed shader resources
+    ///          are invalidated by this command and must be set again before they are used.
+    VIRTUAL void METHOD(ExecuteSecondaryCommandLists)(THIS_
+                                                      Uint32               NumCommandLists,
+                                                      ICommandList* const* ppCommandLists) PURE;
+
+    /// Returns the GPU timings of the most recent profiled frame that has been completed by the GPU.
+
+    /// \remarks The GPU profiler is enabled by EngineVkCreateInfo::GPUProfilerMaxScopesPerFrame.
+    ///          Every debug group begun by IDeviceContext::BeginDebugGroup() (e.g. by ScopedDebugGroup)
+    ///          in an immediate context is a profiler scope, and nested groups form the scope tree.
+    ///          The timings become available a few frames after the frame has been finished by
+    ///          IDeviceContext::FinishFrame(). If the profiler is disabled, or no frame has been
+    ///          completed yet, the returned frame has no scopes.
+    ///
+    ///          The pointers in the returned structure remain valid until the next call to
+    ///          IDeviceContext::FinishFrame().
+    VIRTUAL GPUProfilerFrameVk METHOD(GetProfilerFrame)(THIS) CONST PURE;
+
+    /// Instructs the GPU to wait until the queue of another immediate context completes
+    /// the commands submitted with the given fence value.
+
+    /// \param [in] ImmediateContextId - Index of the immediate context whose queue to wait for.
+    /// \param [in] FenceValue         - Fence value to wait for, e.g. the value returned by
+    ///                                  IDeviceContextVk::GetLastSubmittedFenceValue() of that context.
+    ///
+    /// \remarks The wait is performed on the GPU by the next command buffer submitted by
+    ///          IDeviceContext::Flush() or IDeviceContext::ExecuteCommandLists(), so commands
+    ///          submitted to the queue of this context are executed after the commands submitted
+    ///          to the other queue with the given or a smaller fence value, without waiting on the CPU.
+    ///          The wait is a timeline semaphore wait, and every queue signals its timeline semaphore
+    ///          as part of the submission (see ICommandQueueVk::GetVkTimelineSemaphore()), so
+    ///          no additional submissions or fences are required.
+    ///
+    ///          Multiple waits for the same queue are merged into one wait for the largest value.
+    ///          The method can only be called for immediate contexts and requires NativeFence feature.
+    VIRTUAL void METHOD(DeviceWaitForQueue)(THIS_
+                                            Uint32 ImmediateContextId,
+                                            Uint64 FenceValue) PURE;
+
+    /// Returns the fence value of the last command buffer submitted by this immediate context.
+
+    /// \remarks The value is updated by IDeviceContext::Flush() and IDeviceContext::ExecuteCommandLists(),
+    ///          and is zero if the context has not submitted any commands yet.
+    VIRTUAL Uint64 METHOD(GetLastSubmittedFenceValue)(THIS) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -93,8 +251,14 @@ DILIGENT_END_INTERFACE
 
 // clang-format off
 
-#    define IDeviceContextVk_TransitionImageLayout(This, ...) CALL_IFACE_METHOD(DeviceContextVk, TransitionImageLayout, This, __VA_ARGS__)
-#    define IDeviceContextVk_BufferMemoryBarrier(This, ...)   CALL_IFACE_METHOD(DeviceContextVk, BufferMemoryBarrier,   This, __VA_ARGS__)
+#    define IDeviceContextVk_TransitionImageLayout(This, ...)        CALL_IFACE_METHOD(DeviceContextVk, TransitionImageLayout,        This, __VA_ARGS__)
+#    define IDeviceContextVk_BufferMemoryBarrier(This, ...)          CALL_IFACE_METHOD(DeviceContextVk, BufferMemoryBarrier,          This, __VA_ARGS__)
+#    define IDeviceContextVk_BeginSecondaryRenderPass(This, ...)     CALL_IFACE_METHOD(DeviceContextVk, BeginSecondaryRenderPass,     This, __VA_ARGS__)
+#    define IDeviceContextVk_BeginSecondaryCommandList(This, ...)    CALL_IFACE_METHOD(DeviceContextVk, BeginSecondaryCommandList,    This, __VA_ARGS__)
+#    define IDeviceContextVk_ExecuteSecondaryCommandLists(This, ...) CALL_IFACE_METHOD(DeviceContextVk, ExecuteSecondaryCommandLists, This, __VA_ARGS__)
+#    define IDeviceContextVk_GetProfilerFrame(This)                  CALL_IFACE_METHOD(DeviceContextVk, GetProfilerFrame,             This)
+#    define IDeviceContextVk_DeviceWaitForQueue(This, ...)           CALL_IFACE_METHOD(DeviceContextVk, DeviceWaitForQueue,           This, __VA_ARGS__)
+#    define IDeviceContextVk_GetLastSubmittedFenceValue(This)        CALL_IFACE_METHOD(DeviceContextVk, GetLastSubmittedFenceValue,   This)
 
 // clang-format on
 
@@ -47,6 +47,107 @@ static DILIGENT_CONSTEXPR INTERFACE_ID IID_RenderDeviceVk =
 
 // clang-format off
 
+/// Memory budget and usage of a single Vulkan memory heap, see Diligent::MemoryBudgetVk.
+struct MemoryHeapBudgetVk
+{
+    /// Heap size, in bytes.
+    Uint64 Size              DEFAULT_INITIALIZER(0);
+
+    /// Estimated amount of memory the process can allocate from the heap
+    /// without allocation failures or performance degradation, in bytes.
+
+    /// \note  If VK_EXT_memory_budget is not enabled, a fixed fraction
+    ///        of the heap size is reported.
+    Uint64 Budget            DEFAULT_INITIALIZER(0);
+
+    /// Estimated amount of heap memory currently used by the process, in bytes.
+
+    /// \note  If VK_EXT_memory_budget is not enabled, the size of the memory
+    ///        allocated by the engine is reported.
+    Uint64 Usage             DEFAULT_INITIALIZER(0);
+
+    /// Size of the device memory allocated from the heap by the engine, in bytes.
+    Uint64 AllocatedByEngine DEFAULT_INITIALIZER(0);
+
+    /// Vulkan memory heap flags, see VkMemoryHeapFlagBits.
+    Uint32 Flags             DEFAULT_INITIALIZER(0);
+
+    /// Whether the heap is under memory pressure, i.e. its usage is close to or exceeds the budget.
+
+    /// \remarks  While the heap is under memory pressure, the engine releases all unused memory pages
+    ///           regardless of the reserve sizes and does not allocate full-size pages for small allocations.
+    Bool   UnderPressure     DEFAULT_INITIALIZER(False);
+};
+typedef struct MemoryHeapBudgetVk MemoryHeapBudgetVk;
+
+
+/// Memory budget and allocation statistics returned by IRenderDeviceVk::GetMemoryBudget().
+struct MemoryBudgetVk
+{
+    /// The number of valid elements in the Heaps array.
+    Uint32 NumHeaps DEFAULT_INITIALIZER(0);
+
+    /// Whether the budget and usage values are reported by the VK_EXT_memory_budget extension.
+    Bool   BudgetExtensionEnabled DEFAULT_INITIALIZER(False);
+
+    /// Per-heap budget and usage.
+    MemoryHeapBudgetVk Heaps[VK_MAX_MEMORY_HEAPS] DEFAULT_INITIALIZER({});
+
+    /// Size of the device-local memory used by resources, in bytes.
+    Uint64 DeviceLocalUsedSize          DEFAULT_INITIALIZER(0);
+
+    /// Peak size of the device-local memory used by resources, in bytes.
+    Uint64 DeviceLocalPeakUsedSize      DEFAULT_INITIALIZER(0);
+
+    /// Size of the device-local memory allocated by the engine, in bytes.
+    Uint64 DeviceLocalAllocatedSize     DEFAULT_INITIALIZER(0);
+
+    /// Peak size of the device-local memory allocated by the engine, in bytes.
+    Uint64 DeviceLocalPeakAllocatedSize DEFAULT_INITIALIZER(0);
+
+    /// Size of the host-visible memory used by resources, in bytes.
+    Uint64 HostVisibleUsedSize          DEFAULT_INITIALIZER(0);
+
+    /// Peak size of the host-visible memory used by resources, in bytes.
+    Uint64 HostVisiblePeakUsedSize      DEFAULT_INITIALIZER(0);
+
+    /// Size of the host-visible memory allocated by the engine, in bytes.
+    Uint64 HostVisibleAllocatedSize     DEFAULT_INITIALIZER(0);
+
+    /// Peak size of the host-visible memory allocated by the engine, in bytes.
+    Uint64 HostVisiblePeakAllocatedSize DEFAULT_INITIALIZER(0);
+};
+typedef struct MemoryBudgetVk MemoryBudgetVk;
+
+
+/// Device pipeline cache statistics returned by IRenderDeviceVk::GetPipelineCacheStats().
+struct PipelineCacheStatsVk
+{
+    /// Whether the device pipeline cache is enabled, see EngineVkCreateInfo::PipelineCacheDirectory.
+    Bool    Enabled           DEFAULT_INITIALIZER(False);
+
+    /// Whether the cache was initialized with the data loaded from the cache directory (warm cache).
+    /// If false, all pipelines are compiled from scratch (cold cache).
+    Bool    IsWarm            DEFAULT_INITIALIZER(False);
+
+    /// Size of the cache data loaded from the cache directory, in bytes.
+    Uint64  LoadedDataSize    DEFAULT_INITIALIZER(0);
+
+    /// Size of the cache data written by the last save operation, in bytes.
+    Uint64  SavedDataSize     DEFAULT_INITIALIZER(0);
+
+    /// The number of pipelines created with the device pipeline cache.
+    Uint32  PipelineCount     DEFAULT_INITIALIZER(0);
+
+    /// Total time spent in Vulkan pipeline creation functions, in seconds.
+    Float64 TotalCreationTime DEFAULT_INITIALIZER(0);
+
+    /// The longest time spent creating a single pipeline, in seconds.
+    Float64 MaxCreationTime   DEFAULT_INITIALIZER(0);
+};
+typedef struct PipelineCacheStatsVk PipelineCacheStatsVk;
+
+
 /// Exposes Vulkan-specific functionality of a render device.
 DILIGENT_BEGIN_INTERFACE(IRenderDeviceVk, IRenderDevice)
 {
@@ -157,6 +258,38 @@ DILIGENT_BEGIN_INTERFACE(IRenderDeviceVk, IRenderDevice)
                                                        VkSemaphore         vkTimelineSemaphore,
                                                        const FenceDesc REF Desc,
                                                        IFence**            ppFence) PURE;
+
+    /// Returns the memory budget and allocation statistics of the device.
+
+    /// \remarks  The budget is queried from the driver every time the method is called.
+    ///           The method can be used to export memory statistics for telemetry.
+    VIRTUAL MemoryBudgetVk METHOD(GetMemoryBudget)(THIS) PURE;
+
+    /// Merges the device pipeline cache and writes it to the cache directory.
+
+    /// \return  true if the cache has been successfully written, and false otherwise.
+    ///
+    /// \remarks  The method does nothing and returns false if the device pipeline cache
+    ///           is not enabled (see EngineVkCreateInfo::PipelineCacheDirectory).
+    ///           The cache file is replaced atomically, so that a concurrent process or
+    ///           an interrupted save never leaves a truncated file behind.
+    ///           The cache is also saved automatically when the device is destroyed.
+    VIRTUAL Bool METHOD(SavePipelineCache)(THIS) PURE;
+
+    /// Returns the device pipeline cache statistics.
+
+    /// \remarks  Comparing the average pipeline creation time with a cold and a warm cache
+    ///           shows how much the application benefits from the persistent cache.
+    VIRTUAL PipelineCacheStatsVk METHOD(GetPipelineCacheStats)(THIS) PURE;
+
+    /// Returns the statistics of the release queue of the given command queue.
+
+    /// \param [in]  QueueIndex - Index of the command queue, which is the same as the
+    ///                           ContextId of the immediate context that uses the queue.
+    ///
+    /// \remarks  The statistics can be used to tune EngineCreateInfo::MaxResourcesReleasedPerPurge.
+    VIRTUAL ReleaseQueueStats METHOD(GetReleaseQueueStats)(THIS_
+                                                           Uint32 QueueIndex) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -174,6 +307,10 @@ DILIGENT_END_INTERFACE
 #    define IRenderDeviceVk_CreateBLASFromVulkanResource(This, ...)   CALL_IFACE_METHOD(RenderDeviceVk, CreateBLASFromVulkanResource,   This, __VA_ARGS__)
 #    define IRenderDeviceVk_CreateTLASFromVulkanResource(This, ...)   CALL_IFACE_METHOD(RenderDeviceVk, CreateTLASFromVulkanResource,   This, __VA_ARGS__)
 #    define IRenderDeviceVk_CreateFenceFromVulkanResource(This, ...)  CALL_IFACE_METHOD(RenderDeviceVk, CreateFenceFromVulkanResource,  This, __VA_ARGS__)
+#    define IRenderDeviceVk_GetMemoryBudget(This)                     CALL_IFACE_METHOD(RenderDeviceVk, GetMemoryBudget,                This)
+#    define IRenderDeviceVk_SavePipelineCache(This)                   CALL_IFACE_METHOD(RenderDeviceVk, SavePipelineCache,              This)
+#    define IRenderDeviceVk_GetPipelineCacheStats(This)               CALL_IFACE_METHOD(RenderDeviceVk, GetPipelineCacheStats,          This)
+#    define IRenderDeviceVk_GetReleaseQueueStats(This, ...)           CALL_IFACE_METHOD(RenderDeviceVk, GetReleaseQueueStats,           This, __VA_ARGS__)
 
 // clang-format on
 
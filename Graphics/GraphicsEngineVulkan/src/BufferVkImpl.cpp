@@ -189,6 +189,19 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
         // Read-only storage buffers (aka structured buffers) don't need a backing buffer.
         ((VkBuffCI.usage & VK_BUFFER_USAGE_STORAGE_BUFFER_BIT) != 0 && (m_Desc.BindFlags & BIND_UNORDERED_ACCESS) != 0);
 
+    if (pRenderDeviceVk->UseDescriptorBuffers())
+    {
+        // Buffer descriptors are created from device addresses when descriptor buffers are used.
+        // Dynamic buffers without a backing buffer use the address of the dynamic heap.
+        constexpr VkBufferUsageFlags DescriptorUsage =
+            VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+            VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT |
+            VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT;
+        if ((VkBuffCI.usage & DescriptorUsage) != 0)
+            VkBuffCI.usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    }
+
     if (m_Desc.Usage == USAGE_SPARSE)
     {
         VkBuffCI.flags =
@@ -238,7 +251,8 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
 
         m_VulkanBuffer = LogicalDevice.CreateBuffer(VkBuffCI, m_Desc.Name);
 
-        VkMemoryRequirements MemReqs = LogicalDevice.GetBufferMemoryRequirements(m_VulkanBuffer);
+        bool                 PrefersDedicatedAllocation = false;
+        VkMemoryRequirements MemReqs                    = LogicalDevice.GetBufferMemoryRequirements(m_VulkanBuffer, PrefersDedicatedAllocation);
 
         static constexpr auto InvalidMemoryTypeIndex = VulkanUtilities::VulkanPhysicalDevice::InvalidMemoryTypeIndex;
 
@@ -316,7 +330,20 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
         }
 
         VERIFY(IsPowerOfTwo(RequiredAlignment), "Alignment is not power of 2!");
-        m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs.size, RequiredAlignment, MemoryTypeIndex, AllocateFlags);
+        // Only use dedicated memory for GPU-only buffers: CPU-accessible buffers are mapped and
+        // are frequently created and destroyed, so they benefit from the shared pages.
+        const bool IsGPUOnly = m_Desc.Usage != USAGE_UNIFIED && m_Desc.Usage != USAGE_STAGING;
+        if (IsGPUOnly && pRenderDeviceVk->GetGlobalMemoryManager().ShouldUseDedicatedAllocation(MemReqs.size, PrefersDedicatedAllocation))
+        {
+            VkMemoryDedicatedAllocateInfo DedicatedAllocInfo{};
+            DedicatedAllocInfo.sType  = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+            DedicatedAllocInfo.buffer = m_VulkanBuffer;
+            m_MemoryAllocation        = pRenderDeviceVk->AllocateDedicatedMemory(MemReqs.size, MemoryTypeIndex, DedicatedAllocInfo, AllocateFlags);
+        }
+        else
+        {
+            m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs.size, RequiredAlignment, MemoryTypeIndex, AllocateFlags);
+        }
         if (!m_MemoryAllocation)
             LOG_ERROR_AND_THROW("Failed to allocate memory for buffer '", m_Desc.Name, "'.");
 
@@ -328,6 +355,12 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
 
         VERIFY(!AlignToNonCoherentAtomSize || (m_BufferMemoryAlignedOffset + MemReqs.size) % DeviceLimits.nonCoherentAtomSize == 0, "End offset is not properly aligned");
 
+        if (VkBuffCI.usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT)
+        {
+            m_VkDeviceAddress = LogicalDevice.GetBufferDeviceAddress(m_VulkanBuffer);
+            VERIFY_EXPR(m_VkDeviceAddress != 0);
+        }
+
 #ifdef DILIGENT_DEBUG
         if ((m_Desc.BindFlags & BIND_RAY_TRACING) != 0)
         {
@@ -364,87 +397,107 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
             }
             else
             {
-                VkBufferCreateInfo VkStaginBuffCI = VkBuffCI;
-                VkStaginBuffCI.usage              = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-
-                std::string StagingBufferName = "Upload buffer for '";
-                StagingBufferName += m_Desc.Name;
-                StagingBufferName += '\'';
-                VulkanUtilities::BufferWrapper StagingBuffer = LogicalDevice.CreateBuffer(VkStaginBuffCI, StagingBufferName.c_str());
-
-                VkMemoryRequirements StagingBufferMemReqs = LogicalDevice.GetBufferMemoryRequirements(StagingBuffer);
-                VERIFY(IsPowerOfTwo(StagingBufferMemReqs.alignment), "Alignment is not power of 2!");
-
-                // VK_MEMORY_PROPERTY_HOST_COHERENT_BIT bit specifies that the host cache management commands vkFlushMappedMemoryRanges
-                // and vkInvalidateMappedMemoryRanges are NOT needed to flush host writes to the device or make device writes visible
-                // to the host (10.2)
-                auto StagingMemoryAllocation = pRenderDeviceVk->AllocateMemory(StagingBufferMemReqs, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-                if (!StagingMemoryAllocation)
-                    LOG_ERROR_AND_THROW("Failed to allocate staging memory for buffer '", m_Desc.Name, "'.");
-
-                auto StagingBufferMemory     = StagingMemoryAllocation.Page->GetVkMemory();
-                auto AlignedStagingMemOffset = AlignUp(VkDeviceSize{StagingMemoryAllocation.UnalignedOffset}, StagingBufferMemReqs.alignment);
-                VERIFY_EXPR(StagingMemoryAllocation.Size >= StagingBufferMemReqs.size + (AlignedStagingMemOffset - StagingMemoryAllocation.UnalignedOffset));
-
-                auto* StagingData = reinterpret_cast<uint8_t*>(StagingMemoryAllocation.Page->GetCPUMemory());
-                if (StagingData == nullptr)
-                    LOG_ERROR_AND_THROW("Failed to allocate staging data for buffer '", m_Desc.Name, '\'');
-                memcpy(StagingData + AlignedStagingMemOffset, pBuffData->pData, StaticCast<size_t>(InitialDataSize));
-
-                err = LogicalDevice.BindBufferMemory(StagingBuffer, StagingBufferMemory, AlignedStagingMemOffset);
-                CHECK_VK_ERROR_AND_THROW(err, "Failed to bind staging buffer memory");
-
                 const auto CmdQueueInd = pBuffData->pContext ?
                     ClassPtrCast<DeviceContextVkImpl>(pBuffData->pContext)->GetCommandQueueId() :
                     SoftwareQueueIndex{PlatformMisc::GetLSB(m_Desc.ImmediateContextMask)};
 
-                VulkanUtilities::CommandPoolWrapper  CmdPool;
-                VulkanUtilities::VulkanCommandBuffer CmdBuffer;
-                pRenderDeviceVk->AllocateTransientCmdPool(CmdQueueInd, CmdPool, CmdBuffer, "Transient command pool to copy staging data to a device buffer");
-
-                CmdBuffer.MemoryBarrier(VK_ACCESS_HOST_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_HOST_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
                 InitialState              = RESOURCE_STATE_COPY_DEST;
                 VkAccessFlags AccessFlags = ResourceStateFlagsToVkAccessFlags(InitialState);
                 VERIFY_EXPR(AccessFlags == VK_ACCESS_TRANSFER_WRITE_BIT);
-                CmdBuffer.MemoryBarrier(0, AccessFlags, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
-
-                // Copy commands MUST be recorded outside of a render pass instance. This is OK here
-                // as copy will be the only command in the cmd buffer
-                VkBufferCopy BuffCopy{};
-                BuffCopy.srcOffset = 0;
-                BuffCopy.dstOffset = 0;
-                BuffCopy.size      = VkBuffCI.size;
-                CmdBuffer.CopyBuffer(StagingBuffer, m_VulkanBuffer, 1, &BuffCopy);
-
-                pRenderDeviceVk->ExecuteAndDisposeTransientCmdBuff(CmdQueueInd, CmdBuffer.GetVkCmdBuffer(), std::move(CmdPool));
-
-
-                // After command buffer is submitted, safe-release staging resources. This strategy
-                // is little overconservative as the resources will only be released after the
-                // first command buffer submitted through the immediate context is complete
-
-                // Next Cmd Buff| Next Fence |               This Thread                      |           Immediate Context
-                //              |            |                                                |
-                //      N       |     F      |                                                |
-                //              |            |                                                |
-                //              |            |  ExecuteAndDisposeTransientCmdBuff(vkCmdBuff)  |
-                //              |            |  - SubmittedCmdBuffNumber = N                  |
-                //              |            |  - SubmittedFenceValue = F                     |
-                //     N+1 -  - | -  F+1  -  |                                                |
-                //              |            |  Release(StagingBuffer)                        |
-                //              |            |  - {N+1, StagingBuffer} -> Stale Objects       |
-                //              |            |                                                |
-                //              |            |                                                |
-                //              |            |                                                | ExecuteCommandBuffer()
-                //              |            |                                                | - SubmittedCmdBuffNumber = N+1
-                //              |            |                                                | - SubmittedFenceValue = F+1
-                //     N+2 -  - | -  F+2  -  |  -   -   -   -   -   -   -   -   -   -   -   - |
-                //              |            |                                                | - DiscardStaleVkObjects(N+1, F+1)
-                //              |            |                                                |   - {F+1, StagingBuffer} -> Release Queue
-                //              |            |                                                |
-
-                pRenderDeviceVk->SafeReleaseDeviceObject(std::move(StagingBuffer), Uint64{1} << Uint64{CmdQueueInd});
-                pRenderDeviceVk->SafeReleaseDeviceObject(std::move(StagingMemoryAllocation), Uint64{1} << Uint64{CmdQueueInd});
+
+                // When upload batching is enabled, the copy is recorded into the shared batch command buffer
+                // and is executed before the next command buffer submitted to any queue.
+                const auto IsBatched = pRenderDeviceVk->EnqueueInitialDataUpload(
+                    CmdQueueInd, InitialDataSize, 16,
+                    [&](VulkanUtilities::VulkanCommandBuffer& CmdBuffer, VkBuffer vkStagingBuffer, VkDeviceSize StagingOffset, Uint8* pStagingData) {
+                        memcpy(pStagingData, pBuffData->pData, StaticCast<size_t>(InitialDataSize));
+
+                        CmdBuffer.MemoryBarrier(0, AccessFlags, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+                        VkBufferCopy BuffCopy{};
+                        BuffCopy.srcOffset = StagingOffset;
+                        BuffCopy.dstOffset = 0;
+                        BuffCopy.size      = InitialDataSize;
+                        CmdBuffer.CopyBuffer(vkStagingBuffer, m_VulkanBuffer, 1, &BuffCopy);
+                    });
+
+                if (!IsBatched)
+                {
+                    VkBufferCreateInfo VkStaginBuffCI = VkBuffCI;
+                    VkStaginBuffCI.usage              = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+
+                    std::string StagingBufferName = "Upload buffer for '";
+                    StagingBufferName += m_Desc.Name;
+                    StagingBufferName += '\'';
+                    VulkanUtilities::BufferWrapper StagingBuffer = LogicalDevice.CreateBuffer(VkStaginBuffCI, StagingBufferName.c_str());
+
+                    VkMemoryRequirements StagingBufferMemReqs = LogicalDevice.GetBufferMemoryRequirements(StagingBuffer);
+                    VERIFY(IsPowerOfTwo(StagingBufferMemReqs.alignment), "Alignment is not power of 2!");
+
+                    // VK_MEMORY_PROPERTY_HOST_COHERENT_BIT bit specifies that the host cache management commands vkFlushMappedMemoryRanges
+                    // and vkInvalidateMappedMemoryRanges are NOT needed to flush host writes to the device or make device writes visible
+                    // to the host (10.2)
+                    auto StagingMemoryAllocation = pRenderDeviceVk->AllocateMemory(StagingBufferMemReqs, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+                    if (!StagingMemoryAllocation)
+                        LOG_ERROR_AND_THROW("Failed to allocate staging memory for buffer '", m_Desc.Name, "'.");
+
+                    auto StagingBufferMemory     = StagingMemoryAllocation.Page->GetVkMemory();
+                    auto AlignedStagingMemOffset = AlignUp(VkDeviceSize{StagingMemoryAllocation.UnalignedOffset}, StagingBufferMemReqs.alignment);
+                    VERIFY_EXPR(StagingMemoryAllocation.Size >= StagingBufferMemReqs.size + (AlignedStagingMemOffset - StagingMemoryAllocation.UnalignedOffset));
+
+                    auto* StagingData = reinterpret_cast<uint8_t*>(StagingMemoryAllocation.Page->GetCPUMemory());
+                    if (StagingData == nullptr)
+                        LOG_ERROR_AND_THROW("Failed to allocate staging data for buffer '", m_Desc.Name, '\'');
+                    memcpy(StagingData + AlignedStagingMemOffset, pBuffData->pData, StaticCast<size_t>(InitialDataSize));
+
+                    err = LogicalDevice.BindBufferMemory(StagingBuffer, StagingBufferMemory, AlignedStagingMemOffset);
+                    CHECK_VK_ERROR_AND_THROW(err, "Failed to bind staging buffer memory");
+
+                    VulkanUtilities::CommandPoolWrapper  CmdPool;
+                    VulkanUtilities::VulkanCommandBuffer CmdBuffer;
+                    pRenderDeviceVk->AllocateTransientCmdPool(CmdQueueInd, CmdPool, CmdBuffer, "Transient command pool to copy staging data to a device buffer");
+
+                    CmdBuffer.MemoryBarrier(VK_ACCESS_HOST_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_HOST_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+                    CmdBuffer.MemoryBarrier(0, AccessFlags, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+                    // Copy commands MUST be recorded outside of a render pass instance. This is OK here
+                    // as copy will be the only command in the cmd buffer
+                    VkBufferCopy BuffCopy{};
+                    BuffCopy.srcOffset = 0;
+                    BuffCopy.dstOffset = 0;
+                    BuffCopy.size      = VkBuffCI.size;
+                    CmdBuffer.CopyBuffer(StagingBuffer, m_VulkanBuffer, 1, &BuffCopy);
+
+                    pRenderDeviceVk->ExecuteAndDisposeTransientCmdBuff(CmdQueueInd, CmdBuffer.GetVkCmdBuffer(), std::move(CmdPool));
+
+
+                    // After command buffer is submitted, safe-release staging resources. This strategy
+                    // is little overconservative as the resources will only be released after the
+                    // first command buffer submitted through the immediate context is complete
+
+                    // Next Cmd Buff| Next Fence |               This Thread                      |           Immediate Context
+                    //              |            |                                                |
+                    //      N       |     F      |                                                |
+                    //              |            |                                                |
+                    //              |            |  ExecuteAndDisposeTransientCmdBuff(vkCmdBuff)  |
+                    //              |            |  - SubmittedCmdBuffNumber = N                  |
+                    //              |            |  - SubmittedFenceValue = F                     |
+                    //     N+1 -  - | -  F+1  -  |                                                |
+                    //              |            |  Release(StagingBuffer)                        |
+                    //              |            |  - {N+1, StagingBuffer} -> Stale Objects       |
+                    //              |            |                                                |
+                    //              |            |                                                |
+                    //              |            |                                                | ExecuteCommandBuffer()
+                    //              |            |                                                | - SubmittedCmdBuffNumber = N+1
+                    //              |            |                                                | - SubmittedFenceValue = F+1
+                    //     N+2 -  - | -  F+2  -  |  -   -   -   -   -   -   -   -   -   -   -   - |
+                    //              |            |                                                | - DiscardStaleVkObjects(N+1, F+1)
+                    //              |            |                                                |   - {F+1, StagingBuffer} -> Release Queue
+                    //              |            |                                                |
+
+                    pRenderDeviceVk->SafeReleaseDeviceObject(std::move(StagingBuffer), Uint64{1} << Uint64{CmdQueueInd});
+                    pRenderDeviceVk->SafeReleaseDeviceObject(std::move(StagingMemoryAllocation), Uint64{1} << Uint64{CmdQueueInd});
+                }
             }
         }
 
@@ -568,22 +621,22 @@ VkAccessFlags BufferVkImpl::GetAccessFlags() const
 
 VkDeviceAddress BufferVkImpl::GetVkDeviceAddress() const
 {
-    constexpr auto DeviceAddressFlags = BIND_RAY_TRACING;
+    if (m_VkDeviceAddress != 0)
+        return m_VkDeviceAddress;
 
-    if (m_VulkanBuffer != VK_NULL_HANDLE && (m_Desc.BindFlags & DeviceAddressFlags) != 0)
+    if (m_VulkanBuffer == VK_NULL_HANDLE && m_Desc.Usage == USAGE_DYNAMIC && m_pDevice->UseDescriptorBuffers())
     {
-#if DILIGENT_USE_VOLK
-        VkBufferDeviceAddressInfoKHR BufferInfo = {};
+        // The buffer is suballocated from the dynamic heap; the caller must add the dynamic offset.
+        return m_pDevice->GetDynamicMemoryManager().GetVkDeviceAddress();
+    }
 
-        BufferInfo.sType       = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO_KHR;
-        BufferInfo.buffer      = m_VulkanBuffer;
-        VkDeviceAddress Result = vkGetBufferDeviceAddressKHR(m_pDevice->GetLogicalDevice().GetVkDevice(), &BufferInfo);
+    // Sparse buffers and buffers created from existing Vulkan handles
+    constexpr auto DeviceAddressFlags = BIND_RAY_TRACING;
+    if (m_VulkanBuffer != VK_NULL_HANDLE && ((m_Desc.BindFlags & DeviceAddressFlags) != 0 || m_pDevice->UseDescriptorBuffers()))
+    {
+        VkDeviceAddress Result = m_pDevice->GetLogicalDevice().GetBufferDeviceAddress(m_VulkanBuffer);
         VERIFY_EXPR(Result > 0);
         return Result;
-#else
-        UNSUPPORTED("vkGetBufferDeviceAddressKHR is only available through Volk");
-        return VkDeviceAddress{};
-#endif
     }
     else
     {
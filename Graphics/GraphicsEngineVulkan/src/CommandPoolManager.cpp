@@ -29,6 +29,7 @@
 #include "CommandPoolManager.hpp"
 #include "RenderDeviceVkImpl.hpp"
 #include "VulkanUtilities/VulkanDebug.hpp"
+#include "EngineMemory.h"
 
 namespace Diligent
 {
@@ -39,22 +40,19 @@ CommandPoolManager::CommandPoolManager(const CreateInfo& CI) noexcept :
     m_Name            {CI.Name            },
     m_QueueFamilyIndex{CI.queueFamilyIndex},
     m_CmdPoolFlags    {CI.flags           },
-    m_CmdPools        (STD_ALLOCATOR_RAW_MEM(VulkanUtilities::CommandPoolWrapper, GetRawAllocator(), "Allocator for deque<VulkanUtilities::CommandPoolWrapper>"))
+    m_CmdPools        {GetRawAllocator()  }
 // clang-format on
 {
 }
 
 VulkanUtilities::CommandPoolWrapper CommandPoolManager::AllocateCommandPool(const char* DebugName)
 {
-    std::lock_guard<std::mutex> LockGuard{m_Mutex};
-
     VulkanUtilities::CommandPoolWrapper CmdPool;
-    if (!m_CmdPools.empty())
+    if (m_CmdPools.Pop(1, [&CmdPool](VulkanUtilities::CommandPoolWrapper&& Pool) { CmdPool = std::move(Pool); }) > 0)
     {
-        CmdPool = std::move(m_CmdPools.front());
-        m_CmdPools.pop_front();
-
+        // The pool is exclusively owned by this thread now
         m_LogicalDevice.ResetCommandPool(CmdPool);
+        m_ReusedPoolCount.fetch_add(1, std::memory_order_relaxed);
     }
 
     if (CmdPool == VK_NULL_HANDLE)
@@ -68,6 +66,7 @@ VulkanUtilities::CommandPoolWrapper CommandPoolManager::AllocateCommandPool(cons
 
         CmdPool = m_LogicalDevice.CreateCommandPool(CmdPoolCI);
         DEV_CHECK_ERR(CmdPool != VK_NULL_HANDLE, "Failed to create Vulkan command pool");
+        m_CreatedPoolCount.fetch_add(1, std::memory_order_relaxed);
     }
 
     VulkanUtilities::SetCommandPoolName(m_LogicalDevice.GetVkDevice(), CmdPool, DebugName);
@@ -80,24 +79,31 @@ VulkanUtilities::CommandPoolWrapper CommandPoolManager::AllocateCommandPool(cons
 
 void CommandPoolManager::RecycleCommandPool(VulkanUtilities::CommandPoolWrapper&& CmdPool)
 {
-    std::lock_guard<std::mutex> LockGuard{m_Mutex};
 #ifdef DILIGENT_DEVELOPMENT
     --m_AllocatedPoolCounter;
 #endif
-    m_CmdPools.emplace_back(std::move(CmdPool));
+    m_CmdPools.Push(std::move(CmdPool));
+}
+
+CommandPoolManager::PoolStats CommandPoolManager::GetStats() const
+{
+    PoolStats Stats;
+    Stats.CreatedPoolCount = m_CreatedPoolCount.load(std::memory_order_relaxed);
+    Stats.ReusedPoolCount  = m_ReusedPoolCount.load(std::memory_order_relaxed);
+    return Stats;
 }
 
 void CommandPoolManager::DestroyPools()
 {
-    std::lock_guard<std::mutex> LockGuard{m_Mutex};
     DEV_CHECK_ERR(m_AllocatedPoolCounter == 0, m_AllocatedPoolCounter, " pool(s) have not been recycled. This will cause a crash if the references to these pools are still in release queues when CommandPoolManager::RecycleCommandPool() is called for destroyed CommandPoolManager object.");
-    LOG_INFO_MESSAGE(m_Name, " allocated descriptor pool count: ", m_CmdPools.size());
-    m_CmdPools.clear();
+    const auto Stats = GetStats();
+    LOG_INFO_MESSAGE(m_Name, " stats: created ", Stats.CreatedPoolCount, " command pool(s); reused ", Stats.ReusedPoolCount, " time(s)");
+    m_CmdPools.PopAll([](VulkanUtilities::CommandPoolWrapper&&) {});
 }
 
 CommandPoolManager::~CommandPoolManager()
 {
-    DEV_CHECK_ERR(m_CmdPools.empty() && m_AllocatedPoolCounter == 0, "Command pools have not been destroyed");
+    DEV_CHECK_ERR(m_CmdPools.IsEmpty() && m_AllocatedPoolCounter == 0, "Command pools have not been destroyed");
 }
 
 } // namespace Diligent
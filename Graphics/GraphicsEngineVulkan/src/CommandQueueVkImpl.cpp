@@ -60,6 +60,13 @@ CommandQueueVkImpl::CommandQueueVkImpl(IReferenceCounters*
     if (CreateInfo.Name != nullptr)
         VulkanUtilities::SetQueueName(m_LogicalDevice->GetVkDevice(), m_VkQueue, CreateInfo.Name);
 
+    if (m_SupportedTimelineSemaphore)
+    {
+        const auto SemaphoreName = std::string{"Queue ("} + std::to_string(CommandQueueId) + ") timeline semaphore";
+        // The first submission signals value 1
+        m_vkTimelineSemaphore = m_LogicalDevice->CreateTimelineSemaphore(0, SemaphoreName.c_str());
+    }
+
     m_TempSignalSemaphores.reserve(16);
 }
 
@@ -179,14 +186,34 @@ Uint64 CommandQueueVkImpl::Submit(const VkSubmitInfo& InSubmitInfo)
     SubmitInfo.signalSemaphoreCount = static_cast<Uint32>(m_TempSignalSemaphores.size());
     SubmitInfo.pSignalSemaphores    = m_TempSignalSemaphores.data();
 
-    const uint32_t SubmitCount =
-        (SubmitInfo.waitSemaphoreCount != 0 ||
-         SubmitInfo.commandBufferCount != 0 ||
-         SubmitInfo.signalSemaphoreCount != 0) ?
-        1 :
-        0;
+    VkSubmitInfo SubmitBatches[2] = {};
+    uint32_t     SubmitCount      = 0;
+    if (SubmitInfo.waitSemaphoreCount != 0 ||
+        SubmitInfo.commandBufferCount != 0 ||
+        SubmitInfo.signalSemaphoreCount != 0)
+    {
+        SubmitBatches[SubmitCount++] = SubmitInfo;
+    }
+
+    // Signal the queue timeline semaphore in a separate batch of the same submission, so that
+    // the user-provided timeline semaphore values in SubmitInfo.pNext are not affected.
+    // The signal operation's first synchronization scope includes all commands that occur
+    // earlier in submission order, including the previous batch.
+    VkTimelineSemaphoreSubmitInfo QueueSemaphoreSignalInfo{};
+    if (m_vkTimelineSemaphore != VK_NULL_HANDLE)
+    {
+        QueueSemaphoreSignalInfo.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        QueueSemaphoreSignalInfo.signalSemaphoreValueCount = 1;
+        QueueSemaphoreSignalInfo.pSignalSemaphoreValues    = &FenceValue;
+
+        auto& SignalBatch{SubmitBatches[SubmitCount++]};
+        SignalBatch.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        SignalBatch.pNext                = &QueueSemaphoreSignalInfo;
+        SignalBatch.signalSemaphoreCount = 1;
+        SignalBatch.pSignalSemaphores    = &m_vkTimelineSemaphore;
+    }
 
-    auto err = vkQueueSubmit(m_VkQueue, SubmitCount, &SubmitInfo, NewSyncPoint->GetFence());
+    auto err = vkQueueSubmit(m_VkQueue, SubmitCount, SubmitBatches, NewSyncPoint->GetFence());
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit command buffer to the command queue");
     (void)err;
 
@@ -233,6 +260,20 @@ Uint64 CommandQueueVkImpl::WaitForIdle()
     m_pFence->Wait(UINT64_MAX);
     m_pFence->Reset(FenceValue);
 
+    if (m_vkTimelineSemaphore != VK_NULL_HANDLE)
+    {
+        // No submission signals this value, so signal it from the host to unblock
+        // the queues that may wait for it.
+        VkSemaphoreSignalInfo SignalInfo{};
+        SignalInfo.sType     = VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO;
+        SignalInfo.semaphore = m_vkTimelineSemaphore;
+        SignalInfo.value     = FenceValue;
+
+        auto err = m_LogicalDevice->SignalSemaphore(SignalInfo);
+        DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to signal the queue timeline semaphore");
+        (void)err;
+    }
+
     return FenceValue;
 }
 
@@ -318,11 +359,30 @@ Uint64 CommandQueueVkImpl::BindSparse(const VkBindSparseInfo& InBindInfo)
     for (uint32_t s = 0; s < InBindInfo.signalSemaphoreCount; ++s)
         m_TempSignalSemaphores.push_back(InBindInfo.pSignalSemaphores[s]);
 
-    VkBindSparseInfo BindInfo     = InBindInfo;
+    VkBindSparseInfo BindBatches[2] = {};
+    uint32_t         BindCount      = 0;
+
+    auto& BindInfo{BindBatches[BindCount++]};
+    BindInfo                      = InBindInfo;
     BindInfo.signalSemaphoreCount = static_cast<Uint32>(m_TempSignalSemaphores.size());
     BindInfo.pSignalSemaphores    = m_TempSignalSemaphores.data();
 
-    auto err = vkQueueBindSparse(m_VkQueue, 1, &BindInfo, NewSyncPoint->GetFence());
+    // Signal the queue timeline semaphore in a separate batch, see Submit()
+    VkTimelineSemaphoreSubmitInfo QueueSemaphoreSignalInfo{};
+    if (m_vkTimelineSemaphore != VK_NULL_HANDLE)
+    {
+        QueueSemaphoreSignalInfo.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        QueueSemaphoreSignalInfo.signalSemaphoreValueCount = 1;
+        QueueSemaphoreSignalInfo.pSignalSemaphoreValues    = &FenceValue;
+
+        auto& SignalBatch{BindBatches[BindCount++]};
+        SignalBatch.sType                = VK_STRUCTURE_TYPE_BIND_SPARSE_INFO;
+        SignalBatch.pNext                = &QueueSemaphoreSignalInfo;
+        SignalBatch.signalSemaphoreCount = 1;
+        SignalBatch.pSignalSemaphores    = &m_vkTimelineSemaphore;
+    }
+
+    auto err = vkQueueBindSparse(m_VkQueue, BindCount, BindBatches, NewSyncPoint->GetFence());
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit sparse bind commands to the command queue");
     (void)err;
 
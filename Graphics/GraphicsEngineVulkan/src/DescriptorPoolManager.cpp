@@ -28,6 +28,7 @@
 #include "pch.h"
 #include "DescriptorPoolManager.hpp"
 #include "RenderDeviceVkImpl.hpp"
+#include "EngineMemory.h"
 
 namespace Diligent
 {
@@ -43,8 +44,10 @@ void DescriptorSetAllocation::Release()
     }
 }
 
-VulkanUtilities::DescriptorPoolWrapper DescriptorPoolManager::CreateDescriptorPool(const char* DebugName) const
+VulkanUtilities::DescriptorPoolWrapper DescriptorPoolManager::CreateDescriptorPool(const char* DebugName)
 {
+    m_CreatedPoolCount.fetch_add(1, std::memory_order_relaxed);
+
     VkDescriptorPoolCreateInfo PoolCI = {};
 
     PoolCI.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
@@ -89,7 +92,8 @@ DescriptorPoolManager::DescriptorPoolManager(RenderDeviceVkImpl&               D
     m_PoolName    {std::move(PoolName) },
     m_PoolSizes   (PrunePoolSizes(DeviceVkImpl, std::move(PoolSizes))),
     m_MaxSets     {MaxSets             },
-    m_AllowFreeing{AllowFreeing        }
+    m_AllowFreeing{AllowFreeing        },
+    m_FreePools   {GetRawAllocator()   }
 // clang-format on
 {
 #ifdef DILIGENT_DEVELOPMENT
@@ -100,25 +104,47 @@ DescriptorPoolManager::DescriptorPoolManager(RenderDeviceVkImpl&               D
 DescriptorPoolManager::~DescriptorPoolManager()
 {
     DEV_CHECK_ERR(m_AllocatedPoolCounter == 0, "Not all allocated descriptor pools are returned to the pool manager");
-    LOG_INFO_MESSAGE(m_PoolName, " stats: allocated ", m_Pools.size(), " pool(s)");
+    const auto Stats = GetStats();
+    LOG_INFO_MESSAGE(m_PoolName, " stats: created ", Stats.CreatedPoolCount, " pool(s); reused ", Stats.ReusedPoolCount,
+                     " time(s); recycled ", Stats.RecycledPoolCount, " time(s)");
+}
+
+DescriptorPoolManager::PoolStats DescriptorPoolManager::GetStats() const
+{
+    PoolStats Stats;
+    Stats.CreatedPoolCount  = m_CreatedPoolCount.load(std::memory_order_relaxed);
+    Stats.ReusedPoolCount   = m_ReusedPoolCount.load(std::memory_order_relaxed);
+    Stats.RecycledPoolCount = m_RecycledPoolCount.load(std::memory_order_relaxed);
+    return Stats;
 }
 
 VulkanUtilities::DescriptorPoolWrapper DescriptorPoolManager::GetPool(const char* DebugName)
 {
-    std::lock_guard<std::mutex> Lock{m_Mutex};
+    std::vector<VulkanUtilities::DescriptorPoolWrapper> Pools;
+    GetPools(Pools, 1, DebugName);
+    VERIFY_EXPR(Pools.size() == 1);
+    return std::move(Pools.front());
+}
+
+void DescriptorPoolManager::GetPools(std::vector<VulkanUtilities::DescriptorPoolWrapper>& Pools, Uint32 MaxCount, const char* DebugName)
+{
+    VERIFY_EXPR(MaxCount > 0);
+
+    const auto vkDevice = m_DeviceVkImpl.GetLogicalDevice().GetVkDevice();
+
+    const auto NumPools = m_FreePools.Pop(MaxCount,
+                                          [&](VulkanUtilities::DescriptorPoolWrapper&& Pool) {
+                                              VulkanUtilities::SetDescriptorPoolName(vkDevice, Pool, DebugName);
+                                              Pools.emplace_back(std::move(Pool));
+                                          });
+    if (NumPools > 0)
+        m_ReusedPoolCount.fetch_add(NumPools, std::memory_order_relaxed);
+    else
+        Pools.emplace_back(CreateDescriptorPool(DebugName));
+
 #ifdef DILIGENT_DEVELOPMENT
-    ++m_AllocatedPoolCounter;
+    m_AllocatedPoolCounter.fetch_add(static_cast<Int32>(std::max(NumPools, size_t{1})));
 #endif
-    if (m_Pools.empty())
-        return CreateDescriptorPool(DebugName);
-    else
-    {
-        auto& LogicalDevice = m_DeviceVkImpl.GetLogicalDevice();
-        auto  Pool          = std::move(m_Pools.front());
-        VulkanUtilities::SetDescriptorPoolName(LogicalDevice.GetVkDevice(), Pool, DebugName);
-        m_Pools.pop_front();
-        return Pool;
-    }
 }
 
 void DescriptorPoolManager::DisposePool(VulkanUtilities::DescriptorPoolWrapper&& Pool, Uint64 QueueMask)
@@ -161,11 +187,61 @@ void DescriptorPoolManager::DisposePool(VulkanUtilities::DescriptorPoolWrapper&&
     m_DeviceVkImpl.SafeReleaseDeviceObject(DescriptorPoolDeleter{*this, std::move(Pool)}, QueueMask);
 }
 
+void DescriptorPoolManager::DisposePools(std::vector<VulkanUtilities::DescriptorPoolWrapper>&& Pools, Uint64 QueueMask)
+{
+    class DescriptorPoolsDeleter
+    {
+    public:
+        // clang-format off
+        DescriptorPoolsDeleter(DescriptorPoolManager&                                _PoolMgr,
+                               std::vector<VulkanUtilities::DescriptorPoolWrapper>&& _Pools) noexcept :
+            PoolMgr {&_PoolMgr        },
+            Pools   {std::move(_Pools)}
+        {}
+
+        DescriptorPoolsDeleter            (const DescriptorPoolsDeleter&) = delete;
+        DescriptorPoolsDeleter& operator= (const DescriptorPoolsDeleter&) = delete;
+        DescriptorPoolsDeleter& operator= (      DescriptorPoolsDeleter&&)= delete;
+
+        DescriptorPoolsDeleter(DescriptorPoolsDeleter&& rhs)noexcept :
+            PoolMgr {rhs.PoolMgr         },
+            Pools   {std::move(rhs.Pools)}
+        {
+            rhs.PoolMgr = nullptr;
+        }
+        // clang-format on
+
+        ~DescriptorPoolsDeleter()
+        {
+            if (PoolMgr != nullptr)
+            {
+                for (auto& Pool : Pools)
+                    PoolMgr->FreePool(std::move(Pool));
+            }
+        }
+
+    private:
+        DescriptorPoolManager*                              PoolMgr;
+        std::vector<VulkanUtilities::DescriptorPoolWrapper> Pools;
+    };
+
+    if (!Pools.empty())
+        m_DeviceVkImpl.SafeReleaseDeviceObject(DescriptorPoolsDeleter{*this, std::move(Pools)}, QueueMask);
+}
+
+void DescriptorPoolManager::ReturnPools(std::vector<VulkanUtilities::DescriptorPoolWrapper>&& Pools)
+{
+    for (auto& Pool : Pools)
+        FreePool(std::move(Pool));
+    Pools.clear();
+}
+
 void DescriptorPoolManager::FreePool(VulkanUtilities::DescriptorPoolWrapper&& Pool)
 {
-    std::lock_guard<std::mutex> Lock{m_Mutex};
+    // The pool is not used by anyone else, so it can be reset without synchronization
     m_DeviceVkImpl.GetLogicalDevice().ResetDescriptorPool(Pool);
-    m_Pools.emplace_back(std::move(Pool));
+    m_FreePools.Push(std::move(Pool));
+    m_RecycledPoolCount.fetch_add(1, std::memory_order_relaxed);
 #ifdef DILIGENT_DEVELOPMENT
     --m_AllocatedPoolCounter;
 #endif
@@ -298,7 +374,11 @@ VkDescriptorSet DynamicDescriptorSetAllocator::Allocate(VkDescriptorSetLayout Se
 
     if (set == VK_NULL_HANDLE)
     {
-        m_AllocatedPools.emplace_back(m_GlobalPoolMgr.GetPool("Dynamic Descriptor Pool"));
+        if (m_FreePools.empty())
+            m_GlobalPoolMgr.GetPools(m_FreePools, PoolBatchSize, "Dynamic Descriptor Pool");
+
+        m_AllocatedPools.emplace_back(std::move(m_FreePools.back()));
+        m_FreePools.pop_back();
         set = AllocateDescriptorSet(LogicalDevice, m_AllocatedPools.back(), SetLayout, DebugName);
     }
 
@@ -307,17 +387,17 @@ VkDescriptorSet DynamicDescriptorSetAllocator::Allocate(VkDescriptorSetLayout Se
 
 void DynamicDescriptorSetAllocator::ReleasePools(Uint64 QueueMask)
 {
-    for (auto& Pool : m_AllocatedPools)
-    {
-        m_GlobalPoolMgr.DisposePool(std::move(Pool), QueueMask);
-    }
     m_PeakPoolCount = std::max(m_PeakPoolCount, m_AllocatedPools.size());
+    // All pools go into a single release queue entry
+    m_GlobalPoolMgr.DisposePools(std::move(m_AllocatedPools), QueueMask);
     m_AllocatedPools.clear();
 }
 
 DynamicDescriptorSetAllocator::~DynamicDescriptorSetAllocator()
 {
     DEV_CHECK_ERR(m_AllocatedPools.empty(), "All allocated pools must be returned to the parent descriptor pool manager");
+    // Pools in the local free list have never been used since they were reset
+    m_GlobalPoolMgr.ReturnPools(std::move(m_FreePools));
     LOG_INFO_MESSAGE(m_Name, " peak descriptor pool count: ", m_PeakPoolCount);
 }
 
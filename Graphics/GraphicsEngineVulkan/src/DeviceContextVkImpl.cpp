@@ -45,6 +45,7 @@
 #include "GraphicsAccessories.hpp"
 #include "GenerateMipsVkHelper.hpp"
 #include "QueryManagerVk.hpp"
+#include "GPUProfilerVk.hpp"
 #include "CommandQueueVkImpl.hpp"
 
 namespace Diligent
@@ -101,12 +102,17 @@ DeviceContextVkImpl::DeviceContextVkImpl(IReferenceCounters*       pRefCounters,
     }
 // clang-format on
 {
+    m_CommandBuffer.SetBarrierStats(&m_Stats.Barriers);
+
     if (!IsDeferred())
     {
         PrepareCommandPool(GetCommandQueueId());
         m_pQueryMgr = &pDeviceVkImpl->GetQueryMgr(GetCommandQueueId());
         EnsureVkCmdBuffer();
         m_State.NumCommands += m_pQueryMgr->ResetStaleQueries(m_pDevice->GetLogicalDevice(), m_CommandBuffer);
+
+        if (EngineCI.GPUProfilerMaxScopesPerFrame != 0 && m_pQueryMgr->GetQueryPool(QUERY_TYPE_TIMESTAMP) != VK_NULL_HANDLE)
+            m_pProfiler = std::make_unique<GPUProfilerVk>(pDeviceVkImpl, *m_pQueryMgr, EngineCI.GPUProfilerMaxScopesPerFrame);
     }
 
     BufferDesc DummyVBDesc;
@@ -212,7 +218,7 @@ void DeviceContextVkImpl::Begin(Uint32 ImmediateContextId)
     m_pQueryMgr = &m_pDevice->GetQueryMgr(CommandQueueId);
 }
 
-void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkCommandBuffer vkCmdBuff, Uint64 FenceValue)
+void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkCommandBuffer vkCmdBuff, Uint64 FenceValue, VkCommandBufferLevel Level)
 {
     VERIFY_EXPR(vkCmdBuff != VK_NULL_HANDLE);
     VERIFY_EXPR(m_CmdPool != nullptr);
@@ -221,9 +227,11 @@ void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkComm
     public:
         // clang-format off
         CmdBufferRecycler(VkCommandBuffer                           _vkCmdBuff,
-                         VulkanUtilities::VulkanCommandBufferPool& _Pool) noexcept :
+                         VulkanUtilities::VulkanCommandBufferPool& _Pool,
+                         VkCommandBufferLevel                      _Level) noexcept :
             vkCmdBuff {_vkCmdBuff},
-            Pool      {&_Pool    }
+            Pool      {&_Pool    },
+            Level     {_Level    }
         {
             VERIFY_EXPR(vkCmdBuff != VK_NULL_HANDLE);
         }
@@ -234,7 +242,8 @@ void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkComm
 
         CmdBufferRecycler(CmdBufferRecycler&& rhs) noexcept :
             vkCmdBuff {rhs.vkCmdBuff},
-            Pool      {rhs.Pool     }
+            Pool      {rhs.Pool     },
+            Level     {rhs.Level    }
         {
             rhs.vkCmdBuff = VK_NULL_HANDLE;
             rhs.Pool      = nullptr;
@@ -245,19 +254,20 @@ void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkComm
         {
             if (Pool != nullptr)
             {
-                Pool->RecycleCommandBuffer(std::move(vkCmdBuff));
+                Pool->RecycleCommandBuffer(std::move(vkCmdBuff), Level);
             }
         }
 
     private:
         VkCommandBuffer                           vkCmdBuff = VK_NULL_HANDLE;
         VulkanUtilities::VulkanCommandBufferPool* Pool      = nullptr;
+        VkCommandBufferLevel                      Level     = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
     };
 
     // Discard command buffer directly to the release queue since we know exactly which queue it was submitted to
     // as well as the associated FenceValue.
     auto& ReleaseQueue = m_pDevice->GetReleaseQueue(CmdQueue);
-    ReleaseQueue.DiscardResource(CmdBufferRecycler{vkCmdBuff, *m_CmdPool}, FenceValue);
+    ReleaseQueue.DiscardResource(CmdBufferRecycler{vkCmdBuff, *m_CmdPool, Level}, FenceValue);
 }
 
 inline void DeviceContextVkImpl::DisposeCurrentCmdBuffer(SoftwareQueueIndex CmdQueue, Uint64 FenceValue)
@@ -266,7 +276,7 @@ inline void DeviceContextVkImpl::DisposeCurrentCmdBuffer(SoftwareQueueIndex CmdQ
     auto vkCmdBuff = m_CommandBuffer.GetVkCmdBuffer();
     if (vkCmdBuff != VK_NULL_HANDLE)
     {
-        DisposeVkCmdBuffer(CmdQueue, vkCmdBuff, FenceValue);
+        DisposeVkCmdBuffer(CmdQueue, vkCmdBuff, FenceValue, VK_COMMAND_BUFFER_LEVEL_PRIMARY);
         m_CommandBuffer.Reset();
     }
 }
@@ -421,6 +431,12 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
 {
     VERIFY(CommitSRBMask != 0, "This method should not be called when there is nothing to commit");
 
+    if (m_pDevice->UseDescriptorBuffers())
+    {
+        CommitDescriptorBuffers(BindInfo, CommitSRBMask);
+        return;
+    }
+
     const auto FirstSign = PlatformMisc::GetLSB(CommitSRBMask);
     const auto LastSign  = PlatformMisc::GetMSB(CommitSRBMask);
     VERIFY_EXPR(LastSign < m_pPipelineState->GetResourceSignatureCount());
@@ -483,6 +499,81 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
     BindInfo.StaleSRBMask &= ~BindInfo.ActiveSRBMask;
 }
 
+void DeviceContextVkImpl::CommitDescriptorBuffers(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask)
+{
+    VERIFY_EXPR(m_pDevice->UseDescriptorBuffers());
+    VERIFY_EXPR(m_State.vkPipelineBindPoint != VK_PIPELINE_BIND_POINT_MAX_ENUM);
+
+    auto&        DynamicMemMgr    = m_pDevice->GetDynamicMemoryManager();
+    const Uint32 DescrBufferAlign = StaticCast<Uint32>(m_pDevice->GetPhysicalDevice().GetExtProperties().DescriptorBuffer.descriptorBufferOffsetAlignment);
+
+    // Descriptors of all SRBs are suballocated from the dynamic heap, which is bound as the only
+    // descriptor buffer. The heap buffer is never resized, so it only needs to be bound once per command buffer.
+    m_CommandBuffer.BindDescriptorBuffer(DynamicMemMgr.GetVkDeviceAddress(),
+                                         VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT);
+
+    // All descriptor sets use the same buffer
+    static constexpr std::array<uint32_t, MAX_DESCR_SET_PER_SIGNATURE> BufferIndices = {};
+
+    while (CommitSRBMask != 0)
+    {
+        const Uint32 sign = PlatformMisc::GetLSB(CommitSRBMask);
+        CommitSRBMask &= ~(1u << sign);
+        VERIFY_EXPR(sign < m_pPipelineState->GetResourceSignatureCount());
+
+        auto&       SetInfo        = BindInfo.SetInfo[sign];
+        const auto* pResourceCache = BindInfo.ResourceCaches[sign];
+        const auto* pSignature     = SetInfo.pSignature;
+        DEV_CHECK_ERR(pResourceCache != nullptr && pSignature != nullptr, "Resource cache at binding index ", sign, " is null");
+
+        Uint32 NumSets = 0;
+        for (auto SetId : {PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE, PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC})
+        {
+            if (!pSignature->HasDescriptorSet(SetId))
+                continue;
+
+            // Static/mutable descriptors written earlier in this frame can be reused as long as the cache
+            // has not changed. Dynamic buffers are excluded as their addresses change without a revision update.
+            DescrBufferSetInfo* pCachedSet = nullptr;
+            if (SetId == PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE && !pResourceCache->HasDynamicResources())
+            {
+                pCachedSet = &m_StaticDescrBufferSets[pResourceCache->GetUniqueID()];
+                if (pCachedSet->Size != 0 && pCachedSet->Revision == pResourceCache->GetRevision())
+                {
+                    SetInfo.DescrBufferOffsets[NumSets++] = pCachedSet->Offset;
+                    continue;
+                }
+            }
+
+            const VkDeviceSize SetSize = pSignature->GetDescriptorBufferSetSize(SetId);
+            if (auto Allocation = AllocateDynamicSpace(SetSize, DescrBufferAlign))
+            {
+                const Uint32 Revision = pResourceCache->GetRevision();
+                pSignature->WriteDescriptorBuffer(*pResourceCache, SetId, GetContextId(), DynamicMemMgr.GetCPUAddress() + Allocation.AlignedOffset);
+                SetInfo.DescrBufferOffsets[NumSets] = Allocation.AlignedOffset;
+                if (pCachedSet != nullptr)
+                    *pCachedSet = {Allocation.AlignedOffset, SetSize, Revision};
+            }
+            else
+            {
+                LOG_ERROR_MESSAGE("Failed to allocate ", SetSize, " bytes in the dynamic heap for descriptors of resource signature '",
+                                  pSignature->GetDesc().Name, "'. Consider increasing EngineVkCreateInfo::DynamicHeapSize.");
+            }
+            ++NumSets;
+        }
+        VERIFY_EXPR(NumSets == pSignature->GetNumDescriptorSets());
+
+        m_CommandBuffer.SetDescriptorBufferOffsets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, SetInfo.BaseInd, NumSets,
+                                                   BufferIndices.data(), SetInfo.DescrBufferOffsets.data());
+
+#ifdef DILIGENT_DEVELOPMENT
+        SetInfo.LastBoundBaseInd = SetInfo.BaseInd;
+#endif
+    }
+
+    BindInfo.StaleSRBMask &= ~BindInfo.ActiveSRBMask;
+}
+
 #ifdef DILIGENT_DEVELOPMENT
 void DeviceContextVkImpl::DvpValidateCommittedShaderResources(ResourceBindInfo& BindInfo)
 {
@@ -502,11 +593,19 @@ void DeviceContextVkImpl::DvpValidateCommittedShaderResources(ResourceBindInfo&
 
         const auto& SetInfo = BindInfo.SetInfo[i];
         const auto  DSCount = pSign->GetNumDescriptorSets();
-        for (Uint32 s = 0; s < DSCount; ++s)
+        if (m_pDevice->UseDescriptorBuffers())
         {
-            DEV_CHECK_ERR(SetInfo.vkSets[s] != VK_NULL_HANDLE,
-                          "descriptor set with index ", s, " is not bound for resource signature '",
-                          pSign->GetDesc().Name, "', binding index ", i, ".");
+            DEV_CHECK_ERR(SetInfo.pSignature != nullptr,
+                          "descriptors are not written for resource signature '", pSign->GetDesc().Name, "', binding index ", i, ".");
+        }
+        else
+        {
+            for (Uint32 s = 0; s < DSCount; ++s)
+            {
+                DEV_CHECK_ERR(SetInfo.vkSets[s] != VK_NULL_HANDLE,
+                              "descriptor set with index ", s, " is not bound for resource signature '",
+                              pSign->GetDesc().Name, "', binding index ", i, ".");
+            }
         }
 
         DEV_CHECK_ERR(SetInfo.LastBoundBaseInd == SetInfo.BaseInd,
@@ -559,9 +658,15 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
     }
 #endif
 
+    auto& BindInfo = GetBindInfo(pResBindingVkImpl->GetPipelineType());
+    if (IsRedundantSRBCommit(BindInfo, pResBindingVkImpl))
+    {
+        // The descriptor sets of this SRB are already up to date
+        return;
+    }
+
     const auto  SRBIndex   = pResBindingVkImpl->GetBindingIndex();
     const auto* pSignature = pResBindingVkImpl->GetSignature();
-    auto&       BindInfo   = GetBindInfo(pResBindingVkImpl->GetPipelineType());
     auto&       SetInfo    = BindInfo.SetInfo[SRBIndex];
 
     BindInfo.Set(SRBIndex, pResBindingVkImpl);
@@ -569,6 +674,14 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
     // are set by SetPipelineState().
     SetInfo.vkSets = {};
 
+    if (m_pDevice->UseDescriptorBuffers())
+    {
+        // The SRB is now stale. Its descriptors will be written to the descriptor buffer
+        // by CommitDescriptorBuffers() when a draw or dispatch command is issued.
+        SetInfo.pSignature = pSignature;
+        return;
+    }
+
     Uint32 DSIndex = 0;
     if (pSignature->HasDescriptorSet(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE))
     {
@@ -610,6 +723,7 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
 
 void DeviceContextVkImpl::SetStencilRef(Uint32 StencilRef)
 {
+    DEV_CHECK_ERR(IsInlineSubpass(), "SetStencilRef() can't be called in a render pass begun by IDeviceContextVk::BeginSecondaryRenderPass()");
     if (TDeviceContextBase::SetStencilRef(StencilRef, 0))
     {
         EnsureVkCmdBuffer();
@@ -619,6 +733,7 @@ void DeviceContextVkImpl::SetStencilRef(Uint32 StencilRef)
 
 void DeviceContextVkImpl::SetBlendFactors(const float* pBlendFactors)
 {
+    DEV_CHECK_ERR(IsInlineSubpass(), "SetBlendFactors() can't be called in a render pass begun by IDeviceContextVk::BeginSecondaryRenderPass()");
     if (TDeviceContextBase::SetBlendFactors(pBlendFactors, 0))
     {
         EnsureVkCmdBuffer();
@@ -735,6 +850,10 @@ void DeviceContextVkImpl::PrepareForDraw(DRAW_FLAGS Flags)
     }
 
 #ifdef DILIGENT_DEVELOPMENT
+    DEV_CHECK_ERR(IsInlineSubpass(),
+                  "Draw commands can't be recorded in a render pass begun by IDeviceContextVk::BeginSecondaryRenderPass(). "
+                  "Record them in secondary command lists instead.");
+
     if ((Flags & DRAW_FLAG_VERIFY_RENDER_TARGETS) != 0)
         DvpVerifyRenderTargets();
 
@@ -1148,6 +1267,7 @@ void DeviceContextVkImpl::ClearDepthStencil(ITextureView*                  pView
                                             RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
 {
     TDeviceContextBase::ClearDepthStencil(pView);
+    DEV_CHECK_ERR(IsInlineSubpass(), "ClearDepthStencil() can't be called in a render pass begun by IDeviceContextVk::BeginSecondaryRenderPass()");
 
     auto* pVkDSV = ClassPtrCast<ITextureViewVk>(pView);
 
@@ -1249,6 +1369,7 @@ VkClearColorValue ClearValueToVkClearValue(const void* RGBA, TEXTURE_FORMAT TexF
 void DeviceContextVkImpl::ClearRenderTarget(ITextureView* pView, const void* RGBA, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
 {
     TDeviceContextBase::ClearRenderTarget(pView);
+    DEV_CHECK_ERR(IsInlineSubpass(), "ClearRenderTarget() can't be called in a render pass begun by IDeviceContextVk::BeginSecondaryRenderPass()");
 
     auto* pVkRTV = ClassPtrCast<ITextureViewVk>(pView);
 
@@ -1399,12 +1520,17 @@ void DeviceContextVkImpl::FinishFrame()
     // Note: as global dynamic memory manager is hosted by the render device, the dynamic heap can
     // be destroyed before the blocks are actually returned to the global dynamic memory manager.
     m_DynamicHeap.ReleaseMasterBlocks(*m_pDevice, QueueMask);
+    // Descriptors written to the dynamic heap are no longer valid
+    m_StaticDescrBufferSets.clear();
 
     // Dynamic descriptor set allocator returns all allocated pools to the global dynamic descriptor pool manager.
     // Note: as global pool manager is hosted by the render device, the allocator can
     // be destroyed before the pools are actually returned to the global pool manager.
     m_DynamicDescrSetAllocator.ReleasePools(QueueMask);
 
+    if (m_pProfiler)
+        m_pProfiler->EndFrame(m_pDevice->GetCompletedFenceValue(GetCommandQueueId()));
+
     EndFrame();
 }
 
@@ -1442,6 +1568,12 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
             m_State.NumCommands += m_pQueryMgr->ResetStaleQueries(m_pDevice->GetLogicalDevice(), m_CommandBuffer);
         }
 
+        if (m_pProfiler)
+        {
+            // Copy the results of all profiler queries recorded since the last flush with one command per frame
+            m_State.NumCommands += m_pProfiler->ResolveQueries(m_CommandBuffer);
+        }
+
         if (m_State.NumCommands != 0)
         {
             if (m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE)
@@ -1469,6 +1601,7 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
         DEV_CHECK_ERR(pCmdListVk->GetQueueId() == GetDesc().QueueId, "Command list recorded for QueueId ", pCmdListVk->GetQueueId(), ", but executed on QueueId ", GetDesc().QueueId, ".");
         DeferredCtxs.emplace_back();
         vkCmdBuffs.emplace_back();
+        DEV_CHECK_ERR(!pCmdListVk->IsSecondary(), "Secondary command lists must be executed by IDeviceContextVk::ExecuteSecondaryCommandLists()");
         pCmdListVk->Close(DeferredCtxs.back(), vkCmdBuffs.back());
         VERIFY(vkCmdBuffs.back() != VK_NULL_HANDLE, "Trying to execute empty command buffer");
         VERIFY_EXPR(DeferredCtxs.back() != nullptr);
@@ -1526,6 +1659,18 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
         }
     }
 
+    for (const auto& val_queue : m_WaitQueues)
+    {
+        // Queue timeline semaphores are signaled by every submission, so the wait maps directly
+        // to a GPU-side semaphore wait without additional submissions or CPU synchronization.
+        const auto& CmdQueue = m_pDevice->GetCommandQueue(val_queue.second);
+        VERIFY(CmdQueue.GetVkTimelineSemaphore() != VK_NULL_HANDLE, "Queue timeline semaphore is not initialized");
+        UsedTimelineSemaphore = true;
+        m_VkWaitSemaphores.push_back(CmdQueue.GetVkTimelineSemaphore());
+        m_WaitDstStageMasks.push_back(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+        m_WaitSemaphoreValues.push_back(val_queue.first);
+    }
+
     VERIFY_EXPR(m_VkWaitSemaphores.size() == m_WaitDstStageMasks.size());
     VERIFY_EXPR(m_VkWaitSemaphores.size() == m_WaitSemaphoreValues.size());
     VERIFY_EXPR(m_VkSignalSemaphores.size() == m_SignalSemaphoreValues.size());
@@ -1557,6 +1702,11 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
     // Submit command buffer even if there are no commands to release stale resources.
     auto SubmittedFenceValue = m_pDevice->ExecuteCommandBuffer(GetCommandQueueId(), SubmitInfo, &m_SignalFences);
 
+    m_LastSubmittedFenceValue = SubmittedFenceValue;
+
+    if (m_pProfiler)
+        m_pProfiler->OnCommandBufferSubmitted(SubmittedFenceValue);
+
     // Recycle semaphores
     {
         auto& ReleaseQueue = m_pDevice->GetReleaseQueue(GetCommandQueueId());
@@ -1575,6 +1725,7 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
     m_VkSignalSemaphores.clear();
     m_SignalFences.clear();
     m_WaitFences.clear();
+    m_WaitQueues.clear();
     m_WaitSemaphoreValues.clear();
     m_SignalSemaphoreValues.clear();
 
@@ -1593,10 +1744,19 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
         pDeferredCtxVkImpl->UpdateSubmittedBuffersCmdQueueMask(GetCommandQueueId());
         // It is OK to dispose command buffer from another thread. We are not going to
         // record any commands and only need to add the buffer to the queue
-        pDeferredCtxVkImpl->DisposeVkCmdBuffer(GetCommandQueueId(), std::move(vkCmdBuffs[buff_idx]), SubmittedFenceValue);
+        pDeferredCtxVkImpl->DisposeVkCmdBuffer(GetCommandQueueId(), std::move(vkCmdBuffs[buff_idx]), SubmittedFenceValue, VK_COMMAND_BUFFER_LEVEL_PRIMARY);
     }
     VERIFY_EXPR(buff_idx == vkCmdBuffs.size());
 
+    // Secondary command buffers were executed by the primary command buffer submitted above
+    for (auto& Ctx_CmdBuff : m_ExecutedSecondaryCmdBuffers)
+    {
+        auto pDeferredCtxVkImpl = Ctx_CmdBuff.first.RawPtr<DeviceContextVkImpl>();
+        pDeferredCtxVkImpl->UpdateSubmittedBuffersCmdQueueMask(GetCommandQueueId());
+        pDeferredCtxVkImpl->DisposeVkCmdBuffer(GetCommandQueueId(), Ctx_CmdBuff.second, SubmittedFenceValue, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    }
+    m_ExecutedSecondaryCmdBuffers.clear();
+
     m_State    = {};
     m_BindInfo = {};
     m_CommandBuffer.Reset();
@@ -1701,6 +1861,7 @@ void DeviceContextVkImpl::CommitViewports()
 void DeviceContextVkImpl::SetViewports(Uint32 NumViewports, const Viewport* pViewports, Uint32 RTWidth, Uint32 RTHeight)
 {
     TDeviceContextBase::SetViewports(NumViewports, pViewports, RTWidth, RTHeight);
+    DEV_CHECK_ERR(IsInlineSubpass(), "SetViewports() can't be called in a render pass begun by IDeviceContextVk::BeginSecondaryRenderPass()");
     VERIFY(NumViewports == m_NumViewports, "Unexpected number of viewports");
 
     if (m_State.NullRenderTargets)
@@ -1752,6 +1913,7 @@ void DeviceContextVkImpl::CommitScissorRects()
 void DeviceContextVkImpl::SetScissorRects(Uint32 NumRects, const Rect* pRects, Uint32 RTWidth, Uint32 RTHeight)
 {
     TDeviceContextBase::SetScissorRects(NumRects, pRects, RTWidth, RTHeight);
+    DEV_CHECK_ERR(IsInlineSubpass(), "SetScissorRects() can't be called in a render pass begun by IDeviceContextVk::BeginSecondaryRenderPass()");
 
     // Only commit scissor rects if scissor test is enabled in the rasterizer state.
     // If scissor is currently disabled, or no PSO is bound, scissor rects will be committed by
@@ -1977,26 +2139,127 @@ void DeviceContextVkImpl::BeginRenderPass(const BeginRenderPassAttribs& Attribs)
     }
 
     EnsureVkCmdBuffer();
-    m_CommandBuffer.BeginRenderPass(m_vkRenderPass, m_vkFramebuffer, m_FramebufferWidth, m_FramebufferHeight, Attribs.ClearValueCount, pVkClearValues);
+    m_CommandBuffer.BeginRenderPass(m_vkRenderPass, m_vkFramebuffer, m_FramebufferWidth, m_FramebufferHeight, Attribs.ClearValueCount, pVkClearValues, m_vkSubpassContents);
 
-    // Set the viewport to match the framebuffer size
-    SetViewports(1, nullptr, 0, 0);
+    // Set the viewport to match the framebuffer size.
+    // Dynamic states can't be set in the subpass whose contents are recorded in secondary command buffers.
+    if (IsInlineSubpass())
+        SetViewports(1, nullptr, 0, 0);
 
     m_State.ShadingRateIsSet = false;
 }
 
+void DeviceContextVkImpl::BeginSecondaryRenderPass(const BeginRenderPassAttribs& Attribs)
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Only immediate contexts can begin render passes that execute secondary command lists");
+
+    m_vkSubpassContents = VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS;
+    BeginRenderPass(Attribs);
+}
+
 void DeviceContextVkImpl::NextSubpass()
 {
+    DEV_CHECK_ERR(!m_IsRecordingSecondary, "NextSubpass() can't be called in a secondary command list");
     TDeviceContextBase::NextSubpass();
     VERIFY_EXPR(m_CommandBuffer.GetVkCmdBuffer() != VK_NULL_HANDLE && m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE);
-    m_CommandBuffer.NextSubpass();
+    m_CommandBuffer.NextSubpass(m_vkSubpassContents);
 }
 
 void DeviceContextVkImpl::EndRenderPass()
 {
+    DEV_CHECK_ERR(!m_IsRecordingSecondary, "EndRenderPass() can't be called in a secondary command list. The render pass is ended by the immediate context.");
     TDeviceContextBase::EndRenderPass();
     // TDeviceContextBase::EndRenderPass calls ResetRenderTargets() that in turn
     // calls m_CommandBuffer.EndRenderPass()
+    m_vkSubpassContents = VK_SUBPASS_CONTENTS_INLINE;
+}
+
+void DeviceContextVkImpl::BeginSecondaryCommandList(const SecondaryCommandListAttribsVk& Attribs)
+{
+    DEV_CHECK_ERR(IsDeferred(), "BeginSecondaryCommandList() should only be called for deferred contexts.");
+    DEV_CHECK_ERR(Attribs.pRenderPass != nullptr, "Render pass must not be null");
+    DEV_CHECK_ERR(Attribs.pFramebuffer != nullptr, "Framebuffer must not be null");
+    DEV_CHECK_ERR(Attribs.SubpassIndex < Attribs.pRenderPass->GetDesc().SubpassCount,
+                  "Subpass index (", Attribs.SubpassIndex, ") exceeds the number of subpasses (",
+                  Attribs.pRenderPass->GetDesc().SubpassCount, ") in render pass '", Attribs.pRenderPass->GetDesc().Name, "'");
+
+    Begin(Attribs.ImmediateContextId);
+
+    // The render pass is active in the immediate context that will execute the command list.
+    // Set it in the context so that the draw commands are validated against the subpass attachments.
+    m_pActiveRenderPass                   = ClassPtrCast<RenderPassVkImpl>(Attribs.pRenderPass);
+    m_pBoundFramebuffer                   = ClassPtrCast<FramebufferVkImpl>(Attribs.pFramebuffer);
+    m_SubpassIndex                        = Attribs.SubpassIndex;
+    m_RenderPassAttachmentsTransitionMode = RESOURCE_STATE_TRANSITION_MODE_NONE;
+    SetSubpassRenderTargets();
+
+    m_vkRenderPass  = m_pActiveRenderPass->GetVkRenderPass();
+    m_vkFramebuffer = m_pBoundFramebuffer->GetVkFramebuffer();
+
+    VkCommandBufferInheritanceInfo InheritanceInfo{};
+    InheritanceInfo.sType                = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    InheritanceInfo.pNext                = nullptr;
+    InheritanceInfo.renderPass           = m_vkRenderPass;
+    InheritanceInfo.subpass              = m_SubpassIndex;
+    InheritanceInfo.framebuffer          = m_vkFramebuffer; // Providing the framebuffer may result in better performance
+    InheritanceInfo.occlusionQueryEnable = VK_FALSE;
+    InheritanceInfo.queryFlags           = 0;
+    InheritanceInfo.pipelineStatistics   = 0;
+
+    VERIFY_EXPR(m_CommandBuffer.GetVkCmdBuffer() == VK_NULL_HANDLE);
+    auto vkCmdBuff = m_CmdPool->GetCommandBuffer("", &InheritanceInfo);
+    m_CommandBuffer.SetVkCmdBuffer(vkCmdBuff, m_CmdPool->GetSupportedStagesMask(), m_CmdPool->GetSupportedAccessMask());
+    m_CommandBuffer.SetInheritedRenderPass(m_vkRenderPass, m_vkFramebuffer, m_FramebufferWidth, m_FramebufferHeight);
+    m_IsRecordingSecondary = true;
+
+    // Dynamic states are not inherited by secondary command buffers.
+    // Set the viewport to match the framebuffer size.
+    SetViewports(1, nullptr, 0, 0);
+}
+
+void DeviceContextVkImpl::ExecuteSecondaryCommandLists(Uint32               NumCommandLists,
+                                                       ICommandList* const* ppCommandLists)
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Only immediate context can execute secondary command lists");
+    DEV_CHECK_ERR(m_pActiveRenderPass != nullptr && m_vkSubpassContents == VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS,
+                  "Secondary command lists must be executed inside a render pass begun by IDeviceContextVk::BeginSecondaryRenderPass()");
+
+    if (NumCommandLists == 0)
+        return;
+    DEV_CHECK_ERR(ppCommandLists != nullptr, "ppCommandLists must not be null when NumCommandLists is not zero");
+
+    // The array keeps its capacity between calls
+    auto& vkCmdBuffs = m_vkSecondaryCmdBuffs;
+    vkCmdBuffs.resize(NumCommandLists);
+    for (Uint32 i = 0; i < NumCommandLists; ++i)
+    {
+        auto* pCmdListVk = ClassPtrCast<CommandListVkImpl>(ppCommandLists[i]);
+        DEV_CHECK_ERR(pCmdListVk != nullptr, "Command list must not be null");
+        DEV_CHECK_ERR(pCmdListVk->IsSecondary(), "Command list was not recorded by IDeviceContextVk::BeginSecondaryCommandList()");
+        DEV_CHECK_ERR(pCmdListVk->GetSubpassIndex() == m_SubpassIndex,
+                      "Command list was recorded for subpass ", pCmdListVk->GetSubpassIndex(), ", but executed in subpass ", m_SubpassIndex, ".");
+        DEV_CHECK_ERR(pCmdListVk->GetQueueId() == GetDesc().QueueId, "Command list recorded for QueueId ", pCmdListVk->GetQueueId(), ", but executed on QueueId ", GetDesc().QueueId, ".");
+
+        RefCntAutoPtr<IDeviceContext> pDeferredCtx;
+        pCmdListVk->Close(pDeferredCtx, vkCmdBuffs[i]);
+        VERIFY(vkCmdBuffs[i] != VK_NULL_HANDLE, "Trying to execute empty command buffer");
+        VERIFY_EXPR(pDeferredCtx != nullptr);
+        // The command buffer can only be recycled after the primary command buffer has been submitted
+        m_ExecutedSecondaryCmdBuffers.emplace_back(std::move(pDeferredCtx), vkCmdBuffs[i]);
+    }
+
+    EnsureVkCmdBuffer();
+    m_CommandBuffer.ExecuteCommands(NumCommandLists, vkCmdBuffs.data());
+    ++m_State.NumCommands;
+
+    // The state of the primary command buffer is undefined after vkCmdExecuteCommands,
+    // so all bindings must be committed again.
+    m_pPipelineState             = nullptr;
+    m_BindInfo                   = {};
+    m_State.CommittedVBsUpToDate = false;
+    m_State.CommittedIBUpToDate  = false;
+    m_State.ShadingRateIsSet     = false;
+    m_State.vkPipelineBindPoint  = VK_PIPELINE_BIND_POINT_MAX_ENUM;
 }
 
 void DeviceContextVkImpl::UpdateBufferRegion(BufferVkImpl*                  pBuffVk,
@@ -2702,11 +2965,26 @@ void DeviceContextVkImpl::UnmapTextureSubresource(ITexture* pTexture,
 void DeviceContextVkImpl::FinishCommandList(ICommandList** ppCommandList)
 {
     DEV_CHECK_ERR(IsDeferred(), "Only deferred context can record command list");
-    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Finishing command list inside an active render pass.");
 
-    if (m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE)
+    const bool   IsSecondary  = m_IsRecordingSecondary;
+    const Uint32 SubpassIndex = m_SubpassIndex;
+    if (IsSecondary)
     {
-        m_CommandBuffer.EndRenderPass();
+        // The render pass is ended by the immediate context that executes the command list
+        VERIFY_EXPR(m_pActiveRenderPass != nullptr);
+        m_pActiveRenderPass.Release();
+        m_pBoundFramebuffer.Release();
+        m_SubpassIndex         = 0;
+        m_IsRecordingSecondary = false;
+    }
+    else
+    {
+        DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Finishing command list inside an active render pass.");
+
+        if (m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE)
+        {
+            m_CommandBuffer.EndRenderPass();
+        }
     }
 
     auto vkCmdBuff = m_CommandBuffer.GetVkCmdBuffer();
@@ -2714,7 +2992,7 @@ void DeviceContextVkImpl::FinishCommandList(ICommandList** ppCommandList)
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to end command buffer");
     (void)err;
 
-    CommandListVkImpl* pCmdListVk{NEW_RC_OBJ(m_CmdListAllocator, "CommandListVkImpl instance", CommandListVkImpl)(m_pDevice, this, vkCmdBuff)};
+    CommandListVkImpl* pCmdListVk{NEW_RC_OBJ(m_CmdListAllocator, "CommandListVkImpl instance", CommandListVkImpl)(m_pDevice, this, vkCmdBuff, IsSecondary, SubpassIndex)};
     pCmdListVk->QueryInterface(IID_CommandList, reinterpret_cast<IObject**>(ppCommandList));
 
     m_CommandBuffer.Reset();
@@ -2753,6 +3031,28 @@ void DeviceContextVkImpl::DeviceWaitForFence(IFence* pFence, Uint64 Value)
     m_WaitFences.emplace_back(std::make_pair(Value, ClassPtrCast<FenceVkImpl>(pFence)));
 }
 
+void DeviceContextVkImpl::DeviceWaitForQueue(Uint32 ImmediateContextId, Uint64 FenceValue)
+{
+    DEV_CHECK_ERR(!IsDeferred(), "DeviceWaitForQueue() is only allowed for immediate contexts");
+    DEV_CHECK_ERR(m_pDevice->GetFeatures().NativeFence, "DeviceWaitForQueue() requires NativeFence feature");
+    DEV_CHECK_ERR(ImmediateContextId < m_pDevice->GetCommandQueueCount(), "Immediate context id (", ImmediateContextId,
+                  ") is out of range. The number of immediate contexts is ", m_pDevice->GetCommandQueueCount(), '.');
+    DEV_CHECK_ERR(ImmediateContextId != GetCommandQueueId(),
+                  "Commands submitted to the same queue are always executed in order, waiting for the context's own queue is not allowed");
+
+    const SoftwareQueueIndex QueueId{ImmediateContextId};
+    for (auto& val_queue : m_WaitQueues)
+    {
+        if (val_queue.second == QueueId)
+        {
+            // A batch can't wait for the same semaphore twice, and waiting for the largest value is sufficient
+            val_queue.first = std::max(val_queue.first, FenceValue);
+            return;
+        }
+    }
+    m_WaitQueues.emplace_back(FenceValue, QueueId);
+}
+
 void DeviceContextVkImpl::WaitForIdle()
 {
     DEV_CHECK_ERR(!IsDeferred(), "Only immediate contexts can be idled");
@@ -2763,6 +3063,7 @@ void DeviceContextVkImpl::WaitForIdle()
 void DeviceContextVkImpl::BeginQuery(IQuery* pQuery)
 {
     TDeviceContextBase::BeginQuery(pQuery, 0);
+    DEV_CHECK_ERR(IsInlineSubpass(), "BeginQuery() can't be called in a render pass begun by IDeviceContextVk::BeginSecondaryRenderPass()");
 
     VERIFY(m_pQueryMgr != nullptr || IsDeferred(), "Query manager should never be null for immediate contexts. This might be a bug.");
     DEV_CHECK_ERR(m_pQueryMgr != nullptr, "Query manager is null, which indicates that this deferred context is not in a recording state");
@@ -2811,6 +3112,7 @@ void DeviceContextVkImpl::BeginQuery(IQuery* pQuery)
 void DeviceContextVkImpl::EndQuery(IQuery* pQuery)
 {
     TDeviceContextBase::EndQuery(pQuery, 0);
+    DEV_CHECK_ERR(IsInlineSubpass(), "EndQuery() can't be called in a render pass begun by IDeviceContextVk::BeginSecondaryRenderPass()");
 
     VERIFY(m_pQueryMgr != nullptr || IsDeferred(), "Query manager should never be null for immediate contexts. This might be a bug.");
     DEV_CHECK_ERR(m_pQueryMgr != nullptr, "Query manager is null, which indicates that this deferred context is not in a recording state");
@@ -3848,6 +4150,7 @@ void DeviceContextVkImpl::UpdateSBT(IShaderBindingTable* pSBT, const UpdateIndir
 void DeviceContextVkImpl::BeginDebugGroup(const Char* Name, const float* pColor)
 {
     TDeviceContextBase::BeginDebugGroup(Name, pColor, 0);
+    DEV_CHECK_ERR(IsInlineSubpass(), "BeginDebugGroup() can't be called in a render pass begun by IDeviceContextVk::BeginSecondaryRenderPass()");
 
     VkDebugUtilsLabelEXT Info{};
     Info.sType      = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
@@ -3858,19 +4161,32 @@ void DeviceContextVkImpl::BeginDebugGroup(const Char* Name, const float* pColor)
 
     EnsureVkCmdBuffer();
     m_CommandBuffer.BeginDebugUtilsLabel(Info);
+
+    if (m_pProfiler)
+        m_pProfiler->BeginScope(m_CommandBuffer, Name);
 }
 
 void DeviceContextVkImpl::EndDebugGroup()
 {
     TDeviceContextBase::EndDebugGroup(0);
+    DEV_CHECK_ERR(IsInlineSubpass(), "EndDebugGroup() can't be called in a render pass begun by IDeviceContextVk::BeginSecondaryRenderPass()");
 
     EnsureVkCmdBuffer();
+    if (m_pProfiler)
+        m_pProfiler->EndScope(m_CommandBuffer);
+
     m_CommandBuffer.EndDebugUtilsLabel();
 }
 
+GPUProfilerFrameVk DeviceContextVkImpl::GetProfilerFrame() const
+{
+    return m_pProfiler ? m_pProfiler->GetLastFrame() : GPUProfilerFrameVk{};
+}
+
 void DeviceContextVkImpl::InsertDebugLabel(const Char* Label, const float* pColor)
 {
     TDeviceContextBase::InsertDebugLabel(Label, pColor, 0);
+    DEV_CHECK_ERR(IsInlineSubpass(), "InsertDebugLabel() can't be called in a render pass begun by IDeviceContextVk::BeginSecondaryRenderPass()");
 
     VkDebugUtilsLabelEXT Info{};
     Info.sType      = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
@@ -3886,6 +4202,7 @@ void DeviceContextVkImpl::InsertDebugLabel(const Char* Label, const float* pColo
 void DeviceContextVkImpl::SetShadingRate(SHADING_RATE BaseRate, SHADING_RATE_COMBINER PrimitiveCombiner, SHADING_RATE_COMBINER TextureCombiner)
 {
     TDeviceContextBase::SetShadingRate(BaseRate, PrimitiveCombiner, TextureCombiner, 0);
+    DEV_CHECK_ERR(IsInlineSubpass(), "SetShadingRate() can't be called in a render pass begun by IDeviceContextVk::BeginSecondaryRenderPass()");
 
     const auto& ExtFeatures = m_pDevice->GetLogicalDevice().GetEnabledExtFeatures();
     if (ExtFeatures.ShadingRate.attachmentFragmentShadingRate != VK_FALSE)
@@ -99,6 +99,15 @@ DeviceMemoryVkImpl::DeviceMemoryVkImpl(IReferenceCounters*           pRefCounter
     MemAlloc.allocationSize  = m_Desc.PageSize;
     MemAlloc.memoryTypeIndex = m_MemoryTypeIndex;
 
+    // Sparse buffers bound to this memory must be addressable when descriptor buffers are used
+    VkMemoryAllocateFlagsInfo FlagsInfo{};
+    if (m_pDevice->UseDescriptorBuffers())
+    {
+        FlagsInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+        FlagsInfo.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+        MemAlloc.pNext  = &FlagsInfo;
+    }
+
     const auto PageCount = StaticCast<size_t>(MemCI.InitialSize / m_Desc.PageSize);
     m_Pages.reserve(PageCount);
 
@@ -126,6 +135,15 @@ Bool DeviceMemoryVkImpl::Resize(Uint64 NewSize)
     MemAlloc.allocationSize  = m_Desc.PageSize;
     MemAlloc.memoryTypeIndex = m_MemoryTypeIndex;
 
+    // Sparse buffers bound to this memory must be addressable when descriptor buffers are used
+    VkMemoryAllocateFlagsInfo FlagsInfo{};
+    if (m_pDevice->UseDescriptorBuffers())
+    {
+        FlagsInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+        FlagsInfo.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+        MemAlloc.pNext  = &FlagsInfo;
+    }
+
     m_Pages.reserve(NewPageCount);
 
     while (m_Pages.size() < NewPageCount)
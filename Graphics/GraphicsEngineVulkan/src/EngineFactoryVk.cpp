@@ -1144,6 +1144,101 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
                 }
             }
 
+            if (DeviceExtFeatures.DedicatedAllocation)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_GET_MEMORY_REQUIREMENTS_2_EXTENSION_NAME));
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_GET_MEMORY_REQUIREMENTS_2_EXTENSION_NAME); // Required for VK_KHR_dedicated_allocation
+                DeviceExtensions.push_back(VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME);      // Allows large resources to have their own memory objects
+                EnabledExtFeats.DedicatedAllocation = true;
+            }
+
+            if (DeviceExtFeatures.MemoryBudget)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME); // Allows querying the heap budget and usage
+                EnabledExtFeats.MemoryBudget = true;
+            }
+
+            if (DeviceExtFeatures.DescrUpdateTemplate)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME); // Allows updating descriptor sets from packed data with a single call
+                EnabledExtFeats.DescrUpdateTemplate = true;
+            }
+
+            if (EngineCI.EnableDescriptorBuffers)
+            {
+                const auto& DescrBufferProps = PhysicalDevice->GetExtProperties().DescriptorBuffer;
+                // All descriptors are written into the dynamic heap buffer, so it must be fully addressable
+                // as both resource and sampler descriptor buffer.
+                // clang-format off
+                const VkDeviceSize MaxDescrBufferRange = std::min({DescrBufferProps.maxResourceDescriptorBufferRange,
+                                                                   DescrBufferProps.maxSamplerDescriptorBufferRange,
+                                                                   DescrBufferProps.resourceDescriptorBufferAddressSpaceSize,
+                                                                   DescrBufferProps.samplerDescriptorBufferAddressSpaceSize,
+                                                                   DescrBufferProps.descriptorBufferAddressSpaceSize});
+                // clang-format on
+
+                const bool DescrIndexingSupported =
+                    PhysicalDevice->IsExtensionSupported(VK_KHR_MAINTENANCE3_EXTENSION_NAME) &&
+                    PhysicalDevice->IsExtensionSupported(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME);
+
+                if (DeviceExtFeatures.DescriptorBuffer.descriptorBuffer == VK_FALSE)
+                {
+                    LOG_INFO_MESSAGE("Descriptor buffers are not supported by the device. Descriptor pools will be used instead.");
+                }
+                else if (DeviceExtFeatures.BufferDeviceAddress.bufferDeviceAddress == VK_FALSE ||
+                         !PhysicalDevice->IsExtensionSupported(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME) ||
+                         !PhysicalDevice->IsExtensionSupported(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME) ||
+                         !DescrIndexingSupported)
+                {
+                    LOG_INFO_MESSAGE("Descriptor buffers require buffer device address, synchronization2 and descriptor indexing extensions "
+                                     "that are not supported by the device. Descriptor pools will be used instead.");
+                }
+                else if (EngineCI.DynamicHeapSize > MaxDescrBufferRange)
+                {
+                    LOG_WARNING_MESSAGE("Dynamic heap size (", EngineCI.DynamicHeapSize, ") exceeds the maximum descriptor buffer range (",
+                                        MaxDescrBufferRange, "). Descriptor pools will be used instead.");
+                }
+                else
+                {
+                    auto AddExtension = [&DeviceExtensions](const char* ExtName) {
+                        for (const auto* Name : DeviceExtensions)
+                        {
+                            if (std::strcmp(Name, ExtName) == 0)
+                                return false;
+                        }
+                        DeviceExtensions.push_back(ExtName);
+                        return true;
+                    };
+                    AddExtension(VK_KHR_MAINTENANCE3_EXTENSION_NAME);        // required for VK_EXT_descriptor_indexing
+                    AddExtension(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME); // required for VK_EXT_descriptor_buffer
+                    AddExtension(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);   // required for VK_EXT_descriptor_buffer
+                    DeviceExtensions.push_back(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+
+                    // Buffer device address feature may have already been enabled for ray tracing
+                    if (AddExtension(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME))
+                    {
+                        EnabledExtFeats.BufferDeviceAddress = DeviceExtFeatures.BufferDeviceAddress;
+
+                        *NextExt = &EnabledExtFeats.BufferDeviceAddress;
+                        NextExt  = &EnabledExtFeats.BufferDeviceAddress.pNext;
+                    }
+                    VERIFY_EXPR(EnabledExtFeats.BufferDeviceAddress.bufferDeviceAddress != VK_FALSE);
+
+                    EnabledExtFeats.DescriptorBuffer = DeviceExtFeatures.DescriptorBuffer;
+
+                    // disable unused features
+                    EnabledExtFeats.DescriptorBuffer.descriptorBufferCaptureReplay      = VK_FALSE;
+                    EnabledExtFeats.DescriptorBuffer.descriptorBufferImageLayoutIgnored = VK_FALSE;
+                    EnabledExtFeats.DescriptorBuffer.descriptorBufferPushDescriptors    = VK_FALSE;
+
+                    *NextExt = &EnabledExtFeats.DescriptorBuffer;
+                    NextExt  = &EnabledExtFeats.DescriptorBuffer.pNext;
+                }
+            }
+
             if (EnabledFeatures.NativeMultiDraw != DEVICE_FEATURE_STATE_DISABLED)
             {
                 VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_MULTI_DRAW_EXTENSION_NAME));
@@ -0,0 +1,313 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "GPUProfilerVk.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "RenderDeviceVkImpl.hpp"
+#include "QueryManagerVk.hpp"
+#include "Align.hpp"
+
+namespace Diligent
+{
+
+GPUProfilerVk::GPUProfilerVk(RenderDeviceVkImpl* pDeviceVk,
+                             QueryManagerVk&     QueryMgr,
+                             Uint32              MaxScopesPerFrame) :
+    // clang-format off
+    m_pDevice          {pDeviceVk},
+    m_QueryMgr         {QueryMgr},
+    m_vkQueryPool      {QueryMgr.GetQueryPool(QUERY_TYPE_TIMESTAMP)},
+    m_MaxScopesPerFrame{MaxScopesPerFrame},
+    m_QueriesPerFrame  {MaxScopesPerFrame * 2},
+    m_TimestampPeriod  {1.0 / static_cast<double>(QueryMgr.GetCounterFrequency())}
+// clang-format on
+{
+    VERIFY_EXPR(m_vkQueryPool != VK_NULL_HANDLE && m_MaxScopesPerFrame > 0);
+
+    const auto& LogicalDevice = m_pDevice->GetLogicalDevice();
+
+    VkBufferCreateInfo ReadbackBuffCI{};
+    ReadbackBuffCI.sType       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    ReadbackBuffCI.size        = sizeof(Uint64) * m_QueriesPerFrame * MaxFramesInFlight;
+    ReadbackBuffCI.usage       = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    ReadbackBuffCI.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    m_ReadbackBuffer           = LogicalDevice.CreateBuffer(ReadbackBuffCI, "GPU profiler readback buffer");
+
+    VkMemoryRequirements MemReqs = LogicalDevice.GetBufferMemoryRequirements(m_ReadbackBuffer);
+    VERIFY(IsPowerOfTwo(MemReqs.alignment), "Alignment is not power of 2!");
+
+    // Host-coherent memory does not require vkInvalidateMappedMemoryRanges to make device writes visible to the host (10.2)
+    m_ReadbackMemory = m_pDevice->AllocateMemory(MemReqs, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    if (!m_ReadbackMemory)
+        LOG_ERROR_AND_THROW("Failed to allocate memory for the GPU profiler readback buffer.");
+
+    const auto AlignedOffset = AlignUp(VkDeviceSize{m_ReadbackMemory.UnalignedOffset}, MemReqs.alignment);
+    VERIFY_EXPR(m_ReadbackMemory.Size >= MemReqs.size + (AlignedOffset - m_ReadbackMemory.UnalignedOffset));
+
+    auto err = LogicalDevice.BindBufferMemory(m_ReadbackBuffer, m_ReadbackMemory.Page->GetVkMemory(), AlignedOffset);
+    CHECK_VK_ERROR_AND_THROW(err, "Failed to bind GPU profiler readback buffer memory");
+
+    const auto* pCPUMemory = reinterpret_cast<const Uint8*>(m_ReadbackMemory.Page->GetCPUMemory());
+    if (pCPUMemory == nullptr)
+        LOG_ERROR_AND_THROW("GPU profiler readback buffer memory is not mapped.");
+    m_pReadbackData = reinterpret_cast<const Uint64*>(pCPUMemory + AlignedOffset);
+
+    for (auto& Frame : m_Frames)
+        Frame.Scopes.reserve(m_MaxScopesPerFrame);
+
+    // Start the first frame in slot 0
+    m_CurrSlot = MaxFramesInFlight - 1;
+    BeginFrame();
+}
+
+GPUProfilerVk::~GPUProfilerVk()
+{
+    for (auto& Frame : m_Frames)
+    {
+        if (Frame.IsInUse && Frame.FirstQuery != InvalidIndex)
+            m_QueryMgr.DiscardQueryRange(QUERY_TYPE_TIMESTAMP, Frame.FirstQuery, m_QueriesPerFrame);
+    }
+
+    const Uint64 QueueMask = Uint64{1} << Uint64{m_QueryMgr.GetCommandQueueId()};
+    m_pDevice->SafeReleaseDeviceObject(std::move(m_ReadbackBuffer), QueueMask);
+    m_pDevice->SafeReleaseDeviceObject(std::move(m_ReadbackMemory), QueueMask);
+}
+
+void GPUProfilerVk::BeginFrame()
+{
+    const Uint32 NextSlot = (m_CurrSlot + 1) % MaxFramesInFlight;
+
+    auto& Frame = m_Frames[NextSlot];
+    if (Frame.IsInUse)
+    {
+        // The GPU is too far behind - do not profile this frame.
+        m_pCurrFrame = nullptr;
+        return;
+    }
+
+    Frame.IsInUse     = true;
+    Frame.FrameNumber = m_FrameNumber;
+    // If the range can't be allocated, the frame is reported with all scopes dropped.
+    Frame.FirstQuery = m_QueryMgr.AllocateQueryRange(QUERY_TYPE_TIMESTAMP, m_QueriesPerFrame);
+
+    m_CurrSlot   = NextSlot;
+    m_pCurrFrame = &Frame;
+}
+
+void GPUProfilerVk::BeginScope(VulkanUtilities::VulkanCommandBuffer& CmdBuffer, const Char* Name)
+{
+    Uint32 ScopeIdx = InvalidIndex;
+    if (m_pCurrFrame != nullptr)
+    {
+        auto& Frame = *m_pCurrFrame;
+        if (Frame.FirstQuery != InvalidIndex && Frame.Scopes.size() < m_MaxScopesPerFrame)
+        {
+            ScopeIdx = static_cast<Uint32>(Frame.Scopes.size());
+
+            ScopeData Scope;
+            Scope.NameOffset  = static_cast<Uint32>(Frame.Names.size());
+            Scope.ParentIndex = !m_OpenScopes.empty() ? m_OpenScopes.back() : InvalidIndex;
+            Scope.Depth       = Scope.ParentIndex != InvalidIndex ? Frame.Scopes[Scope.ParentIndex].Depth + 1 : 0;
+            Scope.BeginQuery  = Frame.NumWrittenQueries++;
+            Frame.Scopes.push_back(Scope);
+
+            // Names are packed into a single array to avoid per-scope allocations
+            Frame.Names.insert(Frame.Names.end(), Name, Name + strlen(Name) + 1);
+
+            CmdBuffer.WriteTimestamp(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_vkQueryPool, Frame.FirstQuery + Scope.BeginQuery);
+        }
+        else
+        {
+            ++Frame.NumDroppedScopes;
+        }
+    }
+    m_OpenScopes.push_back(ScopeIdx);
+}
+
+void GPUProfilerVk::EndScope(VulkanUtilities::VulkanCommandBuffer& CmdBuffer)
+{
+    if (m_OpenScopes.empty())
+    {
+        // The scope was begun in one of the previous frames
+        if (m_NumOrphanedScopes > 0)
+            --m_NumOrphanedScopes;
+        return;
+    }
+
+    const Uint32 ScopeIdx = m_OpenScopes.back();
+    m_OpenScopes.pop_back();
+    if (ScopeIdx == InvalidIndex)
+        return;
+
+    VERIFY_EXPR(m_pCurrFrame != nullptr && ScopeIdx < m_pCurrFrame->Scopes.size());
+    auto& Frame = *m_pCurrFrame;
+    auto& Scope = Frame.Scopes[ScopeIdx];
+    // Every recorded scope reserves two queries, so the frame range can't be exhausted here.
+    VERIFY_EXPR(Frame.NumWrittenQueries < m_QueriesPerFrame);
+    Scope.EndQuery = Frame.NumWrittenQueries++;
+
+    CmdBuffer.WriteTimestamp(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_vkQueryPool, Frame.FirstQuery + Scope.EndQuery);
+}
+
+Uint32 GPUProfilerVk::ResolveQueries(VulkanUtilities::VulkanCommandBuffer& CmdBuffer)
+{
+    Uint32 NumCommands = 0;
+    for (Uint32 Slot = 0; Slot < MaxFramesInFlight; ++Slot)
+    {
+        auto& Frame = m_Frames[Slot];
+        if (Frame.NumResolvedQueries == Frame.NumWrittenQueries)
+            continue;
+
+        // Queries are used in the order they are written, so all queries written since
+        // the last resolve form a contiguous range.
+        VERIFY_EXPR(Frame.IsInUse && Frame.FirstQuery != InvalidIndex);
+        const Uint32 QueryCount = Frame.NumWrittenQueries - Frame.NumResolvedQueries;
+        const auto   DstOffset  = sizeof(Uint64) * (size_t{Slot} * m_QueriesPerFrame + Frame.NumResolvedQueries);
+        CmdBuffer.CopyQueryPoolResults(m_vkQueryPool, Frame.FirstQuery + Frame.NumResolvedQueries, QueryCount,
+                                       m_ReadbackBuffer, DstOffset, sizeof(Uint64),
+                                       VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT);
+        Frame.NumResolvedQueries = Frame.NumWrittenQueries;
+        Frame.IsQueued           = true;
+        ++NumCommands;
+    }
+
+    if (NumCommands > 0)
+    {
+        // Make query results visible to the host after the command buffer is complete
+        CmdBuffer.MemoryBarrier(VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_HOST_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT);
+    }
+
+    return NumCommands;
+}
+
+void GPUProfilerVk::OnCommandBufferSubmitted(Uint64 FenceValue)
+{
+    for (auto& Frame : m_Frames)
+    {
+        if (Frame.IsQueued)
+        {
+            Frame.ResolveFenceValue = FenceValue;
+            Frame.IsQueued          = false;
+        }
+    }
+}
+
+bool GPUProfilerVk::IsReadyForReadback(const FrameData& Frame, Uint64 CompletedFenceValue) const
+{
+    return (Frame.IsInUse &&
+            Frame.IsEnded &&
+            !Frame.IsQueued &&
+            Frame.NumResolvedQueries == Frame.NumWrittenQueries &&
+            Frame.ResolveFenceValue <= CompletedFenceValue);
+}
+
+void GPUProfilerVk::ReadBack(FrameData& Frame, Uint32 Slot)
+{
+    const Uint64* pTimestamps = m_pReadbackData + size_t{Slot} * m_QueriesPerFrame;
+
+    m_LastNames.swap(Frame.Names);
+    m_LastScopes.resize(Frame.Scopes.size());
+
+    const Uint64 FrameStart = !Frame.Scopes.empty() ? pTimestamps[Frame.Scopes[0].BeginQuery] : 0;
+    Uint64       FrameEnd   = FrameStart;
+    for (size_t i = 0; i < Frame.Scopes.size(); ++i)
+    {
+        const auto& Src = Frame.Scopes[i];
+        auto&       Dst = m_LastScopes[i];
+
+        const Uint64 Begin = pTimestamps[Src.BeginQuery];
+        const Uint64 End   = Src.EndQuery != InvalidIndex ? pTimestamps[Src.EndQuery] : Begin;
+
+        Dst.Name        = &m_LastNames[Src.NameOffset];
+        Dst.ParentIndex = Src.ParentIndex;
+        Dst.Depth       = Src.Depth;
+        Dst.StartTime   = Begin > FrameStart ? static_cast<double>(Begin - FrameStart) * m_TimestampPeriod : 0;
+        Dst.Duration    = End > Begin ? static_cast<double>(End - Begin) * m_TimestampPeriod : 0;
+
+        FrameEnd = std::max(FrameEnd, End);
+    }
+    m_LastTotalTime         = static_cast<double>(FrameEnd - FrameStart) * m_TimestampPeriod;
+    m_LastFrameNumber       = Frame.FrameNumber;
+    m_LastDroppedScopeCount = Frame.NumDroppedScopes;
+
+    // Stale queries are reset by the query manager when the next command buffer is submitted
+    if (Frame.FirstQuery != InvalidIndex)
+        m_QueryMgr.DiscardQueryRange(QUERY_TYPE_TIMESTAMP, Frame.FirstQuery, m_QueriesPerFrame);
+
+    // Keep the memory of the scope and name arrays
+    Frame.Scopes.clear();
+    Frame.Names.clear();
+    Frame.FirstQuery         = InvalidIndex;
+    Frame.NumWrittenQueries  = 0;
+    Frame.NumResolvedQueries = 0;
+    Frame.NumDroppedScopes   = 0;
+    Frame.ResolveFenceValue  = 0;
+    Frame.IsInUse            = false;
+    Frame.IsEnded            = false;
+}
+
+void GPUProfilerVk::EndFrame(Uint64 CompletedFenceValue)
+{
+    if (m_pCurrFrame != nullptr)
+        m_pCurrFrame->IsEnded = true;
+
+    // Scopes that are still open are not measured and will be ended in one of the next frames
+    m_NumOrphanedScopes += m_OpenScopes.size();
+    m_OpenScopes.clear();
+    ++m_FrameNumber;
+
+    // Read back completed frames from the oldest to the newest
+    for (Uint32 i = 1; i <= MaxFramesInFlight; ++i)
+    {
+        const Uint32 Slot  = (m_CurrSlot + i) % MaxFramesInFlight;
+        auto&        Frame = m_Frames[Slot];
+        if (!Frame.IsInUse)
+            continue;
+        if (!IsReadyForReadback(Frame, CompletedFenceValue))
+            break;
+        ReadBack(Frame, Slot);
+    }
+
+    BeginFrame();
+}
+
+GPUProfilerFrameVk GPUProfilerVk::GetLastFrame() const
+{
+    GPUProfilerFrameVk Frame;
+    Frame.FrameNumber       = m_LastFrameNumber;
+    Frame.ScopeCount        = static_cast<Uint32>(m_LastScopes.size());
+    Frame.DroppedScopeCount = m_LastDroppedScopeCount;
+    Frame.pScopes           = !m_LastScopes.empty() ? m_LastScopes.data() : nullptr;
+    Frame.TotalTime         = m_LastTotalTime;
+    return Frame;
+}
+
+} // namespace Diligent
@@ -0,0 +1,253 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "PipelineCacheManagerVk.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <iomanip>
+
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Builds the cache file path from the device identity, so that caches produced by different
+// devices or driver versions are kept in separate files and are never fed to the wrong driver.
+std::string GetPipelineCacheFilePath(const char* CacheDirectory, const VkPhysicalDeviceProperties& Props)
+{
+    std::string Path{CacheDirectory};
+    if (!Path.empty() && !FileSystem::IsSlash(Path.back()))
+        Path.push_back(FileSystem::SlashSymbol);
+
+    char Buffer[64];
+    std::snprintf(Buffer, sizeof(Buffer), "VkPipelineCache_%04x_%04x_%08x_", Props.vendorID, Props.deviceID, Props.driverVersion);
+    Path += Buffer;
+    for (auto Byte : Props.pipelineCacheUUID)
+    {
+        std::snprintf(Buffer, sizeof(Buffer), "%02x", static_cast<Uint32>(Byte));
+        Path += Buffer;
+    }
+    Path += ".bin";
+
+    return Path;
+}
+
+bool IsCompatibleCacheData(const std::vector<Uint8>& Data, const VkPhysicalDeviceProperties& Props)
+{
+    if (Data.size() <= sizeof(VkPipelineCacheHeaderVersionOne))
+        return false;
+
+    VkPipelineCacheHeaderVersionOne Header;
+    std::memcpy(&Header, Data.data(), sizeof(Header));
+
+    return (Header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+            Header.headerSize == 32 && // from specs
+            Header.vendorID == Props.vendorID &&
+            Header.deviceID == Props.deviceID &&
+            std::memcmp(Header.pipelineCacheUUID, Props.pipelineCacheUUID, sizeof(Header.pipelineCacheUUID)) == 0);
+}
+
+} // namespace
+
+PipelineCacheManagerVk::PipelineCacheManagerVk(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice,
+                                               const VkPhysicalDeviceProperties&           DeviceProps,
+                                               const char*                                 CacheDirectory) :
+    m_LogicalDevice{LogicalDevice},
+    m_FilePath{GetPipelineCacheFilePath(CacheDirectory, DeviceProps)}
+{
+    m_Stats.Enabled = True;
+
+    if (FileSystem::FileExists(m_FilePath.c_str()) && FileWrapper::ReadWholeFile(m_FilePath.c_str(), m_InitialData))
+    {
+        if (IsCompatibleCacheData(m_InitialData, DeviceProps))
+        {
+            m_Stats.IsWarm         = True;
+            m_Stats.LoadedDataSize = m_InitialData.size();
+            LOG_INFO_MESSAGE("Loaded Vulkan pipeline cache (", m_InitialData.size(), " bytes) from '", m_FilePath, "'");
+        }
+        else
+        {
+            LOG_WARNING_MESSAGE("Vulkan pipeline cache file '", m_FilePath, "' is corrupted or incompatible with the device and will be overwritten");
+            m_InitialData.clear();
+        }
+    }
+
+    m_MergedCache = CreateCache("Device pipeline cache");
+}
+
+PipelineCacheManagerVk::~PipelineCacheManagerVk()
+{
+    const auto Stats = GetStats();
+    if (Stats.PipelineCount > 0)
+    {
+        Save();
+
+        LOG_INFO_MESSAGE("Vulkan pipeline cache (", (Stats.IsWarm ? "warm" : "cold"), "): ", Stats.PipelineCount, " pipelines created in ",
+                         std::fixed, std::setprecision(1), Stats.TotalCreationTime * 1000.0, " ms (average: ",
+                         std::setprecision(2), Stats.TotalCreationTime * 1000.0 / Stats.PipelineCount, " ms, max: ",
+                         Stats.MaxCreationTime * 1000.0, " ms)");
+    }
+}
+
+VulkanUtilities::PipelineCacheWrapper PipelineCacheManagerVk::CreateCache(const char* DebugName) const
+{
+    VkPipelineCacheCreateInfo PipelineCacheCI{};
+    PipelineCacheCI.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    if (!m_InitialData.empty())
+    {
+        PipelineCacheCI.initialDataSize = m_InitialData.size();
+        PipelineCacheCI.pInitialData    = m_InitialData.data();
+    }
+    return m_LogicalDevice.CreatePipelineCache(PipelineCacheCI, DebugName);
+}
+
+PipelineCacheManagerVk::ScopedCache PipelineCacheManagerVk::Acquire()
+{
+    {
+        std::lock_guard<std::mutex> Lock{m_PoolMtx};
+        if (!m_AvailableCaches.empty())
+        {
+            const auto vkCache = m_AvailableCaches.back();
+            m_AvailableCaches.pop_back();
+            return ScopedCache{this, vkCache};
+        }
+    }
+
+    // All caches are in use by other threads. Create a new one outside of the lock,
+    // since parsing the initial data may take a while.
+    auto                  Cache   = CreateCache("Thread pipeline cache");
+    const VkPipelineCache vkCache = Cache;
+    {
+        std::lock_guard<std::mutex> Lock{m_PoolMtx};
+        m_Caches.emplace_back(std::move(Cache));
+    }
+    return ScopedCache{this, vkCache};
+}
+
+void PipelineCacheManagerVk::Release(VkPipelineCache vkCache, double CreationTime)
+{
+    std::lock_guard<std::mutex> Lock{m_PoolMtx};
+    m_AvailableCaches.push_back(vkCache);
+
+    ++m_Stats.PipelineCount;
+    m_Stats.TotalCreationTime += CreationTime;
+    m_Stats.MaxCreationTime = std::max(m_Stats.MaxCreationTime, CreationTime);
+}
+
+PipelineCacheStatsVk PipelineCacheManagerVk::GetStats() const
+{
+    std::lock_guard<std::mutex> Lock{m_PoolMtx};
+    return m_Stats;
+}
+
+bool PipelineCacheManagerVk::Save()
+{
+    std::lock_guard<std::mutex> SaveLock{m_SaveMtx};
+
+    const auto vkDevice = m_LogicalDevice.GetVkDevice();
+
+    std::vector<VkPipelineCache> SrcCaches;
+    {
+        std::lock_guard<std::mutex> Lock{m_PoolMtx};
+        SrcCaches.reserve(m_Caches.size());
+        for (const auto& Cache : m_Caches)
+            SrcCaches.push_back(Cache);
+    }
+
+    // Source caches are internally synchronized, so they may be merged while
+    // other threads are creating pipelines with them.
+    if (!SrcCaches.empty())
+    {
+        if (vkMergePipelineCaches(vkDevice, m_MergedCache, static_cast<uint32_t>(SrcCaches.size()), SrcCaches.data()) != VK_SUCCESS)
+        {
+            LOG_ERROR_MESSAGE("Failed to merge Vulkan pipeline caches");
+            return false;
+        }
+    }
+
+    size_t DataSize = 0;
+    if (vkGetPipelineCacheData(vkDevice, m_MergedCache, &DataSize, nullptr) != VK_SUCCESS)
+    {
+        LOG_ERROR_MESSAGE("Failed to get the Vulkan pipeline cache data size");
+        return false;
+    }
+
+    std::vector<Uint8> Data(DataSize);
+    if (vkGetPipelineCacheData(vkDevice, m_MergedCache, &DataSize, Data.data()) != VK_SUCCESS)
+    {
+        LOG_ERROR_MESSAGE("Failed to get the Vulkan pipeline cache data");
+        return false;
+    }
+    Data.resize(DataSize);
+
+    // Write the data to a temporary file first and then rename it, so that the
+    // cache file is never left truncated if the process is terminated while saving.
+    const auto TmpFilePath = m_FilePath + ".tmp";
+    {
+        FileWrapper File{TmpFilePath.c_str(), EFileAccessMode::Overwrite};
+        if (!File)
+        {
+            LOG_ERROR_MESSAGE("Failed to open '", TmpFilePath, "' for writing");
+            return false;
+        }
+        if (!File->Write(Data.data(), Data.size()))
+        {
+            LOG_ERROR_MESSAGE("Failed to write Vulkan pipeline cache to '", TmpFilePath, "'");
+            File.Close();
+            std::remove(TmpFilePath.c_str());
+            return false;
+        }
+    }
+
+    if (std::rename(TmpFilePath.c_str(), m_FilePath.c_str()) != 0)
+    {
+        // On Windows, rename fails if the destination file exists
+        std::remove(m_FilePath.c_str());
+        if (std::rename(TmpFilePath.c_str(), m_FilePath.c_str()) != 0)
+        {
+            LOG_ERROR_MESSAGE("Failed to replace Vulkan pipeline cache file '", m_FilePath, "'");
+            std::remove(TmpFilePath.c_str());
+            return false;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock{m_PoolMtx};
+        m_Stats.SavedDataSize = Data.size();
+    }
+
+    return true;
+}
+
+} // namespace Diligent
@@ -101,16 +101,20 @@ void PipelineLayoutVk::Create(RenderDeviceVkImpl* pDeviceVk, RefCntAutoPtr<Pipel
                             ") used by the pipeline layout exceeds device limit (", Limits.maxBoundDescriptorSets, ")");
     }
 
-    if (DynamicUniformBufferCount > Limits.maxDescriptorSetUniformBuffersDynamic)
+    // Descriptor buffers do not use dynamic buffer descriptors
+    if (!pDeviceVk->UseDescriptorBuffers())
     {
-        LOG_ERROR_AND_THROW("The number of dynamic uniform buffers  (", DynamicUniformBufferCount,
-                            ") used by the pipeline layout exceeds device limit (", Limits.maxDescriptorSetUniformBuffersDynamic, ")");
-    }
+        if (DynamicUniformBufferCount > Limits.maxDescriptorSetUniformBuffersDynamic)
+        {
+            LOG_ERROR_AND_THROW("The number of dynamic uniform buffers  (", DynamicUniformBufferCount,
+                                ") used by the pipeline layout exceeds device limit (", Limits.maxDescriptorSetUniformBuffersDynamic, ")");
+        }
 
-    if (DynamicStorageBufferCount > Limits.maxDescriptorSetStorageBuffersDynamic)
-    {
-        LOG_ERROR_AND_THROW("The number of dynamic storage buffers (", DynamicStorageBufferCount,
-                            ") used by the pipeline layout exceeds device limit (", Limits.maxDescriptorSetStorageBuffersDynamic, ")");
+        if (DynamicStorageBufferCount > Limits.maxDescriptorSetStorageBuffersDynamic)
+        {
+            LOG_ERROR_AND_THROW("The number of dynamic storage buffers (", DynamicStorageBufferCount,
+                                ") used by the pipeline layout exceeds device limit (", Limits.maxDescriptorSetStorageBuffersDynamic, ")");
+        }
     }
 
     VERIFY(m_DescrSetCount <= std::numeric_limits<decltype(m_DescrSetCount)>::max(),
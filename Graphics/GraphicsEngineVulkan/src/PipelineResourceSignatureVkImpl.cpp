@@ -32,6 +32,8 @@
 #include "RenderDeviceVkImpl.hpp"
 #include "SamplerVkImpl.hpp"
 #include "TextureViewVkImpl.hpp"
+#include "BufferViewVkImpl.hpp"
+#include "TopLevelASVkImpl.hpp"
 
 #include "VulkanTypeConversions.hpp"
 #include "DynamicLinearAllocator.hpp"
@@ -111,6 +113,167 @@ Uint32 FindImmutableSamplerVk(const PipelineResourceDesc&          Res,
     return FindImmutableSampler(Desc.ImmutableSamplers, Desc.NumImmutableSamplers, Res.ShaderStages, Res.Name, SamplerSuffix);
 }
 
+// Descriptor buffers do not support dynamic uniform and storage buffers.
+// Dynamic offsets are instead added to the buffer addresses when the descriptors are written.
+VkDescriptorType GetVkDescriptorType(DescriptorType Type, bool UseDescriptorBuffers)
+{
+    const VkDescriptorType vkType = DescriptorTypeToVkDescriptorType(Type);
+    if (!UseDescriptorBuffers)
+        return vkType;
+
+    switch (vkType)
+    {
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC: return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC: return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        default: return vkType;
+    }
+}
+
+size_t GetDescriptorBufferDescriptorSize(const VkPhysicalDeviceDescriptorBufferPropertiesEXT& Props, DescriptorType Type)
+{
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (Type)
+    {
+        // clang-format off
+        case DescriptorType::Sampler:                       return Props.samplerDescriptorSize;
+        case DescriptorType::CombinedImageSampler:          return Props.combinedImageSamplerDescriptorSize;
+        case DescriptorType::SeparateImage:                 return Props.sampledImageDescriptorSize;
+        case DescriptorType::StorageImage:                  return Props.storageImageDescriptorSize;
+        case DescriptorType::UniformTexelBuffer:            return Props.uniformTexelBufferDescriptorSize;
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:   return Props.storageTexelBufferDescriptorSize;
+        case DescriptorType::UniformBuffer:
+        case DescriptorType::UniformBufferDynamic:          return Props.uniformBufferDescriptorSize;
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBuffer_ReadOnly:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBufferDynamic_ReadOnly: return Props.storageBufferDescriptorSize;
+        case DescriptorType::InputAttachment:
+        case DescriptorType::InputAttachment_General:       return Props.inputAttachmentDescriptorSize;
+        case DescriptorType::AccelerationStructure:         return Props.accelerationStructureDescriptorSize;
+        // clang-format on
+        default:
+            UNEXPECTED("Unexpected descriptor type");
+            return 0;
+    }
+}
+
+// Gets the descriptor of the cached resource and writes it to pDst
+void GetResourceDescriptor(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice,
+                           const ShaderResourceCacheVk::Resource&      Res,
+                           DeviceContextIndex                          CtxId,
+                           VkSampler                                   vkImmutableSampler,
+                           size_t                                      DescriptorSize,
+                           void*                                       pDst)
+{
+    VkDescriptorGetInfoEXT GetInfo{};
+    GetInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+    GetInfo.pNext = nullptr;
+    GetInfo.type  = GetVkDescriptorType(Res.Type, /*UseDescriptorBuffers = */ true);
+
+    // Do not zero-initialize!
+    VkDescriptorImageInfo ImageInfo;
+
+    VkDescriptorAddressInfoEXT AddressInfo{};
+    AddressInfo.sType  = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+    AddressInfo.pNext  = nullptr;
+    AddressInfo.format = VK_FORMAT_UNDEFINED;
+
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (Res.Type)
+    {
+        case DescriptorType::Sampler:
+            ImageInfo             = Res.GetSamplerDescriptorWriteInfo();
+            GetInfo.data.pSampler = &ImageInfo.sampler;
+            break;
+
+        case DescriptorType::CombinedImageSampler:
+            ImageInfo = Res.GetImageDescriptorWriteInfo();
+            // Immutable samplers are not stored in the descriptor buffer and must be provided here
+            if (Res.HasImmutableSampler)
+                ImageInfo.sampler = vkImmutableSampler;
+            GetInfo.data.pCombinedImageSampler = &ImageInfo;
+            break;
+
+        case DescriptorType::SeparateImage:
+            ImageInfo                  = Res.GetImageDescriptorWriteInfo();
+            GetInfo.data.pSampledImage = &ImageInfo;
+            break;
+
+        case DescriptorType::StorageImage:
+            ImageInfo                  = Res.GetImageDescriptorWriteInfo();
+            GetInfo.data.pStorageImage = &ImageInfo;
+            break;
+
+        case DescriptorType::InputAttachment:
+        case DescriptorType::InputAttachment_General:
+            ImageInfo                          = Res.GetInputAttachmentDescriptorWriteInfo();
+            GetInfo.data.pInputAttachmentImage = &ImageInfo;
+            break;
+
+        case DescriptorType::UniformTexelBuffer:
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:
+        {
+            const BufferViewVkImpl* pBuffViewVk = Res.pObject.ConstPtr<BufferViewVkImpl>();
+            const BufferViewDesc&   ViewDesc    = pBuffViewVk->GetDesc();
+            const BufferVkImpl*     pBuffVk     = pBuffViewVk->GetBuffer<const BufferVkImpl>();
+
+            AddressInfo.address = pBuffVk->GetVkDeviceAddress() + ViewDesc.ByteOffset;
+            AddressInfo.range   = ViewDesc.ByteWidth;
+            AddressInfo.format  = TypeToVkFormat(ViewDesc.Format.ValueType, ViewDesc.Format.NumComponents, ViewDesc.Format.IsNormalized);
+            if (Res.Type == DescriptorType::UniformTexelBuffer)
+                GetInfo.data.pUniformTexelBuffer = &AddressInfo;
+            else
+                GetInfo.data.pStorageTexelBuffer = &AddressInfo;
+            break;
+        }
+
+        case DescriptorType::UniformBuffer:
+        case DescriptorType::UniformBufferDynamic:
+        {
+            const BufferVkImpl* pBuffVk = Res.pObject.ConstPtr<BufferVkImpl>();
+
+            VkDeviceSize Offset = Res.BufferBaseOffset;
+            if (Res.Type == DescriptorType::UniformBufferDynamic)
+                Offset += Res.BufferDynamicOffset + pBuffVk->GetDynamicOffset(CtxId, nullptr /* Do not verify allocation*/);
+
+            AddressInfo.address         = pBuffVk->GetVkDeviceAddress() + Offset;
+            AddressInfo.range           = Res.BufferRangeSize;
+            GetInfo.data.pUniformBuffer = &AddressInfo;
+            break;
+        }
+
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBuffer_ReadOnly:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBufferDynamic_ReadOnly:
+        {
+            const BufferViewVkImpl* pBuffViewVk = Res.pObject.ConstPtr<BufferViewVkImpl>();
+            const BufferVkImpl*     pBuffVk     = pBuffViewVk->GetBuffer<const BufferVkImpl>();
+
+            VkDeviceSize Offset = Res.BufferBaseOffset;
+            if (Res.Type == DescriptorType::StorageBufferDynamic || Res.Type == DescriptorType::StorageBufferDynamic_ReadOnly)
+                Offset += Res.BufferDynamicOffset + pBuffVk->GetDynamicOffset(CtxId, nullptr /* Do not verify allocation*/);
+
+            AddressInfo.address         = pBuffVk->GetVkDeviceAddress() + Offset;
+            AddressInfo.range           = Res.BufferRangeSize;
+            GetInfo.data.pStorageBuffer = &AddressInfo;
+            break;
+        }
+
+        case DescriptorType::AccelerationStructure:
+            GetInfo.data.accelerationStructure = Res.pObject.ConstPtr<TopLevelASVkImpl>()->GetVkDeviceAddress();
+            break;
+
+        default:
+            UNEXPECTED("Unexpected descriptor type");
+            return;
+    }
+
+    LogicalDevice.GetDescriptor(GetInfo, DescriptorSize, pDst);
+}
+
 } // namespace
 
 inline PipelineResourceSignatureVkImpl::CACHE_GROUP PipelineResourceSignatureVkImpl::GetResourceCacheGroup(const PipelineResourceDesc& Res)
@@ -244,7 +407,11 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
     // Current offset in the static resource cache
     Uint32 StaticCacheOffset = 0;
 
+    const bool UseDescriptorBuffers = HasDevice() && GetDevice()->UseDescriptorBuffers();
+
     std::array<std::vector<VkDescriptorSetLayoutBinding>, DESCRIPTOR_SET_ID_NUM_SETS> vkSetLayoutBindings;
+    // Static resources of the static/mutable set and all resources of the dynamic set
+    std::array<std::vector<VkDescriptorUpdateTemplateEntry>, DESCRIPTOR_SET_ID_NUM_SETS> vkTemplateEntries;
 
     DynamicLinearAllocator TempAllocator{GetRawAllocator(), 256};
 
@@ -329,9 +496,30 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
         vkSetLayoutBinding.descriptorCount    = ResDesc.ArraySize;
         vkSetLayoutBinding.stageFlags         = ShaderTypesToVkShaderStageFlags(ResDesc.ShaderStages);
         vkSetLayoutBinding.pImmutableSamplers = pVkImmutableSamplers;
-        vkSetLayoutBinding.descriptorType     = DescriptorTypeToVkDescriptorType(pAttribs->GetDescriptorType());
+        vkSetLayoutBinding.descriptorType     = GetVkDescriptorType(pAttribs->GetDescriptorType(), UseDescriptorBuffers);
         vkSetLayoutBindings[SetId].push_back(vkSetLayoutBinding);
 
+        // Mutable resources are written one by one when they are set. Immutable separate samplers
+        // are permanently bound into the set layout and must not be written.
+        if (ResDesc.VarType != SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE &&
+            !(DescrType == DescriptorType::Sampler && pAttribs->IsImmutableSamplerAssigned()))
+        {
+            VkDescriptorUpdateTemplateEntry vkTemplateEntry{};
+            vkTemplateEntry.dstBinding      = pAttribs->BindingIndex;
+            vkTemplateEntry.dstArrayElement = 0;
+            vkTemplateEntry.descriptorCount = ResDesc.ArraySize;
+            vkTemplateEntry.descriptorType  = vkSetLayoutBinding.descriptorType;
+            vkTemplateEntry.offset          = size_t{pAttribs->CacheOffset(ResourceCacheContentType::SRB)} * sizeof(ShaderResourceCacheVk::DescriptorData);
+            vkTemplateEntry.stride          = sizeof(ShaderResourceCacheVk::DescriptorData);
+            vkTemplateEntries[SetId].push_back(vkTemplateEntry);
+
+            if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC &&
+                DescrType == DescriptorType::CombinedImageSampler && !pAttribs->IsImmutableSamplerAssigned())
+            {
+                m_DynamicCombinedSamplers.push_back(i);
+            }
+        }
+
         if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
         {
             VERIFY(pAttribs->DescrSet == 0, "Static resources must always be allocated in descriptor set 0");
@@ -453,7 +641,7 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
 
     SetLayoutCI.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
     SetLayoutCI.pNext = nullptr;
-    SetLayoutCI.flags = 0;
+    SetLayoutCI.flags = UseDescriptorBuffers ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT : 0;
 
     if (HasDevice())
     {
@@ -470,6 +658,102 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
             m_VkDescrSetLayouts[i]   = LogicalDevice.CreateDescriptorSetLayout(SetLayoutCI);
         }
         VERIFY_EXPR(NumSets == GetNumDescriptorSets());
+
+        if (UseDescriptorBuffers)
+            InitDescriptorBufferData(vkSetLayoutBindings);
+        else if (LogicalDevice.GetEnabledExtFeatures().DescrUpdateTemplate)
+            CreateDescriptorUpdateTemplates(vkTemplateEntries);
+    }
+}
+
+void PipelineResourceSignatureVkImpl::CreateDescriptorUpdateTemplates(const std::array<std::vector<VkDescriptorUpdateTemplateEntry>, DESCRIPTOR_SET_ID_NUM_SETS>& TemplateEntries)
+{
+    const auto& LogicalDevice = GetDevice()->GetLogicalDevice();
+
+    for (size_t i = 0; i < TemplateEntries.size(); ++i)
+    {
+        const auto& Entries = TemplateEntries[i];
+        if (Entries.empty())
+            continue;
+
+        VERIFY_EXPR(m_VkDescrSetLayouts[i] != VK_NULL_HANDLE);
+
+        VkDescriptorUpdateTemplateCreateInfo TemplateCI{};
+        TemplateCI.sType                      = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+        TemplateCI.pNext                      = nullptr;
+        TemplateCI.flags                      = 0;
+        TemplateCI.descriptorUpdateEntryCount = StaticCast<uint32_t>(Entries.size());
+        TemplateCI.pDescriptorUpdateEntries   = Entries.data();
+        TemplateCI.templateType               = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+        TemplateCI.descriptorSetLayout        = m_VkDescrSetLayouts[i];
+        // pipelineBindPoint, pipelineLayout and set are ignored for VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET
+
+        m_VkDescrUpdateTemplates[i] = LogicalDevice.CreateDescriptorUpdateTemplate(TemplateCI, m_Desc.Name);
+
+        Uint32 NumDescriptors = 0;
+        for (const auto& Entry : Entries)
+            NumDescriptors += Entry.descriptorCount;
+        m_DescrUpdateTemplateSizes[i] = NumDescriptors;
+    }
+}
+
+void PipelineResourceSignatureVkImpl::InitDescriptorBufferData(const std::array<std::vector<VkDescriptorSetLayoutBinding>, DESCRIPTOR_SET_ID_NUM_SETS>& SetLayoutBindings)
+{
+    const auto& LogicalDevice    = GetDevice()->GetLogicalDevice();
+    const auto& DescrBufferProps = GetDevice()->GetPhysicalDevice().GetExtProperties().DescriptorBuffer;
+
+    for (size_t SetId = 0; SetId < SetLayoutBindings.size(); ++SetId)
+    {
+        const VkDescriptorSetLayout vkLayout = m_VkDescrSetLayouts[SetId];
+        if (vkLayout == VK_NULL_HANDLE)
+            continue;
+
+        auto& SetData = m_DescrBufferSets[SetId];
+        SetData.Size  = LogicalDevice.GetDescriptorSetLayoutSize(vkLayout);
+
+        // Immutable samplers specified in the set layout must be written to the descriptor buffer by the application.
+        // Separate sampler descriptors never change, so they are written once here and copied every time the set is written.
+        for (const auto& Binding : SetLayoutBindings[SetId])
+        {
+            if (Binding.descriptorType != VK_DESCRIPTOR_TYPE_SAMPLER || Binding.pImmutableSamplers == nullptr)
+                continue;
+
+            if (SetData.InitData.empty())
+                SetData.InitData.resize(StaticCast<size_t>(SetData.Size));
+
+            const VkDeviceSize BindingOffset = LogicalDevice.GetDescriptorSetLayoutBindingOffset(vkLayout, Binding.binding);
+            for (uint32_t Elem = 0; Elem < Binding.descriptorCount; ++Elem)
+            {
+                VkDescriptorGetInfoEXT GetInfo{};
+                GetInfo.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+                GetInfo.type          = VK_DESCRIPTOR_TYPE_SAMPLER;
+                GetInfo.data.pSampler = &Binding.pImmutableSamplers[Elem];
+
+                const size_t Offset = StaticCast<size_t>(BindingOffset + Elem * DescrBufferProps.samplerDescriptorSize);
+                VERIFY_EXPR(Offset + DescrBufferProps.samplerDescriptorSize <= SetData.InitData.size());
+                LogicalDevice.GetDescriptor(GetInfo, DescrBufferProps.samplerDescriptorSize, &SetData.InitData[Offset]);
+            }
+        }
+    }
+
+    m_DescrBufferBindings.resize(GetTotalResourceCount());
+    for (Uint32 r = 0; r < GetTotalResourceCount(); ++r)
+    {
+        const auto& ResDesc = GetResourceDesc(r);
+        const auto& Attr    = GetResourceAttribs(r);
+        const auto  SetId   = VarTypeToDescriptorSetId(ResDesc.VarType);
+        auto&       Binding = m_DescrBufferBindings[r];
+
+        Binding.Offset = LogicalDevice.GetDescriptorSetLayoutBindingOffset(m_VkDescrSetLayouts[SetId], Attr.BindingIndex);
+
+        if (Attr.GetDescriptorType() == DescriptorType::CombinedImageSampler && Attr.IsImmutableSamplerAssigned())
+        {
+            const auto& SetBindings = SetLayoutBindings[SetId];
+            const auto  BindingIt   = std::find_if(SetBindings.begin(), SetBindings.end(),
+                                                [&Attr](const VkDescriptorSetLayoutBinding& B) { return B.binding == Attr.BindingIndex; });
+            VERIFY_EXPR(BindingIt != SetBindings.end() && BindingIt->pImmutableSamplers != nullptr);
+            Binding.vkImmutableSampler = BindingIt->pImmutableSamplers[0];
+        }
     }
 }
 
@@ -486,6 +770,12 @@ void PipelineResourceSignatureVkImpl::Destruct()
             GetDevice()->SafeReleaseDeviceObject(std::move(Layout), ~0ull);
     }
 
+    for (auto& Template : m_VkDescrUpdateTemplates)
+    {
+        if (Template)
+            GetDevice()->SafeReleaseDeviceObject(std::move(Template), ~0ull);
+    }
+
     TPipelineResourceSignatureBase::Destruct();
 }
 
@@ -514,6 +804,10 @@ void PipelineResourceSignatureVkImpl::InitSRBResourceCache(ShaderResourceCacheVk
     ResourceCache.DbgVerifyResourceInitialization();
 #endif
 
+    // When descriptor buffers are used, descriptors are written to the dynamic heap when the SRB is committed
+    if (GetDevice()->UseDescriptorBuffers())
+        return;
+
     if (auto vkLayout = GetVkDescriptorSetLayout(DESCRIPTOR_SET_ID_STATIC_MUTABLE))
     {
         const char* DescrSetName = "Static/Mutable Descriptor Set";
@@ -542,6 +836,33 @@ void PipelineResourceSignatureVkImpl::CopyStaticResources(ShaderResourceCacheVk&
     const auto  ResIdxRange      = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
     const auto  SrcCacheType     = SrcResourceCache.GetContentType();
     const auto  DstCacheType     = DstResourceCache.GetContentType();
+    const auto& LogicalDevice    = GetDevice()->GetLogicalDevice();
+
+    // When the SRB is initialized, none of the static resources has been copied yet. If all of them
+    // are bound, write them with a single template update instead of one update per descriptor.
+    const VkDescriptorUpdateTemplate vkUpdateTemplate = m_VkDescrUpdateTemplates[DESCRIPTOR_SET_ID_STATIC_MUTABLE];
+    const VkDescriptorSet            vkStaticSet      = DstDescrSet.GetVkDescriptorSet();
+
+    bool UseUpdateTemplate = vkUpdateTemplate != VK_NULL_HANDLE && vkStaticSet != VK_NULL_HANDLE;
+    if (UseUpdateTemplate)
+    {
+        Uint32 NumNewDescriptors = 0;
+        for (Uint32 r = ResIdxRange.first; r < ResIdxRange.second; ++r)
+        {
+            const auto& ResDesc = GetResourceDesc(r);
+            const auto& Attr    = GetResourceAttribs(r);
+            if (ResDesc.ResourceType == SHADER_RESOURCE_TYPE_SAMPLER && Attr.IsImmutableSamplerAssigned())
+                continue;
+
+            for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
+            {
+                if (SrcDescrSet.GetResource(Attr.CacheOffset(SrcCacheType) + ArrInd) &&
+                    !DstDescrSet.GetResource(Attr.CacheOffset(DstCacheType) + ArrInd))
+                    ++NumNewDescriptors;
+            }
+        }
+        UseUpdateTemplate = (NumNewDescriptors == m_DescrUpdateTemplateSizes[DESCRIPTOR_SET_ID_STATIC_MUTABLE]);
+    }
 
     for (Uint32 r = ResIdxRange.first; r < ResIdxRange.second; ++r)
     {
@@ -572,7 +893,8 @@ void PipelineResourceSignatureVkImpl::CopyStaticResources(ShaderResourceCacheVk&
             if (pCachedResource != pObject)
             {
                 DEV_CHECK_ERR(pCachedResource == nullptr, "Static resource has already been initialized, and the new resource does not match previously assigned resource");
-                DstResourceCache.SetResource(&GetDevice()->GetLogicalDevice(),
+                // Do not write the descriptor if the whole set will be updated with the template
+                DstResourceCache.SetResource(UseUpdateTemplate ? nullptr : &LogicalDevice,
                                              StaticSetIdx,
                                              DstCacheOffset,
                                              {
@@ -586,6 +908,9 @@ void PipelineResourceSignatureVkImpl::CopyStaticResources(ShaderResourceCacheVk&
         }
     }
 
+    if (UseUpdateTemplate)
+        LogicalDevice.UpdateDescriptorSetWithTemplate(vkStaticSet, vkUpdateTemplate, DstDescrSet.GetDescriptorData());
+
 #ifdef DILIGENT_DEBUG
     DstResourceCache.DbgVerifyDynamicBuffersCounter();
 #endif
@@ -605,6 +930,60 @@ Uint32 PipelineResourceSignatureVkImpl::GetDescriptorSetIndex<PipelineResourceSi
     return HasDescriptorSet(DESCRIPTOR_SET_ID_STATIC_MUTABLE) ? 1 : 0;
 }
 
+void PipelineResourceSignatureVkImpl::WriteDescriptorBuffer(const ShaderResourceCacheVk& ResourceCache,
+                                                            DESCRIPTOR_SET_ID            SetId,
+                                                            DeviceContextIndex           CtxId,
+                                                            void*                        pDescriptors) const
+{
+    VERIFY(GetDevice()->UseDescriptorBuffers(), "Descriptor buffers are not enabled");
+    VERIFY(HasDescriptorSet(SetId), "This signature does not contain descriptor set ", Uint32{SetId});
+    VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
+    VERIFY_EXPR(pDescriptors != nullptr);
+
+    const auto& LogicalDevice    = GetDevice()->GetLogicalDevice();
+    const auto& DescrBufferProps = GetDevice()->GetPhysicalDevice().GetExtProperties().DescriptorBuffer;
+    const auto& SetData          = m_DescrBufferSets[SetId];
+
+    Uint8* const pDstData = static_cast<Uint8*>(pDescriptors);
+    if (!SetData.InitData.empty())
+        memcpy(pDstData, SetData.InitData.data(), SetData.InitData.size());
+
+    const Uint32 SetIdx = SetId == DESCRIPTOR_SET_ID_STATIC_MUTABLE ?
+        GetDescriptorSetIndex<DESCRIPTOR_SET_ID_STATIC_MUTABLE>() :
+        GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>();
+    const auto& SetResources = ResourceCache.GetDescriptorSet(SetIdx);
+
+    // Resources are sorted by variable type, so static and mutable resources form a single range
+    const auto ResIdxRange = SetId == DESCRIPTOR_SET_ID_STATIC_MUTABLE ?
+        std::make_pair(GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_STATIC).first, GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE).second) :
+        GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+
+    constexpr auto CacheType = ResourceCacheContentType::SRB;
+
+    for (Uint32 r = ResIdxRange.first; r < ResIdxRange.second; ++r)
+    {
+        const auto& Attr      = GetResourceAttribs(r);
+        const auto  DescrType = Attr.GetDescriptorType();
+        VERIFY_EXPR(VarTypeToDescriptorSetId(GetResourceDesc(r).VarType) == SetId);
+
+        if (DescrType == DescriptorType::Sampler && Attr.IsImmutableSamplerAssigned())
+            continue; // Immutable separate samplers are copied from the initial data
+
+        const auto&  Binding   = m_DescrBufferBindings[r];
+        const size_t DescrSize = GetDescriptorBufferDescriptorSize(DescrBufferProps, DescrType);
+        for (Uint32 Elem = 0; Elem < Attr.ArraySize; ++Elem)
+        {
+            const auto& Res = SetResources.GetResource(Attr.CacheOffset(CacheType) + Elem);
+            if (Res.IsNull())
+                continue;
+
+            const size_t Offset = StaticCast<size_t>(Binding.Offset + Elem * DescrSize);
+            VERIFY_EXPR(Offset + DescrSize <= SetData.Size);
+            GetResourceDescriptor(LogicalDevice, Res, CtxId, Binding.vkImmutableSampler, DescrSize, pDstData + Offset);
+        }
+    }
+}
+
 void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
                                                              VkDescriptorSet              vkDynamicDescriptorSet) const
 {
@@ -612,6 +991,30 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
     VERIFY_EXPR(vkDynamicDescriptorSet != VK_NULL_HANDLE);
     VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
 
+    const auto  DynamicSetIdx = GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>();
+    const auto& SetResources  = ResourceCache.GetDescriptorSet(DynamicSetIdx);
+    const auto& LogicalDevice = GetDevice()->GetLogicalDevice();
+    VERIFY(SetResources.GetVkDescriptorSet() == VK_NULL_HANDLE, "Dynamic descriptor set must not be assigned to the resource cache");
+
+    if (const VkDescriptorUpdateTemplate vkUpdateTemplate = m_VkDescrUpdateTemplates[DESCRIPTOR_SET_ID_DYNAMIC])
+    {
+        // If all dynamic resources are bound, write the entire set from the packed descriptor data.
+        // Otherwise, null descriptors must be skipped, which requires individual writes.
+        if (SetResources.GetNumBoundResources() == m_DescrUpdateTemplateSizes[DESCRIPTOR_SET_ID_DYNAMIC])
+        {
+            // The descriptor data is written when the resource is set, but the sampler
+            // of a texture view may have changed since then.
+            for (Uint32 ResIdx : m_DynamicCombinedSamplers)
+            {
+                const auto& Attr = GetResourceAttribs(ResIdx);
+                ResourceCache.UpdateCombinedSamplers(DynamicSetIdx, Attr.CacheOffset(ResourceCacheContentType::SRB), Attr.ArraySize);
+            }
+
+            LogicalDevice.UpdateDescriptorSetWithTemplate(vkDynamicDescriptorSet, vkUpdateTemplate, SetResources.GetDescriptorData());
+            return;
+        }
+    }
+
 #ifdef DILIGENT_DEBUG
     static constexpr size_t ImgUpdateBatchSize          = 4;
     static constexpr size_t BuffUpdateBatchSize         = 2;
@@ -639,10 +1042,7 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
     auto AccelStructIt   = DescrAccelStructArr.begin();
     auto WriteDescrSetIt = WriteDescrSetArr.begin();
 
-    const auto  DynamicSetIdx  = GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>();
-    const auto& SetResources   = ResourceCache.GetDescriptorSet(DynamicSetIdx);
-    const auto& LogicalDevice  = GetDevice()->GetLogicalDevice();
-    const auto  DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+    const auto DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
 
     constexpr auto CacheType = ResourceCacheContentType::SRB;
 
@@ -661,9 +1061,8 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
         }
 #endif
 
-        WriteDescrSetIt->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        WriteDescrSetIt->pNext = nullptr;
-        VERIFY(SetResources.GetVkDescriptorSet() == VK_NULL_HANDLE, "Dynamic descriptor set must not be assigned to the resource cache");
+        WriteDescrSetIt->sType  = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        WriteDescrSetIt->pNext  = nullptr;
         WriteDescrSetIt->dstSet = vkDynamicDescriptorSet;
         VERIFY(WriteDescrSetIt->dstSet != VK_NULL_HANDLE, "Vulkan descriptor set must not be null");
         WriteDescrSetIt->dstBinding      = Attr.BindingIndex;
@@ -116,6 +116,8 @@ void CreateComputePipeline(RenderDeviceVkImpl*                           pDevice
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    if (pDeviceVk->UseDescriptorBuffers())
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
     PipelineCI.basePipelineHandle = VK_NULL_HANDLE; // a pipeline to derive from
     PipelineCI.basePipelineIndex  = -1;             // an index into the pCreateInfos parameter to use as a pipeline to derive from
 
@@ -159,6 +161,8 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    if (pDeviceVk->UseDescriptorBuffers())
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
 
     PipelineCI.stageCount = static_cast<Uint32>(Stages.size());
     PipelineCI.pStages    = Stages.data();
@@ -350,6 +354,8 @@ void CreateRayTracingPipeline(RenderDeviceVkImpl*
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    if (pDeviceVk->UseDescriptorBuffers())
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
 
     PipelineCI.stageCount                   = static_cast<Uint32>(vkStages.size());
     PipelineCI.pStages                      = vkStages.data();
@@ -523,6 +529,19 @@ void VerifyResourceMerge(const char*                       PSOName,
 #undef LOG_RESOURCE_MERGE_ERROR_AND_THROW
 }
 
+// Returns the cache object provided by the application, or the device pipeline cache if it is enabled.
+// The device cache is returned to the pool when the returned object is destroyed.
+PipelineCacheManagerVk::ScopedCache AcquirePipelineCache(RenderDeviceVkImpl* pDeviceVk, IPipelineStateCache* pPSOCache)
+{
+    if (pPSOCache != nullptr)
+        return {nullptr, ClassPtrCast<PipelineStateCacheVkImpl>(pPSOCache)->GetVkPipelineCache()};
+
+    if (auto* pCacheMgr = pDeviceVk->GetPipelineCacheManager())
+        return pCacheMgr->Acquire();
+
+    return {nullptr, VK_NULL_HANDLE};
+}
+
 } // namespace
 
 
@@ -632,12 +651,23 @@ void PipelineStateVkImpl::RemapOrVerifyShaderResources(
     bool                                                 bVerifyOnly,
     bool                                                 bStripReflection,
     const char*                                          PipelineName,
+    IThreadPool*                                         pThreadPool,
     TShaderResources*                                    pDvpShaderResources,
     TResourceAttibutions*                                pDvpResourceAttibutions) noexcept(false)
 {
     if (PipelineName == nullptr)
         PipelineName = "<null>";
 
+    if (bStripReflection)
+    {
+        // Strip the code of all shaders of the pipeline in one batch, so that
+        // the shaders are processed in parallel by the thread pool.
+        std::vector<const ShaderVkImpl*> Shaders;
+        for (const auto& Stage : ShaderStages)
+            Shaders.insert(Shaders.end(), Stage.Shaders.begin(), Stage.Shaders.end());
+        ShaderVkImpl::StripReflection(Shaders.data(), Shaders.size(), pThreadPool);
+    }
+
     // Verify that pipeline layout is compatible with shader resources and
     // remap resource bindings.
     for (size_t s = 0; s < ShaderStages.size(); ++s)
@@ -659,8 +689,14 @@ void PipelineStateVkImpl::RemapOrVerifyShaderResources(
             if (pDvpShaderResources)
                 pDvpShaderResources->emplace_back(pShaderResources);
 
+            // The stripped code and the resource decoration offsets in it are computed
+            // once per shader, so that the pipeline only copies the code and patches the bindings.
+            const auto* pStrippedSPIRV = bStripReflection ? pShader->GetStrippedSPIRV() : nullptr;
+            if (pStrippedSPIRV != nullptr && !bVerifyOnly)
+                SPIRV = pStrippedSPIRV->SPIRV;
+
             pShaderResources->ProcessResources(
-                [&](const SPIRVShaderResourceAttribs& SPIRVAttribs, Uint32) //
+                [&](const SPIRVShaderResourceAttribs& SPIRVAttribs, Uint32 ResIndex) //
                 {
                     const auto ResAttribution = GetResourceAttribution(SPIRVAttribs.Name, ShaderType, pSignatures, SignatureCount);
                     if (!ResAttribution)
@@ -723,6 +759,13 @@ void PipelineStateVkImpl::RemapOrVerifyShaderResources(
                                                 SignDesc.Name, "' is mapped to set ", DescriptorSet, '.');
                         }
                     }
+                    else if (pStrippedSPIRV != nullptr)
+                    {
+                        const auto& Offsets = pStrippedSPIRV->ResourceOffsets[ResIndex];
+
+                        SPIRV[Offsets.Binding]       = ResourceBinding;
+                        SPIRV[Offsets.DescriptorSet] = DescriptorSet;
+                    }
                     else
                     {
                         SPIRV[SPIRVAttribs.BindingDecorationOffset]       = ResourceBinding;
@@ -733,7 +776,12 @@ void PipelineStateVkImpl::RemapOrVerifyShaderResources(
                         pDvpResourceAttibutions->emplace_back(ResAttribution);
                 });
 
-            if (bStripReflection)
+            if (pStrippedSPIRV != nullptr)
+            {
+                if (bVerifyOnly)
+                    SPIRV = pStrippedSPIRV->SPIRV;
+            }
+            else if (bStripReflection && HasSPIRVReflectionInstructions(SPIRV))
             {
 #if !DILIGENT_NO_HLSL
                 // We have to strip reflection instructions to fix the following validation error:
@@ -784,6 +832,7 @@ void PipelineStateVkImpl::InitPipelineLayout(const PipelineStateCreateInfo& Crea
                                      VerifyBindings, // VerifyOnly
                                      true,           // bStripReflection
                                      m_Desc.Name,
+                                     GetDevice()->GetShaderCompilationThreadPool(),
 #ifdef DILIGENT_DEVELOPMENT
                                      &m_ShaderResources, &m_ResourceAttibutions
 #else
@@ -827,7 +876,7 @@ void PipelineStateVkImpl::InitializePipeline(const GraphicsPipelineStateCreateIn
 
     InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
 
-    const auto vkSPOCache = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
+    const auto vkSPOCache = AcquirePipelineCache(m_pDevice, CreateInfo.pPSOCache);
     CreateGraphicsPipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, GetGraphicsPipelineDesc(), m_Pipeline, GetRenderPassPtr(), vkSPOCache);
 }
 
@@ -838,7 +887,7 @@ void PipelineStateVkImpl::InitializePipeline(const ComputePipelineStateCreateInf
 
     InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
 
-    const auto vkSPOCache = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
+    const auto vkSPOCache = AcquirePipelineCache(m_pDevice, CreateInfo.pPSOCache);
     CreateComputePipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_Pipeline, vkSPOCache);
 }
 
@@ -851,9 +900,11 @@ void PipelineStateVkImpl::InitializePipeline(const RayTracingPipelineStateCreate
 
     const auto ShaderStages   = InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
     const auto vkShaderGroups = BuildRTShaderGroupDescription(CreateInfo, m_pRayTracingPipelineData->NameToGroupIndex, ShaderStages);
-    const auto vkSPOCache     = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
 
-    CreateRayTracingPipeline(m_pDevice, vkShaderStages, vkShaderGroups, m_PipelineLayout, m_Desc, GetRayTracingPipelineDesc(), m_Pipeline, vkSPOCache);
+    {
+        const auto vkSPOCache = AcquirePipelineCache(m_pDevice, CreateInfo.pPSOCache);
+        CreateRayTracingPipeline(m_pDevice, vkShaderStages, vkShaderGroups, m_PipelineLayout, m_Desc, GetRayTracingPipelineDesc(), m_Pipeline, vkSPOCache);
+    }
 
     VERIFY(m_pRayTracingPipelineData->NameToGroupIndex.size() == vkShaderGroups.size(),
            "The size of NameToGroupIndex map does not match the actual number of groups in the pipeline. This is a bug.");
@@ -95,6 +95,45 @@ void QueryManagerVk::QueryPoolInfo::Discard(Uint32 Index)
     m_StaleQueries.push_back(Index);
 }
 
+Uint32 QueryManagerVk::QueryPoolInfo::AllocateRange(Uint32 Count)
+{
+    VERIFY_EXPR(Count > 0);
+
+    std::lock_guard<std::mutex> Lock{m_QueriesMtx};
+    if (m_AvailableQueries.size() < Count)
+        return InvalidIndex;
+
+    // Allocate() takes queries from the back of the list, which is sorted in descending order,
+    // so the run with the highest indices is found first and the low indices are left to single queries.
+    VERIFY_EXPR(std::is_sorted(m_AvailableQueries.begin(), m_AvailableQueries.end(), std::greater<Uint32>{}));
+
+    // The indices are unique, so Count elements starting at i are consecutive if and only if
+    // the first and the last of them differ by Count - 1.
+    for (size_t i = 0; i + Count <= m_AvailableQueries.size(); ++i)
+    {
+        if (m_AvailableQueries[i] - m_AvailableQueries[i + Count - 1] == Count - 1)
+        {
+            const Uint32 FirstIndex = m_AvailableQueries[i + Count - 1];
+            m_AvailableQueries.erase(m_AvailableQueries.begin() + i, m_AvailableQueries.begin() + i + Count);
+            m_MaxAllocatedQueries = std::max(m_MaxAllocatedQueries, m_QueryCount - static_cast<Uint32>(m_AvailableQueries.size()));
+            return FirstIndex;
+        }
+    }
+
+    return InvalidIndex;
+}
+
+void QueryManagerVk::QueryPoolInfo::DiscardRange(Uint32 FirstIndex, Uint32 Count)
+{
+    std::lock_guard<std::mutex> Lock{m_QueriesMtx};
+
+    VERIFY(FirstIndex + Count <= m_QueryCount, "Query range [", FirstIndex, ", ", FirstIndex + Count, ") is out of range");
+    VERIFY(m_vkQueryPool != VK_NULL_HANDLE, "Query pool is not initialized");
+
+    for (Uint32 i = 0; i < Count; ++i)
+        m_StaleQueries.push_back(FirstIndex + i);
+}
+
 Uint32 QueryManagerVk::QueryPoolInfo::ResetStaleQueries(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice,
                                                         VulkanUtilities::VulkanCommandBuffer&       CmdBuff)
 {
@@ -128,17 +167,28 @@ Uint32 QueryManagerVk::QueryPoolInfo::ResetStaleQueries(const VulkanUtilities::V
         ResetQueries(0, m_QueryCount);
         m_AvailableQueries.resize(m_QueryCount);
         for (Uint32 i = 0; i < m_QueryCount; ++i)
-            m_AvailableQueries[i] = i;
+            m_AvailableQueries[i] = m_QueryCount - 1 - i;
         NumCommands = 1;
     }
     else
     {
-        for (auto& StaleQuery : m_StaleQueries)
+        // Reset every run of consecutive queries (e.g. a range discarded by DiscardRange()) with a single command.
+        std::sort(m_StaleQueries.begin(), m_StaleQueries.end());
+        for (size_t i = 0; i < m_StaleQueries.size();)
         {
-            ResetQueries(StaleQuery, 1);
-            m_AvailableQueries.push_back(StaleQuery);
+            size_t j = i + 1;
+            while (j < m_StaleQueries.size() && m_StaleQueries[j] == m_StaleQueries[j - 1] + 1)
+                ++j;
+            ResetQueries(m_StaleQueries[i], static_cast<uint32_t>(j - i));
+            ++NumCommands;
+            i = j;
         }
-        NumCommands = static_cast<Uint32>(m_StaleQueries.size());
+
+        // Merge the stale queries into the available queries keeping the list sorted in descending order.
+        // Appending them would break runs of consecutive indices, since Allocate() takes queries from the back.
+        const size_t NumAvailable = m_AvailableQueries.size();
+        m_AvailableQueries.insert(m_AvailableQueries.end(), m_StaleQueries.rbegin(), m_StaleQueries.rend());
+        std::inplace_merge(m_AvailableQueries.begin(), m_AvailableQueries.begin() + NumAvailable, m_AvailableQueries.end(), std::greater<Uint32>{});
     }
     m_StaleQueries.clear();
 
@@ -279,6 +329,16 @@ void QueryManagerVk::DiscardQuery(QUERY_TYPE Type, Uint32 Index)
     m_Pools[Type].Discard(Index);
 }
 
+Uint32 QueryManagerVk::AllocateQueryRange(QUERY_TYPE Type, Uint32 Count)
+{
+    return m_Pools[Type].AllocateRange(Count);
+}
+
+void QueryManagerVk::DiscardQueryRange(QUERY_TYPE Type, Uint32 FirstIndex, Uint32 Count)
+{
+    m_Pools[Type].DiscardRange(FirstIndex, Count);
+}
+
 Uint32 QueryManagerVk::ResetStaleQueries(const VulkanUtilities::VulkanLogicalDevice& LogicalDevice, VulkanUtilities::VulkanCommandBuffer& CmdBuff)
 {
     Uint32 NumQueriesReset = 0;
@@ -51,6 +51,7 @@
 #include "VulkanTypeConversions.hpp"
 #include "EngineMemory.h"
 #include "QueryManagerVk.hpp"
+#include "GPUProfilerVk.hpp"
 
 namespace Diligent
 {
@@ -143,6 +144,7 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
         EngineCI.DynamicHeapSize,
         ~Uint64{0}
     },
+    m_InitialDataUploadBatchSize{EngineCI.InitialDataUploadBatchSize},
     m_pDxCompiler{CreateDXCompiler(DXCompilerTarget::Vulkan, m_PhysicalDevice->GetVkVersion(), EngineCI.pDxCompilerPath)}
 // clang-format on
 {
@@ -168,6 +170,12 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
     // invert y (see comments in DeviceContextVkImpl::CommitViewports() for details)
     m_DeviceInfo.NDC = NDCAttribs{0.0f, 1.0f, -0.5f};
 
+    // The GPU profiler of the immediate context allocates its queries from the timestamp pool of the queue
+    Uint32 QueryPoolSizes[QUERY_TYPE_NUM_TYPES];
+    std::copy(std::begin(EngineCI.QueryPoolSizes), std::end(EngineCI.QueryPoolSizes), QueryPoolSizes);
+    if (EngineCI.GPUProfilerMaxScopesPerFrame != 0)
+        QueryPoolSizes[QUERY_TYPE_TIMESTAMP] += GPUProfilerVk::GetRequiredQueryCount(EngineCI.GPUProfilerMaxScopesPerFrame);
+
     // Every queue family needs its own command pool.
     // Every queue needs its own query pool.
     m_QueryMgrs.reserve(CommandQueueCount);
@@ -188,12 +196,18 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
                 });
         }
 
-        m_QueryMgrs.emplace_back(std::make_unique<QueryManagerVk>(this, EngineCI.QueryPoolSizes, SoftwareQueueIndex{q}));
+        m_QueryMgrs.emplace_back(std::make_unique<QueryManagerVk>(this, QueryPoolSizes, SoftwareQueueIndex{q}));
+
+        if (m_InitialDataUploadBatchSize != 0)
+            m_InitialDataUploadBatches.emplace_back(std::make_unique<InitialDataUploadBatch>());
     }
 
     for (Uint32 fmt = 1; fmt < m_TextureFormatsInfo.size(); ++fmt)
         m_TextureFormatsInfo[fmt].Supported = true; // We will test every format on a specific hardware device
 
+    if (EngineCI.PipelineCacheDirectory != nullptr)
+        m_pPipelineCacheMgr = std::make_unique<PipelineCacheManagerVk>(*m_LogicalVkDevice, m_PhysicalDevice->GetProperties(), EngineCI.PipelineCacheDirectory);
+
     InitShaderCompilationThreadPool(EngineCI.pAsyncShaderCompilationThreadPool, EngineCI.NumAsyncShaderCompilationThreads);
 }
 
@@ -390,6 +404,104 @@ void RenderDeviceVkImpl::ExecuteAndDisposeTransientCmdBuff(SoftwareQueueIndex
     // clang-format on
 }
 
+bool RenderDeviceVkImpl::EnqueueInitialDataUpload(SoftwareQueueIndex                   CommandQueueId,
+                                                  VkDeviceSize                         Size,
+                                                  VkDeviceSize                         Alignment,
+                                                  const InitialDataUploadCallbackType& Callback)
+{
+    if (m_InitialDataUploadBatchSize == 0 || Size > m_InitialDataUploadBatchSize)
+        return false;
+
+    VERIFY_EXPR(Alignment != 0);
+    VERIFY_EXPR(CommandQueueId < m_InitialDataUploadBatches.size());
+    auto& Batch = *m_InitialDataUploadBatches[CommandQueueId];
+
+    std::lock_guard<std::mutex> Lock{Batch.Mtx};
+
+    // Alignment is not necessarily a power of two (e.g. 12-byte texel formats)
+    auto Offset = (Batch.Offset + Alignment - 1) / Alignment * Alignment;
+    if (Batch.StagingBuffer != VK_NULL_HANDLE && Offset + Size > m_InitialDataUploadBatchSize)
+    {
+        // The batch is full - submit it and start a new one
+        SubmitInitialDataUploadBatch(CommandQueueId, Batch);
+        Offset = 0;
+    }
+
+    if (Batch.StagingBuffer == VK_NULL_HANDLE)
+    {
+        VkBufferCreateInfo StagingBuffCI{};
+        StagingBuffCI.sType       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        StagingBuffCI.size        = m_InitialDataUploadBatchSize;
+        StagingBuffCI.usage       = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        StagingBuffCI.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        auto StagingBuffer = m_LogicalVkDevice->CreateBuffer(StagingBuffCI, "Initial data upload batch buffer");
+
+        VkMemoryRequirements StagingBufferMemReqs = m_LogicalVkDevice->GetBufferMemoryRequirements(StagingBuffer);
+        VERIFY(IsPowerOfTwo(StagingBufferMemReqs.alignment), "Alignment is not power of 2!");
+
+        auto StagingMemory = AllocateMemory(StagingBufferMemReqs, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+        if (!StagingMemory)
+            LOG_ERROR_AND_THROW("Failed to allocate staging memory for the initial data upload batch.");
+
+        const auto AlignedStagingMemOffset = AlignUp(VkDeviceSize{StagingMemory.UnalignedOffset}, StagingBufferMemReqs.alignment);
+        VERIFY_EXPR(StagingMemory.Size >= StagingBufferMemReqs.size + (AlignedStagingMemOffset - StagingMemory.UnalignedOffset));
+
+        auto err = m_LogicalVkDevice->BindBufferMemory(StagingBuffer, StagingMemory.Page->GetVkMemory(), AlignedStagingMemOffset);
+        CHECK_VK_ERROR_AND_THROW(err, "Failed to bind staging buffer memory");
+
+        Batch.pStagingData  = reinterpret_cast<Uint8*>(StagingMemory.Page->GetCPUMemory()) + AlignedStagingMemOffset;
+        Batch.StagingBuffer = std::move(StagingBuffer);
+        Batch.StagingMemory = std::move(StagingMemory);
+
+        AllocateTransientCmdPool(CommandQueueId, Batch.CmdPool, Batch.CmdBuffer, "Transient command pool for batched initial data uploads");
+        // One barrier makes host writes visible to all copy commands in the batch
+        Batch.CmdBuffer.MemoryBarrier(VK_ACCESS_HOST_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_HOST_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    }
+
+    Callback(Batch.CmdBuffer, Batch.StagingBuffer, Offset, Batch.pStagingData + Offset);
+    Batch.Offset = Offset + Size;
+
+    return true;
+}
+
+void RenderDeviceVkImpl::SubmitInitialDataUploadBatch(SoftwareQueueIndex CommandQueueId, InitialDataUploadBatch& Batch)
+{
+    VERIFY_EXPR(Batch.StagingBuffer != VK_NULL_HANDLE);
+
+    Batch.CmdBuffer.FlushBarriers();
+    // All uploads in the batch share the fence value of this submission
+    ExecuteAndDisposeTransientCmdBuff(CommandQueueId, Batch.CmdBuffer.GetVkCmdBuffer(), std::move(Batch.CmdPool));
+    Batch.CmdBuffer.Reset();
+
+    // Staging resources are moved to the release queue by the next command buffer submitted to the queue,
+    // which always completes after the batch (see comments in BufferVkImpl::BufferVkImpl).
+    SafeReleaseDeviceObject(std::move(Batch.StagingBuffer), Uint64{1} << Uint64{CommandQueueId});
+    SafeReleaseDeviceObject(std::move(Batch.StagingMemory), Uint64{1} << Uint64{CommandQueueId});
+
+    Batch.pStagingData = nullptr;
+    Batch.Offset       = 0;
+}
+
+void RenderDeviceVkImpl::FlushInitialDataUploads(SoftwareQueueIndex CommandQueueId)
+{
+    if (m_InitialDataUploadBatches.empty())
+        return;
+
+    VERIFY_EXPR(CommandQueueId < m_InitialDataUploadBatches.size());
+    auto& Batch = *m_InitialDataUploadBatches[CommandQueueId];
+
+    std::lock_guard<std::mutex> Lock{Batch.Mtx};
+    if (Batch.StagingBuffer != VK_NULL_HANDLE)
+        SubmitInitialDataUploadBatch(CommandQueueId, Batch);
+}
+
+void RenderDeviceVkImpl::FlushAllInitialDataUploads()
+{
+    for (Uint32 q = 0; q < m_InitialDataUploadBatches.size(); ++q)
+        FlushInitialDataUploads(SoftwareQueueIndex{q});
+}
+
 void RenderDeviceVkImpl::SubmitCommandBuffer(SoftwareQueueIndex                                          CommandQueueId,
                                              const VkSubmitInfo&                                         SubmitInfo,
                                              Uint64&                                                     SubmittedCmdBuffNumber, // Number of the submitted command buffer
@@ -397,6 +509,12 @@ void RenderDeviceVkImpl::SubmitCommandBuffer(SoftwareQueueIndex
                                              std::vector<std::pair<Uint64, RefCntAutoPtr<FenceVkImpl>>>* pSignalFences           // List of fences to signal
 )
 {
+    // Pending initial data uploads must be executed before any command that may use the resources.
+    // A resource may be used by any queue in its immediate context mask, while its upload is
+    // recorded into the batch of one queue only, so flush the batches of all queues. This matches
+    // the non-batched path, where the upload is submitted when the resource is created.
+    FlushAllInitialDataUploads();
+
     // Submit the command list to the queue
     auto CmbBuffInfo       = TRenderDeviceBase::SubmitCommandBuffer(CommandQueueId, true, SubmitInfo);
     SubmittedFenceValue    = CmbBuffInfo.FenceValue;
@@ -431,6 +549,8 @@ Uint64 RenderDeviceVkImpl::ExecuteCommandBuffer(SoftwareQueueIndex CommandQueueI
 
 void RenderDeviceVkImpl::IdleGPU()
 {
+    FlushAllInitialDataUploads();
+
     IdleAllCommandQueues(true);
     m_LogicalVkDevice->WaitIdle();
     ReleaseStaleResources();
@@ -692,6 +812,58 @@ void RenderDeviceVkImpl::CreateFenceFromVulkanResource(VkSemaphore      vkTimeli
     CreateFenceImpl(ppFence, Desc, vkTimelineSemaphore);
 }
 
+MemoryBudgetVk RenderDeviceVkImpl::GetMemoryBudget()
+{
+    m_MemoryMgr.UpdateMemoryBudget();
+
+    const auto& MemoryProps = m_PhysicalDevice->GetMemoryProperties();
+
+    MemoryBudgetVk Budget;
+    Budget.NumHeaps               = MemoryProps.memoryHeapCount;
+    Budget.BudgetExtensionEnabled = m_LogicalVkDevice->GetEnabledExtFeatures().MemoryBudget;
+    for (Uint32 HeapIdx = 0; HeapIdx < MemoryProps.memoryHeapCount; ++HeapIdx)
+    {
+        const auto HeapBudget = m_MemoryMgr.GetHeapBudget(HeapIdx);
+
+        auto& Heap             = Budget.Heaps[HeapIdx];
+        Heap.Size              = MemoryProps.memoryHeaps[HeapIdx].size;
+        Heap.Flags             = MemoryProps.memoryHeaps[HeapIdx].flags;
+        Heap.Budget            = HeapBudget.Budget;
+        Heap.Usage             = HeapBudget.Usage;
+        Heap.AllocatedByEngine = HeapBudget.AllocatedSize;
+        Heap.UnderPressure     = HeapBudget.UnderPressure;
+    }
+
+    const auto Stats = m_MemoryMgr.GetMemoryStats();
+
+    Budget.DeviceLocalUsedSize          = Stats.UsedSize[0];
+    Budget.DeviceLocalPeakUsedSize      = Stats.PeakUsedSize[0];
+    Budget.DeviceLocalAllocatedSize     = Stats.AllocatedSize[0];
+    Budget.DeviceLocalPeakAllocatedSize = Stats.PeakAllocatedSize[0];
+    Budget.HostVisibleUsedSize          = Stats.UsedSize[1];
+    Budget.HostVisiblePeakUsedSize      = Stats.PeakUsedSize[1];
+    Budget.HostVisibleAllocatedSize     = Stats.AllocatedSize[1];
+    Budget.HostVisiblePeakAllocatedSize = Stats.PeakAllocatedSize[1];
+
+    return Budget;
+}
+
+Bool RenderDeviceVkImpl::SavePipelineCache()
+{
+    if (!m_pPipelineCacheMgr)
+    {
+        LOG_WARNING_MESSAGE("Device pipeline cache is not enabled. Set EngineVkCreateInfo::PipelineCacheDirectory to enable it.");
+        return False;
+    }
+
+    return m_pPipelineCacheMgr->Save();
+}
+
+PipelineCacheStatsVk RenderDeviceVkImpl::GetPipelineCacheStats()
+{
+    return m_pPipelineCacheMgr ? m_pPipelineCacheMgr->GetStats() : PipelineCacheStatsVk{};
+}
+
 void RenderDeviceVkImpl::CreateTLAS(const TopLevelASDesc& Desc,
                                     ITopLevelAS**         ppTLAS)
 {
@@ -46,7 +46,7 @@ size_t ShaderResourceCacheVk::GetRequiredMemorySize(Uint32 NumSets, const Uint32
     Uint32 TotalResources = 0;
     for (Uint32 t = 0; t < NumSets; ++t)
         TotalResources += SetSizes[t];
-    size_t MemorySize = NumSets * sizeof(DescriptorSet) + TotalResources * sizeof(Resource);
+    size_t MemorySize = NumSets * sizeof(DescriptorSet) + TotalResources * (sizeof(Resource) + sizeof(DescriptorData));
     return MemorySize;
 }
 
@@ -59,7 +59,7 @@ void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator, Uint3
     //  m_pMemory
     //  |
     //  V
-    // ||  DescriptorSet[0]  |   ....    |  DescriptorSet[Ns-1]  |  Res[0]  |  ... |  Res[n-1]  |    ....     | Res[0]  |  ... |  Res[m-1]  ||
+    // ||  DescriptorSet[0]  |   ....    |  DescriptorSet[Ns-1]  |  Res[0]  |  ... |  Res[n-1]  |    ....     | Res[0]  |  ... |  Res[m-1]  |  Data[0]  |  ... |  Data[n+m-1]  ||
     //
     //
     //  Ns = m_NumSets
@@ -74,7 +74,7 @@ void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator, Uint3
         m_TotalResources += SetSizes[t];
     }
 
-    const auto MemorySize = NumSets * sizeof(DescriptorSet) + m_TotalResources * sizeof(Resource);
+    const auto MemorySize = NumSets * sizeof(DescriptorSet) + m_TotalResources * (sizeof(Resource) + sizeof(DescriptorData));
     VERIFY_EXPR(MemorySize == GetRequiredMemorySize(NumSets, SetSizes));
 #ifdef DILIGENT_DEBUG
     m_DbgInitializedResources.resize(m_NumSets);
@@ -86,17 +86,20 @@ void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator, Uint3
             STDDeleter<void, IMemoryAllocator>(MemAllocator) //
         };
 
-        DescriptorSet* pSets       = reinterpret_cast<DescriptorSet*>(m_pMemory.get());
-        Resource*      pCurrResPtr = reinterpret_cast<Resource*>(pSets + m_NumSets);
+        DescriptorSet*  pSets        = reinterpret_cast<DescriptorSet*>(m_pMemory.get());
+        Resource*       pCurrResPtr  = reinterpret_cast<Resource*>(pSets + m_NumSets);
+        DescriptorData* pCurrDataPtr = reinterpret_cast<DescriptorData*>(pCurrResPtr + m_TotalResources);
+        static_assert(alignof(DescriptorData) <= alignof(Resource), "Descriptor data may be misaligned");
         for (Uint32 t = 0; t < NumSets; ++t)
         {
-            new (&GetDescriptorSet(t)) DescriptorSet{SetSizes[t], SetSizes[t] > 0 ? pCurrResPtr : nullptr};
+            new (&GetDescriptorSet(t)) DescriptorSet{SetSizes[t], SetSizes[t] > 0 ? pCurrResPtr : nullptr, SetSizes[t] > 0 ? pCurrDataPtr : nullptr};
             pCurrResPtr += SetSizes[t];
+            pCurrDataPtr += SetSizes[t];
 #ifdef DILIGENT_DEBUG
             m_DbgInitializedResources[t].resize(SetSizes[t]);
 #endif
         }
-        VERIFY_EXPR((char*)pCurrResPtr == (char*)m_pMemory.get() + MemorySize);
+        VERIFY_EXPR((char*)pCurrDataPtr == (char*)m_pMemory.get() + MemorySize);
     }
 }
 
@@ -288,6 +291,122 @@ void ShaderResourceCacheVk::Resource::SetStorageBuffer(RefCntAutoPtr<IDeviceObje
 #endif
 }
 
+static void WriteDescriptorData(const ShaderResourceCacheVk::Resource& Res, ShaderResourceCacheVk::DescriptorData& Data)
+{
+    VERIFY_EXPR(!Res.IsNull());
+
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (Res.Type)
+    {
+        case DescriptorType::Sampler:
+            // Immutable samplers are permanently bound into the set layout and are never assigned to the cache
+            Data.ImageInfo = Res.GetSamplerDescriptorWriteInfo();
+            break;
+
+        case DescriptorType::CombinedImageSampler:
+        case DescriptorType::SeparateImage:
+        case DescriptorType::StorageImage:
+            Data.ImageInfo = Res.GetImageDescriptorWriteInfo();
+            break;
+
+        case DescriptorType::UniformTexelBuffer:
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:
+            Data.BufferView = Res.GetBufferViewWriteInfo();
+            break;
+
+        case DescriptorType::UniformBuffer:
+        case DescriptorType::UniformBufferDynamic:
+            Data.BufferInfo = Res.GetUniformBufferDescriptorWriteInfo();
+            break;
+
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBuffer_ReadOnly:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBufferDynamic_ReadOnly:
+            Data.BufferInfo = Res.GetStorageBufferDescriptorWriteInfo();
+            break;
+
+        case DescriptorType::InputAttachment:
+        case DescriptorType::InputAttachment_General:
+            Data.ImageInfo = Res.GetInputAttachmentDescriptorWriteInfo();
+            break;
+
+        case DescriptorType::AccelerationStructure:
+            Data.AccelStruct = *Res.pObject.ConstPtr<TopLevelASVkImpl>()->GetVkTLASPtr();
+            break;
+
+        default:
+            UNEXPECTED("Unexpected descriptor type");
+    }
+}
+
+static void WriteDescriptor(const VulkanUtilities::VulkanLogicalDevice&  LogicalDevice,
+                            VkDescriptorSet                              vkSet,
+                            Uint32                                       BindingIndex,
+                            Uint32                                       ArrayIndex,
+                            DescriptorType                               Type,
+                            const ShaderResourceCacheVk::DescriptorData& Data)
+{
+    VkWriteDescriptorSet WriteDescrSet;
+    WriteDescrSet.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    WriteDescrSet.pNext           = nullptr;
+    WriteDescrSet.dstSet          = vkSet;
+    WriteDescrSet.dstBinding      = BindingIndex;
+    WriteDescrSet.dstArrayElement = ArrayIndex;
+    WriteDescrSet.descriptorCount = 1;
+    // descriptorType must be the same type as that specified in VkDescriptorSetLayoutBinding for dstSet at dstBinding.
+    // The type of the descriptor also controls which array the descriptors are taken from. (13.2.4)
+    WriteDescrSet.descriptorType   = DescriptorTypeToVkDescriptorType(Type);
+    WriteDescrSet.pImageInfo       = nullptr;
+    WriteDescrSet.pBufferInfo      = nullptr;
+    WriteDescrSet.pTexelBufferView = nullptr;
+
+    // Do not zero-initialize!
+    VkWriteDescriptorSetAccelerationStructureKHR vkDescrAccelStructInfo;
+
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (Type)
+    {
+        case DescriptorType::Sampler:
+        case DescriptorType::CombinedImageSampler:
+        case DescriptorType::SeparateImage:
+        case DescriptorType::StorageImage:
+        case DescriptorType::InputAttachment:
+        case DescriptorType::InputAttachment_General:
+            WriteDescrSet.pImageInfo = &Data.ImageInfo;
+            break;
+
+        case DescriptorType::UniformTexelBuffer:
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:
+            WriteDescrSet.pTexelBufferView = &Data.BufferView;
+            break;
+
+        case DescriptorType::UniformBuffer:
+        case DescriptorType::UniformBufferDynamic:
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBuffer_ReadOnly:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBufferDynamic_ReadOnly:
+            WriteDescrSet.pBufferInfo = &Data.BufferInfo;
+            break;
+
+        case DescriptorType::AccelerationStructure:
+            vkDescrAccelStructInfo.sType                      = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR;
+            vkDescrAccelStructInfo.pNext                      = nullptr;
+            vkDescrAccelStructInfo.accelerationStructureCount = 1;
+            vkDescrAccelStructInfo.pAccelerationStructures    = &Data.AccelStruct;
+            WriteDescrSet.pNext                               = &vkDescrAccelStructInfo;
+            break;
+
+        default:
+            UNEXPECTED("Unexpected descriptor type");
+    }
+
+    LogicalDevice.UpdateDescriptorSets(1, &WriteDescrSet, 0, nullptr);
+}
+
 const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
     const VulkanUtilities::VulkanLogicalDevice* pLogicalDevice,
     Uint32                                      DescrSetIndex,
@@ -303,6 +422,12 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
         --m_NumDynamicBuffers;
     }
 
+    if (DstRes)
+    {
+        VERIFY(DescrSet.m_NumBoundResources > 0, "Bound resources counter must be greater than zero when there is at least one resource bound in the set");
+        --DescrSet.m_NumBoundResources;
+    }
+
     static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
     switch (DstRes.Type)
     {
@@ -328,86 +453,20 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
         ++m_NumDynamicBuffers;
     }
 
-    VkDescriptorSet vkSet = DescrSet.GetVkDescriptorSet();
-    if (vkSet != VK_NULL_HANDLE && DstRes.pObject)
+    if (DstRes)
     {
-        VERIFY(pLogicalDevice != nullptr, "Logical device must not be null to write descriptor to a non-null set");
-
-        VkWriteDescriptorSet WriteDescrSet;
-        WriteDescrSet.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-        WriteDescrSet.pNext           = nullptr;
-        WriteDescrSet.dstSet          = vkSet;
-        WriteDescrSet.dstBinding      = SrcRes.BindingIndex;
-        WriteDescrSet.dstArrayElement = SrcRes.ArrayIndex;
-        WriteDescrSet.descriptorCount = 1;
-        // descriptorType must be the same type as that specified in VkDescriptorSetLayoutBinding for dstSet at dstBinding.
-        // The type of the descriptor also controls which array the descriptors are taken from. (13.2.4)
-        WriteDescrSet.descriptorType   = DescriptorTypeToVkDescriptorType(DstRes.Type);
-        WriteDescrSet.pImageInfo       = nullptr;
-        WriteDescrSet.pBufferInfo      = nullptr;
-        WriteDescrSet.pTexelBufferView = nullptr;
+        ++DescrSet.m_NumBoundResources;
 
-        // Do not zero-initialize!
-        union
+        // Static resource caches have no descriptor sets, so there is no need to keep the descriptor data
+        if (GetContentType() == ResourceCacheContentType::SRB)
         {
-            VkDescriptorImageInfo                        vkDescrImageInfo;
-            VkDescriptorBufferInfo                       vkDescrBufferInfo;
-            VkBufferView                                 vkDescrBufferView;
-            VkWriteDescriptorSetAccelerationStructureKHR vkDescrAccelStructInfo;
-        };
-
-        static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
-        switch (DstRes.Type)
-        {
-            case DescriptorType::Sampler:
-                vkDescrImageInfo         = DstRes.GetSamplerDescriptorWriteInfo();
-                WriteDescrSet.pImageInfo = &vkDescrImageInfo;
-                break;
-
-            case DescriptorType::CombinedImageSampler:
-            case DescriptorType::SeparateImage:
-            case DescriptorType::StorageImage:
-                vkDescrImageInfo         = DstRes.GetImageDescriptorWriteInfo();
-                WriteDescrSet.pImageInfo = &vkDescrImageInfo;
-                break;
-
-            case DescriptorType::UniformTexelBuffer:
-            case DescriptorType::StorageTexelBuffer:
-            case DescriptorType::StorageTexelBuffer_ReadOnly:
-                vkDescrBufferView              = DstRes.GetBufferViewWriteInfo();
-                WriteDescrSet.pTexelBufferView = &vkDescrBufferView;
-                break;
-
-            case DescriptorType::UniformBuffer:
-            case DescriptorType::UniformBufferDynamic:
-                vkDescrBufferInfo         = DstRes.GetUniformBufferDescriptorWriteInfo();
-                WriteDescrSet.pBufferInfo = &vkDescrBufferInfo;
-                break;
+            DescriptorData& DstData = DescrSet.m_pDescriptorData[CacheOffset];
+            WriteDescriptorData(DstRes, DstData);
 
-            case DescriptorType::StorageBuffer:
-            case DescriptorType::StorageBuffer_ReadOnly:
-            case DescriptorType::StorageBufferDynamic:
-            case DescriptorType::StorageBufferDynamic_ReadOnly:
-                vkDescrBufferInfo         = DstRes.GetStorageBufferDescriptorWriteInfo();
-                WriteDescrSet.pBufferInfo = &vkDescrBufferInfo;
-                break;
-
-            case DescriptorType::InputAttachment:
-            case DescriptorType::InputAttachment_General:
-                vkDescrImageInfo         = DstRes.GetInputAttachmentDescriptorWriteInfo();
-                WriteDescrSet.pImageInfo = &vkDescrImageInfo;
-                break;
-
-            case DescriptorType::AccelerationStructure:
-                vkDescrAccelStructInfo = DstRes.GetAccelerationStructureWriteInfo();
-                WriteDescrSet.pNext    = &vkDescrAccelStructInfo;
-                break;
-
-            default:
-                UNEXPECTED("Unexpected descriptor type");
+            VkDescriptorSet vkSet = DescrSet.GetVkDescriptorSet();
+            if (vkSet != VK_NULL_HANDLE && pLogicalDevice != nullptr)
+                WriteDescriptor(*pLogicalDevice, vkSet, SrcRes.BindingIndex, SrcRes.ArrayIndex, DstRes.Type, DstData);
         }
-
-        pLogicalDevice->UpdateDescriptorSets(1, &WriteDescrSet, 0, nullptr);
     }
 
     UpdateRevision();
@@ -433,6 +492,28 @@ void ShaderResourceCacheVk::SetDynamicBufferOffset(Uint32 DescrSetIndex,
     DstRes.BufferDynamicOffset = DynamicBufferOffset;
 }
 
+void ShaderResourceCacheVk::UpdateCombinedSamplers(Uint32 DescrSetIndex,
+                                                   Uint32 CacheOffset,
+                                                   Uint32 ArraySize) const
+{
+    VERIFY_EXPR(GetContentType() == ResourceCacheContentType::SRB);
+
+    const DescriptorSet& DescrSet = GetDescriptorSet(DescrSetIndex);
+    for (Uint32 Elem = 0; Elem < ArraySize; ++Elem)
+    {
+        const Resource& Res = DescrSet.GetResource(CacheOffset + Elem);
+        VERIFY(Res.Type == DescriptorType::CombinedImageSampler && !Res.HasImmutableSampler,
+               "Combined image sampler without immutable sampler is expected");
+        if (!Res.pObject)
+            continue;
+
+        const SamplerVkImpl* pSamplerVk = Res.pObject.ConstPtr<TextureViewVkImpl>()->GetSampler<const SamplerVkImpl>();
+
+        DescriptorData& Data   = DescrSet.m_pDescriptorData[CacheOffset + Elem];
+        Data.ImageInfo.sampler = pSamplerVk != nullptr ? pSamplerVk->GetVkSampler() : VK_NULL_HANDLE;
+    }
+}
+
 
 namespace
 {
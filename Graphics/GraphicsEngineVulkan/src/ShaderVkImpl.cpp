@@ -164,6 +164,7 @@ std::vector<uint32_t> CompileShaderGLSLang(const ShaderCreateInfo&         Shade
 void ShaderVkImpl::Initialize(const ShaderCreateInfo& ShaderCI,
                               const CreateInfo&       VkShaderCI)
 {
+    SerializedData SerializedResources;
     if (ShaderCI.Source != nullptr || ShaderCI.FilePath != nullptr)
     {
         DEV_CHECK_ERR(ShaderCI.ByteCode == nullptr, "'ByteCode' must be null when shader is created from source code or a file");
@@ -203,8 +204,10 @@ void ShaderVkImpl::Initialize(const ShaderCreateInfo& ShaderCI,
     {
         DEV_CHECK_ERR(ShaderCI.ByteCodeSize != 0, "ByteCodeSize must not be 0");
         DEV_CHECK_ERR(ShaderCI.ByteCodeSize % 4 == 0, "Byte code size (", ShaderCI.ByteCodeSize, ") is not multiple of 4");
-        m_SPIRV.resize(ShaderCI.ByteCodeSize / 4);
-        memcpy(m_SPIRV.data(), ShaderCI.ByteCode, ShaderCI.ByteCodeSize);
+        // Byte code unpacked from an archive may be followed by the serialized shader resources
+        const auto SPIRVSize = SPIRVShaderResources::ExtractSerializedResources(ShaderCI.ByteCode, ShaderCI.ByteCodeSize, SerializedResources);
+        m_SPIRV.resize(SPIRVSize / 4);
+        memcpy(m_SPIRV.data(), ShaderCI.ByteCode, SPIRVSize);
     }
     else
     {
@@ -225,17 +228,45 @@ void ShaderVkImpl::Initialize(const ShaderCreateInfo& ShaderCI,
                 ALLOCATE(Allocator, "Memory for SPIRVShaderResources", SPIRVShaderResources, 1),
                 STDDeleterRawMem<void>(Allocator),
             };
-            auto LoadShaderInputs = m_Desc.ShaderType == SHADER_TYPE_VERTEX;
-            new (pRawMem.get()) SPIRVShaderResources // May throw
+            auto LoadShaderInputs      = m_Desc.ShaderType == SHADER_TYPE_VERTEX;
+            auto CombinedSamplerSuffix = m_Desc.UseCombinedTextureSamplers ? m_Desc.CombinedSamplerSuffix : nullptr;
+
+            bool ResourcesRestored = false;
+            // Uniform buffer reflection is not serialized, so SPIRV-Cross is required to load it
+            if (SerializedResources && !ShaderCI.LoadConstantBufferReflection)
+            {
+                try
+                {
+                    new (pRawMem.get()) SPIRVShaderResources //
+                        {
+                            Allocator,
+                            SerializedResources,
+                            m_Desc,
+                            CombinedSamplerSuffix,
+                            m_EntryPoint //
+                        };
+                    ResourcesRestored = true;
+                }
+                catch (...)
                 {
-                    Allocator,
-                    m_SPIRV,
-                    m_Desc,
-                    m_Desc.UseCombinedTextureSamplers ? m_Desc.CombinedSamplerSuffix : nullptr,
-                    LoadShaderInputs,
-                    ShaderCI.LoadConstantBufferReflection,
-                    m_EntryPoint //
-                };
+                    LOG_WARNING_MESSAGE("Failed to restore serialized resources of shader '", m_Desc.Name, "'. Resources will be loaded from the SPIR-V byte code.");
+                    m_EntryPoint.clear();
+                }
+            }
+
+            if (!ResourcesRestored)
+            {
+                new (pRawMem.get()) SPIRVShaderResources // May throw
+                    {
+                        Allocator,
+                        m_SPIRV,
+                        m_Desc,
+                        CombinedSamplerSuffix,
+                        LoadShaderInputs,
+                        ShaderCI.LoadConstantBufferReflection,
+                        m_EntryPoint //
+                    };
+            }
             VERIFY_EXPR(ShaderCI.ByteCode != nullptr || m_EntryPoint == ShaderCI.EntryPoint);
             m_pShaderResources.reset(static_cast<SPIRVShaderResources*>(pRawMem.release()), STDDeleterRawMem<SPIRVShaderResources>(Allocator));
 
@@ -347,4 +378,98 @@ const ShaderCodeBufferDesc* ShaderVkImpl::GetConstantBufferDesc(Uint32 Index) co
     return m_pShaderResources->GetUniformBufferDesc(Index);
 }
 
+bool ShaderVkImpl::HasReflectionToStrip() const
+{
+    return !m_SPIRV.empty() && m_pShaderResources && HasSPIRVReflectionInstructions(m_SPIRV);
+}
+
+void ShaderVkImpl::InitStrippedSPIRV(std::vector<uint32_t>&& StrippedSPIRV) const
+{
+    if (StrippedSPIRV.empty())
+    {
+        LOG_ERROR("Failed to strip reflection information from shader '", m_Desc.Name, "'. This may indicate a problem with the byte code.");
+        return;
+    }
+
+    // Stripping does not renumber ids, so the resource variables can be found
+    // in the stripped code by the targets of their original decorations.
+    std::vector<uint32_t> ResourceIds(m_pShaderResources->GetTotalResources());
+    m_pShaderResources->ProcessResources(
+        [&](const SPIRVShaderResourceAttribs& Attribs, Uint32 Index) //
+        {
+            VERIFY_EXPR(Attribs.BindingDecorationOffset >= 2 && Attribs.BindingDecorationOffset < m_SPIRV.size());
+            // OpDecorate | Target | Decoration | Literal
+            ResourceIds[Index] = m_SPIRV[Attribs.BindingDecorationOffset - 2];
+        });
+
+    auto ResourceOffsets = FindResourceDecorationOffsets(StrippedSPIRV, ResourceIds);
+    for (size_t i = 0; i < ResourceOffsets.size(); ++i)
+    {
+        if (ResourceOffsets[i].Binding == 0 || ResourceOffsets[i].DescriptorSet == 0)
+        {
+            LOG_ERROR("Unable to find decorations of resource '", m_pShaderResources->GetResource(static_cast<Uint32>(i)).Name,
+                      "' in the stripped code of shader '", m_Desc.Name, "'.");
+            return;
+        }
+    }
+
+    m_pStrippedSPIRV = std::make_unique<const StrippedSPIRVInfo>(StrippedSPIRVInfo{std::move(StrippedSPIRV), std::move(ResourceOffsets)});
+}
+
+const ShaderVkImpl::StrippedSPIRVInfo* ShaderVkImpl::GetStrippedSPIRV() const
+{
+    DEV_CHECK_ERR(!IsCompiling(), "Shader byte code is not available until the shader is compiled. Use GetStatus() to check the shader status.");
+
+    std::call_once(m_StrippedSPIRVFlag, [this]() {
+#if !DILIGENT_NO_HLSL
+        // NB: SPIRV offsets become INVALID after this operation.
+        if (HasReflectionToStrip())
+            InitStrippedSPIRV(OptimizeSPIRV(m_SPIRV, SPV_ENV_MAX, SPIRV_OPTIMIZATION_FLAG_STRIP_REFLECTION));
+#endif
+        m_StrippedSPIRVReady.store(true);
+    });
+
+    return m_pStrippedSPIRV.get();
+}
+
+void ShaderVkImpl::StripReflection(const ShaderVkImpl* const* ppShaders, size_t NumShaders, IThreadPool* pThreadPool)
+{
+#if !DILIGENT_NO_HLSL
+    std::vector<const ShaderVkImpl*> Shaders;
+    std::vector<SPIRVBatchItem>      Items;
+    for (size_t i = 0; i < NumShaders; ++i)
+    {
+        const auto* pShader = ppShaders[i];
+        if (pShader == nullptr || pShader->m_StrippedSPIRVReady.load())
+            continue;
+
+        DEV_CHECK_ERR(!pShader->IsCompiling(), "Shader byte code is not available until the shader is compiled. Use GetStatus() to check the shader status.");
+        if (!pShader->HasReflectionToStrip())
+            continue;
+
+        SPIRVBatchItem Item;
+        Item.pSrcSPIRV = &pShader->m_SPIRV;
+        Item.Passes    = SPIRV_OPTIMIZATION_FLAG_STRIP_REFLECTION;
+        Items.emplace_back(std::move(Item));
+        Shaders.emplace_back(pShader);
+    }
+
+    if (Items.empty())
+        return;
+
+    OptimizeSPIRVBatch(Items.data(), Items.size(), pThreadPool);
+
+    for (size_t i = 0; i < Shaders.size(); ++i)
+    {
+        const auto* pShader = Shaders[i];
+        // The code may have been stripped by another thread in the meantime, in which case
+        // the result is discarded.
+        std::call_once(pShader->m_StrippedSPIRVFlag, [&]() {
+            pShader->InitStrippedSPIRV(std::move(Items[i].SPIRV));
+            pShader->m_StrippedSPIRVReady.store(true);
+        });
+    }
+#endif
+}
+
 } // namespace Diligent
@@ -209,11 +209,24 @@ TextureVkImpl::TextureVkImpl(IReferenceCounters*        pRefCounters,
         {
             m_VulkanImage = LogicalDevice.CreateImage(ImageCI, m_Desc.Name);
 
-            VkMemoryRequirements MemReqs = LogicalDevice.GetImageMemoryRequirements(m_VulkanImage);
+            bool                 PrefersDedicatedAllocation = false;
+            VkMemoryRequirements MemReqs                    = LogicalDevice.GetImageMemoryRequirements(m_VulkanImage, PrefersDedicatedAllocation);
 
             const auto ImageMemoryFlags = IsMemoryless ? VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT : VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
             VERIFY(IsPowerOfTwo(MemReqs.alignment), "Alignment is not power of 2!");
-            m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs, ImageMemoryFlags);
+            if (!IsMemoryless && pRenderDeviceVk->GetGlobalMemoryManager().ShouldUseDedicatedAllocation(MemReqs.size, PrefersDedicatedAllocation))
+            {
+                // Large render targets and textures get their own memory objects, which lets the driver
+                // optimize their placement and avoids fragmenting the shared pages.
+                VkMemoryDedicatedAllocateInfo DedicatedAllocInfo{};
+                DedicatedAllocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+                DedicatedAllocInfo.image = m_VulkanImage;
+                m_MemoryAllocation       = pRenderDeviceVk->AllocateDedicatedMemory(MemReqs, ImageMemoryFlags, DedicatedAllocInfo);
+            }
+            else
+            {
+                m_MemoryAllocation = pRenderDeviceVk->AllocateMemory(MemReqs, ImageMemoryFlags);
+            }
             if (!m_MemoryAllocation)
                 LOG_ERROR_AND_THROW("Failed to allocate memory for texture '", m_Desc.Name, "'.");
 
@@ -251,13 +264,6 @@ void TextureVkImpl::InitializeTextureContent(const TextureData&          InitDat
         ClassPtrCast<DeviceContextVkImpl>(InitData.pContext)->GetCommandQueueId() :
         SoftwareQueueIndex{PlatformMisc::GetLSB(m_Desc.ImmediateContextMask)};
 
-    // Vulkan validation layers do not like uninitialized memory, so if no initial data
-    // is provided, we will clear the memory
-
-    VulkanUtilities::CommandPoolWrapper  CmdPool;
-    VulkanUtilities::VulkanCommandBuffer CmdBuffer;
-    GetDevice()->AllocateTransientCmdPool(CmdQueueInd, CmdPool, CmdBuffer, "Transient command pool to copy staging data to a device buffer");
-
     VkImageAspectFlags aspectMask = 0;
     if (FmtAttribs.ComponentType == COMPONENT_TYPE_DEPTH)
         aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
@@ -271,18 +277,6 @@ void TextureVkImpl::InitializeTextureContent(const TextureData&          InitDat
     else
         aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
 
-    // For either clear or copy command, dst layout must be VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
-    VkImageSubresourceRange SubresRange;
-    SubresRange.aspectMask     = aspectMask;
-    SubresRange.baseArrayLayer = 0;
-    SubresRange.layerCount     = VK_REMAINING_ARRAY_LAYERS;
-    SubresRange.baseMipLevel   = 0;
-    SubresRange.levelCount     = VK_REMAINING_MIP_LEVELS;
-    CmdBuffer.TransitionImageLayout(m_VulkanImage, ImageCI.initialLayout, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, SubresRange, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
-    SetState(RESOURCE_STATE_COPY_DEST);
-    const auto CurrentLayout = GetLayout();
-    VERIFY_EXPR(CurrentLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-
     Uint32 ExpectedNumSubresources = ImageCI.mipLevels * ImageCI.arrayLayers;
     if (InitData.NumSubresources != ExpectedNumSubresources)
         LOG_ERROR_AND_THROW("Incorrect number of subresources in init data. ", ExpectedNumSubresources, " expected, while ", InitData.NumSubresources, " provided");
@@ -331,6 +325,69 @@ void TextureVkImpl::InitializeTextureContent(const TextureData&          InitDat
     }
     VERIFY_EXPR(subres == InitData.NumSubresources);
 
+    // Writes subresource data to the staging memory and records the copy commands.
+    // Offsets of all regions are relative to StagingOffset.
+    auto RecordUpload = [&](VulkanUtilities::VulkanCommandBuffer& CmdBuffer, VkBuffer vkStagingBuffer, VkDeviceSize StagingOffset, Uint8* pStagingData) {
+        // For either clear or copy command, dst layout must be VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL
+        VkImageSubresourceRange SubresRange;
+        SubresRange.aspectMask     = aspectMask;
+        SubresRange.baseArrayLayer = 0;
+        SubresRange.layerCount     = VK_REMAINING_ARRAY_LAYERS;
+        SubresRange.baseMipLevel   = 0;
+        SubresRange.levelCount     = VK_REMAINING_MIP_LEVELS;
+        CmdBuffer.TransitionImageLayout(m_VulkanImage, ImageCI.initialLayout, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, SubresRange, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+        subres = 0;
+        for (Uint32 layer = 0; layer < ImageCI.arrayLayers; ++layer)
+        {
+            for (Uint32 mip = 0; mip < ImageCI.mipLevels; ++mip)
+            {
+                const auto& SubResData = InitData.pSubResources[subres];
+                auto&       CopyRegion = Regions[subres];
+
+                auto MipInfo = GetMipLevelProperties(m_Desc, mip);
+
+                VERIFY_EXPR(MipInfo.LogicalWidth == CopyRegion.imageExtent.width);
+                VERIFY_EXPR(MipInfo.LogicalHeight == CopyRegion.imageExtent.height);
+                VERIFY_EXPR(MipInfo.Depth == CopyRegion.imageExtent.depth);
+
+                for (Uint32 z = 0; z < MipInfo.Depth; ++z)
+                {
+                    for (Uint32 y = 0; y < MipInfo.StorageHeight; y += FmtAttribs.BlockHeight)
+                    {
+                        memcpy(pStagingData + CopyRegion.bufferOffset + ((y + z * MipInfo.StorageHeight) / FmtAttribs.BlockHeight) * MipInfo.RowSize,
+                               // SubResData.Stride must be the stride of one row of compressed blocks
+                               reinterpret_cast<const uint8_t*>(SubResData.pData) + (y / FmtAttribs.BlockHeight) * SubResData.Stride + z * SubResData.DepthStride,
+                               StaticCast<size_t>(MipInfo.RowSize));
+                    }
+                }
+
+                CopyRegion.bufferOffset += StagingOffset;
+                ++subres;
+            }
+        }
+        VERIFY_EXPR(subres == InitData.NumSubresources);
+
+        // Copy commands MUST be recorded outside of a render pass instance. This is OK here
+        // as the command buffer only contains copy commands
+        CmdBuffer.CopyBufferToImage(vkStagingBuffer, m_VulkanImage,
+                                    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, // dstImageLayout must be VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL or VK_IMAGE_LAYOUT_GENERAL (18.4)
+                                    static_cast<uint32_t>(Regions.size()), Regions.data());
+    };
+
+    SetState(RESOURCE_STATE_COPY_DEST);
+    VERIFY_EXPR(GetLayout() == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+    // Staging offset must be a multiple of 4 as well as of the texel block size (18.4).
+    // Note that the texel size is not necessarily a power of two (e.g. 12 bytes for RGB32 formats).
+    const VkDeviceSize ElementSize      = std::max(FmtAttribs.GetElementSize(), Uint32{1});
+    VkDeviceSize       StagingAlignment = ElementSize;
+    while (StagingAlignment % 4 != 0)
+        StagingAlignment += ElementSize;
+
+    if (GetDevice()->EnqueueInitialDataUpload(CmdQueueInd, uploadBufferSize, StagingAlignment, RecordUpload))
+        return;
+
     VkBufferCreateInfo VkStagingBuffCI    = {};
     VkStagingBuffCI.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
     VkStagingBuffCI.pNext                 = nullptr;
@@ -363,50 +420,15 @@ void TextureVkImpl::InitializeTextureContent(const TextureData&          InitDat
     VERIFY_EXPR(StagingData != nullptr);
     StagingData += AlignedStagingMemOffset;
 
-    subres = 0;
-    for (Uint32 layer = 0; layer < ImageCI.arrayLayers; ++layer)
-    {
-        for (Uint32 mip = 0; mip < ImageCI.mipLevels; ++mip)
-        {
-            const auto& SubResData = InitData.pSubResources[subres];
-            const auto& CopyRegion = Regions[subres];
-
-            auto MipInfo = GetMipLevelProperties(m_Desc, mip);
-
-            VERIFY_EXPR(MipInfo.LogicalWidth == CopyRegion.imageExtent.width);
-            VERIFY_EXPR(MipInfo.LogicalHeight == CopyRegion.imageExtent.height);
-            VERIFY_EXPR(MipInfo.Depth == CopyRegion.imageExtent.depth);
-
-            VERIFY(SubResData.Stride == 0 || SubResData.Stride >= MipInfo.RowSize, "Stride is too small");
-            // For compressed-block formats, MipInfo.RowSize is the size of one row of blocks
-            VERIFY(SubResData.DepthStride == 0 || SubResData.DepthStride >= (MipInfo.StorageHeight / FmtAttribs.BlockHeight) * MipInfo.RowSize, "Depth stride is too small");
-
-            for (Uint32 z = 0; z < MipInfo.Depth; ++z)
-            {
-                for (Uint32 y = 0; y < MipInfo.StorageHeight; y += FmtAttribs.BlockHeight)
-                {
-                    memcpy(StagingData + CopyRegion.bufferOffset + ((y + z * MipInfo.StorageHeight) / FmtAttribs.BlockHeight) * MipInfo.RowSize,
-                           // SubResData.Stride must be the stride of one row of compressed blocks
-                           reinterpret_cast<const uint8_t*>(SubResData.pData) + (y / FmtAttribs.BlockHeight) * SubResData.Stride + z * SubResData.DepthStride,
-                           StaticCast<size_t>(MipInfo.RowSize));
-                }
-            }
-
-            ++subres;
-        }
-    }
-    VERIFY_EXPR(subres == InitData.NumSubresources);
-
     auto err = LogicalDevice.BindBufferMemory(StagingBuffer, StagingBufferMemory, AlignedStagingMemOffset);
     CHECK_VK_ERROR_AND_THROW(err, "Failed to bind staging buffer memory");
 
-    CmdBuffer.MemoryBarrier(VK_ACCESS_HOST_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_HOST_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    VulkanUtilities::CommandPoolWrapper  CmdPool;
+    VulkanUtilities::VulkanCommandBuffer CmdBuffer;
+    GetDevice()->AllocateTransientCmdPool(CmdQueueInd, CmdPool, CmdBuffer, "Transient command pool to copy staging data to a device buffer");
 
-    // Copy commands MUST be recorded outside of a render pass instance. This is OK here
-    // as copy will be the only command in the cmd buffer
-    CmdBuffer.CopyBufferToImage(StagingBuffer, m_VulkanImage,
-                                CurrentLayout, // dstImageLayout must be VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL or VK_IMAGE_LAYOUT_GENERAL (18.4)
-                                static_cast<uint32_t>(Regions.size()), Regions.data());
+    CmdBuffer.MemoryBarrier(VK_ACCESS_HOST_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_HOST_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    RecordUpload(CmdBuffer, StagingBuffer, 0, StagingData);
 
     GetDevice()->ExecuteAndDisposeTransientCmdBuff(CmdQueueInd, CmdBuffer.GetVkCmdBuffer(), std::move(CmdPool));
 
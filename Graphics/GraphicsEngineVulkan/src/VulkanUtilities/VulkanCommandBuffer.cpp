@@ -25,9 +25,11 @@
  *  of the possibility of such damages.
  */
 #include <sstream>
+#include <algorithm>
 
 #include "VulkanUtilities/VulkanCommandBuffer.hpp"
 #include "AdvancedMath.hpp"
+#include "DeviceContext.h"
 
 namespace VulkanUtilities
 {
@@ -175,10 +177,13 @@ void VulkanCommandBuffer::TransitionImageLayout(VkImage                        I
         return;
     }
 
+    // Pending barrier that the new transition can be merged with
+    VkImageMemoryBarrier* pMergeBarrier = nullptr;
+
     // Check overlapping subresources
     for (size_t i = 0; i < m_ImageBarriers.size(); ++i)
     {
-        const auto& ImgBarrier = m_ImageBarriers[i];
+        auto& ImgBarrier = m_ImageBarriers[i];
         if (ImgBarrier.image != Image)
             continue;
 
@@ -197,13 +202,72 @@ void VulkanCommandBuffer::TransitionImageLayout(VkImage                        I
         const auto SlicesOverlap = Diligent::CheckLineSectionOverlap<true>(StartLayer0, EndLayer0, StartLayer1, EndLayer1);
         const auto MipsOverlap   = Diligent::CheckLineSectionOverlap<true>(StartMip0, EndMip0, StartMip1, EndMip1);
 
-        // If the range overlaps with any of the existing barriers, we need to
-        // flush them.
         if (SlicesOverlap && MipsOverlap)
         {
+            const auto SameRange =
+                SubresRange.aspectMask == OtherRange.aspectMask &&
+                StartLayer0 == StartLayer1 && EndLayer0 == EndLayer1 &&
+                StartMip0 == StartMip1 && EndMip0 == EndMip1;
+            if (SameRange && ImgBarrier.newLayout == OldLayout)
+            {
+                // The subresources are transitioned again before any command uses them:
+                // fold both transitions into one (A -> B, B -> C  ==>  A -> C).
+                // Pending barriers never overlap, so no other barrier references these subresources.
+                m_Barrier.ImageSrcStages |= SrcStages;
+                m_Barrier.ImageDstStages |= DstStages;
+
+                ImgBarrier.newLayout     = NewLayout;
+                ImgBarrier.dstAccessMask = AccessMaskFromImageLayout(NewLayout, true) & m_Barrier.SupportedAccessMask;
+                if (m_pBarrierStats != nullptr)
+                    ++m_pBarrierStats->MergedTextureBarriers;
+                return;
+            }
+
+            // If the range overlaps with any of the existing barriers, we need to
+            // flush them.
             FlushBarriers();
+            pMergeBarrier = nullptr;
             break;
         }
+
+        if (pMergeBarrier == nullptr &&
+            ImgBarrier.oldLayout == OldLayout && ImgBarrier.newLayout == NewLayout &&
+            SubresRange.aspectMask == OtherRange.aspectMask &&
+            EndLayer0 != ~0u && EndLayer1 != ~0u && EndMip0 != ~0u && EndMip1 != ~0u)
+        {
+            // Ranges that cover the same mip levels and adjacent array slices (or vice versa)
+            // can be merged into one barrier.
+            const auto SameMips   = StartMip0 == StartMip1 && EndMip0 == EndMip1;
+            const auto SameLayers = StartLayer0 == StartLayer1 && EndLayer0 == EndLayer1;
+            if ((SameMips && (EndLayer0 == StartLayer1 || EndLayer1 == StartLayer0)) ||
+                (SameLayers && (EndMip0 == StartMip1 || EndMip1 == StartMip0)))
+            {
+                pMergeBarrier = &ImgBarrier;
+            }
+        }
+    }
+
+    if (pMergeBarrier != nullptr)
+    {
+        m_Barrier.ImageSrcStages |= SrcStages;
+        m_Barrier.ImageDstStages |= DstStages;
+
+        auto& Range = pMergeBarrier->subresourceRange;
+        if (Range.baseMipLevel == SubresRange.baseMipLevel && Range.levelCount == SubresRange.levelCount)
+        {
+            const auto EndLayer  = std::max(Range.baseArrayLayer + Range.layerCount, SubresRange.baseArrayLayer + SubresRange.layerCount);
+            Range.baseArrayLayer = std::min(Range.baseArrayLayer, SubresRange.baseArrayLayer);
+            Range.layerCount     = EndLayer - Range.baseArrayLayer;
+        }
+        else
+        {
+            const auto EndMip  = std::max(Range.baseMipLevel + Range.levelCount, SubresRange.baseMipLevel + SubresRange.levelCount);
+            Range.baseMipLevel = std::min(Range.baseMipLevel, SubresRange.baseMipLevel);
+            Range.levelCount   = EndMip - Range.baseMipLevel;
+        }
+        if (m_pBarrierStats != nullptr)
+            ++m_pBarrierStats->MergedTextureBarriers;
+        return;
     }
 
     m_Barrier.ImageSrcStages |= SrcStages;
@@ -280,6 +344,14 @@ void VulkanCommandBuffer::FlushBarriers()
                          static_cast<uint32_t>(m_ImageBarriers.size()),
                          m_ImageBarriers.empty() ? nullptr : m_ImageBarriers.data());
 
+    if (m_pBarrierStats != nullptr)
+    {
+        ++m_pBarrierStats->PipelineBarriers;
+        m_pBarrierStats->TextureBarriers += static_cast<Diligent::Uint32>(m_ImageBarriers.size());
+        if (HasMemoryBarrier)
+            ++m_pBarrierStats->MemoryBarriers;
+    }
+
     m_ImageBarriers.clear();
     m_Barrier.ImageSrcStages  = 0;
     m_Barrier.ImageDstStages  = 0;
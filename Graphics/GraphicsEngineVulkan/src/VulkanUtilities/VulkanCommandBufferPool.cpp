@@ -61,19 +61,23 @@ VulkanCommandBufferPool::~VulkanCommandBufferPool()
 
     for (auto CmdBuff : m_CmdBuffers)
         m_LogicalDevice->FreeCommandBuffer(m_CmdPool, CmdBuff);
+    for (auto CmdBuff : m_SecondaryCmdBuffers)
+        m_LogicalDevice->FreeCommandBuffer(m_CmdPool, CmdBuff);
     m_CmdPool.Release();
 }
 
-VkCommandBuffer VulkanCommandBufferPool::GetCommandBuffer(const char* DebugName)
+VkCommandBuffer VulkanCommandBufferPool::GetCommandBuffer(const char* DebugName, const VkCommandBufferInheritanceInfo* pInheritanceInfo)
 {
     VkCommandBuffer CmdBuffer = VK_NULL_HANDLE;
 
+    const bool IsSecondary = pInheritanceInfo != nullptr;
     {
         std::lock_guard<std::mutex> Lock{m_Mutex};
 
-        if (!m_CmdBuffers.empty())
+        auto& CmdBuffers = IsSecondary ? m_SecondaryCmdBuffers : m_CmdBuffers;
+        if (!CmdBuffers.empty())
         {
-            CmdBuffer = m_CmdBuffers.front();
+            CmdBuffer = CmdBuffers.front();
             auto err  = vkResetCommandBuffer(
                 CmdBuffer,
                 0 // VK_COMMAND_BUFFER_RESET_RELEASE_RESOURCES_BIT -  specifies that most or all memory resources currently
@@ -81,7 +85,7 @@ VkCommandBuffer VulkanCommandBufferPool::GetCommandBuffer(const char* DebugName)
             );
             DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to reset command buffer");
             (void)err;
-            m_CmdBuffers.pop_front();
+            CmdBuffers.pop_front();
         }
     }
 
@@ -93,7 +97,7 @@ VkCommandBuffer VulkanCommandBufferPool::GetCommandBuffer(const char* DebugName)
         BuffAllocInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
         BuffAllocInfo.pNext              = nullptr;
         BuffAllocInfo.commandPool        = m_CmdPool;
-        BuffAllocInfo.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        BuffAllocInfo.level              = IsSecondary ? VK_COMMAND_BUFFER_LEVEL_SECONDARY : VK_COMMAND_BUFFER_LEVEL_PRIMARY;
         BuffAllocInfo.commandBufferCount = 1;
 
         CmdBuffer = m_LogicalDevice->AllocateVkCommandBuffer(BuffAllocInfo);
@@ -107,7 +111,12 @@ VkCommandBuffer VulkanCommandBufferPool::GetCommandBuffer(const char* DebugName)
     CmdBuffBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT; // Each recording of the command buffer will only be
                                                                           // submitted once, and the command buffer will be reset
                                                                           // and recorded again between each submission.
-    CmdBuffBeginInfo.pInheritanceInfo = nullptr;                          // Ignored for a primary command buffer
+    CmdBuffBeginInfo.pInheritanceInfo = pInheritanceInfo;                 // Ignored for a primary command buffer
+    if (IsSecondary)
+    {
+        // The secondary command buffer will be executed entirely inside a render pass
+        CmdBuffBeginInfo.flags |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    }
 
     auto err = vkBeginCommandBuffer(CmdBuffer, &CmdBuffBeginInfo);
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to begin command buffer");
@@ -118,10 +127,11 @@ VkCommandBuffer VulkanCommandBufferPool::GetCommandBuffer(const char* DebugName)
     return CmdBuffer;
 }
 
-void VulkanCommandBufferPool::RecycleCommandBuffer(VkCommandBuffer&& CmdBuffer)
+void VulkanCommandBufferPool::RecycleCommandBuffer(VkCommandBuffer&& CmdBuffer, VkCommandBufferLevel Level)
 {
     std::lock_guard<std::mutex> Lock{m_Mutex};
-    m_CmdBuffers.emplace_back(CmdBuffer);
+    auto&                       CmdBuffers = Level == VK_COMMAND_BUFFER_LEVEL_SECONDARY ? m_SecondaryCmdBuffers : m_CmdBuffers;
+    CmdBuffers.emplace_back(CmdBuffer);
     CmdBuffer = VK_NULL_HANDLE;
 #ifdef DILIGENT_DEVELOPMENT
     --m_BuffCounter;
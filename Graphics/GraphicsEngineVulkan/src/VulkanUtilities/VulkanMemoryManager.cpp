@@ -40,14 +40,53 @@ VulkanMemoryAllocation::~VulkanMemoryAllocation()
     }
 }
 
-VulkanMemoryPage::VulkanMemoryPage(VulkanMemoryManager&  ParentMemoryMgr,
-                                   VkDeviceSize          PageSize,
-                                   uint32_t              MemoryTypeIndex,
-                                   bool                  IsHostVisible,
-                                   VkMemoryAllocateFlags AllocateFlags) :
+namespace
+{
+
+template <typename T>
+void UpdatePeakValue(std::atomic<T>& Peak, T Value)
+{
+    auto CurrPeak = Peak.load();
+    while (CurrPeak < Value && !Peak.compare_exchange_weak(CurrPeak, Value))
+    {}
+}
+
+// Without VK_EXT_memory_budget, the process is assumed to be able to use this fraction of the heap
+constexpr VkDeviceSize DefaultHeapBudgetPercentage = 80;
+
+// The heap is under memory pressure when its usage reaches this fraction of the budget
+constexpr VkDeviceSize MemoryPressurePercentage = 90;
+
+// Under memory pressure, new pages are not allowed to be smaller than this fraction of the default page size
+constexpr VkDeviceSize MinPageSizeDivisor = 16;
+
+VkDeviceSize EstimateHeapUsage(VkDeviceSize Usage, VkDeviceSize AllocatedAtUpdate, VkDeviceSize CurrAllocatedSize)
+{
+    // Account for the pages that have been created or destroyed since the budget was updated
+    return CurrAllocatedSize >= AllocatedAtUpdate ?
+        Usage + (CurrAllocatedSize - AllocatedAtUpdate) :
+        Usage - std::min(Usage, AllocatedAtUpdate - CurrAllocatedSize);
+}
+
+bool IsUsageOverPressureThreshold(VkDeviceSize Usage, VkDeviceSize Budget)
+{
+    return Budget > 0 && Usage >= Budget / 100 * MemoryPressurePercentage;
+}
+
+} // namespace
+
+VulkanMemoryPage::VulkanMemoryPage(VulkanMemoryManager&                 ParentMemoryMgr,
+                                   VulkanMemoryPool&                    ParentPool,
+                                   VkDeviceSize                         PageSize,
+                                   uint32_t                             MemoryTypeIndex,
+                                   bool                                 IsHostVisible,
+                                   VkMemoryAllocateFlags                AllocateFlags,
+                                   const VkMemoryDedicatedAllocateInfo* pDedicatedAllocInfo) :
     // clang-format off
     m_ParentMemoryMgr{ParentMemoryMgr},
-    m_AllocationMgr  {static_cast<AllocationsMgrOffsetType>(PageSize), ParentMemoryMgr.m_Allocator}
+    m_ParentPool     {ParentPool},
+    m_AllocationMgr  {static_cast<AllocationsMgrOffsetType>(PageSize), ParentMemoryMgr.m_Allocator},
+    m_IsDedicated    {pDedicatedAllocInfo != nullptr}
 // clang-format on
 {
     VERIFY(PageSize <= std::numeric_limits<AllocationsMgrOffsetType>::max(),
@@ -62,15 +101,24 @@ VulkanMemoryPage::VulkanMemoryPage(VulkanMemoryManager&  ParentMemoryMgr,
     MemAlloc.allocationSize  = PageSize;
     MemAlloc.memoryTypeIndex = MemoryTypeIndex;
 
+    if (pDedicatedAllocInfo != nullptr)
+    {
+        VERIFY_EXPR(pDedicatedAllocInfo->sType == VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO && pDedicatedAllocInfo->pNext == nullptr);
+        VERIFY((pDedicatedAllocInfo->image != VK_NULL_HANDLE) != (pDedicatedAllocInfo->buffer != VK_NULL_HANDLE),
+               "Exactly one of image or buffer must be specified for a dedicated allocation");
+        MemAlloc.pNext = pDedicatedAllocInfo;
+    }
+
     if (AllocateFlags)
     {
-        MemAlloc.pNext    = &MemFlagInfo;
         MemFlagInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
-        MemFlagInfo.pNext = nullptr;
+        MemFlagInfo.pNext = MemAlloc.pNext;
         MemFlagInfo.flags = AllocateFlags;
+        MemAlloc.pNext    = &MemFlagInfo;
     }
 
-    auto MemoryName = Diligent::FormatString("Device memory page. Size: ", Diligent::FormatMemorySize(PageSize, 2), ", type: ", MemoryTypeIndex);
+    auto MemoryName = Diligent::FormatString(m_IsDedicated ? "Dedicated device memory. Size: " : "Device memory page. Size: ",
+                                             Diligent::FormatMemorySize(PageSize, 2), ", type: ", MemoryTypeIndex);
     m_VkMemory      = ParentMemoryMgr.m_LogicalDevice.AllocateDeviceMemory(MemAlloc, MemoryName.c_str());
 
     if (IsHostVisible)
@@ -94,11 +142,11 @@ VulkanMemoryPage::~VulkanMemoryPage()
     }
 
     VERIFY(IsEmpty(), "Destroying a page with not all allocations released");
+    VERIFY(!m_SizeClassLoc.IsValid(), "Destroying a page that is still in the free space index");
 }
 
 VulkanMemoryAllocation VulkanMemoryPage::Allocate(VkDeviceSize size, VkDeviceSize alignment)
 {
-    std::lock_guard<std::mutex> Lock{m_Mutex};
     VERIFY(size <= std::numeric_limits<AllocationsMgrOffsetType>::max(),
            "Allocation size (", size, ") exceeds maximum allowed value ",
            std::numeric_limits<AllocationsMgrOffsetType>::max());
@@ -108,6 +156,8 @@ VulkanMemoryAllocation VulkanMemoryPage::Allocate(VkDeviceSize size, VkDeviceSiz
         // Offset may not necessarily be aligned, but the allocation is guaranteed to be large enough
         // to accommodate requested alignment
         VERIFY_EXPR(Diligent::AlignUp(VkDeviceSize{Allocation.UnalignedOffset}, alignment) - Allocation.UnalignedOffset + size <= Allocation.Size);
+        if (!m_IsDedicated)
+            m_ParentPool.FreeSpaceIndex.Update(*this, m_SizeClassLoc, GetMaxFreeBlockSize());
         return VulkanMemoryAllocation{this, Allocation.UnalignedOffset, Allocation.Size};
     }
     else
@@ -119,14 +169,24 @@ VulkanMemoryAllocation VulkanMemoryPage::Allocate(VkDeviceSize size, VkDeviceSiz
 void VulkanMemoryPage::Free(VulkanMemoryAllocation&& Allocation)
 {
     m_ParentMemoryMgr.OnFreeAllocation(Allocation.Size, m_CPUMemory != nullptr);
-    std::lock_guard<std::mutex> Lock{m_Mutex};
+    std::lock_guard<std::mutex> Lock{m_ParentPool.Mtx};
     VERIFY_EXPR(Allocation.UnalignedOffset <= std::numeric_limits<AllocationsMgrOffsetType>::max());
     VERIFY_EXPR(Allocation.Size <= std::numeric_limits<AllocationsMgrOffsetType>::max());
     m_AllocationMgr.Free(static_cast<AllocationsMgrOffsetType>(Allocation.UnalignedOffset), static_cast<AllocationsMgrOffsetType>(Allocation.Size));
     Allocation = VulkanMemoryAllocation{};
+
+    if (m_IsDedicated)
+    {
+        // Dedicated memory is bound to a single resource and can't be reused.
+        // Note that this destroys the page, so no members may be accessed after this call.
+        m_ParentMemoryMgr.DestroyPage(m_ParentPool, *this);
+        return;
+    }
+
+    m_ParentPool.FreeSpaceIndex.Update(*this, m_SizeClassLoc, GetMaxFreeBlockSize());
 }
 
-VulkanMemoryAllocation VulkanMemoryManager::Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags)
+uint32_t VulkanMemoryManager::GetMemoryTypeIndex(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps) const
 {
     // memoryTypeBits is a bitmask and contains one bit set for every supported memory type for the resource.
     // Bit i is set if the memory type i in the VkPhysicalDeviceMemoryProperties structure for the
@@ -153,11 +213,68 @@ VulkanMemoryAllocation VulkanMemoryManager::Allocate(const VkMemoryRequirements&
     {
         LOG_ERROR_AND_THROW("Failed to find suitable device memory type for a buffer");
     }
+    return MemoryTypeIndex;
+}
+
+VulkanMemoryAllocation VulkanMemoryManager::Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags)
+{
+    const auto MemoryTypeIndex = GetMemoryTypeIndex(MemReqs, MemoryProps);
 
     bool HostVisible = (MemoryProps & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0;
     return Allocate(MemReqs.size, MemReqs.alignment, MemoryTypeIndex, HostVisible, AllocateFlags);
 }
 
+VulkanMemoryPool& VulkanMemoryManager::GetPool(const MemoryPageIndex& PageIdx)
+{
+    std::lock_guard<std::mutex> Lock{m_PoolsMtx};
+
+    auto& pPool = m_Pools[PageIdx];
+    if (!pPool)
+        pPool = std::make_unique<VulkanMemoryPool>();
+    // Pools are never destroyed, so the reference remains valid after the lock is released
+    return *pPool;
+}
+
+VulkanMemoryPage& VulkanMemoryManager::CreatePage(VulkanMemoryPool&                    Pool,
+                                                  VkDeviceSize                         PageSize,
+                                                  uint32_t                             MemoryTypeIndex,
+                                                  bool                                 HostVisible,
+                                                  VkMemoryAllocateFlags                AllocateFlags,
+                                                  const VkMemoryDedicatedAllocateInfo* pDedicatedAllocInfo)
+{
+    auto pPage         = std::make_unique<VulkanMemoryPage>(*this, Pool, PageSize, MemoryTypeIndex, HostVisible, AllocateFlags, pDedicatedAllocInfo);
+    pPage->m_PoolPos   = Pool.Pages.size();
+    pPage->m_HeapIndex = m_PhysicalDevice.GetMemoryProperties().memoryTypes[MemoryTypeIndex].heapIndex;
+    m_HeapAllocatedSize[pPage->m_HeapIndex].fetch_add(PageSize);
+    Pool.Pages.emplace_back(std::move(pPage));
+
+    size_t stat_ind = HostVisible ? 1 : 0;
+    UpdatePeakValue(m_PeakAllocatedSize[stat_ind], m_CurrAllocatedSize[stat_ind].fetch_add(PageSize) + PageSize);
+
+    auto& Page = *Pool.Pages.back();
+    OnNewPageCreated(Page);
+    return Page;
+}
+
+void VulkanMemoryManager::DestroyPage(VulkanMemoryPool& Pool, VulkanMemoryPage& Page)
+{
+    VERIFY_EXPR(&Page.m_ParentPool == &Pool);
+    VERIFY_EXPR(Page.m_PoolPos < Pool.Pages.size() && Pool.Pages[Page.m_PoolPos].get() == &Page);
+
+    m_CurrAllocatedSize[Page.GetCPUMemory() != nullptr ? 1 : 0].fetch_sub(Page.GetPageSize());
+    m_HeapAllocatedSize[Page.m_HeapIndex].fetch_sub(Page.GetPageSize());
+    Pool.FreeSpaceIndex.Remove(Page.m_SizeClassLoc);
+    OnPageDestroy(Page);
+
+    const auto PagePos = Page.m_PoolPos;
+    if (PagePos + 1 != Pool.Pages.size())
+    {
+        std::swap(Pool.Pages[PagePos], Pool.Pages.back());
+        Pool.Pages[PagePos]->m_PoolPos = PagePos;
+    }
+    Pool.Pages.pop_back();
+}
+
 VulkanMemoryAllocation VulkanMemoryManager::Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags)
 {
     VulkanMemoryAllocation Allocation;
@@ -169,33 +286,51 @@ VulkanMemoryAllocation VulkanMemoryManager::Allocate(VkDeviceSize Size, VkDevice
     // even though on integrated GPUs same pages can be used for both GPU-only and staging
     // allocations. Staging allocations are short-living and will be released when upload is
     // complete, while GPU-only allocations are expected to be long-living.
-    MemoryPageIndex             PageIdx{MemoryTypeIndex, HostVisible, AllocateFlags};
-    std::lock_guard<std::mutex> Lock{m_PagesMtx};
+    auto& Pool = GetPool(MemoryPageIndex{MemoryTypeIndex, HostVisible, AllocateFlags});
+
+    std::lock_guard<std::mutex> Lock{Pool.Mtx};
+
+    // A page whose largest free block is at least this large can accommodate the
+    // allocation regardless of the alignment of the block offset.
+    const auto RequiredBlockSize = Diligent::AlignUp(Size, Alignment) + Alignment - 1;
 
-    auto range = m_Pages.equal_range(PageIdx);
-    for (auto page_it = range.first; page_it != range.second; ++page_it)
+    // First try a page from the size class of the required block size: it may fit the allocation and
+    // using it preserves larger blocks. If it does not, any page from the higher classes is guaranteed to fit.
+    if (auto* pPage = Pool.FreeSpaceIndex.FindCandidate(RequiredBlockSize))
+        Allocation = pPage->Allocate(Size, Alignment);
+
+    if (Allocation.Page == nullptr)
     {
-        Allocation = page_it->second.Allocate(Size, Alignment);
-        if (Allocation.Page != nullptr)
-            break;
+        if (auto* pPage = Pool.FreeSpaceIndex.FindGuaranteed(RequiredBlockSize))
+        {
+            Allocation = pPage->Allocate(Size, Alignment);
+            VERIFY(Allocation.Page != nullptr, "The page is expected to accommodate the allocation");
+        }
     }
 
     size_t stat_ind = HostVisible ? 1 : 0;
     if (Allocation.Page == nullptr)
     {
-        auto PageSize = HostVisible ? m_HostVisiblePageSize : m_DeviceLocalPageSize;
+        const auto DefaultPageSize = HostVisible ? m_HostVisiblePageSize : m_DeviceLocalPageSize;
+
+        auto PageSize = DefaultPageSize;
         while (PageSize < Size)
             PageSize *= 2;
 
-        m_CurrAllocatedSize[stat_ind] += PageSize;
-        m_PeakAllocatedSize[stat_ind] = std::max(m_PeakAllocatedSize[stat_ind], m_CurrAllocatedSize[stat_ind]);
+        const auto HeapIndex = m_PhysicalDevice.GetMemoryProperties().memoryTypes[MemoryTypeIndex].heapIndex;
+        if (IsHeapUnderPressure(HeapIndex))
+        {
+            // Do not speculatively allocate a full page that may never be used
+            const auto MinPageSize = std::max(DefaultPageSize / MinPageSizeDivisor, VkDeviceSize{1});
+            while (PageSize / 2 >= RequiredBlockSize && PageSize / 2 >= MinPageSize)
+                PageSize /= 2;
+        }
 
-        auto it = m_Pages.emplace(PageIdx, VulkanMemoryPage{*this, PageSize, MemoryTypeIndex, HostVisible, AllocateFlags});
+        auto& NewPage = CreatePage(Pool, PageSize, MemoryTypeIndex, HostVisible, AllocateFlags, nullptr);
         LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "': created new ", (HostVisible ? "host-visible" : "device-local"),
                          " page. (", Diligent::FormatMemorySize(PageSize, 2), ", type idx: ", MemoryTypeIndex,
                          "). Current allocated size: ", Diligent::FormatMemorySize(m_CurrAllocatedSize[stat_ind], 2));
-        OnNewPageCreated(it->second);
-        Allocation = it->second.Allocate(Size, Alignment);
+        Allocation = NewPage.Allocate(Size, Alignment);
         DEV_CHECK_ERR(Allocation.Page != nullptr, "Failed to allocate new memory page");
     }
 
@@ -204,38 +339,191 @@ VulkanMemoryAllocation VulkanMemoryManager::Allocate(VkDeviceSize Size, VkDevice
         VERIFY_EXPR(Size + Diligent::AlignUp(Allocation.UnalignedOffset, Alignment) - Allocation.UnalignedOffset <= Allocation.Size);
     }
 
-    m_CurrUsedSize[stat_ind].fetch_add(Allocation.Size);
-    m_PeakUsedSize[stat_ind] = std::max(m_PeakUsedSize[stat_ind], static_cast<VkDeviceSize>(m_CurrUsedSize[stat_ind].load()));
+    OnNewAllocation(Allocation.Size, HostVisible);
+
+    return Allocation;
+}
+
+VulkanMemoryAllocation VulkanMemoryManager::AllocateDedicated(const VkMemoryRequirements&          MemReqs,
+                                                              VkMemoryPropertyFlags                MemoryProps,
+                                                              VkMemoryAllocateFlags                AllocateFlags,
+                                                              const VkMemoryDedicatedAllocateInfo& DedicatedAllocInfo)
+{
+    const auto MemoryTypeIndex = GetMemoryTypeIndex(MemReqs, MemoryProps);
+
+    bool HostVisible = (MemoryProps & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0;
+    return AllocateDedicated(MemReqs.size, MemoryTypeIndex, HostVisible, AllocateFlags, DedicatedAllocInfo);
+}
+
+VulkanMemoryAllocation VulkanMemoryManager::AllocateDedicated(VkDeviceSize                         Size,
+                                                              uint32_t                             MemoryTypeIndex,
+                                                              bool                                 HostVisible,
+                                                              VkMemoryAllocateFlags                AllocateFlags,
+                                                              const VkMemoryDedicatedAllocateInfo& DedicatedAllocInfo)
+{
+    VERIFY(m_LogicalDevice.GetEnabledExtFeatures().DedicatedAllocation, "Dedicated allocation extension is not enabled");
+
+    // Dedicated pages are kept in the same pool as regular pages so that they are protected by the
+    // same mutex, but they are never added to the free space index.
+    auto& Pool = GetPool(MemoryPageIndex{MemoryTypeIndex, HostVisible, AllocateFlags});
+
+    std::lock_guard<std::mutex> Lock{Pool.Mtx};
+
+    // The memory size must be exactly the size required by the resource
+    auto& Page = CreatePage(Pool, Size, MemoryTypeIndex, HostVisible, AllocateFlags, &DedicatedAllocInfo);
+    // The resource is bound at offset 0, which satisfies any alignment
+    auto Allocation = Page.Allocate(Size, 1);
+    DEV_CHECK_ERR(Allocation.Page != nullptr, "Failed to allocate dedicated memory");
+    VERIFY_EXPR(Allocation.UnalignedOffset == 0 && Allocation.Size == Size);
+
+    OnNewAllocation(Allocation.Size, HostVisible);
 
     return Allocation;
 }
 
+bool VulkanMemoryManager::ShouldUseDedicatedAllocation(VkDeviceSize Size, bool PrefersDedicatedAllocation) const
+{
+    if (!m_LogicalDevice.GetEnabledExtFeatures().DedicatedAllocation)
+        return false;
+
+    // Resources that take more than half of a page would leave most of the page unused
+    // or require a page of their own anyway.
+    return PrefersDedicatedAllocation || Size > m_DeviceLocalPageSize / 2;
+}
+
 void VulkanMemoryManager::ShrinkMemory()
 {
-    std::lock_guard<std::mutex> Lock{m_PagesMtx};
-    if (m_CurrAllocatedSize[0] <= m_DeviceLocalReserveSize && m_CurrAllocatedSize[1] <= m_HostVisibleReserveSize)
+    UpdateMemoryBudget();
+
+    // Heaps that are under memory pressure release all empty pages regardless of the reserve size
+    uint32_t HeapsUnderPressure = 0;
+    {
+        std::lock_guard<std::mutex> Lock{m_BudgetMtx};
+        for (uint32_t HeapIdx = 0; HeapIdx < m_PhysicalDevice.GetMemoryProperties().memoryHeapCount; ++HeapIdx)
+        {
+            if (m_HeapBudgets[HeapIdx].UnderPressure)
+                HeapsUnderPressure |= 1u << HeapIdx;
+        }
+    }
+
+    if (HeapsUnderPressure == 0 && m_CurrAllocatedSize[0] <= m_DeviceLocalReserveSize && m_CurrAllocatedSize[1] <= m_HostVisibleReserveSize)
         return;
 
-    auto it = m_Pages.begin();
-    while (it != m_Pages.end())
+    std::lock_guard<std::mutex> PoolsLock{m_PoolsMtx};
+    for (auto& it : m_Pools)
+    {
+        const bool IsHostVisible = it.first.IsHostVisible;
+        const auto HeapIndex     = m_PhysicalDevice.GetMemoryProperties().memoryTypes[it.first.MemoryTypeIndex].heapIndex;
+        const auto stat_ind      = IsHostVisible ? 1 : 0;
+
+        auto ReserveSize = IsHostVisible ? m_HostVisibleReserveSize : m_DeviceLocalReserveSize;
+        if ((HeapsUnderPressure & (1u << HeapIndex)) != 0)
+            ReserveSize = 0;
+
+        auto&                       Pool = *it.second;
+        std::lock_guard<std::mutex> Lock{Pool.Mtx};
+
+        size_t page_idx = 0;
+        while (page_idx < Pool.Pages.size())
+        {
+            auto& Page = *Pool.Pages[page_idx];
+            if (Page.IsEmpty() && m_CurrAllocatedSize[stat_ind] > ReserveSize)
+            {
+                VERIFY(!Page.IsDedicated(), "Dedicated pages are expected to be destroyed when their allocation is released");
+                const auto PageSize = Page.GetPageSize();
+                // The last page is moved in place of the destroyed one
+                DestroyPage(Pool, Page);
+                LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "': destroying ", (IsHostVisible ? "host-visible" : "device-local"),
+                                 " page (", Diligent::FormatMemorySize(PageSize, 2),
+                                 "). Current allocated size: ",
+                                 Diligent::FormatMemorySize(m_CurrAllocatedSize[stat_ind], 2));
+            }
+            else
+            {
+                ++page_idx;
+            }
+        }
+    }
+}
+
+void VulkanMemoryManager::UpdateMemoryBudget()
+{
+    const auto& MemoryProps = m_PhysicalDevice.GetMemoryProperties();
+
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT BudgetProps{};
+
+    const bool UseBudgetExt = m_LogicalDevice.GetEnabledExtFeatures().MemoryBudget;
+    if (UseBudgetExt)
+        m_PhysicalDevice.QueryMemoryBudget(BudgetProps);
+
+    std::lock_guard<std::mutex> Lock{m_BudgetMtx};
+    for (uint32_t HeapIdx = 0; HeapIdx < MemoryProps.memoryHeapCount; ++HeapIdx)
     {
-        auto curr_it = it;
-        ++it;
-        auto& Page          = curr_it->second;
-        bool  IsHostVisible = Page.GetCPUMemory() != nullptr;
-        auto  ReserveSize   = IsHostVisible ? m_HostVisibleReserveSize : m_DeviceLocalReserveSize;
-        if (Page.IsEmpty() && m_CurrAllocatedSize[IsHostVisible ? 1 : 0] > ReserveSize)
+        auto&      Heap          = m_HeapBudgets[HeapIdx];
+        const auto AllocatedSize = m_HeapAllocatedSize[HeapIdx].load();
+        if (UseBudgetExt)
+        {
+            Heap.Budget = BudgetProps.heapBudget[HeapIdx];
+            Heap.Usage  = BudgetProps.heapUsage[HeapIdx];
+        }
+        else
+        {
+            Heap.Budget = MemoryProps.memoryHeaps[HeapIdx].size / 100 * DefaultHeapBudgetPercentage;
+            Heap.Usage  = AllocatedSize;
+        }
+        Heap.AllocatedAtUpdate = AllocatedSize;
+
+        const bool UnderPressure = IsUsageOverPressureThreshold(Heap.Usage, Heap.Budget);
+        if (UnderPressure && !Heap.UnderPressure)
         {
-            auto PageSize = Page.GetPageSize();
-            m_CurrAllocatedSize[IsHostVisible ? 1 : 0] -= PageSize;
-            LOG_INFO_MESSAGE("VulkanMemoryManager '", m_MgrName, "': destroying ", (IsHostVisible ? "host-visible" : "device-local"),
-                             " page (", Diligent::FormatMemorySize(PageSize, 2),
-                             "). Current allocated size: ",
-                             Diligent::FormatMemorySize(m_CurrAllocatedSize[IsHostVisible ? 1 : 0], 2));
-            OnPageDestroy(Page);
-            m_Pages.erase(curr_it);
+            LOG_WARNING_MESSAGE("VulkanMemoryManager '", m_MgrName, "': memory heap ", HeapIdx, " is under pressure. Usage: ",
+                                Diligent::FormatMemorySize(Heap.Usage, 2), ", budget: ", Diligent::FormatMemorySize(Heap.Budget, 2),
+                                ". Unused pages will be released regardless of the reserve size.");
         }
+        Heap.UnderPressure = UnderPressure;
+    }
+}
+
+VulkanMemoryManager::HeapBudget VulkanMemoryManager::GetHeapBudget(uint32_t HeapIndex)
+{
+    VERIFY_EXPR(HeapIndex < m_PhysicalDevice.GetMemoryProperties().memoryHeapCount);
+
+    HeapBudget Budget;
+    Budget.AllocatedSize = m_HeapAllocatedSize[HeapIndex].load();
+
+    std::lock_guard<std::mutex> Lock{m_BudgetMtx};
+
+    const auto& Heap     = m_HeapBudgets[HeapIndex];
+    Budget.Budget        = Heap.Budget;
+    Budget.Usage         = EstimateHeapUsage(Heap.Usage, Heap.AllocatedAtUpdate, Budget.AllocatedSize);
+    Budget.UnderPressure = IsUsageOverPressureThreshold(Budget.Usage, Budget.Budget);
+    return Budget;
+}
+
+bool VulkanMemoryManager::IsHeapUnderPressure(uint32_t HeapIndex)
+{
+    return GetHeapBudget(HeapIndex).UnderPressure;
+}
+
+VulkanMemoryManager::MemoryStats VulkanMemoryManager::GetMemoryStats() const
+{
+    MemoryStats Stats;
+    for (size_t i = 0; i < 2; ++i)
+    {
+        Stats.UsedSize[i]          = static_cast<VkDeviceSize>(std::max(m_CurrUsedSize[i].load(), int64_t{0}));
+        Stats.PeakUsedSize[i]      = m_PeakUsedSize[i].load();
+        Stats.AllocatedSize[i]     = m_CurrAllocatedSize[i].load();
+        Stats.PeakAllocatedSize[i] = m_PeakAllocatedSize[i].load();
     }
+    return Stats;
+}
+
+void VulkanMemoryManager::OnNewAllocation(VkDeviceSize Size, bool IsHostVisible)
+{
+    size_t stat_ind = IsHostVisible ? 1 : 0;
+
+    const auto CurrUsedSize = m_CurrUsedSize[stat_ind].fetch_add(static_cast<int64_t>(Size)) + static_cast<int64_t>(Size);
+    UpdatePeakValue(m_PeakUsedSize[stat_ind], static_cast<VkDeviceSize>(CurrUsedSize));
 }
 
 void VulkanMemoryManager::OnFreeAllocation(VkDeviceSize Size, bool IsHostVisible)
@@ -257,8 +545,15 @@ VulkanMemoryManager::~VulkanMemoryManager()
                      Diligent::FormatMemorySize(m_PeakAllocatedSize[1], 2, m_PeakAllocatedSize[1]),
                      " (", PeakHostVisiblePages, (PeakHostVisiblePages == 1 ? " page)" : " pages)"));
 
-    for (auto it = m_Pages.begin(); it != m_Pages.end(); ++it)
-        VERIFY(it->second.IsEmpty(), "The page contains outstanding allocations");
+    for (auto& it : m_Pools)
+    {
+        auto& Pool = *it.second;
+        for (auto& pPage : Pool.Pages)
+        {
+            VERIFY(pPage->IsEmpty(), "The page contains outstanding allocations");
+            Pool.FreeSpaceIndex.Remove(pPage->m_SizeClassLoc);
+        }
+    }
     VERIFY(m_CurrUsedSize[0] == 0 && m_CurrUsedSize[1] == 0, "Not all allocations have been released");
 }
 
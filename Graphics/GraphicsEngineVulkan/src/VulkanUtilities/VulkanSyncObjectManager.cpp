@@ -25,47 +25,54 @@
  */
 
 #include "VulkanUtilities/VulkanSyncObjectManager.hpp"
+#include "EngineMemory.h"
 
 namespace VulkanUtilities
 {
 
 VulkanSyncObjectManager::VulkanSyncObjectManager(VulkanLogicalDevice& LogicalDevice) :
-    m_LogicalDevice{LogicalDevice}
+    m_LogicalDevice{LogicalDevice},
+    m_SemaphorePool{Diligent::GetRawAllocator()},
+    m_FencePool{Diligent::GetRawAllocator()}
 {
-    m_SemaphorePool.reserve(64);
-    m_FencePool.reserve(32);
 }
 
 VulkanSyncObjectManager::~VulkanSyncObjectManager()
 {
-    {
-        std::lock_guard<std::mutex> Lock{m_SemaphorePoolGuard};
-
-        for (auto vkSem : m_SemaphorePool)
-        {
-            vkDestroySemaphore(m_LogicalDevice.GetVkDevice(), vkSem, nullptr);
-        }
-    }
-    {
-        std::lock_guard<std::mutex> Lock{m_FencePoolGuard};
+    m_SemaphorePool.PopAll([this](VkSemaphore vkSem) {
+        vkDestroySemaphore(m_LogicalDevice.GetVkDevice(), vkSem, nullptr);
+    });
+
+    m_FencePool.PopAll([this](VkFence vkFence) {
+        vkDestroyFence(m_LogicalDevice.GetVkDevice(), vkFence, nullptr);
+    });
+
+    const auto SyncObjStats = GetStats();
+    LOG_INFO_MESSAGE("Vulkan sync object manager stats: created ", SyncObjStats.CreatedSemaphoreCount, " semaphore(s) and ",
+                     SyncObjStats.CreatedFenceCount, " fence(s); reused semaphores ", SyncObjStats.ReusedSemaphoreCount,
+                     " time(s) and fences ", SyncObjStats.ReusedFenceCount, " time(s)");
+}
 
-        for (auto vkFence : m_FencePool)
-        {
-            vkDestroyFence(m_LogicalDevice.GetVkDevice(), vkFence, nullptr);
-        }
-    }
+VulkanSyncObjectManager::Stats VulkanSyncObjectManager::GetStats() const
+{
+    Stats SyncObjStats;
+    SyncObjStats.CreatedSemaphoreCount = m_CreatedSemaphoreCount.load(std::memory_order_relaxed);
+    SyncObjStats.CreatedFenceCount     = m_CreatedFenceCount.load(std::memory_order_relaxed);
+    SyncObjStats.ReusedSemaphoreCount  = m_ReusedSemaphoreCount.load(std::memory_order_relaxed);
+    SyncObjStats.ReusedFenceCount      = m_ReusedFenceCount.load(std::memory_order_relaxed);
+    return SyncObjStats;
 }
 
 void VulkanSyncObjectManager::CreateSemaphores(VulkanRecycledSemaphore* pSemaphores, uint32_t Count)
 {
     uint32_t SemIdx = 0;
+    if (Count > 0)
     {
-        std::lock_guard<std::mutex> Lock{m_SemaphorePoolGuard};
-        for (; SemIdx < Count && !m_SemaphorePool.empty(); ++SemIdx)
-        {
-            pSemaphores[SemIdx] = VulkanRecycledSemaphore{shared_from_this(), m_SemaphorePool.back()};
-            m_SemaphorePool.pop_back();
-        }
+        auto pSelf = shared_from_this();
+        m_SemaphorePool.Pop(Count, [&](VkSemaphore vkSem) {
+            pSemaphores[SemIdx++] = VulkanRecycledSemaphore{pSelf, vkSem};
+        });
+        m_ReusedSemaphoreCount.fetch_add(SemIdx, std::memory_order_relaxed);
     }
 
     // Create new semaphores.
@@ -77,18 +84,17 @@ void VulkanSyncObjectManager::CreateSemaphores(VulkanRecycledSemaphore* pSemapho
         VkSemaphore vkSem = VK_NULL_HANDLE;
         vkCreateSemaphore(m_LogicalDevice.GetVkDevice(), &SemCI, nullptr, &vkSem);
         pSemaphores[SemIdx] = VulkanRecycledSemaphore{shared_from_this(), vkSem};
+        m_CreatedSemaphoreCount.fetch_add(1, std::memory_order_relaxed);
     }
 }
 
 VulkanRecycledFence VulkanSyncObjectManager::CreateFence()
 {
     {
-        std::lock_guard<std::mutex> Lock{m_FencePoolGuard};
-
-        if (!m_FencePool.empty())
+        VkFence vkFence = VK_NULL_HANDLE;
+        if (m_FencePool.Pop(1, [&vkFence](VkFence Fence) { vkFence = Fence; }) > 0)
         {
-            auto vkFence = m_FencePool.back();
-            m_FencePool.pop_back();
+            m_ReusedFenceCount.fetch_add(1, std::memory_order_relaxed);
             return {shared_from_this(), vkFence};
         }
     }
@@ -98,6 +104,7 @@ VulkanRecycledFence VulkanSyncObjectManager::CreateFence()
 
     FenceCI.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
     vkCreateFence(m_LogicalDevice.GetVkDevice(), &FenceCI, nullptr, &vkFence);
+    m_CreatedFenceCount.fetch_add(1, std::memory_order_relaxed);
 
     return {shared_from_this(), vkFence};
 }
@@ -111,8 +118,7 @@ void VulkanSyncObjectManager::Recycle(VkSemaphoreType vkSem, bool IsUnsignaled)
         return;
     }
 
-    std::lock_guard<std::mutex> Lock{m_SemaphorePoolGuard};
-    m_SemaphorePool.push_back(vkSem.Value);
+    m_SemaphorePool.Push(vkSem.Value);
 }
 
 void VulkanSyncObjectManager::Recycle(VkFenceType vkFence, bool IsUnsignaled)
@@ -123,8 +129,7 @@ void VulkanSyncObjectManager::Recycle(VkFenceType vkFence, bool IsUnsignaled)
         vkResetFences(m_LogicalDevice.GetVkDevice(), 1, &vkFence.Value);
     }
 
-    std::lock_guard<std::mutex> Lock{m_FencePoolGuard};
-    m_FencePool.push_back(vkFence.Value);
+    m_FencePool.Push(vkFence.Value);
 }
 
 } // namespace VulkanUtilities
@@ -190,6 +190,12 @@ void DeviceContextWebGPUImpl::CommitShaderResources(IShaderResourceBinding*
     ResourceCache.DbgVerifyDynamicBuffersCounter();
 #endif
 
+    if (IsRedundantSRBCommit(m_BindInfo, pResBindingWebGPU))
+    {
+        // The bind groups of this SRB are already up to date
+        return;
+    }
+
     const WGPUDevice wgpuDevice = m_pDevice->GetWebGPUDevice();
 
     const Uint32                         SRBIndex   = pResBindingWebGPU->GetBindingIndex();
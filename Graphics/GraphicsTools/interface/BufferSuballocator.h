@@ -103,16 +103,53 @@ struct BufferSuballocatorUsageStats
     /// The current number of allocations.
     Uint32 AllocationCount = 0;
 
+    /// The total number of bytes moved by defragmentation.
+    Uint64 MovedSize = 0;
+
+    /// The total memory size released by shrinking the internal buffer
+    /// after defragmentation, in bytes.
+    Uint64 ReclaimedSize = 0;
+
     BufferSuballocatorUsageStats& operator+=(const BufferSuballocatorUsageStats& rhs)
     {
         CommittedSize += rhs.CommittedSize;
         UsedSize += rhs.UsedSize;
         MaxFreeChunkSize = std::max(MaxFreeChunkSize, rhs.MaxFreeChunkSize);
         AllocationCount += rhs.AllocationCount;
+        MovedSize += rhs.MovedSize;
+        ReclaimedSize += rhs.ReclaimedSize;
         return *this;
     }
 };
 
+
+/// Callback function that is called by IBufferSuballocator::Defragment() for every
+/// suballocation that has been moved to a new location.
+
+/// \param [in] pSuballocation - The suballocation that has been moved. Its GetOffset() method
+///                              returns the new offset.
+/// \param [in] OldOffset      - The previous offset of the suballocation, in bytes.
+/// \param [in] pUserData      - User data pointer provided in BufferSuballocatorDefragmentAttribs.
+typedef void(DILIGENT_CALL_TYPE* BufferSuballocationMovedCallbackType)(IBufferSuballocation* pSuballocation, Uint32 OldOffset, void* pUserData);
+
+
+/// Buffer suballocator defragmentation attributes.
+struct BufferSuballocatorDefragmentAttribs
+{
+    /// The maximum number of bytes to move in one call to Defragment().
+
+    /// If zero, all suballocations that can be moved to lower offsets are moved at once.
+    /// When the budget is smaller than the next suballocation to move, that suballocation
+    /// is still moved to guarantee progress.
+    Uint64 MaxMoveSize = 0;
+
+    /// An optional callback that is called for every suballocation that has been moved.
+    BufferSuballocationMovedCallbackType SuballocationMoved = nullptr;
+
+    /// User data that is passed to the SuballocationMoved callback.
+    void* pUserData = nullptr;
+};
+
 /// Buffer suballocator.
 struct IBufferSuballocator : public IObject
 {
@@ -154,8 +191,36 @@ struct IBufferSuballocator : public IObject
 
 
     /// Returns the internal buffer version. The version is incremented every time
-    /// the buffer is expanded.
+    /// the buffer is expanded or shrunk.
     virtual Uint32 GetVersion() const = 0;
+
+
+    /// Incrementally compacts the suballocations towards the beginning of the buffer.
+
+    /// \param[in]  pDevice  - A pointer to the render device that will be used to create
+    ///                        the scratch buffer and the new internal buffer, if necessary.
+    /// \param[in]  pContext - A pointer to the device context that will be used to record
+    ///                        copy commands.
+    /// \param[in]  Attribs  - Defragmentation attributes, see Diligent::BufferSuballocatorDefragmentAttribs.
+    ///
+    /// \return     The number of bytes moved by this call.
+    ///
+    /// \remarks    Suballocations are processed starting from the highest offset and are moved to
+    ///             the lowest free region that can accommodate them. The data is copied by the GPU
+    ///             through a scratch buffer, and IBufferSuballocation::GetOffset() returns the new
+    ///             offset once the method returns. Once no more suballocations can be moved within
+    ///             the budget, the free space at the end of the buffer is released and the internal
+    ///             buffer is shrunk (but never below its initial size), which increments the buffer version.
+    ///
+    ///             Copy commands are recorded into pContext, so any commands that access the moved
+    ///             suballocations must be recorded after this call. Regions vacated by moved suballocations
+    ///             may be immediately reused by new allocations.
+    ///
+    ///             The method is not thread-safe with respect to Update() and must be called from the same
+    ///             thread. Allocate() may be called from other threads simultaneously.
+    virtual Uint64 Defragment(IRenderDevice*                             pDevice,
+                              IDeviceContext*                            pContext,
+                              const BufferSuballocatorDefragmentAttribs& Attribs) = 0;
 };
 
 /// Buffer suballocator create information.
@@ -0,0 +1,100 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Defines Diligent::IShaderIncludeCache interface
+
+#include "../../GraphicsEngine/interface/Shader.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "XXH128Hasher.hpp"
+
+namespace Diligent
+{
+
+// {4B0C7A1E-52D3-4F6B-A0E4-3D2F9C18B7A5}
+static constexpr INTERFACE_ID IID_ShaderIncludeCache =
+    {0x4b0c7a1e, 0x52d3, 0x4f6b, {0xa0, 0xe4, 0x3d, 0x2f, 0x9c, 0x18, 0xb7, 0xa5}};
+
+/// Shader include cache interface.
+
+/// The include cache is a shader source input stream factory that wraps another factory
+/// and memoizes the contents of every file it reads together with their XXH128 hashes.
+/// It also memoizes the include closure of every shader source file so that computing the hash
+/// of a shader create info (see XXH128State::Update) does not require re-reading and re-parsing
+/// all includes for every shader variant.
+///
+/// \remarks    The cache is intended to be used for the lifetime of a compilation session
+///             (e.g. by passing it as ShaderCreateInfo::pShaderSourceStreamFactory to
+///             IRenderStateCache or IBytecodeCache). If the source files may change on disk,
+///             call Invalidate() to make the cache re-read them on next access.
+///
+///             All methods are thread-safe.
+class IShaderIncludeCache : public IShaderSourceInputStreamFactory
+{
+public:
+    /// Returns the hash of the contents of the file with the given path.
+
+    /// \param [in]  Path - File path.
+    /// \param [out] Hash - File contents hash.
+    /// \return      true if the file was found, and false otherwise.
+    virtual bool GetFileHash(const Char* Path, XXH128Hash& Hash) = 0;
+
+    /// Computes the combined hash of the shader source and all files it includes.
+
+    /// \param [in]  ShaderCI - Shader create info. Either Source or FilePath must not be null.
+    ///                         ShaderCI.pShaderSourceStreamFactory is ignored: all includes are
+    ///                         loaded through the cache.
+    /// \param [out] Hash     - Combined source hash.
+    /// \return      true if all sources were processed successfully, and false otherwise.
+    ///
+    /// \remarks    The include closure of a file does not depend on shader macros, so the result is
+    ///             computed once per file and is reused by all variants of the shader.
+    ///             Note that the hash is computed from the hashes of individual files rather than from their
+    ///             contents, so it is different from the one produced when the include cache is not used.
+    virtual bool GetSourceHash(const ShaderCreateInfo& ShaderCI, XXH128Hash& Hash) = 0;
+
+    /// Invalidates all cached data.
+
+    /// \return     The new invalidation stamp.
+    ///
+    /// \remarks    Invalidation is cheap: it only increments the stamp. Stale entries are re-read
+    ///             lazily when they are accessed next time.
+    virtual Uint32 Invalidate() = 0;
+
+    /// Returns the current invalidation stamp.
+    virtual Uint32 GetStamp() const = 0;
+};
+
+/// Creates a shader include cache.
+
+/// \param [in] pFactory - Shader source input stream factory that the cache will use
+///                        to load the files it does not have.
+/// \return     The new include cache.
+RefCntAutoPtr<IShaderIncludeCache> CreateShaderIncludeCache(IShaderSourceInputStreamFactory* pFactory);
+
+} // namespace Diligent
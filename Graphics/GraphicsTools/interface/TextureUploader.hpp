@@ -66,6 +66,16 @@ public:
 /// Texture uploader description.
 struct TextureUploaderDesc
 {
+    /// The maximum number of bytes that ITextureUploader::RenderThreadUpdate() copies from
+    /// upload buffers to destination textures in one call. Copies that exceed the budget
+    /// are deferred to the next call, which bounds frame time spikes when many textures
+    /// are streamed at once. At least one copy is always executed. Zero means no limit.
+    ///
+    /// When the budget is set, copies scheduled from the render thread are executed by
+    /// RenderThreadUpdate() as well, in the same order as the copies scheduled by worker threads.
+    ///
+    /// \note  The budget is currently honored by Direct3D12 and Vulkan texture uploaders.
+    Uint64 MaxCopyBytesPerUpdate = 0;
 };
 
 
@@ -105,6 +105,13 @@ struct VertexPoolUsageStats
     /// The number of allocations.
     Uint32 AllocationCount = 0;
 
+    /// The total number of vertices moved by defragmentation.
+    Uint64 MovedVertexCount = 0;
+
+    /// The total memory size released by shrinking the internal buffers
+    /// after defragmentation, in bytes.
+    Uint64 ReclaimedMemorySize = 0;
+
     VertexPoolUsageStats& operator+=(const VertexPoolUsageStats& RHS)
     {
         TotalVertexCount += RHS.TotalVertexCount;
@@ -112,11 +119,41 @@ struct VertexPoolUsageStats
         CommittedMemorySize += RHS.CommittedMemorySize;
         UsedMemorySize += RHS.UsedMemorySize;
         AllocationCount += RHS.AllocationCount;
+        MovedVertexCount += RHS.MovedVertexCount;
+        ReclaimedMemorySize += RHS.ReclaimedMemorySize;
         return *this;
     }
 };
 
 
+/// Callback function that is called by IVertexPool::Defragment() for every
+/// allocation that has been moved to a new location.
+
+/// \param [in] pAllocation    - The allocation that has been moved. Its GetStartVertex() method
+///                              returns the new start vertex.
+/// \param [in] OldStartVertex - The previous start vertex of the allocation.
+/// \param [in] pUserData      - User data pointer provided in VertexPoolDefragmentAttribs.
+typedef void(DILIGENT_CALL_TYPE* VertexPoolAllocationMovedCallbackType)(IVertexPoolAllocation* pAllocation, Uint32 OldStartVertex, void* pUserData);
+
+
+/// Vertex pool defragmentation attributes.
+struct VertexPoolDefragmentAttribs
+{
+    /// The maximum number of vertices to move in one call to Defragment().
+
+    /// If zero, all allocations that can be moved to lower offsets are moved at once.
+    /// When the budget is smaller than the next allocation to move, that allocation
+    /// is still moved to guarantee progress.
+    Uint32 MaxMoveVertexCount DEFAULT_INITIALIZER(0);
+
+    /// An optional callback that is called for every allocation that has been moved.
+    VertexPoolAllocationMovedCallbackType AllocationMoved DEFAULT_INITIALIZER(nullptr);
+
+    /// User data that is passed to the AllocationMoved callback.
+    void* pUserData DEFAULT_INITIALIZER(nullptr);
+};
+
+
 /// Vertex pool element description.
 struct VertexPoolElementDesc
 {
@@ -259,6 +296,33 @@ struct IVertexPool : public IObject
 
     /// Returns the pool description.
     virtual const VertexPoolDesc& GetDesc() const = 0;
+
+
+    /// Incrementally compacts the allocations towards the beginning of the pool.
+
+    /// \param[in]  pDevice  - A pointer to the render device that will be used to create
+    ///                        the scratch buffer and the new internal buffers, if necessary.
+    /// \param[in]  pContext - A pointer to the device context that will be used to record
+    ///                        copy commands.
+    /// \param[in]  Attribs  - Defragmentation attributes, see Diligent::VertexPoolDefragmentAttribs.
+    ///
+    /// \return     The number of vertices moved by this call.
+    ///
+    /// \remarks    Allocations are processed starting from the highest start vertex and are moved
+    ///             to the lowest free range that can accommodate them. The data of all internal buffers
+    ///             is copied by the GPU through a scratch buffer, and IVertexPoolAllocation::GetStartVertex()
+    ///             returns the new start vertex once the method returns. Once no more allocations can be
+    ///             moved within the budget, the free space at the end of the pool is released and the internal
+    ///             buffers are shrunk (but never below the initial vertex count).
+    ///
+    ///             Copy commands are recorded into pContext, so any commands that access the moved
+    ///             allocations must be recorded after this call.
+    ///
+    ///             The method is not thread-safe with respect to Update() and must be called from the same
+    ///             thread. Allocate() may be called from other threads simultaneously.
+    virtual Uint32 Defragment(IRenderDevice*                     pDevice,
+                              IDeviceContext*                    pContext,
+                              const VertexPoolDefragmentAttribs& Attribs) = 0;
 };
 
 
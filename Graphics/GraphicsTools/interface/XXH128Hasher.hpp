@@ -47,6 +47,11 @@ struct XXH128Hash
     {
         return LowPart == RHS.LowPart && HighPart == RHS.HighPart;
     }
+
+    constexpr bool operator!=(const XXH128Hash& RHS) const noexcept
+    {
+        return !(*this == RHS);
+    }
 };
 
 struct XXH128State final
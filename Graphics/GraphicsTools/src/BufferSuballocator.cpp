@@ -29,6 +29,8 @@
 
 #include <mutex>
 #include <atomic>
+#include <vector>
+#include <algorithm>
 
 #include "DebugUtilities.hpp"
 #include "ObjectBase.hpp"
@@ -52,13 +54,15 @@ public:
                             BufferSuballocatorImpl*                      pParentAllocator,
                             Uint32                                       Offset,
                             Uint32                                       Size,
+                            Uint32                                       Alignment,
                             VariableSizeAllocationsManager::Allocation&& Subregion) :
         // clang-format off
         TBase             {pRefCounters},
         m_pParentAllocator{pParentAllocator},
         m_Subregion       {std::move(Subregion)},
         m_Offset          {Offset},
-        m_Size            {Size}
+        m_Size            {Size},
+        m_Alignment       {Alignment}
     // clang-format on
     {
         VERIFY_EXPR(m_pParentAllocator);
@@ -83,7 +87,7 @@ public:
 
     virtual Uint32 GetOffset() const override final
     {
-        return m_Offset;
+        return m_Offset.load();
     }
 
     virtual Uint32 GetSize() const override final
@@ -108,12 +112,20 @@ public:
     }
 
 private:
+    friend class BufferSuballocatorImpl;
+
     RefCntAutoPtr<BufferSuballocatorImpl> m_pParentAllocator;
 
+    // The subregion and the links are protected by the parent allocator mutex.
     VariableSizeAllocationsManager::Allocation m_Subregion;
 
-    const Uint32 m_Offset;
-    const Uint32 m_Size;
+    BufferSuballocationImpl* m_pPrevLive = nullptr;
+    BufferSuballocationImpl* m_pNextLive = nullptr;
+
+    // The offset is changed by the defragmentation and may be read from other threads.
+    std::atomic<Uint32> m_Offset;
+    const Uint32        m_Size;
+    const Uint32        m_Alignment;
 
     RefCntAutoPtr<IObject> m_pUserData;
 };
@@ -142,6 +154,7 @@ public:
 
                 return MaxSize;
             }(CreateInfo.Desc.Size, CreateInfo.MaxSize)},
+        m_InitialSize{CreateInfo.Desc.Size},
         m_ExpansionSize{CreateInfo.ExpansionSize},
         m_Mgr{
             VariableSizeAllocationsManager::CreateInfo{
@@ -171,6 +184,7 @@ public:
     ~BufferSuballocatorImpl()
     {
         VERIFY_EXPR(m_AllocationCount.load() == 0);
+        VERIFY_EXPR(m_pLiveSuballocations == nullptr);
     }
 
     virtual IBuffer* Update(IRenderDevice* pDevice, IDeviceContext* pContext) override final
@@ -217,7 +231,7 @@ public:
 
         DEV_CHECK_ERR(*ppSuballocation == nullptr, "Overwriting reference to existing object may cause memory leaks");
 
-        VariableSizeAllocationsManager::Allocation Subregion;
+        BufferSuballocationImpl* pSuballocation = nullptr;
         {
             std::lock_guard<std::mutex> Lock{m_MgrMtx};
 
@@ -234,7 +248,7 @@ public:
                 }
             }
 
-            Subregion = m_Mgr.Allocate(Size, Alignment);
+            VariableSizeAllocationsManager::Allocation Subregion = m_Mgr.Allocate(Size, Alignment);
 
             while (!Subregion.IsValid() && (m_MaxSize == 0 || m_MaxSize > m_Mgr.GetMaxSize()))
             {
@@ -252,31 +266,51 @@ public:
             }
 
             UpdateUsageStats();
+
+            if (Subregion.IsValid())
+            {
+                // clang-format off
+                pSuballocation =
+                    NEW_RC_OBJ(m_SuballocationsAllocator, "BufferSuballocationImpl instance", BufferSuballocationImpl)
+                    (
+                        this,
+                        AlignUp(static_cast<Uint32>(Subregion.UnalignedOffset), Alignment),
+                        Size,
+                        Alignment,
+                        std::move(Subregion)
+                    );
+                // clang-format on
+
+                // Keep track of live suballocations so that they can be moved by Defragment()
+                pSuballocation->m_pNextLive = m_pLiveSuballocations;
+                if (m_pLiveSuballocations != nullptr)
+                    m_pLiveSuballocations->m_pPrevLive = pSuballocation;
+                m_pLiveSuballocations = pSuballocation;
+            }
         }
 
-        if (Subregion.IsValid())
+        if (pSuballocation != nullptr)
         {
-            // clang-format off
-            BufferSuballocationImpl* pSuballocation{
-                NEW_RC_OBJ(m_SuballocationsAllocator, "BufferSuballocationImpl instance", BufferSuballocationImpl)
-                (
-                    this,
-                    AlignUp(static_cast<Uint32>(Subregion.UnalignedOffset), Alignment),
-                    Size,
-                    std::move(Subregion)
-                )
-            };
-            // clang-format on
-
             pSuballocation->QueryInterface(IID_BufferSuballocation, reinterpret_cast<IObject**>(ppSuballocation));
             m_AllocationCount.fetch_add(1);
         }
     }
 
-    void Free(VariableSizeAllocationsManager::Allocation&& Subregion)
+    void Free(BufferSuballocationImpl& Suballocation)
     {
         std::lock_guard<std::mutex> Lock{m_MgrMtx};
-        m_Mgr.Free(std::move(Subregion));
+
+        if (Suballocation.m_pPrevLive != nullptr)
+            Suballocation.m_pPrevLive->m_pNextLive = Suballocation.m_pNextLive;
+        else
+        {
+            VERIFY_EXPR(m_pLiveSuballocations == &Suballocation);
+            m_pLiveSuballocations = Suballocation.m_pNextLive;
+        }
+        if (Suballocation.m_pNextLive != nullptr)
+            Suballocation.m_pNextLive->m_pPrevLive = Suballocation.m_pPrevLive;
+
+        m_Mgr.Free(std::move(Suballocation.m_Subregion));
         m_AllocationCount.fetch_add(-1);
         UpdateUsageStats();
     }
@@ -293,6 +327,166 @@ public:
         UsageStats.UsedSize         = m_UsedSize.load();
         UsageStats.MaxFreeChunkSize = m_MaxFreeBlockSize.load();
         UsageStats.AllocationCount  = m_AllocationCount.load();
+        UsageStats.MovedSize        = m_MovedSize.load();
+        UsageStats.ReclaimedSize    = m_ReclaimedSize.load();
+    }
+
+    virtual Uint64 Defragment(IRenderDevice*                             pDevice,
+                              IDeviceContext*                            pContext,
+                              const BufferSuballocatorDefragmentAttribs& Attribs) override final
+    {
+        if (pDevice == nullptr || pContext == nullptr)
+        {
+            UNEXPECTED("pDevice and pContext must not be null");
+            return 0;
+        }
+
+        IBuffer* pBuffer = Update(pDevice, pContext);
+        if (pBuffer == nullptr)
+            return 0;
+
+        struct SuballocationMove
+        {
+            BufferSuballocationImpl* pSuballocation = nullptr;
+
+            // Strong reference that keeps the suballocation alive until the move is complete
+            RefCntAutoPtr<IObject> pKeepAlive;
+
+            VariableSizeAllocationsManager::Allocation NewSubregion;
+
+            Uint32 OldOffset     = 0;
+            Uint32 NewOffset     = 0;
+            Uint64 ScratchOffset = 0;
+        };
+        std::vector<SuballocationMove> Moves;
+
+        Uint64 MovedSize       = 0;
+        Uint64 ScratchSize     = 0;
+        bool   BudgetExhausted = false;
+        {
+            std::lock_guard<std::mutex> Lock{m_MgrMtx};
+
+            const auto BufferSize = m_BufferSize.load();
+            for (auto* pSuballocation = m_pLiveSuballocations; pSuballocation != nullptr; pSuballocation = pSuballocation->m_pNextLive)
+            {
+                // Suballocations in the space that has not been added to the buffer yet have no data to move
+                const auto& Subregion = pSuballocation->m_Subregion;
+                if (Subregion.UnalignedOffset + Subregion.Size <= BufferSize)
+                {
+                    Moves.emplace_back();
+                    Moves.back().pSuballocation = pSuballocation;
+                    Moves.back().OldOffset      = pSuballocation->m_Offset.load();
+                }
+            }
+
+            // Process suballocations starting from the end of the buffer
+            std::sort(Moves.begin(), Moves.end(),
+                      [](const SuballocationMove& lhs, const SuballocationMove& rhs) {
+                          return lhs.OldOffset > rhs.OldOffset;
+                      });
+
+            size_t NumMoves = 0;
+            for (auto& Move : Moves)
+            {
+                auto* const pSuballocation = Move.pSuballocation;
+                if (Attribs.MaxMoveSize != 0 && MovedSize > 0 && MovedSize + pSuballocation->m_Size > Attribs.MaxMoveSize)
+                {
+                    BudgetExhausted = true;
+                    break;
+                }
+
+                // Old subregion remains allocated until the copy commands are recorded
+                Move.NewSubregion = m_Mgr.AllocateBelow(pSuballocation->m_Size, pSuballocation->m_Alignment, pSuballocation->m_Subregion.UnalignedOffset);
+                if (!Move.NewSubregion.IsValid())
+                    continue;
+
+                // Suballocations whose reference count has reached zero are being destroyed
+                // and are waiting for the mutex to release their subregions.
+                // NB: the strong reference must not be released while the mutex is locked.
+                pSuballocation->GetReferenceCounters()->QueryObject(&Move.pKeepAlive);
+                if (!Move.pKeepAlive)
+                {
+                    m_Mgr.Free(std::move(Move.NewSubregion));
+                    continue;
+                }
+
+                Move.NewOffset     = AlignUp(static_cast<Uint32>(Move.NewSubregion.UnalignedOffset), pSuballocation->m_Alignment);
+                Move.ScratchOffset = ScratchSize;
+                ScratchSize        = AlignUp(ScratchSize + pSuballocation->m_Size, Uint64{16});
+                MovedSize += pSuballocation->m_Size;
+
+                Moves[NumMoves++] = std::move(Move);
+            }
+            Moves.resize(NumMoves);
+        }
+
+        if (!Moves.empty())
+        {
+            if (!m_pScratchBuffer || m_pScratchBuffer->GetDesc().Size < ScratchSize)
+            {
+                m_pScratchBuffer.Release();
+
+                BufferDesc ScratchDesc;
+                ScratchDesc.Name  = "Buffer suballocator defragmentation scratch buffer";
+                ScratchDesc.Size  = ScratchSize;
+                ScratchDesc.Usage = USAGE_DEFAULT;
+                pDevice->CreateBuffer(ScratchDesc, nullptr, &m_pScratchBuffer);
+            }
+
+            if (!m_pScratchBuffer)
+            {
+                LOG_ERROR_MESSAGE("Failed to create defragmentation scratch buffer");
+
+                std::lock_guard<std::mutex> Lock{m_MgrMtx};
+                for (auto& Move : Moves)
+                    m_Mgr.Free(std::move(Move.NewSubregion));
+                UpdateUsageStats();
+                return 0;
+            }
+
+            // Copy all suballocations to the scratch buffer first to minimize the number of state transitions
+            for (const auto& Move : Moves)
+            {
+                pContext->CopyBuffer(pBuffer, Move.OldOffset, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                                     m_pScratchBuffer, Move.ScratchOffset, Move.pSuballocation->m_Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            }
+            for (const auto& Move : Moves)
+            {
+                pContext->CopyBuffer(m_pScratchBuffer, Move.ScratchOffset, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                                     pBuffer, Move.NewOffset, Move.pSuballocation->m_Size, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> Lock{m_MgrMtx};
+
+            for (auto& Move : Moves)
+            {
+                auto* const pSuballocation = Move.pSuballocation;
+                m_Mgr.Free(std::move(pSuballocation->m_Subregion));
+                pSuballocation->m_Subregion = std::move(Move.NewSubregion);
+                pSuballocation->m_Offset.store(Move.NewOffset);
+            }
+
+            if (!BudgetExhausted)
+            {
+                // No more suballocations can be moved - release the free space at the end of the buffer
+                ShrinkBuffer(pDevice, pContext);
+                m_pScratchBuffer.Release();
+            }
+
+            UpdateUsageStats();
+        }
+        m_MovedSize.fetch_add(MovedSize);
+
+        if (Attribs.SuballocationMoved != nullptr)
+        {
+            for (const auto& Move : Moves)
+                Attribs.SuballocationMoved(Move.pSuballocation, Move.OldOffset, Attribs.pUserData);
+        }
+
+        // NB: the suballocations may be released when Moves goes out of scope, which requires the mutex to be unlocked.
+        return MovedSize;
     }
 
 private:
@@ -302,12 +496,52 @@ private:
         m_MaxFreeBlockSize.store(m_Mgr.GetMaxFreeBlockSize());
     }
 
+    // Must be called with m_MgrMtx locked
+    void ShrinkBuffer(IRenderDevice* pDevice, IDeviceContext* pContext)
+    {
+        const auto MgrSize    = m_Mgr.GetMaxSize();
+        const auto BufferSize = m_Buffer.GetDesc().Size;
+        if (MgrSize != BufferSize)
+        {
+            // The manager has been expanded by another thread, and the buffer has not been updated yet
+            return;
+        }
+
+        // Use the same size steps as the expansion to avoid growing the buffer back on the next allocation
+        const Uint64 UsedEnd = MgrSize - m_Mgr.GetTailFreeSize();
+        Uint64       NewSize = m_InitialSize;
+        while (NewSize < UsedEnd)
+        {
+            const Uint64 Step = m_ExpansionSize != 0 ? m_ExpansionSize : NewSize;
+            if (Step == 0)
+            {
+                NewSize = UsedEnd;
+                break;
+            }
+            NewSize += Step;
+        }
+        if (NewSize >= MgrSize)
+            return;
+
+        m_Mgr.Shrink(StaticCast<size_t>(MgrSize - NewSize));
+        m_MgrSize.store(m_Mgr.GetMaxSize());
+
+        m_Buffer.Resize(pDevice, pContext, NewSize);
+        // For sparse buffers, the new size is aligned up by the memory page size
+        const auto NewBufferSize = m_Buffer.GetDesc().Size;
+        m_BufferSize.store(NewBufferSize);
+        if (NewBufferSize < BufferSize)
+            m_ReclaimedSize.fetch_add(BufferSize - NewBufferSize);
+    }
+
 private:
     const Uint64 m_MaxSize;
+    const Uint64 m_InitialSize;
     const Uint32 m_ExpansionSize;
 
     std::mutex                     m_MgrMtx;
     VariableSizeAllocationsManager m_Mgr;
+    BufferSuballocationImpl*       m_pLiveSuballocations = nullptr;
 
     std::atomic<VariableSizeAllocationsManager::OffsetType> m_MgrSize{0};
 
@@ -317,6 +551,10 @@ private:
     std::atomic<Int32>  m_AllocationCount{0};
     std::atomic<Uint64> m_UsedSize{0};
     std::atomic<Uint64> m_MaxFreeBlockSize{0};
+    std::atomic<Uint64> m_MovedSize{0};
+    std::atomic<Uint64> m_ReclaimedSize{0};
+
+    RefCntAutoPtr<IBuffer> m_pScratchBuffer;
 
     FixedBlockMemoryAllocator m_SuballocationsAllocator;
 };
@@ -324,7 +562,7 @@ private:
 
 BufferSuballocationImpl::~BufferSuballocationImpl()
 {
-    m_pParentAllocator->Free(std::move(m_Subregion));
+    m_pParentAllocator->Free(*this);
 }
 
 IBufferSuballocator* BufferSuballocationImpl::GetAllocator()
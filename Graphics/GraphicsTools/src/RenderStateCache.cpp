@@ -538,6 +538,9 @@ RenderStateCacheImpl::RenderStateCacheImpl(IReferenceCounters*               pRe
         case RENDER_DEVICE_TYPE_WEBGPU:
             break;
 
+        case RENDER_DEVICE_TYPE_NULL:
+            LOG_ERROR_AND_THROW("Render state cache is not supported by Null backend: shaders are not compiled and objects can't be unpacked from archives");
+
         default:
             UNEXPECTED("Unknown device type");
     }
@@ -0,0 +1,250 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ShaderIncludeCache.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "ObjectBase.hpp"
+#include "HashUtils.hpp"
+#include "DataBlobImpl.hpp"
+#include "MemoryFileStream.hpp"
+#include "ShaderToolsCommon.hpp"
+
+namespace Diligent
+{
+
+class ShaderIncludeCacheImpl final : public ObjectBase<IShaderIncludeCache>
+{
+public:
+    using TBase = ObjectBase<IShaderIncludeCache>;
+
+    ShaderIncludeCacheImpl(IReferenceCounters*              pRefCounters,
+                           IShaderSourceInputStreamFactory* pFactory) :
+        TBase{pRefCounters},
+        m_pFactory{pFactory}
+    {
+        DEV_CHECK_ERR(m_pFactory != nullptr, "Shader source input stream factory must not be null");
+    }
+
+    IMPLEMENT_QUERY_INTERFACE2_IN_PLACE(IID_ShaderIncludeCache, IID_IShaderSourceInputStreamFactory, TBase)
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream(const Char*   Name,
+                                                      IFileStream** ppStream) override final
+    {
+        CreateInputStream2(Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE, ppStream);
+    }
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream2(const Char*                             Name,
+                                                       CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
+                                                       IFileStream**                           ppStream) override final
+    {
+        VERIFY_EXPR(ppStream != nullptr && *ppStream == nullptr);
+        if (auto pFile = GetFile(Name, Flags))
+        {
+            // All streams share the same read-only data blob
+            RefCntAutoPtr<MemoryFileStream> pMemStream{MakeNewRCObj<MemoryFileStream>()(pFile->pData)};
+            pMemStream->QueryInterface(IID_FileStream, reinterpret_cast<IObject**>(ppStream));
+        }
+    }
+
+    virtual bool GetFileHash(const Char* Path, XXH128Hash& Hash) override final
+    {
+        auto pFile = GetFile(Path, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE);
+        if (!pFile)
+            return false;
+
+        Hash = pFile->Hash;
+        return true;
+    }
+
+    virtual bool GetSourceHash(const ShaderCreateInfo& ShaderCI, XXH128Hash& Hash) override final
+    {
+        if (ShaderCI.Source == nullptr && ShaderCI.FilePath == nullptr)
+        {
+            DEV_ERROR("Either Source or FilePath must not be null");
+            return false;
+        }
+
+        const Uint32     Stamp = m_Stamp.load();
+        const XXH128Hash Key   = ComputeSourceKey(ShaderCI);
+        {
+            std::lock_guard<std::mutex> Guard{m_SourcesMtx};
+
+            auto it = m_Sources.find(Key);
+            if (it != m_Sources.end() && it->second.Stamp == Stamp)
+            {
+                Hash = it->second.Hash;
+                return true;
+            }
+        }
+
+        ShaderCreateInfo IncludeCI{ShaderCI};
+        IncludeCI.pShaderSourceStreamFactory = this;
+
+        XXH128State Hasher;
+        bool        AllFilesFound = true;
+
+        const bool Result = ProcessShaderIncludes(IncludeCI, [&](const ShaderIncludePreprocessInfo& ProcessInfo) {
+            if (!ProcessInfo.FilePath.empty())
+            {
+                // The file has just been read through the cache, so this is a lookup
+                XXH128Hash FileHash;
+                if (GetFileHash(ProcessInfo.FilePath.c_str(), FileHash))
+                    Hasher.Update(FileHash.LowPart, FileHash.HighPart);
+                else
+                    AllFilesFound = false;
+            }
+            else if (ProcessInfo.SourceLength > 0)
+            {
+                // Inline shader source
+                Hasher.UpdateStr(ProcessInfo.Source, ProcessInfo.SourceLength);
+            }
+        });
+        if (!Result || !AllFilesFound)
+            return false;
+
+        Hash = Hasher.Digest();
+        {
+            std::lock_guard<std::mutex> Guard{m_SourcesMtx};
+            m_Sources[Key] = {Hash, Stamp};
+        }
+        return true;
+    }
+
+    virtual Uint32 Invalidate() override final
+    {
+        return m_Stamp.fetch_add(1) + 1;
+    }
+
+    virtual Uint32 GetStamp() const override final
+    {
+        return m_Stamp.load();
+    }
+
+private:
+    struct FileData
+    {
+        RefCntAutoPtr<IDataBlob> pData;
+        XXH128Hash               Hash;
+        Uint32                   Stamp = 0;
+    };
+
+    std::shared_ptr<const FileData> GetFile(const Char* Path, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags)
+    {
+        if (Path == nullptr)
+        {
+            UNEXPECTED("File path must not be null");
+            return {};
+        }
+
+        const Uint32 Stamp = m_Stamp.load();
+        {
+            std::lock_guard<std::mutex> Guard{m_FilesMtx};
+
+            auto it = m_Files.find(Path);
+            if (it != m_Files.end() && it->second->Stamp == Stamp)
+                return it->second;
+        }
+
+        // Read the file outside of the lock. If two threads race to read the same file,
+        // both will get the same data and one of the entries will simply be overwritten.
+        RefCntAutoPtr<IFileStream> pSourceStream;
+        m_pFactory->CreateInputStream2(Path, Flags, &pSourceStream);
+        if (!pSourceStream)
+            return {};
+
+        auto pFile   = std::make_shared<FileData>();
+        pFile->pData = DataBlobImpl::Create();
+        pSourceStream->ReadBlob(pFile->pData);
+        pFile->Stamp = Stamp;
+
+        XXH128State Hasher;
+        if (const size_t Size = pFile->pData->GetSize())
+            Hasher.UpdateRaw(pFile->pData->GetConstDataPtr(), Size);
+        pFile->Hash = Hasher.Digest();
+
+        {
+            std::lock_guard<std::mutex> Guard{m_FilesMtx};
+
+            auto it = m_Files.find(Path);
+            if (it != m_Files.end())
+                it->second = pFile;
+            else
+                m_Files.emplace(HashMapStringKey{Path, true}, pFile);
+        }
+
+        return pFile;
+    }
+
+    static XXH128Hash ComputeSourceKey(const ShaderCreateInfo& ShaderCI)
+    {
+        enum class SourceKeyType : Uint8
+        {
+            File,
+            Inline
+        };
+
+        XXH128State Hasher;
+        if (ShaderCI.Source != nullptr)
+        {
+            Hasher.Update(SourceKeyType::Inline);
+            Hasher.UpdateStr(ShaderCI.Source, ShaderCI.SourceLength);
+        }
+        else
+        {
+            Hasher.Update(SourceKeyType::File);
+            Hasher.UpdateStr(ShaderCI.FilePath);
+        }
+        return Hasher.Digest();
+    }
+
+private:
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> m_pFactory;
+
+    std::atomic<Uint32> m_Stamp{0};
+
+    std::mutex                                                            m_FilesMtx;
+    std::unordered_map<HashMapStringKey, std::shared_ptr<const FileData>> m_Files;
+
+    struct SourceHashInfo
+    {
+        XXH128Hash Hash;
+        Uint32     Stamp = 0;
+    };
+    std::mutex                                     m_SourcesMtx;
+    std::unordered_map<XXH128Hash, SourceHashInfo> m_Sources;
+};
+
+RefCntAutoPtr<IShaderIncludeCache> CreateShaderIncludeCache(IShaderSourceInputStreamFactory* pFactory)
+{
+    return RefCntAutoPtr<IShaderIncludeCache>{MakeNewRCObj<ShaderIncludeCacheImpl>()(pFactory)};
+}
+
+} // namespace Diligent
@@ -32,7 +32,7 @@
 #    include "TextureUploaderD3D11.hpp"
 #endif
 
-#if D3D12_SUPPORTED || VULKAN_SUPPORTED
+#if D3D12_SUPPORTED || VULKAN_SUPPORTED || NULL_SUPPORTED
 #    include "TextureUploaderD3D12_Vk.hpp"
 #endif
 
@@ -65,6 +65,14 @@ void CreateTextureUploader(IRenderDevice* pDevice, const TextureUploaderDesc& De
             break;
 #endif
 
+#if NULL_SUPPORTED
+        case RENDER_DEVICE_TYPE_NULL:
+            // D3D12/Vulkan uploader only uses staging textures and fences, which
+            // are fully implemented by the Null backend.
+            *ppUploader = MakeNewRCObj<TextureUploaderD3D12_Vk>()(pDevice, Desc);
+            break;
+#endif
+
 #if GL_SUPPORTED || GLES_SUPPORTED
         case RENDER_DEVICE_TYPE_GLES:
         case RENDER_DEVICE_TYPE_GL:
@@ -28,10 +28,12 @@
 #include <mutex>
 #include <unordered_map>
 #include <deque>
-#include <vector>
+#include <array>
+#include <atomic>
 
 #include "TextureUploaderD3D12_Vk.hpp"
 #include "ThreadSignal.hpp"
+#include "MPSCQueue.hpp"
 #include "GraphicsAccessories.hpp"
 
 namespace Diligent
@@ -51,6 +53,10 @@ public:
         m_pStagingTexture{pStagingTexture}
     // clang-format on
     {
+        const TextureDesc& StagingTexDesc = m_pStagingTexture->GetDesc();
+        for (Uint32 Mip = 0; Mip < StagingTexDesc.MipLevels; ++Mip)
+            m_DataSize += GetMipLevelProperties(StagingTexDesc, Mip).MipSize;
+        m_DataSize *= StagingTexDesc.GetArraySize();
     }
 
     ~UploadTexture()
@@ -110,7 +116,10 @@ public:
 
     ITexture* GetStagingTexture() { return m_pStagingTexture; }
 
-    bool DbgIsCopyScheduled() const
+    // Returns the total size of all subresources of the staging texture
+    Uint64 GetDataSize() const { return m_DataSize; }
+
+    bool IsCopyScheduled() const
     {
         return m_CopyScheduledSignal.IsTriggered();
     }
@@ -132,6 +141,7 @@ private:
 
     RefCntAutoPtr<ITexture> m_pStagingTexture;
     Uint64                  m_CopyScheduledFenceValue = 0;
+    Uint64                  m_DataSize                = 0;
 };
 
 } // namespace
@@ -166,7 +176,8 @@ struct TextureUploaderD3D12_Vk::InternalData
         // clang-format on
     };
 
-    InternalData(IRenderDevice* pDevice)
+    InternalData(IRenderDevice* pDevice, const TextureUploaderDesc& Desc) :
+        m_MaxCopyBytesPerUpdate{Desc.MaxCopyBytesPerUpdate}
     {
         FenceDesc fenceDesc;
         fenceDesc.Name = "Texture uploader sync fence";
@@ -175,38 +186,36 @@ struct TextureUploaderD3D12_Vk::InternalData
 
     ~InternalData()
     {
-        for (auto it : m_UploadTexturesCache)
+        for (const auto& Shard : m_UploadTexturesCache)
         {
-            if (it.second.size())
+            for (const auto& it : Shard.Textures)
             {
-                const auto& desc    = it.first;
-                auto&       FmtInfo = GetTextureFormatAttribs(desc.Format);
-                LOG_INFO_MESSAGE("TextureUploaderD3D12_Vk: releasing ", it.second.size(), ' ',
-                                 desc.Width, 'x', desc.Height, 'x', desc.Depth, ' ', FmtInfo.Name,
-                                 " upload buffer(s)", (it.second.size() == 1 ? "" : "s"));
+                if (it.second.size())
+                {
+                    const auto& desc    = it.first;
+                    auto&       FmtInfo = GetTextureFormatAttribs(desc.Format);
+                    LOG_INFO_MESSAGE("TextureUploaderD3D12_Vk: releasing ", it.second.size(), ' ',
+                                     desc.Width, 'x', desc.Height, 'x', desc.Depth, ' ', FmtInfo.Name,
+                                     " upload buffer(s)", (it.second.size() == 1 ? "" : "s"));
+                }
             }
         }
     }
 
-    std::vector<PendingBufferOperation>& SwapMapQueues()
-    {
-        std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
-        m_PendingOperations.swap(m_InWorkOperations);
-        return m_InWorkOperations;
-    }
-
     void EnqueueCopy(UploadTexture* pUploadBuffer, ITexture* pDstTex, Uint32 dstSlice, Uint32 dstMip)
     {
-        std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
-        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Copy, pUploadBuffer, pDstTex, dstSlice, dstMip);
+        m_PendingOperations.Push(PendingBufferOperation::Operation::Copy, pUploadBuffer, pDstTex, dstSlice, dstMip);
     }
 
     void EnqueueMap(UploadTexture* pUploadBuffer)
     {
-        std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
-        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Map, pUploadBuffer);
+        m_PendingOperations.Push(PendingBufferOperation::Operation::Map, pUploadBuffer);
     }
 
+    // Executes all pending map operations and the pending copy operations that
+    // fit into the per-update copy budget. Must only be called by the render thread.
+    void ExecutePendingOperations(IDeviceContext* pContext);
+
     Uint64 SignalFence(IDeviceContext* pContext)
     {
         // Fences can't be accessed from multiple threads simultaneously even
@@ -220,21 +229,24 @@ struct TextureUploaderD3D12_Vk::InternalData
     {
         // Fences can't be accessed from multiple threads simultaneously even
         // when protected by mutex
-        m_CompletedFenceValue = m_pFence->GetCompletedValue();
+        m_CompletedFenceValue.store(m_pFence->GetCompletedValue(), std::memory_order_release);
     }
 
     RefCntAutoPtr<UploadTexture> FindCachedUploadTexture(const UploadBufferDesc& Desc)
     {
         RefCntAutoPtr<UploadTexture> pUploadTexture;
-        std::lock_guard<std::mutex>  CacheLock(m_UploadTexturesCacheMtx);
-        auto                         DequeIt = m_UploadTexturesCache.find(Desc);
-        if (DequeIt != m_UploadTexturesCache.end())
+
+        auto&                       Shard = GetCacheShard(Desc);
+        std::lock_guard<std::mutex> CacheLock{Shard.Mtx};
+        auto                        DequeIt = Shard.Textures.find(Desc);
+        if (DequeIt != Shard.Textures.end())
         {
             auto& Deque = DequeIt->second;
             if (!Deque.empty())
             {
                 auto& FrontBuff = Deque.front();
-                if (FrontBuff->GetCopyScheduledFenceValue() <= m_CompletedFenceValue)
+                if (FrontBuff->IsCopyScheduled() &&
+                    FrontBuff->GetCopyScheduledFenceValue() <= m_CompletedFenceValue.load(std::memory_order_acquire))
                 {
                     pUploadTexture = std::move(FrontBuff);
                     Deque.pop_front();
@@ -248,35 +260,59 @@ struct TextureUploaderD3D12_Vk::InternalData
 
     void RecycleUploadTexture(UploadTexture* pUploadTexture)
     {
-        std::lock_guard<std::mutex> CacheLock(m_UploadTexturesCacheMtx);
-        auto&                       Deque = m_UploadTexturesCache[pUploadTexture->GetDesc()];
+        auto&                       Shard = GetCacheShard(pUploadTexture->GetDesc());
+        std::lock_guard<std::mutex> CacheLock{Shard.Mtx};
+        auto&                       Deque = Shard.Textures[pUploadTexture->GetDesc()];
         Deque.emplace_back(pUploadTexture);
     }
 
-    Uint32 GetNumPendingOperations()
+    // If the copy budget is set, all copies are executed by ExecutePendingOperations()
+    bool HasCopyBudget() const { return m_MaxCopyBytesPerUpdate != 0; }
+
+    Uint32 GetNumPendingOperations() const
     {
-        std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
-        return static_cast<Uint32>(m_PendingOperations.size());
+        return static_cast<Uint32>(m_PendingOperations.GetSize()) + m_NumDeferredCopies.load(std::memory_order_relaxed);
     }
 
     void Execute(IDeviceContext* pContext, PendingBufferOperation& OperationInfo);
 
 private:
-    std::mutex                          m_PendingOperationsMtx;
-    std::vector<PendingBufferOperation> m_PendingOperations;
-    std::vector<PendingBufferOperation> m_InWorkOperations;
+    // Upload textures are only reusable for identical descriptions. The cache is split into
+    // shards by the description hash, so that threads that stream textures of different
+    // sizes or formats do not contend on the same mutex.
+    struct UploadTexturesCacheShard
+    {
+        std::mutex                                                                     Mtx;
+        std::unordered_map<UploadBufferDesc, std::deque<RefCntAutoPtr<UploadTexture>>> Textures;
+    };
+    static constexpr size_t NumUploadTexturesCacheShards = 8;
+
+    UploadTexturesCacheShard& GetCacheShard(const UploadBufferDesc& Desc)
+    {
+        return m_UploadTexturesCache[std::hash<UploadBufferDesc>{}(Desc) % NumUploadTexturesCacheShards];
+    }
+
+private:
+    // Operations enqueued by worker threads
+    Threading::MPSCQueue<PendingBufferOperation> m_PendingOperations;
+
+    // Copy operations that did not fit into the budget of the previous updates.
+    // Only accessed by the render thread.
+    std::deque<PendingBufferOperation> m_DeferredCopies;
+    std::atomic<Uint32>                m_NumDeferredCopies{0};
+
+    const Uint64 m_MaxCopyBytesPerUpdate;
 
-    std::mutex                                                                     m_UploadTexturesCacheMtx;
-    std::unordered_map<UploadBufferDesc, std::deque<RefCntAutoPtr<UploadTexture>>> m_UploadTexturesCache;
+    std::array<UploadTexturesCacheShard, NumUploadTexturesCacheShards> m_UploadTexturesCache;
 
     RefCntAutoPtr<IFence> m_pFence;
-    Uint64                m_NextFenceValue      = 1;
-    Uint64                m_CompletedFenceValue = 0;
+    Uint64                m_NextFenceValue = 1;
+    std::atomic<Uint64>   m_CompletedFenceValue{0};
 };
 
 TextureUploaderD3D12_Vk::TextureUploaderD3D12_Vk(IReferenceCounters* pRefCounters, IRenderDevice* pDevice, const TextureUploaderDesc Desc) :
     TextureUploaderBase{pRefCounters, pDevice, Desc},
-    m_pInternalData{new InternalData(pDevice)}
+    m_pInternalData{new InternalData(pDevice, Desc)}
 {
 }
 
@@ -294,35 +330,52 @@ TextureUploaderD3D12_Vk::~TextureUploaderD3D12_Vk()
 
 void TextureUploaderD3D12_Vk::RenderThreadUpdate(IDeviceContext* pContext)
 {
-    auto& InWorkOperations = m_pInternalData->SwapMapQueues();
-    if (!InWorkOperations.empty())
-    {
-        Uint32 NumCopyOperations = 0;
-        for (auto& OperationInfo : InWorkOperations)
-        {
-            m_pInternalData->Execute(pContext, OperationInfo);
-            if (OperationInfo.operation == InternalData::PendingBufferOperation::Copy)
-                ++NumCopyOperations;
-        }
+    m_pInternalData->ExecutePendingOperations(pContext);
+
+    // This must be called by the same thread that signals the fence
+    m_pInternalData->UpdatedCompletedFenceValue();
+}
 
-        if (NumCopyOperations > 0)
+void TextureUploaderD3D12_Vk::InternalData::ExecutePendingOperations(IDeviceContext* pContext)
+{
+    // Worker threads block until their map operations are complete,
+    // so map operations are always executed immediately.
+    m_PendingOperations.PopAll(
+        [&](PendingBufferOperation&& OperationInfo) //
         {
-            // The buffer may be recycled immediately after the copy scheduled is signaled,
-            // so we must signal the fence first.
-            auto SignaledFenceValue = m_pInternalData->SignalFence(pContext);
+            if (OperationInfo.operation == PendingBufferOperation::Map)
+                Execute(pContext, OperationInfo);
+            else
+                m_DeferredCopies.emplace_back(std::move(OperationInfo));
+        });
+
+    size_t NumCopyOperations = 0;
+    Uint64 NumBytesCopied    = 0;
+    while (NumCopyOperations < m_DeferredCopies.size())
+    {
+        auto&        OperationInfo = m_DeferredCopies[NumCopyOperations];
+        const Uint64 CopySize      = OperationInfo.pUploadTexture->GetDataSize();
+        // Always execute at least one copy to guarantee forward progress
+        if (m_MaxCopyBytesPerUpdate != 0 && NumCopyOperations > 0 && NumBytesCopied + CopySize > m_MaxCopyBytesPerUpdate)
+            break;
+
+        Execute(pContext, OperationInfo);
+        NumBytesCopied += CopySize;
+        ++NumCopyOperations;
+    }
 
-            for (auto& OperationInfo : InWorkOperations)
-            {
-                if (OperationInfo.operation == InternalData::PendingBufferOperation::Copy)
-                    OperationInfo.pUploadTexture->SignalCopyScheduled(SignaledFenceValue);
-            }
-        }
+    if (NumCopyOperations > 0)
+    {
+        // The buffer may be recycled immediately after the copy scheduled is signaled,
+        // so we must signal the fence first.
+        auto SignaledFenceValue = SignalFence(pContext);
 
-        InWorkOperations.clear();
-    }
+        for (size_t i = 0; i < NumCopyOperations; ++i)
+            m_DeferredCopies[i].pUploadTexture->SignalCopyScheduled(SignaledFenceValue);
 
-    // This must be called by the same thread that signals the fence
-    m_pInternalData->UpdatedCompletedFenceValue();
+        m_DeferredCopies.erase(m_DeferredCopies.begin(), m_DeferredCopies.begin() + NumCopyOperations);
+    }
+    m_NumDeferredCopies.store(static_cast<Uint32>(m_DeferredCopies.size()), std::memory_order_relaxed);
 }
 
 
@@ -426,7 +479,7 @@ void TextureUploaderD3D12_Vk::ScheduleGPUCopy(IDeviceContext* pContext,
                                               IUploadBuffer*  pUploadBuffer)
 {
     auto* pUploadTexture = ClassPtrCast<UploadTexture>(pUploadBuffer);
-    if (pContext != nullptr)
+    if (pContext != nullptr && !m_pInternalData->HasCopyBudget())
     {
         // Render thread
         InternalData::PendingBufferOperation CopyOp //
@@ -448,7 +501,9 @@ void TextureUploaderD3D12_Vk::ScheduleGPUCopy(IDeviceContext* pContext,
     }
     else
     {
-        // Worker thread
+        // Worker thread, or render thread when the copy budget is set. In the latter case the copy
+        // goes through the same queue as worker copies, so that it is counted against the budget
+        // and does not overtake copies that were scheduled earlier.
         m_pInternalData->EnqueueCopy(pUploadTexture, pDstTexture, ArraySlice, MipLevel);
     }
 }
@@ -456,7 +511,10 @@ void TextureUploaderD3D12_Vk::ScheduleGPUCopy(IDeviceContext* pContext,
 void TextureUploaderD3D12_Vk::RecycleBuffer(IUploadBuffer* pUploadBuffer)
 {
     auto* pUploadTexture = ClassPtrCast<UploadTexture>(pUploadBuffer);
-    VERIFY(pUploadTexture->DbgIsCopyScheduled(), "Upload buffer must be recycled only after copy operation has been scheduled on the GPU");
+    // With the copy budget, a copy scheduled by the render thread may still be in the queue.
+    // Such buffer is not reused until the copy is executed, see FindCachedUploadTexture().
+    VERIFY(pUploadTexture->IsCopyScheduled() || m_pInternalData->HasCopyBudget(),
+           "Upload buffer must be recycled only after copy operation has been scheduled on the GPU");
 
     m_pInternalData->RecycleUploadTexture(pUploadTexture);
 }
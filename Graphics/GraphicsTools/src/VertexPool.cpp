@@ -29,6 +29,8 @@
 #include <mutex>
 #include <atomic>
 #include <memory>
+#include <vector>
+#include <algorithm>
 
 #include "DebugUtilities.hpp"
 #include "ObjectBase.hpp"
@@ -83,7 +85,7 @@ public:
 
     virtual Uint32 GetStartVertex() const override final
     {
-        return m_StartVertex;
+        return m_StartVertex.load();
     }
 
     virtual Uint32 GetVertexCount() const override final
@@ -108,12 +110,19 @@ public:
     }
 
 private:
+    friend class VertexPoolImpl;
+
     RefCntAutoPtr<VertexPoolImpl> m_pParentPool;
 
+    // The region and the links are protected by the parent pool mutex.
     VariableSizeAllocationsManager::Allocation m_Region;
 
-    const Uint32 m_StartVertex;
-    const Uint32 m_VertexCount;
+    VertexPoolAllocationImpl* m_pPrevLive = nullptr;
+    VertexPoolAllocationImpl* m_pNextLive = nullptr;
+
+    // The start vertex is changed by the defragmentation and may be read from other threads.
+    std::atomic<Uint32> m_StartVertex;
+    const Uint32        m_VertexCount;
 
     RefCntAutoPtr<IObject> m_pUserData;
 };
@@ -144,6 +153,7 @@ public:
         },
         m_MgrSize         {m_Mgr.GetMaxSize()},
         m_BufferSizes     (m_Desc.NumElements),
+        m_InitialVertexCount{CreateInfo.Desc.VertexCount},
         m_ExtraVertexCount{CreateInfo.ExtraVertexCount},
         // clang-format on
         m_MaxVertexCount{
@@ -207,6 +217,7 @@ public:
     ~VertexPoolImpl()
     {
         VERIFY_EXPR(m_AllocationCount.load() == 0);
+        VERIFY_EXPR(m_pLiveAllocations == nullptr);
     }
 
     virtual IBuffer* Update(Uint32 Index, IRenderDevice* pDevice, IDeviceContext* pContext) override final
@@ -268,17 +279,12 @@ public:
 
         DEV_CHECK_ERR(*ppAllocation == nullptr, "Overwriting reference to existing object may cause memory leaks");
 
-        VariableSizeAllocationsManager::Allocation Region;
+        VertexPoolAllocationImpl* pSuballocation = nullptr;
         {
             std::lock_guard<std::mutex> Lock{m_MgrMtx};
 
             {
-                Uint64 ActualCapacity = ~Uint64{0};
-                for (Uint32 i = 0; i < m_Desc.NumElements; ++i)
-                {
-                    const auto BufferCapacity = m_BufferSizes[i].load() / m_Elements[i].Size;
-                    ActualCapacity            = std::min(ActualCapacity, BufferCapacity);
-                }
+                const auto ActualCapacity = GetBufferCapacity();
 
                 // After the resize, the actual buffer size may be larger due to alignment
                 // requirements (for sparse buffers, the size is aligned by the memory page size).
@@ -292,7 +298,7 @@ public:
                 }
             }
 
-            Region = m_Mgr.Allocate(NumVertices, 1);
+            VariableSizeAllocationsManager::Allocation Region = m_Mgr.Allocate(NumVertices, 1);
 
             while (!Region.IsValid() && (m_MaxVertexCount == 0 || m_Mgr.GetMaxSize() < m_MaxVertexCount))
             {
@@ -311,31 +317,50 @@ public:
             }
 
             UpdateUsageStats();
+
+            if (Region.IsValid())
+            {
+                // clang-format off
+                pSuballocation =
+                    NEW_RC_OBJ(m_AllocationObjAllocator, "VertexPoolAllocationImpl instance", VertexPoolAllocationImpl)
+                    (
+                        this,
+                        static_cast<Uint32>(Region.UnalignedOffset),
+                        NumVertices,
+                        std::move(Region)
+                    );
+                // clang-format on
+
+                // Keep track of live allocations so that they can be moved by Defragment()
+                pSuballocation->m_pNextLive = m_pLiveAllocations;
+                if (m_pLiveAllocations != nullptr)
+                    m_pLiveAllocations->m_pPrevLive = pSuballocation;
+                m_pLiveAllocations = pSuballocation;
+            }
         }
 
-        if (Region.IsValid())
+        if (pSuballocation != nullptr)
         {
-            // clang-format off
-            VertexPoolAllocationImpl* pSuballocation{
-                NEW_RC_OBJ(m_AllocationObjAllocator, "VertexPoolAllocationImpl instance", VertexPoolAllocationImpl)
-                (
-                    this,
-                    static_cast<Uint32>(Region.UnalignedOffset),
-                    NumVertices,
-                    std::move(Region)
-                )
-            };
-            // clang-format on
-
             pSuballocation->QueryInterface(IID_VertexPoolAllocation, reinterpret_cast<IObject**>(ppAllocation));
             m_AllocationCount.fetch_add(1);
         }
     }
 
-    void Free(VariableSizeAllocationsManager::Allocation&& Region)
+    void Free(VertexPoolAllocationImpl& Allocation)
     {
         std::lock_guard<std::mutex> Lock{m_MgrMtx};
-        m_Mgr.Free(std::move(Region));
+
+        if (Allocation.m_pPrevLive != nullptr)
+            Allocation.m_pPrevLive->m_pNextLive = Allocation.m_pNextLive;
+        else
+        {
+            VERIFY_EXPR(m_pLiveAllocations == &Allocation);
+            m_pLiveAllocations = Allocation.m_pNextLive;
+        }
+        if (Allocation.m_pNextLive != nullptr)
+            Allocation.m_pNextLive->m_pPrevLive = Allocation.m_pPrevLive;
+
+        m_Mgr.Free(std::move(Allocation.m_Region));
         m_AllocationCount.fetch_add(-1);
         UpdateUsageStats();
     }
@@ -365,10 +390,250 @@ public:
             VertexSize += m_Desc.pElements[Elem].Size;
         UsageStats.UsedMemorySize = UsageStats.AllocatedVertexCount * VertexSize;
 
-        UsageStats.AllocationCount = m_AllocationCount.load();
+        UsageStats.AllocationCount     = m_AllocationCount.load();
+        UsageStats.MovedVertexCount    = m_MovedVertexCount.load();
+        UsageStats.ReclaimedMemorySize = m_ReclaimedMemorySize.load();
+    }
+
+    virtual Uint32 Defragment(IRenderDevice*                     pDevice,
+                              IDeviceContext*                    pContext,
+                              const VertexPoolDefragmentAttribs& Attribs) override final
+    {
+        if (pDevice == nullptr || pContext == nullptr)
+        {
+            UNEXPECTED("pDevice and pContext must not be null");
+            return 0;
+        }
+
+        std::vector<IBuffer*> Buffers(m_Buffers.size());
+        for (Uint32 i = 0; i < m_Buffers.size(); ++i)
+        {
+            Buffers[i] = Update(i, pDevice, pContext);
+            if (Buffers[i] == nullptr)
+                return 0;
+        }
+
+        struct AllocationMove
+        {
+            VertexPoolAllocationImpl* pAllocation = nullptr;
+
+            // Strong reference that keeps the allocation alive until the move is complete
+            RefCntAutoPtr<IObject> pKeepAlive;
+
+            VariableSizeAllocationsManager::Allocation NewRegion;
+
+            Uint32 OldStartVertex     = 0;
+            Uint32 NewStartVertex     = 0;
+            Uint32 ScratchStartVertex = 0;
+        };
+        std::vector<AllocationMove> Moves;
+
+        Uint32 MovedVertexCount = 0;
+        bool   BudgetExhausted  = false;
+        {
+            std::lock_guard<std::mutex> Lock{m_MgrMtx};
+
+            const auto BufferCapacity = GetBufferCapacity();
+            for (auto* pAllocation = m_pLiveAllocations; pAllocation != nullptr; pAllocation = pAllocation->m_pNextLive)
+            {
+                // Allocations in the space that has not been added to the buffers yet have no data to move
+                const auto& Region = pAllocation->m_Region;
+                if (Region.UnalignedOffset + Region.Size <= BufferCapacity)
+                {
+                    Moves.emplace_back();
+                    Moves.back().pAllocation    = pAllocation;
+                    Moves.back().OldStartVertex = pAllocation->m_StartVertex.load();
+                }
+            }
+
+            // Process allocations starting from the end of the pool
+            std::sort(Moves.begin(), Moves.end(),
+                      [](const AllocationMove& lhs, const AllocationMove& rhs) {
+                          return lhs.OldStartVertex > rhs.OldStartVertex;
+                      });
+
+            size_t NumMoves = 0;
+            for (auto& Move : Moves)
+            {
+                auto* const pAllocation = Move.pAllocation;
+                if (Attribs.MaxMoveVertexCount != 0 && MovedVertexCount > 0 && MovedVertexCount + pAllocation->m_VertexCount > Attribs.MaxMoveVertexCount)
+                {
+                    BudgetExhausted = true;
+                    break;
+                }
+
+                // Old region remains allocated until the copy commands are recorded
+                Move.NewRegion = m_Mgr.AllocateBelow(pAllocation->m_VertexCount, 1, pAllocation->m_Region.UnalignedOffset);
+                if (!Move.NewRegion.IsValid())
+                    continue;
+
+                // Allocations whose reference count has reached zero are being destroyed
+                // and are waiting for the mutex to release their regions.
+                // NB: the strong reference must not be released while the mutex is locked.
+                pAllocation->GetReferenceCounters()->QueryObject(&Move.pKeepAlive);
+                if (!Move.pKeepAlive)
+                {
+                    m_Mgr.Free(std::move(Move.NewRegion));
+                    continue;
+                }
+
+                Move.NewStartVertex     = static_cast<Uint32>(Move.NewRegion.UnalignedOffset);
+                Move.ScratchStartVertex = MovedVertexCount;
+                MovedVertexCount += pAllocation->m_VertexCount;
+
+                Moves[NumMoves++] = std::move(Move);
+            }
+            Moves.resize(NumMoves);
+        }
+
+        if (!Moves.empty())
+        {
+            // Every element occupies a separate range of the scratch buffer
+            std::vector<Uint64> ScratchElementOffsets(m_Elements.size());
+            Uint64              ScratchSize = 0;
+            for (size_t i = 0; i < m_Elements.size(); ++i)
+            {
+                ScratchElementOffsets[i] = ScratchSize;
+                ScratchSize              = AlignUp(ScratchSize + Uint64{MovedVertexCount} * m_Elements[i].Size, Uint64{16});
+            }
+
+            if (!m_pScratchBuffer || m_pScratchBuffer->GetDesc().Size < ScratchSize)
+            {
+                m_pScratchBuffer.Release();
+
+                const std::string Name = m_Name + " - defragmentation scratch buffer";
+
+                BufferDesc ScratchDesc;
+                ScratchDesc.Name  = Name.c_str();
+                ScratchDesc.Size  = ScratchSize;
+                ScratchDesc.Usage = USAGE_DEFAULT;
+                pDevice->CreateBuffer(ScratchDesc, nullptr, &m_pScratchBuffer);
+            }
+
+            if (!m_pScratchBuffer)
+            {
+                LOG_ERROR_MESSAGE("Failed to create defragmentation scratch buffer for vertex pool '", m_Name, "'");
+
+                std::lock_guard<std::mutex> Lock{m_MgrMtx};
+                for (auto& Move : Moves)
+                    m_Mgr.Free(std::move(Move.NewRegion));
+                UpdateUsageStats();
+                return 0;
+            }
+
+            // Copy all allocations to the scratch buffer first to minimize the number of state transitions
+            for (size_t i = 0; i < m_Elements.size(); ++i)
+            {
+                const Uint64 ElemSize = m_Elements[i].Size;
+                for (const auto& Move : Moves)
+                {
+                    pContext->CopyBuffer(Buffers[i], Move.OldStartVertex * ElemSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                                         m_pScratchBuffer, ScratchElementOffsets[i] + Move.ScratchStartVertex * ElemSize,
+                                         Move.pAllocation->m_VertexCount * ElemSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+                }
+            }
+            for (size_t i = 0; i < m_Elements.size(); ++i)
+            {
+                const Uint64 ElemSize = m_Elements[i].Size;
+                for (const auto& Move : Moves)
+                {
+                    pContext->CopyBuffer(m_pScratchBuffer, ScratchElementOffsets[i] + Move.ScratchStartVertex * ElemSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                                         Buffers[i], Move.NewStartVertex * ElemSize,
+                                         Move.pAllocation->m_VertexCount * ElemSize, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+                }
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> Lock{m_MgrMtx};
+
+            for (auto& Move : Moves)
+            {
+                auto* const pAllocation = Move.pAllocation;
+                m_Mgr.Free(std::move(pAllocation->m_Region));
+                pAllocation->m_Region = std::move(Move.NewRegion);
+                pAllocation->m_StartVertex.store(Move.NewStartVertex);
+            }
+
+            if (!BudgetExhausted)
+            {
+                // No more allocations can be moved - release the free space at the end of the pool
+                ShrinkBuffers(pDevice, pContext);
+                m_pScratchBuffer.Release();
+            }
+
+            UpdateUsageStats();
+        }
+        m_MovedVertexCount.fetch_add(MovedVertexCount);
+
+        if (Attribs.AllocationMoved != nullptr)
+        {
+            for (const auto& Move : Moves)
+                Attribs.AllocationMoved(Move.pAllocation, Move.OldStartVertex, Attribs.pUserData);
+        }
+
+        // NB: the allocations may be released when Moves goes out of scope, which requires the mutex to be unlocked.
+        return MovedVertexCount;
     }
 
 private:
+    // Returns the number of vertices that fit into all internal buffers
+    Uint64 GetBufferCapacity() const
+    {
+        Uint64 Capacity = ~Uint64{0};
+        for (Uint32 i = 0; i < m_Desc.NumElements; ++i)
+        {
+            const auto BufferCapacity = m_BufferSizes[i].load() / m_Elements[i].Size;
+            Capacity                  = std::min(Capacity, BufferCapacity);
+        }
+        return Capacity;
+    }
+
+    // Must be called with m_MgrMtx locked
+    void ShrinkBuffers(IRenderDevice* pDevice, IDeviceContext* pContext)
+    {
+        const auto MgrSize = m_Mgr.GetMaxSize();
+        if (MgrSize > GetBufferCapacity())
+        {
+            // The pool has been expanded by another thread, and the buffers have not been updated yet
+            return;
+        }
+
+        // Use the same size steps as the expansion to avoid growing the pool back on the next allocation
+        const Uint64 UsedEnd        = MgrSize - m_Mgr.GetTailFreeSize();
+        Uint64       NewVertexCount = m_InitialVertexCount;
+        while (NewVertexCount < UsedEnd)
+        {
+            const Uint64 Step = m_ExtraVertexCount != 0 ? m_ExtraVertexCount : NewVertexCount;
+            if (Step == 0)
+            {
+                NewVertexCount = UsedEnd;
+                break;
+            }
+            NewVertexCount += Step;
+        }
+        if (NewVertexCount >= MgrSize)
+            return;
+
+        m_Mgr.Shrink(StaticCast<size_t>(MgrSize - NewVertexCount));
+        m_MgrSize.store(m_Mgr.GetMaxSize());
+        m_Desc.VertexCount = static_cast<Uint32>(m_Mgr.GetMaxSize());
+
+        Uint64 OldMemorySize = 0;
+        Uint64 NewMemorySize = 0;
+        for (Uint32 i = 0; i < m_Buffers.size(); ++i)
+        {
+            auto& Buffer = *m_Buffers[i];
+            OldMemorySize += Buffer.GetDesc().Size;
+            Buffer.Resize(pDevice, pContext, NewVertexCount * m_Elements[i].Size);
+            // For sparse buffers, the new size is aligned up by the memory page size
+            m_BufferSizes[i].store(Buffer.GetDesc().Size);
+            NewMemorySize += Buffer.GetDesc().Size;
+        }
+        if (NewMemorySize < OldMemorySize)
+            m_ReclaimedMemorySize.fetch_add(OldMemorySize - NewMemorySize);
+    }
+
     void UpdateUsageStats()
     {
         m_AllocatedVertexCount.store(m_Mgr.GetUsedSize());
@@ -391,12 +656,14 @@ private:
 
     std::mutex                     m_MgrMtx;
     VariableSizeAllocationsManager m_Mgr;
+    VertexPoolAllocationImpl*      m_pLiveAllocations = nullptr;
 
     std::atomic<VariableSizeAllocationsManager::OffsetType> m_MgrSize{0};
 
     std::vector<std::unique_ptr<DynamicBuffer>> m_Buffers;
     std::vector<std::atomic<Uint64>>            m_BufferSizes;
 
+    const Uint32 m_InitialVertexCount;
     const Uint32 m_ExtraVertexCount;
     const Uint32 m_MaxVertexCount;
 
@@ -404,6 +671,10 @@ private:
     std::atomic<Uint64> m_AllocatedVertexCount{0};
     std::atomic<Uint64> m_CommittedMemorySize{0};
     std::atomic<Uint64> m_TotalVertexCount{0};
+    std::atomic<Uint64> m_MovedVertexCount{0};
+    std::atomic<Uint64> m_ReclaimedMemorySize{0};
+
+    RefCntAutoPtr<IBuffer> m_pScratchBuffer;
 
     FixedBlockMemoryAllocator m_AllocationObjAllocator;
 };
@@ -411,7 +682,7 @@ private:
 
 VertexPoolAllocationImpl::~VertexPoolAllocationImpl()
 {
-    m_pParentPool->Free(std::move(m_Region));
+    m_pParentPool->Free(*this);
 }
 
 IVertexPool* VertexPoolAllocationImpl::GetPool()
@@ -31,6 +31,7 @@
 #include "DebugUtilities.hpp"
 #include "Cast.hpp"
 #include "ShaderToolsCommon.hpp"
+#include "ShaderIncludeCache.hpp"
 
 namespace Diligent
 {
@@ -79,9 +80,22 @@ void XXH128State::Update(const ShaderCreateInfo& ShaderCI) noexcept
     if (ShaderCI.Source != nullptr || ShaderCI.FilePath != nullptr)
     {
         DEV_CHECK_ERR(ShaderCI.ByteCode == nullptr, "ShaderCI.ByteCode must be null when either Source or FilePath is specified");
-        ProcessShaderIncludes(ShaderCI, [this](const ShaderIncludePreprocessInfo& ProcessInfo) {
-            UpdateStr(ProcessInfo.Source, ProcessInfo.SourceLength);
-        });
+
+        // If the source factory is an include cache, use the memoized hash of all sources
+        // instead of reading and hashing all include files for every shader variant.
+        RefCntAutoPtr<IShaderIncludeCache> pIncludeCache{ShaderCI.pShaderSourceStreamFactory, IID_ShaderIncludeCache};
+
+        XXH128Hash SourceHash;
+        if (pIncludeCache && pIncludeCache->GetSourceHash(ShaderCI, SourceHash))
+        {
+            Update(SourceHash.LowPart, SourceHash.HighPart);
+        }
+        else
+        {
+            ProcessShaderIncludes(ShaderCI, [this](const ShaderIncludePreprocessInfo& ProcessInfo) {
+                UpdateStr(ProcessInfo.Source, ProcessInfo.SourceLength);
+            });
+        }
     }
     else if (ShaderCI.ByteCode != nullptr && ShaderCI.ByteCodeSize != 0)
     {
@@ -46,6 +46,7 @@
 #include "STDAllocator.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "StringPool.hpp"
+#include "Serializer.hpp"
 
 #ifdef DILIGENT_SPIRV_CROSS_NAMESPACE
 #    define diligent_spirv_cross DILIGENT_SPIRV_CROSS_NAMESPACE
@@ -111,6 +112,18 @@ struct SPIRVShaderResourceAttribs
                                Uint32                                _BufferStaticSize = 0,
                                Uint32                                _BufferStride     = 0) noexcept;
 
+    // Initializes the attributes from the values previously
+    // extracted by the constructor above (see SPIRVShaderResources::Serialize).
+    SPIRVShaderResourceAttribs(const char*        _Name,
+                               Uint16             _ArraySize,
+                               ResourceType       _Type,
+                               RESOURCE_DIMENSION _ResourceDim,
+                               bool               _IsMS,
+                               uint32_t           _BindingDecorationOffset,
+                               uint32_t           _DescriptorSetDecorationOffset,
+                               Uint32             _BufferStaticSize,
+                               Uint32             _BufferStride) noexcept;
+
     ShaderResourceDesc GetResourceDesc() const
     {
         return ShaderResourceDesc{Name, GetShaderResourceType(Type), ArraySize};
@@ -155,6 +168,22 @@ public:
                          bool                  LoadUniformBufferReflection,
                          std::string&          EntryPoint) noexcept(false);
 
+    /// Restores the resources from the data produced by Serialize() without parsing the SPIR-V.
+
+    /// \param [in]  Allocator             - Allocator to use for the resource memory.
+    /// \param [in]  Data                  - Serialized resources.
+    /// \param [in]  shaderDesc            - Shader description. The shader type must match the serialized one.
+    /// \param [in]  CombinedSamplerSuffix - Combined sampler suffix.
+    /// \param [out] EntryPoint            - Shader entry point name.
+    ///
+    /// \remarks   Uniform buffer reflection is never serialized. The constructor throws
+    ///            an exception if the data is corrupted or was produced by a different version.
+    SPIRVShaderResources(IMemoryAllocator&     Allocator,
+                         const SerializedData& Data,
+                         const ShaderDesc&     shaderDesc,
+                         const char*           CombinedSamplerSuffix,
+                         std::string&          EntryPoint) noexcept(false);
+
     // clang-format off
     SPIRVShaderResources             (const SPIRVShaderResources&)  = delete;
     SPIRVShaderResources             (      SPIRVShaderResources&&) = delete;
@@ -336,6 +365,19 @@ public:
     // Sets the input location decorations using the HLSL semantic names.
     void MapHLSLVertexShaderInputs(std::vector<uint32_t>& SPIRV) const;
 
+    // Serializes the resources so that they can later be restored without running SPIRV-Cross.
+    // The decoration offsets are only valid for the SPIR-V binary the resources were loaded from.
+    SerializedData Serialize(const char* EntryPoint, IMemoryAllocator& Allocator) const;
+
+    // Appends the serialized resources to the end of the SPIR-V binary.
+    // The appended block is ignored by ExtractSerializedResources() if it is not present.
+    static void AppendSerializedResources(std::vector<uint32_t>& SPIRV, const SerializedData& Resources);
+
+    // Checks if the byte code ends with the serialized resources block appended by AppendSerializedResources().
+    // If it does, initializes Resources with the non-owning view of the block.
+    // Returns the size of the SPIR-V binary itself, in bytes.
+    static size_t ExtractSerializedResources(const void* pBytecode, size_t BytecodeSize, SerializedData& Resources);
+
 private:
     void Initialize(IMemoryAllocator&       Allocator,
                     const ResourceCounters& Counters,
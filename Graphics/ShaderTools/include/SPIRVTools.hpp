@@ -29,6 +29,8 @@
 #include <vector>
 
 #include "FlagEnum.h"
+#include "ThreadPool.h"
+#include "SPIRVUtils.hpp"
 
 #include "spirv-tools/libspirv.h"
 
@@ -49,4 +51,46 @@ std::vector<uint32_t> OptimizeSPIRV(const std::vector<uint32_t>& SrcSPIRV,
                                     spv_target_env               TargetEnv,
                                     SPIRV_OPTIMIZATION_FLAGS     Passes);
 
+
+/// A single SPIRV module processed by OptimizeSPIRVBatch().
+struct SPIRVBatchItem
+{
+    /// Source SPIRV code. Must remain valid until OptimizeSPIRVBatch() returns.
+    const std::vector<uint32_t>* pSrcSPIRV = nullptr;
+
+    /// Target environment. If SPV_ENV_MAX, the environment is derived from the SPIRV version.
+    spv_target_env TargetEnv = SPV_ENV_MAX;
+
+    /// Optimization passes to run. If SPIRV_OPTIMIZATION_FLAG_NONE, the code is only remapped.
+    SPIRV_OPTIMIZATION_FLAGS Passes = SPIRV_OPTIMIZATION_FLAG_NONE;
+
+    /// Optional resource binding remapping applied to the optimized code, see RemapSPIRVBindings().
+    const SPIRVBindingRemapping* pRemapping = nullptr;
+
+    /// Processed SPIRV code. Empty if the optimization failed.
+    std::vector<uint32_t> SPIRV;
+
+    /// The number of resources remapped in the processed code.
+    Uint32 NumRemappedResources = 0;
+};
+
+/// Optimizes and remaps multiple SPIRV modules.
+///
+/// \param [in, out] pItems      - Array of modules to process.
+/// \param [in]      NumItems    - The number of modules in pItems.
+/// \param [in]      pThreadPool - Optional thread pool to process the modules in parallel.
+///                                If null or if the pool has no worker threads, the modules
+///                                are processed on the calling thread.
+///
+/// \remarks   The calling thread also processes the modules and the function
+///            returns when all of them are complete.
+///
+///            Optimizers are reused by every thread for all modules with the same
+///            target environment and set of passes, so the passes are only created once.
+///            Resource bindings are remapped in the optimized code directly, without
+///            parsing the module again.
+void OptimizeSPIRVBatch(SPIRVBatchItem* pItems,
+                        size_t          NumItems,
+                        IThreadPool*    pThreadPool = nullptr);
+
 } // namespace Diligent
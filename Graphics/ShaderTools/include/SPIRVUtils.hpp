@@ -44,4 +44,59 @@ namespace Diligent
 std::vector<uint32_t> PatchImageFormats(const std::vector<uint32_t>&                                SPIRV,
                                         const std::unordered_map<HashMapStringKey, TEXTURE_FORMAT>& ImageFormats);
 
+/// Descriptor set and binding assigned to a shader resource.
+struct SPIRVResourceBinding
+{
+    uint32_t DescriptorSet = 0;
+    uint32_t Binding       = 0;
+};
+
+/// Mapping from resource names to their new descriptor sets and bindings.
+using SPIRVBindingRemapping = std::unordered_map<HashMapStringKey, SPIRVResourceBinding>;
+
+/// Remaps resource descriptor sets and bindings in the SPIRV code in place.
+///
+/// \param [in, out] SPIRV     - SPIRV code.
+/// \param [in]      Remapping - Mapping from resource names to new descriptor sets and bindings.
+///
+/// \return The number of remapped resources.
+///
+/// \remarks   A resource is identified by the name of its variable or, if the variable
+///            is unnamed (e.g. HLSL constant buffers), by the name of its type.
+///            Unlike SPIRVShaderResources, the function does not require decoration
+///            offsets and only performs a single pass over the code, so it can be used
+///            after the code has been optimized.
+Uint32 RemapSPIRVBindings(std::vector<uint32_t>&       SPIRV,
+                          const SPIRVBindingRemapping& Remapping);
+
+
+/// Offsets of the resource decoration literals in the SPIRV code.
+struct SPIRVResourceDecorationOffsets
+{
+    /// Offset of the Binding decoration literal, or 0 if there is no such decoration.
+    uint32_t Binding = 0;
+
+    /// Offset of the DescriptorSet decoration literal, or 0 if there is no such decoration.
+    uint32_t DescriptorSet = 0;
+};
+
+/// Finds the offsets of Binding and DescriptorSet decorations of the given ids in the SPIRV code.
+///
+/// \param [in] SPIRV - SPIRV code.
+/// \param [in] Ids   - Ids of the decorated variables.
+///
+/// \return The decoration offsets for every id in Ids.
+///
+/// \remarks   An id of the resource variable can be read from the original code at
+///            SPIRVShaderResourceAttribs::BindingDecorationOffset - 2. Passes that do not
+///            renumber ids (e.g. reflection stripping) keep the ids valid, so the function
+///            can be used to find the resource decorations in the processed code.
+std::vector<SPIRVResourceDecorationOffsets> FindResourceDecorationOffsets(const std::vector<uint32_t>& SPIRV,
+                                                                          const std::vector<uint32_t>& Ids);
+
+/// Checks if the SPIRV code contains HLSL reflection instructions (SPV_GOOGLE_hlsl_functionality1,
+/// SPV_GOOGLE_decorate_string or SPV_GOOGLE_user_type extensions) that must be stripped
+/// before the code is passed to Vulkan.
+bool HasSPIRVReflectionInstructions(const std::vector<uint32_t>& SPIRV);
+
 } // namespace Diligent
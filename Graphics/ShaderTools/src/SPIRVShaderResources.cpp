@@ -125,6 +125,28 @@ SPIRVShaderResourceAttribs::SPIRVShaderResourceAttribs(const diligent_spirv_cros
 // clang-format on
 {}
 
+SPIRVShaderResourceAttribs::SPIRVShaderResourceAttribs(const char*        _Name,
+                                                       Uint16             _ArraySize,
+                                                       ResourceType       _Type,
+                                                       RESOURCE_DIMENSION _ResourceDim,
+                                                       bool               _IsMS,
+                                                       uint32_t           _BindingDecorationOffset,
+                                                       uint32_t           _DescriptorSetDecorationOffset,
+                                                       Uint32             _BufferStaticSize,
+                                                       Uint32             _BufferStride) noexcept :
+    // clang-format off
+    Name                          {_Name},
+    ArraySize                     {_ArraySize},
+    Type                          {_Type},
+    ResourceDim                   {static_cast<Uint8>(_ResourceDim)},
+    IsMS                          {_IsMS ? Uint8{1} : Uint8{0}},
+    BindingDecorationOffset       {_BindingDecorationOffset},
+    DescriptorSetDecorationOffset {_DescriptorSetDecorationOffset},
+    BufferStaticSize              {_BufferStaticSize},
+    BufferStride                  {_BufferStride}
+// clang-format on
+{}
+
 
 SHADER_RESOURCE_TYPE SPIRVShaderResourceAttribs::GetShaderResourceType(ResourceType Type)
 {
@@ -719,6 +741,292 @@ SPIRVShaderResources::SPIRVShaderResources(IMemoryAllocator&     Allocator,
     //LOG_INFO_MESSAGE(DumpResources());
 }
 
+namespace
+{
+
+// Increment this version whenever the serialized resources layout changes
+constexpr Uint32 SerializedResourcesVersion = 1;
+
+// Marks the end of the serialized resources block appended to the SPIR-V binary.
+// A valid SPIR-V module always ends with OpFunctionEnd, so the marker can't be confused with the byte code.
+constexpr uint32_t SerializedResourcesMagic = 0x53525653; // 'SVRS'
+
+struct SerializedResourcesHeader
+{
+    Uint32                                 Version    = SerializedResourcesVersion;
+    SHADER_TYPE                            ShaderType = SHADER_TYPE_UNKNOWN;
+    const char*                            EntryPoint = nullptr;
+    bool                                   IsHLSLSource{false};
+    std::array<Uint32, 3>                  ComputeGroupSize = {};
+    SPIRVShaderResources::ResourceCounters Counters;
+    Uint32                                 NumShaderStageInputs = 0;
+
+    template <typename SerializerType>
+    bool Serialize(SerializerType& Ser)
+    {
+        static_assert(Uint32{SPIRVShaderResourceAttribs::ResourceType::NumResourceTypes} == 12, "Please serialize the new resource type counter");
+        return Ser(Version, ShaderType, EntryPoint, IsHLSLSource, ComputeGroupSize,
+                   Counters.NumUBs, Counters.NumSBs, Counters.NumImgs, Counters.NumSmpldImgs, Counters.NumACs,
+                   Counters.NumSepSmplrs, Counters.NumSepImgs, Counters.NumInptAtts, Counters.NumAccelStructs,
+                   NumShaderStageInputs);
+    }
+};
+
+struct SerializedResourceAttribs
+{
+    const char* Name                          = nullptr;
+    Uint16      ArraySize                     = 0;
+    Uint8       Type                          = 0;
+    Uint8       ResourceDim                   = 0;
+    Uint8       IsMS                          = 0;
+    Uint32      BindingDecorationOffset       = 0;
+    Uint32      DescriptorSetDecorationOffset = 0;
+    Uint32      BufferStaticSize              = 0;
+    Uint32      BufferStride                  = 0;
+
+    SerializedResourceAttribs() = default;
+
+    explicit SerializedResourceAttribs(const SPIRVShaderResourceAttribs& Attribs) :
+        // clang-format off
+        Name                         {Attribs.Name},
+        ArraySize                    {Attribs.ArraySize},
+        Type                         {static_cast<Uint8>(Attribs.Type)},
+        ResourceDim                  {Attribs.ResourceDim},
+        IsMS                         {Attribs.IsMS},
+        BindingDecorationOffset      {Attribs.BindingDecorationOffset},
+        DescriptorSetDecorationOffset{Attribs.DescriptorSetDecorationOffset},
+        BufferStaticSize             {Attribs.BufferStaticSize},
+        BufferStride                 {Attribs.BufferStride}
+    // clang-format on
+    {}
+
+    template <typename SerializerType>
+    bool Serialize(SerializerType& Ser)
+    {
+        return Ser(Name, ArraySize, Type, ResourceDim, IsMS, BindingDecorationOffset, DescriptorSetDecorationOffset, BufferStaticSize, BufferStride);
+    }
+};
+
+struct SerializedStageInputAttribs
+{
+    const char* Semantic                 = nullptr;
+    Uint32      LocationDecorationOffset = 0;
+
+    template <typename SerializerType>
+    bool Serialize(SerializerType& Ser)
+    {
+        return Ser(Semantic, LocationDecorationOffset);
+    }
+};
+
+} // namespace
+
+SPIRVShaderResources::SPIRVShaderResources(IMemoryAllocator&     Allocator,
+                                           const SerializedData& Data,
+                                           const ShaderDesc&     shaderDesc,
+                                           const char*           CombinedSamplerSuffix,
+                                           std::string&          EntryPoint) noexcept(false) :
+    m_ShaderType{shaderDesc.ShaderType}
+{
+    VERIFY_EXPR(shaderDesc.Name != nullptr);
+
+    Serializer<SerializerMode::Read> Ser{Data};
+
+    SerializedResourcesHeader Header;
+    if (!Header.Serialize(Ser) || Header.Version != SerializedResourcesVersion)
+    {
+        LOG_ERROR_AND_THROW("Serialized resources of shader '", shaderDesc.Name, "' are corrupted or were produced by an incompatible engine version");
+    }
+    if (Header.ShaderType != shaderDesc.ShaderType)
+    {
+        LOG_ERROR_AND_THROW("Serialized resources of shader '", shaderDesc.Name, "' were produced for ", GetShaderTypeLiteralName(Header.ShaderType),
+                            " shader, but the shader type is ", GetShaderTypeLiteralName(shaderDesc.ShaderType));
+    }
+
+    const auto& Counters = Header.Counters;
+
+    const Uint32 TotalResources = Counters.NumUBs + Counters.NumSBs + Counters.NumImgs + Counters.NumSmpldImgs + Counters.NumACs +
+        Counters.NumSepSmplrs + Counters.NumSepImgs + Counters.NumInptAtts + Counters.NumAccelStructs;
+    static_assert(Uint32{SPIRVShaderResourceAttribs::ResourceType::NumResourceTypes} == 12, "Please account for the new resource type counter");
+    if (TotalResources > std::numeric_limits<OffsetType>::max() || Header.NumShaderStageInputs > std::numeric_limits<OffsetType>::max())
+    {
+        LOG_ERROR_AND_THROW("Serialized resources of shader '", shaderDesc.Name, "' are corrupted");
+    }
+
+    // Note that all string pointers reference the serialized data
+    std::vector<SerializedResourceAttribs>   Resources(TotalResources);
+    std::vector<SerializedStageInputAttribs> StageInputs(Header.NumShaderStageInputs);
+
+    size_t ResourceNamesPoolSize = 0;
+    for (auto& Res : Resources)
+    {
+        if (!Res.Serialize(Ser) || Res.Name == nullptr || Res.Type >= SPIRVShaderResourceAttribs::ResourceType::NumResourceTypes)
+            LOG_ERROR_AND_THROW("Failed to read serialized resources of shader '", shaderDesc.Name, "'");
+        ResourceNamesPoolSize += strlen(Res.Name) + 1;
+    }
+    for (auto& Input : StageInputs)
+    {
+        if (!Input.Serialize(Ser) || Input.Semantic == nullptr)
+            LOG_ERROR_AND_THROW("Failed to read serialized stage inputs of shader '", shaderDesc.Name, "'");
+        ResourceNamesPoolSize += strlen(Input.Semantic) + 1;
+    }
+    if (Header.EntryPoint == nullptr || !Ser.IsEnded())
+    {
+        LOG_ERROR_AND_THROW("Serialized resources of shader '", shaderDesc.Name, "' are corrupted");
+    }
+
+    if (CombinedSamplerSuffix != nullptr)
+        ResourceNamesPoolSize += strlen(CombinedSamplerSuffix) + 1;
+    ResourceNamesPoolSize += strlen(shaderDesc.Name) + 1;
+
+    StringPool ResourceNamesPool;
+    Initialize(Allocator, Counters, Header.NumShaderStageInputs, ResourceNamesPoolSize, ResourceNamesPool);
+
+    for (Uint32 n = 0; n < TotalResources; ++n)
+    {
+        const auto& Res = Resources[n];
+        new (&GetResource(n)) SPIRVShaderResourceAttribs //
+            {
+                ResourceNamesPool.CopyString(Res.Name),
+                Res.ArraySize,
+                static_cast<SPIRVShaderResourceAttribs::ResourceType>(Res.Type),
+                static_cast<RESOURCE_DIMENSION>(Res.ResourceDim),
+                Res.IsMS != 0,
+                Res.BindingDecorationOffset,
+                Res.DescriptorSetDecorationOffset,
+                Res.BufferStaticSize,
+                Res.BufferStride //
+            };
+    }
+
+    for (Uint32 n = 0; n < Header.NumShaderStageInputs; ++n)
+    {
+        const auto& Input = StageInputs[n];
+        new (&GetShaderStageInputAttribs(n)) SPIRVShaderStageInputAttribs //
+            {
+                ResourceNamesPool.CopyString(Input.Semantic),
+                Input.LocationDecorationOffset //
+            };
+    }
+
+    if (CombinedSamplerSuffix != nullptr)
+    {
+        m_CombinedSamplerSuffix = ResourceNamesPool.CopyString(CombinedSamplerSuffix);
+    }
+
+    m_ShaderName = ResourceNamesPool.CopyString(shaderDesc.Name);
+
+    VERIFY(ResourceNamesPool.GetRemainingSize() == 0, "Names pool must be empty");
+
+    m_ComputeGroupSize = Header.ComputeGroupSize;
+    m_IsHLSLSource     = Header.IsHLSLSource;
+
+    EntryPoint = Header.EntryPoint;
+}
+
+SerializedData SPIRVShaderResources::Serialize(const char* EntryPoint, IMemoryAllocator& Allocator) const
+{
+    VERIFY_EXPR(EntryPoint != nullptr);
+
+    SerializedResourcesHeader Header;
+    Header.ShaderType       = m_ShaderType;
+    Header.EntryPoint       = EntryPoint;
+    Header.IsHLSLSource     = m_IsHLSLSource;
+    Header.ComputeGroupSize = m_ComputeGroupSize;
+
+    Header.Counters.NumUBs          = GetNumUBs();
+    Header.Counters.NumSBs          = GetNumSBs();
+    Header.Counters.NumImgs         = GetNumImgs();
+    Header.Counters.NumSmpldImgs    = GetNumSmpldImgs();
+    Header.Counters.NumACs          = GetNumACs();
+    Header.Counters.NumSepSmplrs    = GetNumSepSmplrs();
+    Header.Counters.NumSepImgs      = GetNumSepImgs();
+    Header.Counters.NumInptAtts     = GetNumInptAtts();
+    Header.Counters.NumAccelStructs = GetNumAccelStructs();
+    Header.NumShaderStageInputs     = GetNumShaderStageInputs();
+    static_assert(Uint32{SPIRVShaderResourceAttribs::ResourceType::NumResourceTypes} == 12, "Please initialize the new resource type counter");
+
+    std::vector<SerializedResourceAttribs> Resources;
+    Resources.reserve(GetTotalResources());
+    for (Uint32 n = 0; n < GetTotalResources(); ++n)
+        Resources.emplace_back(GetResource(n));
+
+    std::vector<SerializedStageInputAttribs> StageInputs(GetNumShaderStageInputs());
+    for (Uint32 n = 0; n < GetNumShaderStageInputs(); ++n)
+    {
+        const auto& Input                       = GetShaderStageInputAttribs(n);
+        StageInputs[n].Semantic                 = Input.Semantic;
+        StageInputs[n].LocationDecorationOffset = Input.LocationDecorationOffset;
+    }
+
+    auto SerializeAll = [&](auto& Ser) {
+        if (!Header.Serialize(Ser))
+            return false;
+        for (auto& Res : Resources)
+        {
+            if (!Res.Serialize(Ser))
+                return false;
+        }
+        for (auto& Input : StageInputs)
+        {
+            if (!Input.Serialize(Ser))
+                return false;
+        }
+        return true;
+    };
+
+    Serializer<SerializerMode::Measure> MSer;
+    SerializeAll(MSer);
+
+    SerializedData Data = MSer.AllocateData(Allocator);
+
+    Serializer<SerializerMode::Write> WSer{Data};
+    if (!SerializeAll(WSer))
+        UNEXPECTED("Failed to serialize resources of shader '", m_ShaderName, "'");
+    VERIFY_EXPR(WSer.IsEnded());
+
+    return Data;
+}
+
+void SPIRVShaderResources::AppendSerializedResources(std::vector<uint32_t>& SPIRV, const SerializedData& Resources)
+{
+    if (!Resources)
+        return;
+
+    VERIFY(Resources.Size() <= std::numeric_limits<uint32_t>::max(), "Serialized resources size exceeds the maximum representable value");
+
+    // | SPIR-V | Resources (aligned to 4 bytes) | Resources size | Magic |
+    const size_t SPIRVSize = SPIRV.size();
+    SPIRV.resize(SPIRVSize + AlignUp(Resources.Size(), sizeof(uint32_t)) / sizeof(uint32_t) + 2, 0);
+    memcpy(&SPIRV[SPIRVSize], Resources.Ptr(), Resources.Size());
+    SPIRV[SPIRV.size() - 2] = static_cast<uint32_t>(Resources.Size());
+    SPIRV[SPIRV.size() - 1] = SerializedResourcesMagic;
+}
+
+size_t SPIRVShaderResources::ExtractSerializedResources(const void* pBytecode, size_t BytecodeSize, SerializedData& Resources)
+{
+    Resources = {};
+    if (pBytecode == nullptr || BytecodeSize < sizeof(uint32_t) * 2 || BytecodeSize % sizeof(uint32_t) != 0)
+        return BytecodeSize;
+
+    const auto*  pWords   = static_cast<const uint32_t*>(pBytecode);
+    const size_t NumWords = BytecodeSize / sizeof(uint32_t);
+    if (pWords[NumWords - 1] != SerializedResourcesMagic)
+        return BytecodeSize;
+
+    const size_t ResourcesSize = pWords[NumWords - 2];
+    const size_t BlockSize     = AlignUp(ResourcesSize, sizeof(uint32_t)) + sizeof(uint32_t) * 2;
+    if (ResourcesSize == 0 || BlockSize >= BytecodeSize)
+    {
+        UNEXPECTED("The serialized resources block is corrupted");
+        return BytecodeSize;
+    }
+
+    const size_t SPIRVSize = BytecodeSize - BlockSize;
+    Resources              = SerializedData{const_cast<Uint8*>(static_cast<const Uint8*>(pBytecode)) + SPIRVSize, ResourcesSize};
+    return SPIRVSize;
+}
+
 void SPIRVShaderResources::Initialize(IMemoryAllocator&       Allocator,
                                       const ResourceCounters& Counters,
                                       Uint32                  NumShaderStageInputs,
@@ -25,7 +25,13 @@
  */
 
 #include "SPIRVTools.hpp"
+
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+
 #include "DebugUtilities.hpp"
+#include "ThreadPool.hpp"
 
 #include "spirv-tools/optimizer.hpp"
 
@@ -105,37 +111,81 @@ spv_target_env SpvTargetEnvFromSPIRV(const std::vector<uint32_t>& SPIRV)
     }
 }
 
-} // namespace
-
-std::vector<uint32_t> OptimizeSPIRV(const std::vector<uint32_t>& SrcSPIRV, spv_target_env TargetEnv, SPIRV_OPTIMIZATION_FLAGS Passes)
+spvtools::Optimizer& GetThreadOptimizer(spv_target_env TargetEnv, SPIRV_OPTIMIZATION_FLAGS Passes)
 {
-    VERIFY_EXPR(Passes != SPIRV_OPTIMIZATION_FLAG_NONE);
+    // Creating the optimizer and registering the passes is relatively expensive, while
+    // the same optimizer can run any number of modules. Keep one instance per thread
+    // for every combination of the target environment and passes.
+    thread_local std::unordered_map<Uint64, std::unique_ptr<spvtools::Optimizer>> Optimizers;
 
-    if (TargetEnv == SPV_ENV_MAX)
-        TargetEnv = SpvTargetEnvFromSPIRV(SrcSPIRV);
+    const Uint64 Key = (static_cast<Uint64>(TargetEnv) << 32u) | static_cast<Uint64>(Passes);
+
+    auto& pOptimizer = Optimizers[Key];
+    if (pOptimizer)
+        return *pOptimizer;
 
-    spvtools::Optimizer SpirvOptimizer(TargetEnv);
-    SpirvOptimizer.SetMessageConsumer(SpvOptimizerMessageConsumer);
+    pOptimizer = std::make_unique<spvtools::Optimizer>(TargetEnv);
+    pOptimizer->SetMessageConsumer(SpvOptimizerMessageConsumer);
 
     // SPIR-V bytecode generated from HLSL must be legalized to
     // turn it into a valid vulkan SPIR-V shader.
     if (Passes & SPIRV_OPTIMIZATION_FLAG_LEGALIZATION)
     {
-        SpirvOptimizer.RegisterLegalizationPasses();
+        pOptimizer->RegisterLegalizationPasses();
     }
 
     if (Passes & SPIRV_OPTIMIZATION_FLAG_PERFORMANCE)
     {
-        SpirvOptimizer.RegisterPerformancePasses();
+        pOptimizer->RegisterPerformancePasses();
     }
 
     if (Passes & SPIRV_OPTIMIZATION_FLAG_STRIP_REFLECTION)
     {
         // Decorations defined in SPV_GOOGLE_hlsl_functionality1 are the only instructions
         // removed by strip-reflect-info pass. SPIRV offsets become INVALID after this operation.
-        SpirvOptimizer.RegisterPass(spvtools::CreateStripReflectInfoPass());
+        pOptimizer->RegisterPass(spvtools::CreateStripReflectInfoPass());
     }
 
+    return *pOptimizer;
+}
+
+void ProcessBatchItem(SPIRVBatchItem& Item)
+{
+    Item.SPIRV.clear();
+    Item.NumRemappedResources = 0;
+
+    if (Item.pSrcSPIRV == nullptr)
+    {
+        UNEXPECTED("Source SPIRV must not be null");
+        return;
+    }
+
+    if (Item.Passes != SPIRV_OPTIMIZATION_FLAG_NONE)
+    {
+        Item.SPIRV = OptimizeSPIRV(*Item.pSrcSPIRV, Item.TargetEnv, Item.Passes);
+        if (Item.SPIRV.empty())
+            return;
+    }
+    else
+    {
+        Item.SPIRV = *Item.pSrcSPIRV;
+    }
+
+    if (Item.pRemapping != nullptr)
+        Item.NumRemappedResources = RemapSPIRVBindings(Item.SPIRV, *Item.pRemapping);
+}
+
+} // namespace
+
+std::vector<uint32_t> OptimizeSPIRV(const std::vector<uint32_t>& SrcSPIRV, spv_target_env TargetEnv, SPIRV_OPTIMIZATION_FLAGS Passes)
+{
+    VERIFY_EXPR(Passes != SPIRV_OPTIMIZATION_FLAG_NONE);
+
+    if (TargetEnv == SPV_ENV_MAX)
+        TargetEnv = SpvTargetEnvFromSPIRV(SrcSPIRV);
+
+    spvtools::Optimizer& SpirvOptimizer = GetThreadOptimizer(TargetEnv, Passes);
+
     std::vector<uint32_t> OptimizedSPIRV;
     if (!SpirvOptimizer.Run(SrcSPIRV.data(), SrcSPIRV.size(), &OptimizedSPIRV))
         OptimizedSPIRV.clear();
@@ -143,4 +193,52 @@ std::vector<uint32_t> OptimizeSPIRV(const std::vector<uint32_t>& SrcSPIRV, spv_t
     return OptimizedSPIRV;
 }
 
+void OptimizeSPIRVBatch(SPIRVBatchItem* pItems, size_t NumItems, IThreadPool* pThreadPool)
+{
+    if (NumItems == 0)
+        return;
+
+    DEV_CHECK_ERR(pItems != nullptr, "pItems must not be null");
+
+    // Do not enqueue more tasks than there are worker threads to run them. If the pool has
+    // no worker threads, the tasks would only be processed by the calling thread anyway.
+    const size_t NumWorkers = pThreadPool != nullptr ? pThreadPool->GetThreadCount() : 0;
+    if (NumWorkers == 0 || NumItems == 1)
+    {
+        for (size_t i = 0; i < NumItems; ++i)
+            ProcessBatchItem(pItems[i]);
+        return;
+    }
+
+    // Workers pick up the items one by one, so that a few large modules
+    // do not leave other threads idle.
+    std::atomic<size_t> NextItem{0};
+
+    auto ProcessItems = [&]() {
+        for (size_t i = NextItem.fetch_add(1); i < NumItems; i = NextItem.fetch_add(1))
+            ProcessBatchItem(pItems[i]);
+    };
+
+    const size_t NumTasks = std::min(NumItems - 1, NumWorkers);
+
+    std::vector<RefCntAutoPtr<IAsyncTask>> Tasks;
+    Tasks.reserve(NumTasks);
+    for (size_t i = 0; i < NumTasks; ++i)
+    {
+        Tasks.emplace_back(EnqueueAsyncWork(pThreadPool,
+                                            [&ProcessItems](Uint32) {
+                                                ProcessItems();
+                                            }));
+    }
+
+    ProcessItems();
+
+    for (auto& pTask : Tasks)
+    {
+        // Tasks that have not started yet have nothing left to do
+        if (!pThreadPool->RemoveTask(pTask))
+            pTask->WaitForCompletion();
+    }
+}
+
 } // namespace Diligent
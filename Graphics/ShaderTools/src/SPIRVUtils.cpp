@@ -26,6 +26,9 @@
 
 #include "SPIRVUtils.hpp"
 
+#include <cstring>
+#include <string>
+
 #include "spirv_cross.hpp"
 
 namespace Diligent
@@ -154,4 +157,213 @@ std::vector<uint32_t> PatchImageFormats(const std::vector<uint32_t>&
     return PatchedSPIRV;
 }
 
+Uint32 RemapSPIRVBindings(std::vector<uint32_t>& SPIRV, const SPIRVBindingRemapping& Remapping)
+{
+    // First 5 words are the header: magic number, version, generator, bound and schema
+    constexpr size_t HeaderSize = 5;
+    if (SPIRV.size() <= HeaderSize || SPIRV[0] != spv::MagicNumber)
+    {
+        UNEXPECTED("Invalid SPIRV code");
+        return 0;
+    }
+
+    if (Remapping.empty())
+        return 0;
+
+    const uint32_t IdBound = SPIRV[3];
+
+    // Per-id information collected in a single pass over the code
+    struct IdInfo
+    {
+        const char* Name = nullptr;
+        // For pointer types, the pointee type id. For variables, the pointer type id.
+        uint32_t TypeId = 0;
+        // Offsets of the decoration literals
+        uint32_t BindingOffset       = 0;
+        uint32_t DescriptorSetOffset = 0;
+
+        bool IsVariable = false;
+    };
+    std::vector<IdInfo> Ids(IdBound);
+
+    for (size_t i = HeaderSize; i < SPIRV.size();)
+    {
+        const uint32_t WordCount = SPIRV[i] >> 16u;
+        const uint32_t OpCode    = SPIRV[i] & 0xFFFFu;
+        if (WordCount == 0 || i + WordCount > SPIRV.size())
+        {
+            LOG_ERROR_MESSAGE("Invalid SPIRV instruction at offset ", i);
+            return 0;
+        }
+
+        const uint32_t* Operands = &SPIRV[i + 1];
+        switch (OpCode)
+        {
+            // OpName | Target | Name
+            case spv::OpName:
+                if (WordCount > 2 && Operands[0] < IdBound)
+                {
+                    // The string is nul-terminated and padded with zeros to the word boundary,
+                    // which is guaranteed by the instruction word count.
+                    if (reinterpret_cast<const char*>(&SPIRV[i + WordCount])[-1] == '\0')
+                        Ids[Operands[0]].Name = reinterpret_cast<const char*>(&Operands[1]);
+                }
+                break;
+
+            // OpDecorate | Target | Decoration | Literal
+            case spv::OpDecorate:
+                if (WordCount > 3 && Operands[0] < IdBound)
+                {
+                    if (Operands[1] == spv::DecorationBinding)
+                        Ids[Operands[0]].BindingOffset = static_cast<uint32_t>(i + 3);
+                    else if (Operands[1] == spv::DecorationDescriptorSet)
+                        Ids[Operands[0]].DescriptorSetOffset = static_cast<uint32_t>(i + 3);
+                }
+                break;
+
+            // OpTypePointer | Result | Storage Class | Type
+            case spv::OpTypePointer:
+                if (WordCount > 3 && Operands[0] < IdBound)
+                    Ids[Operands[0]].TypeId = Operands[2];
+                break;
+
+            // OpVariable | Result Type | Result | Storage Class
+            case spv::OpVariable:
+                if (WordCount > 3 && Operands[1] < IdBound)
+                {
+                    Ids[Operands[1]].TypeId     = Operands[0];
+                    Ids[Operands[1]].IsVariable = true;
+                }
+                break;
+
+            // Function bodies follow the declarations; there is nothing to remap there.
+            case spv::OpFunction:
+                i = SPIRV.size();
+                continue;
+
+            default:
+                break;
+        }
+
+        i += WordCount;
+    }
+
+    Uint32 NumRemapped = 0;
+    for (const IdInfo& Var : Ids)
+    {
+        if (!Var.IsVariable || Var.BindingOffset == 0)
+            continue;
+
+        const char* Name = Var.Name;
+        if ((Name == nullptr || Name[0] == '\0') && Var.TypeId < IdBound)
+        {
+            const uint32_t PointeeTypeId = Ids[Var.TypeId].TypeId;
+            if (PointeeTypeId < IdBound)
+                Name = Ids[PointeeTypeId].Name;
+        }
+        if (Name == nullptr || Name[0] == '\0')
+            continue;
+
+        auto it = Remapping.find(HashMapStringKey{Name});
+        if (it == Remapping.end())
+            continue;
+
+        SPIRV[Var.BindingOffset] = it->second.Binding;
+        if (Var.DescriptorSetOffset != 0)
+            SPIRV[Var.DescriptorSetOffset] = it->second.DescriptorSet;
+        else if (it->second.DescriptorSet != 0)
+            LOG_WARNING_MESSAGE("Resource '", Name, "' has no descriptor set decoration. Descriptor set ", it->second.DescriptorSet, " will be ignored.");
+
+        ++NumRemapped;
+    }
+
+    return NumRemapped;
+}
+
+std::vector<SPIRVResourceDecorationOffsets> FindResourceDecorationOffsets(const std::vector<uint32_t>& SPIRV,
+                                                                          const std::vector<uint32_t>& Ids)
+{
+    std::vector<SPIRVResourceDecorationOffsets> Offsets(Ids.size());
+
+    constexpr size_t HeaderSize = 5;
+    if (SPIRV.size() <= HeaderSize || SPIRV[0] != spv::MagicNumber)
+    {
+        UNEXPECTED("Invalid SPIRV code");
+        return Offsets;
+    }
+
+    std::unordered_map<uint32_t, size_t> IdToIndex;
+    IdToIndex.reserve(Ids.size());
+    for (size_t i = 0; i < Ids.size(); ++i)
+        IdToIndex.emplace(Ids[i], i);
+
+    for (size_t i = HeaderSize; i < SPIRV.size();)
+    {
+        const uint32_t WordCount = SPIRV[i] >> 16u;
+        const uint32_t OpCode    = SPIRV[i] & 0xFFFFu;
+        if (WordCount == 0 || i + WordCount > SPIRV.size())
+        {
+            LOG_ERROR_MESSAGE("Invalid SPIRV instruction at offset ", i);
+            break;
+        }
+
+        // Decorations precede all types, variables and functions
+        if (OpCode == spv::OpFunction)
+            break;
+
+        // OpDecorate | Target | Decoration | Literal
+        if (OpCode == spv::OpDecorate && WordCount > 3)
+        {
+            auto it = IdToIndex.find(SPIRV[i + 1]);
+            if (it != IdToIndex.end())
+            {
+                if (SPIRV[i + 2] == spv::DecorationBinding)
+                    Offsets[it->second].Binding = static_cast<uint32_t>(i + 3);
+                else if (SPIRV[i + 2] == spv::DecorationDescriptorSet)
+                    Offsets[it->second].DescriptorSet = static_cast<uint32_t>(i + 3);
+            }
+        }
+
+        i += WordCount;
+    }
+
+    return Offsets;
+}
+
+bool HasSPIRVReflectionInstructions(const std::vector<uint32_t>& SPIRV)
+{
+    constexpr size_t HeaderSize = 5;
+    for (size_t i = HeaderSize; i < SPIRV.size();)
+    {
+        const uint32_t WordCount = SPIRV[i] >> 16u;
+        const uint32_t OpCode    = SPIRV[i] & 0xFFFFu;
+        if (WordCount == 0 || i + WordCount > SPIRV.size())
+            break;
+
+        // Extensions are declared right after capabilities
+        if (OpCode != spv::OpCapability && OpCode != spv::OpExtension)
+            break;
+
+        // OpExtension | Name
+        if (OpCode == spv::OpExtension && WordCount > 1)
+        {
+            const char*  Name    = reinterpret_cast<const char*>(&SPIRV[i + 1]);
+            const size_t MaxLen  = (WordCount - 1) * sizeof(uint32_t);
+            const auto   NameLen = strnlen(Name, MaxLen);
+            if (NameLen < MaxLen)
+            {
+                const std::string Ext{Name, NameLen};
+                if (Ext == "SPV_GOOGLE_hlsl_functionality1" ||
+                    Ext == "SPV_GOOGLE_decorate_string" ||
+                    Ext == "SPV_GOOGLE_user_type")
+                    return true;
+            }
+        }
+
+        i += WordCount;
+    }
+
+    return false;
+}
+
 } // namespace Diligent
@@ -26,6 +26,7 @@
  */
 
 #include <sstream>
+#include <vector>
 
 #include "GPUTestingEnvironment.hpp"
 
@@ -103,6 +104,38 @@ TEST(BufferAccessTest, Initialization)
     VerifyBufferData(pBuffer);
 }
 
+TEST(BufferAccessTest, InitializeManyBuffers)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Test immutable buffer";
+    BuffDesc.Usage     = USAGE_IMMUTABLE;
+    BuffDesc.Size      = sizeof(TestBufferData);
+    BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+
+    BufferData InitData;
+    InitData.pData    = TestBufferData;
+    InitData.DataSize = BuffDesc.Size;
+
+    // In Vulkan, initial data uploads of these buffers are batched together
+    // and span several batches (see GPUTestingEnvironment).
+    std::vector<RefCntAutoPtr<IBuffer>> Buffers(2048);
+    for (auto& pBuffer : Buffers)
+    {
+        pDevice->CreateBuffer(BuffDesc, &InitData, &pBuffer);
+        ASSERT_NE(pBuffer, nullptr) << "Buffer desc:\n"
+                                    << BuffDesc;
+    }
+
+    VerifyBufferData(Buffers.front());
+    VerifyBufferData(Buffers[Buffers.size() / 2]);
+    VerifyBufferData(Buffers.back());
+}
+
 TEST(BufferAccessTest, UpdateBufferData)
 {
     auto* pEnv     = GPUTestingEnvironment::GetInstance();
@@ -153,4 +153,91 @@ TEST(BufferSuballocatorTest, Allocate)
     }
 }
 
+TEST(BufferSuballocatorTest, Defragment)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    BufferSuballocatorCreateInfo CI;
+    CI.Desc.Name      = "Buffer Suballocator Defragment Test";
+    CI.Desc.BindFlags = BIND_VERTEX_BUFFER;
+    CI.Desc.Size      = 256;
+    CI.ExpansionSize  = 256;
+    CI.MaxSize        = 1u << 20u;
+
+    RefCntAutoPtr<IBufferSuballocator> pAllocator;
+    CreateBufferSuballocator(pDevice, CI, &pAllocator);
+    ASSERT_NE(pAllocator, nullptr);
+
+    constexpr Uint32 NumAllocations = 64;
+    constexpr Uint32 AllocSize      = 64;
+
+    std::vector<RefCntAutoPtr<IBufferSuballocation>> Allocs(NumAllocations);
+    for (auto& Alloc : Allocs)
+    {
+        pAllocator->Allocate(AllocSize, 16, &Alloc);
+        ASSERT_TRUE(Alloc);
+    }
+    pAllocator->Update(pDevice, pContext);
+
+    // Release every other allocation to fragment the buffer
+    for (size_t i = 0; i < Allocs.size(); i += 2)
+        Allocs[i].Release();
+
+    BufferSuballocatorUsageStats StatsBefore;
+    pAllocator->GetUsageStats(StatsBefore);
+
+    struct CallbackData
+    {
+        Uint32 NumMoved = 0;
+    } Data;
+
+    BufferSuballocatorDefragmentAttribs Attribs;
+    Attribs.MaxMoveSize        = AllocSize * 4;
+    Attribs.pUserData          = &Data;
+    Attribs.SuballocationMoved = [](IBufferSuballocation* pSuballocation, Uint32 OldOffset, void* pUserData) {
+        EXPECT_LT(pSuballocation->GetOffset(), OldOffset);
+        ++static_cast<CallbackData*>(pUserData)->NumMoved;
+    };
+
+    Uint64 TotalMoved = 0;
+    for (Uint32 Frame = 0; Frame < NumAllocations; ++Frame)
+    {
+        const auto Moved = pAllocator->Defragment(pDevice, pContext, Attribs);
+        EXPECT_LE(Moved, Attribs.MaxMoveSize);
+        if (Moved == 0)
+            break;
+        TotalMoved += Moved;
+    }
+    EXPECT_GT(TotalMoved, Uint64{0});
+    EXPECT_EQ(TotalMoved, Uint64{Data.NumMoved} * AllocSize);
+
+    BufferSuballocatorUsageStats StatsAfter;
+    pAllocator->GetUsageStats(StatsAfter);
+    EXPECT_EQ(StatsAfter.AllocationCount, StatsBefore.AllocationCount);
+    EXPECT_EQ(StatsAfter.UsedSize, StatsBefore.UsedSize);
+    EXPECT_EQ(StatsAfter.MovedSize, TotalMoved);
+    EXPECT_LT(StatsAfter.CommittedSize, StatsBefore.CommittedSize);
+    EXPECT_EQ(StatsAfter.ReclaimedSize, StatsBefore.CommittedSize - StatsAfter.CommittedSize);
+
+    // All remaining allocations must fit into the shrunk buffer without overlapping
+    std::vector<Uint32> Offsets;
+    for (const auto& Alloc : Allocs)
+    {
+        if (Alloc)
+            Offsets.push_back(Alloc->GetOffset());
+    }
+    std::sort(Offsets.begin(), Offsets.end());
+    for (size_t i = 1; i < Offsets.size(); ++i)
+        EXPECT_GE(Offsets[i], Offsets[i - 1] + AllocSize);
+    EXPECT_LE(Offsets.back() + AllocSize, StatsAfter.CommittedSize);
+
+    auto* pBuffer = pAllocator->Update(pDevice, pContext);
+    ASSERT_NE(pBuffer, nullptr);
+    EXPECT_EQ(pBuffer->GetDesc().Size, StatsAfter.CommittedSize);
+}
+
 } // namespace
@@ -0,0 +1,309 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "PipelineStateGL.h"
+#include "GPUTestingEnvironment.hpp"
+
+#include "DataBlobImpl.hpp"
+#include "Serializer.hpp"
+#include "GraphicsAccessories.hpp"
+
+#include "InlineShaders/DrawCommandTestHLSL.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+RefCntAutoPtr<IPipelineStateCache> CreatePSOCache(PSO_CACHE_MODE Mode, IDataBlob* pCacheData = nullptr)
+{
+    auto* pDevice = GPUTestingEnvironment::GetInstance()->GetDevice();
+
+    PipelineStateCacheCreateInfo PSOCacheCI;
+    PSOCacheCI.Desc.Name  = "GL pipeline state cache test";
+    PSOCacheCI.Desc.Mode  = Mode;
+    PSOCacheCI.Desc.Flags = PSO_CACHE_FLAG_VERBOSE;
+    if (pCacheData != nullptr)
+    {
+        PSOCacheCI.pCacheData    = pCacheData->GetConstDataPtr();
+        PSOCacheCI.CacheDataSize = pCacheData->GetSize();
+    }
+
+    RefCntAutoPtr<IPipelineStateCache> pPSOCache;
+    pDevice->CreatePipelineStateCache(PSOCacheCI, &pPSOCache);
+    return pPSOCache;
+}
+
+// Creates the pipeline from new shader objects every time so that the programs
+// are not found in the device program cache and the PSO cache is always used.
+RefCntAutoPtr<IPipelineState> CreateTestPSO(IPipelineStateCache* pPSOCache)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.EntryPoint     = "main";
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Desc   = {"GL PSO cache test vertex shader", SHADER_TYPE_VERTEX, true};
+        ShaderCI.Source = HLSL::DrawTest_ProceduralTriangleVS.c_str();
+        pDevice->CreateShader(ShaderCI, &pVS);
+        if (!pVS)
+            return {};
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Desc   = {"GL PSO cache test pixel shader", SHADER_TYPE_PIXEL, true};
+        ShaderCI.Source = HLSL::DrawTest_PS.c_str();
+        pDevice->CreateShader(ShaderCI, &pPS);
+        if (!pPS)
+            return {};
+    }
+
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name = "GL PSO cache test";
+    PSOCreateInfo.pVS          = pVS;
+    PSOCreateInfo.pPS          = pPS;
+    PSOCreateInfo.pPSOCache    = pPSOCache;
+
+    auto& GraphicsPipeline{PSOCreateInfo.GraphicsPipeline};
+    GraphicsPipeline.NumRenderTargets             = 1;
+    GraphicsPipeline.RTVFormats[0]                = pSwapChain->GetDesc().ColorBufferFormat;
+    GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+    return pPSO;
+}
+
+// Checks whether the programs of all shader stages of the test pipeline were loaded from the cache binaries
+void CheckProgramsLoadedFromBinary(IPipelineState* pPSO, bool ExpectedLoaded)
+{
+    RefCntAutoPtr<IPipelineStateGL> pPSOGL{pPSO, IID_PipelineStateGL};
+    ASSERT_NE(pPSOGL, nullptr);
+
+    for (SHADER_TYPE Stage : {SHADER_TYPE_VERTEX, SHADER_TYPE_PIXEL})
+    {
+        EXPECT_EQ(pPSOGL->IsGLProgramLoadedFromBinary(Stage), ExpectedLoaded)
+            << "Unexpected program source for stage " << GetShaderTypeLiteralName(Stage);
+    }
+}
+
+void DrawWithPSO(IPipelineState* pPSO)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    ITextureView* pRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->SetPipelineState(pPSO);
+    pContext->Draw({6, DRAW_FLAG_VERIFY_ALL});
+    pContext->Flush();
+}
+
+// Returns the data of a store-mode cache that contains the programs of the test pipeline,
+// or null if the driver does not support program binaries.
+RefCntAutoPtr<IDataBlob> CreateCacheData()
+{
+    auto pPSOCache = CreatePSOCache(PSO_CACHE_MODE_STORE);
+    if (!pPSOCache)
+    {
+        ADD_FAILURE() << "Failed to create the pipeline state cache";
+        return {};
+    }
+
+    auto pPSO = CreateTestPSO(pPSOCache);
+    if (!pPSO)
+    {
+        ADD_FAILURE() << "Failed to create the pipeline state";
+        return {};
+    }
+
+    RefCntAutoPtr<IDataBlob> pCacheData;
+    pPSOCache->GetData(&pCacheData);
+    return pCacheData;
+}
+
+// Calls Handler for the format and the binary data of every program in the cache data.
+// The layout must match the one written by PipelineStateCacheGLImpl::GetData().
+template <typename HandlerType>
+void ProcessProgramBinaries(IDataBlob* pCacheData, HandlerType&& Handler)
+{
+    Serializer<SerializerMode::Read> Ser{SerializedData{pCacheData->GetDataPtr(), pCacheData->GetSize()}};
+
+    Uint32      Magic       = 0;
+    Uint32      Version     = 0;
+    const char* Vendor      = nullptr;
+    const char* Renderer    = nullptr;
+    const char* GLVersion   = nullptr;
+    Uint32      NumPrograms = 0;
+    ASSERT_TRUE(Ser(Magic, Version, Vendor, Renderer, GLVersion, NumPrograms));
+    ASSERT_GT(NumPrograms, 0u);
+
+    for (Uint32 i = 0; i < NumPrograms; ++i)
+    {
+        Uint64 Hash       = 0;
+        Uint64 SourceSize = 0;
+        ASSERT_TRUE(Ser(Hash, SourceSize));
+
+        Uint32* pFormat = static_cast<Uint32*>(const_cast<void*>(Ser.GetCurrentPtr()));
+        Uint32  Format  = 0;
+        ASSERT_TRUE(Ser(Format));
+
+        const void* pBinData   = nullptr;
+        size_t      BinarySize = 0;
+        ASSERT_TRUE(Ser.SerializeBytes(pBinData, BinarySize));
+
+        Handler(*pFormat, static_cast<Uint8*>(const_cast<void*>(pBinData)), BinarySize);
+    }
+    EXPECT_TRUE(Ser.IsEnded());
+}
+
+class PipelineStateCacheGLTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        auto* pDevice = GPUTestingEnvironment::GetInstance()->GetDevice();
+        if (!pDevice->GetDeviceInfo().IsGLDevice())
+        {
+            GTEST_SKIP() << "This test is OpenGL-specific";
+        }
+
+        m_pCacheData = CreateCacheData();
+        if (HasFailure())
+            return;
+
+        if (!m_pCacheData)
+        {
+            GTEST_SKIP() << "Program binaries are not supported by the driver";
+        }
+    }
+
+    RefCntAutoPtr<IDataBlob> m_pCacheData;
+};
+
+TEST_F(PipelineStateCacheGLTest, Store)
+{
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    ProcessProgramBinaries(m_pCacheData, [](Uint32&, const Uint8* pData, size_t Size) {
+        EXPECT_NE(pData, nullptr);
+        EXPECT_GT(Size, size_t{0});
+    });
+
+    auto pPSOCache = CreatePSOCache(PSO_CACHE_MODE_STORE);
+    ASSERT_NE(pPSOCache, nullptr);
+
+    auto pPSO = CreateTestPSO(pPSOCache);
+    ASSERT_NE(pPSO, nullptr);
+
+    RefCntAutoPtr<IDataBlob> pData;
+    pPSOCache->GetData(&pData);
+    ASSERT_NE(pData, nullptr);
+
+    // Programs that are already in the cache must not be added again
+    auto pPSO2 = CreateTestPSO(pPSOCache);
+    ASSERT_NE(pPSO2, nullptr);
+
+    RefCntAutoPtr<IDataBlob> pData2;
+    pPSOCache->GetData(&pData2);
+    ASSERT_NE(pData2, nullptr);
+    EXPECT_EQ(pData2->GetSize(), pData->GetSize());
+}
+
+TEST_F(PipelineStateCacheGLTest, Reload)
+{
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto pPSOCache = CreatePSOCache(PSO_CACHE_MODE_LOAD_STORE, m_pCacheData);
+    ASSERT_NE(pPSOCache, nullptr);
+
+    auto pPSO = CreateTestPSO(pPSOCache);
+    ASSERT_NE(pPSO, nullptr);
+    CheckProgramsLoadedFromBinary(pPSO, true);
+    DrawWithPSO(pPSO);
+
+    // All programs must have been loaded from the cache data, so no new binaries are added
+    RefCntAutoPtr<IDataBlob> pReloadedData;
+    pPSOCache->GetData(&pReloadedData);
+    ASSERT_NE(pReloadedData, nullptr);
+    EXPECT_EQ(pReloadedData->GetSize(), m_pCacheData->GetSize());
+}
+
+TEST_F(PipelineStateCacheGLTest, FormatMismatch)
+{
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto pModifiedData = DataBlobImpl::MakeCopy(m_pCacheData);
+    // No valid binary format is zero, so the driver must reject all binaries
+    ProcessProgramBinaries(pModifiedData, [](Uint32& Format, Uint8*, size_t) {
+        Format = 0;
+    });
+
+    auto pPSOCache = CreatePSOCache(PSO_CACHE_MODE_LOAD, pModifiedData);
+    ASSERT_NE(pPSOCache, nullptr);
+
+    // The programs must be linked from the shaders
+    auto pPSO = CreateTestPSO(pPSOCache);
+    ASSERT_NE(pPSO, nullptr);
+    EXPECT_EQ(pPSO->GetStatus(), PIPELINE_STATE_STATUS_READY);
+    CheckProgramsLoadedFromBinary(pPSO, false);
+    DrawWithPSO(pPSO);
+}
+
+TEST_F(PipelineStateCacheGLTest, CorruptedBinary)
+{
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto pModifiedData = DataBlobImpl::MakeCopy(m_pCacheData);
+    ProcessProgramBinaries(pModifiedData, [](Uint32&, Uint8* pData, size_t Size) {
+        for (size_t i = 0; i < Size; ++i)
+            pData[i] = static_cast<Uint8>(~pData[i]);
+    });
+
+    auto pPSOCache = CreatePSOCache(PSO_CACHE_MODE_LOAD, pModifiedData);
+    ASSERT_NE(pPSOCache, nullptr);
+
+    auto pPSO = CreateTestPSO(pPSOCache);
+    ASSERT_NE(pPSO, nullptr);
+    EXPECT_EQ(pPSO->GetStatus(), PIPELINE_STATE_STATUS_READY);
+    CheckProgramsLoadedFromBinary(pPSO, false);
+    DrawWithPSO(pPSO);
+}
+
+} // namespace
@@ -0,0 +1,223 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <array>
+
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(NullBackendTest, DeviceInfo)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsNullDevice())
+    {
+        GTEST_SKIP() << "This test is only applicable to Null backend";
+    }
+
+    const auto& AdapterInfo = pDevice->GetAdapterInfo();
+    EXPECT_EQ(AdapterInfo.Type, ADAPTER_TYPE_SOFTWARE);
+    EXPECT_EQ(AdapterInfo.NumQueues, 1u);
+    EXPECT_EQ(AdapterInfo.Queues[0].QueueType, COMMAND_QUEUE_TYPE_GRAPHICS);
+
+    const auto& Features = pDevice->GetDeviceInfo().Features;
+    EXPECT_EQ(Features.RayTracing, DEVICE_FEATURE_STATE_DISABLED);
+    EXPECT_EQ(Features.SparseResources, DEVICE_FEATURE_STATE_DISABLED);
+}
+
+TEST(NullBackendTest, FenceCompletesOnFlush)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsNullDevice())
+    {
+        GTEST_SKIP() << "This test is only applicable to Null backend";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto* pContext = pEnv->GetDeviceContext();
+
+    FenceDesc Desc;
+    Desc.Name = "Null backend test fence";
+    Desc.Type = FENCE_TYPE_CPU_WAIT_ONLY;
+
+    RefCntAutoPtr<IFence> pFence;
+    pDevice->CreateFence(Desc, &pFence);
+    ASSERT_NE(pFence, nullptr);
+    EXPECT_EQ(pFence->GetCompletedValue(), Uint64{0});
+
+    pContext->EnqueueSignal(pFence, 1);
+    EXPECT_EQ(pFence->GetCompletedValue(), Uint64{0}) << "The fence must not be signaled before the context is flushed";
+
+    pContext->Flush();
+    EXPECT_EQ(pFence->GetCompletedValue(), Uint64{1});
+
+    pContext->EnqueueSignal(pFence, 2);
+    pContext->WaitForIdle();
+    EXPECT_EQ(pFence->GetCompletedValue(), Uint64{2});
+}
+
+TEST(NullBackendTest, CPUBufferCopy)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsNullDevice())
+    {
+        GTEST_SKIP() << "This test is only applicable to Null backend";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto* pContext = pEnv->GetDeviceContext();
+
+    constexpr Uint32 RefData[] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name           = "Null backend test upload buffer";
+    BuffDesc.Size           = sizeof(RefData);
+    BuffDesc.Usage          = USAGE_STAGING;
+    BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+
+    RefCntAutoPtr<IBuffer> pUploadBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pUploadBuffer);
+    ASSERT_NE(pUploadBuffer, nullptr);
+
+    BuffDesc.Name           = "Null backend test readback buffer";
+    BuffDesc.CPUAccessFlags = CPU_ACCESS_READ;
+
+    RefCntAutoPtr<IBuffer> pReadbackBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pReadbackBuffer);
+    ASSERT_NE(pReadbackBuffer, nullptr);
+
+    {
+        void* pData = nullptr;
+        pContext->MapBuffer(pUploadBuffer, MAP_WRITE, MAP_FLAG_NONE, pData);
+        ASSERT_NE(pData, nullptr);
+        memcpy(pData, RefData, sizeof(RefData));
+        pContext->UnmapBuffer(pUploadBuffer, MAP_WRITE);
+    }
+
+    // Only buffers with CPU access keep their contents, so the copy between
+    // two staging buffers must be performed
+    pContext->CopyBuffer(pUploadBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                         pReadbackBuffer, 0, sizeof(RefData), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->WaitForIdle();
+
+    {
+        void* pData = nullptr;
+        pContext->MapBuffer(pReadbackBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+        ASSERT_NE(pData, nullptr);
+        EXPECT_EQ(memcmp(pData, RefData, sizeof(RefData)), 0) << "Buffer data does not match reference values";
+        pContext->UnmapBuffer(pReadbackBuffer, MAP_READ);
+    }
+}
+
+TEST(NullBackendTest, TimestampQueries)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsNullDevice())
+    {
+        GTEST_SKIP() << "This test is only applicable to Null backend";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto* pContext = pEnv->GetDeviceContext();
+
+    QueryDesc Desc;
+    Desc.Name = "Null backend test timestamp query";
+    Desc.Type = QUERY_TYPE_TIMESTAMP;
+
+    std::array<RefCntAutoPtr<IQuery>, 2> pQueries;
+    for (auto& pQuery : pQueries)
+    {
+        pDevice->CreateQuery(Desc, &pQuery);
+        ASSERT_NE(pQuery, nullptr);
+        pContext->EndQuery(pQuery);
+    }
+    pContext->Flush();
+
+    std::array<QueryDataTimestamp, 2> QueryData;
+    for (size_t i = 0; i < pQueries.size(); ++i)
+    {
+        EXPECT_TRUE(pQueries[i]->GetData(&QueryData[i], sizeof(QueryData[i])));
+        EXPECT_EQ(QueryData[i].Frequency, Uint64{1000000000}) << "Timestamps must be reported in CPU nanoseconds";
+    }
+    EXPECT_LE(QueryData[0].Counter, QueryData[1].Counter);
+}
+
+TEST(NullBackendTest, ExecuteCommandLists)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsNullDevice())
+    {
+        GTEST_SKIP() << "This test is only applicable to Null backend";
+    }
+    if (pEnv->GetNumDeferredContexts() == 0)
+    {
+        GTEST_SKIP() << "Deferred contexts are not available";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto* pContext     = pEnv->GetDeviceContext();
+    auto* pDeferredCtx = pEnv->GetDeferredContext(0);
+
+    auto* pRTV = pEnv->GetSwapChain()->GetCurrentBackBufferRTV();
+
+    StateTransitionDesc Barrier{pRTV->GetTexture(), RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_RENDER_TARGET, STATE_TRANSITION_FLAG_UPDATE_STATE};
+    pContext->TransitionResourceStates(1, &Barrier);
+
+    const auto NumClears = pDeferredCtx->GetStats().CommandCounters.ClearRenderTarget;
+
+    constexpr float ClearColor[] = {0.25f, 0.5f, 0.75f, 1.0f};
+    pDeferredCtx->Begin(0);
+    pDeferredCtx->SetRenderTargets(1, &pRTV, nullptr, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+    pDeferredCtx->ClearRenderTarget(pRTV, ClearColor, RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+
+    RefCntAutoPtr<ICommandList> pCmdList;
+    pDeferredCtx->FinishCommandList(&pCmdList);
+    ASSERT_NE(pCmdList, nullptr);
+
+    EXPECT_EQ(pDeferredCtx->GetStats().CommandCounters.ClearRenderTarget, NumClears + 1);
+
+    ICommandList* pCmdLists[] = {pCmdList};
+    pContext->ExecuteCommandLists(1, pCmdLists);
+    pDeferredCtx->FinishFrame();
+    pContext->WaitForIdle();
+}
+
+} // namespace
@@ -134,4 +134,67 @@ TEST(ResourceStateTest, DiscardSubresource)
     pContext->Flush();
 }
 
+TEST(ResourceStateTest, MergeSubresourceTransitions)
+{
+    auto*       pEnv       = GPUTestingEnvironment::GetInstance();
+    auto*       pDevice    = pEnv->GetDevice();
+    auto*       pContext   = pEnv->GetDeviceContext();
+    const auto& DeviceInfo = pDevice->GetDeviceInfo();
+    if (DeviceInfo.Type != RENDER_DEVICE_TYPE_VULKAN)
+        GTEST_SKIP() << "Barrier statistics are only reported by Vulkan backend";
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    constexpr Uint32 ArraySize = 4;
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "MergeSubresourceTransitions test texture";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D_ARRAY;
+    TexDesc.Width     = 64;
+    TexDesc.Height    = 64;
+    TexDesc.ArraySize = ArraySize;
+    TexDesc.MipLevels = 1;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+
+    RefCntAutoPtr<ITexture> pTexture;
+    pDevice->CreateTexture(TexDesc, nullptr, &pTexture);
+    ASSERT_NE(pTexture, nullptr);
+    pTexture->SetState(RESOURCE_STATE_UNKNOWN);
+
+    // Make sure there are no pending barriers
+    pContext->Flush();
+    const auto StatsBefore = pContext->GetStats().Barriers;
+
+    // Transitions of adjacent array slices are merged into one barrier
+    for (Uint32 Slice = 0; Slice < ArraySize; ++Slice)
+    {
+        StateTransitionDesc Barrier{pTexture, RESOURCE_STATE_COPY_DEST, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_DISCARD_CONTENT};
+        Barrier.FirstArraySlice = Slice;
+        Barrier.ArraySliceCount = 1;
+        Barrier.FirstMipLevel   = 0;
+        Barrier.MipLevelsCount  = 1;
+        pContext->TransitionResourceStates(1, &Barrier);
+    }
+
+    // The transition of the same subresources is folded into the pending barrier
+    {
+        StateTransitionDesc Barrier{pTexture, RESOURCE_STATE_SHADER_RESOURCE, RESOURCE_STATE_COPY_DEST};
+        Barrier.FirstArraySlice = 0;
+        Barrier.ArraySliceCount = ArraySize;
+        Barrier.FirstMipLevel   = 0;
+        Barrier.MipLevelsCount  = 1;
+        pContext->TransitionResourceStates(1, &Barrier);
+    }
+
+    pContext->Flush();
+
+    const auto& StatsAfter = pContext->GetStats().Barriers;
+    EXPECT_EQ(StatsAfter.TextureBarriers - StatsBefore.TextureBarriers, 1u);
+    EXPECT_EQ(StatsAfter.MergedTextureBarriers - StatsBefore.MergedTextureBarriers, ArraySize);
+    EXPECT_GE(StatsAfter.PipelineBarriers - StatsBefore.PipelineBarriers, 1u);
+
+    pTexture->SetState(RESOURCE_STATE_COPY_DEST);
+}
+
 } // namespace
@@ -89,7 +89,7 @@ Uint32 WriteOrVerifyRGBAData(MappedTextureSubresource& MappedData,
     return NumInvalidPixels;
 }
 
-void TextureUploaderTest(bool IsRenderThread)
+void TextureUploaderTest(bool IsRenderThread, Uint64 MaxCopyBytesPerUpdate = 0)
 {
     auto* pEnv     = GPUTestingEnvironment::GetInstance();
     auto* pDevice  = pEnv->GetDevice();
@@ -102,7 +102,9 @@ void TextureUploaderTest(bool IsRenderThread)
 
     GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
 
-    TextureUploaderDesc             UploaderDesc;
+    TextureUploaderDesc UploaderDesc;
+    UploaderDesc.MaxCopyBytesPerUpdate = MaxCopyBytesPerUpdate;
+
     RefCntAutoPtr<ITextureUploader> pTexUploader;
     CreateTextureUploader(pDevice, UploaderDesc, &pTexUploader);
     ASSERT_TRUE(pTexUploader);
@@ -170,6 +172,11 @@ void TextureUploaderTest(bool IsRenderThread)
         if (IsRenderThread)
         {
             PopulateBuffer(pContext);
+            // With the copy budget, copies scheduled by the render thread are executed by RenderThreadUpdate()
+            while (pTexUploader->GetStats().NumPendingOperations > 0)
+            {
+                pTexUploader->RenderThreadUpdate(pContext);
+            }
         }
         else
         {
@@ -220,4 +227,15 @@ TEST(TextureUploaderTest, WorkerThread)
     TextureUploaderTest(false);
 }
 
+TEST(TextureUploaderTest, RenderThreadCopyBudget)
+{
+    TextureUploaderTest(true, 1);
+}
+
+TEST(TextureUploaderTest, WorkerThreadCopyBudget)
+{
+    // The budget is smaller than any upload buffer, so every update executes exactly one copy
+    TextureUploaderTest(false, 1);
+}
+
 } // namespace
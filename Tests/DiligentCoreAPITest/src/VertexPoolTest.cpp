@@ -183,4 +183,78 @@ TEST(VertexPoolTest, Allocate)
     }
 }
 
+TEST(VertexPoolTest, Defragment)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    constexpr VertexPoolElementDesc Elements[] =
+        {
+            VertexPoolElementDesc{16},
+            VertexPoolElementDesc{24, BIND_SHADER_RESOURCE, USAGE_DEFAULT, BUFFER_MODE_STRUCTURED, CPU_ACCESS_NONE},
+        };
+    VertexPoolCreateInfo CI;
+    CI.Desc.Name        = "Test vertex pool";
+    CI.Desc.pElements   = Elements;
+    CI.Desc.NumElements = _countof(Elements);
+    CI.Desc.VertexCount = 64;
+    CI.ExtraVertexCount = 64;
+
+    RefCntAutoPtr<IVertexPool> pVtxPool;
+    CreateVertexPool(pDevice, CI, &pVtxPool);
+    ASSERT_NE(pVtxPool, nullptr);
+
+    constexpr Uint32 NumAllocations = 32;
+    constexpr Uint32 VertexCount    = 16;
+
+    std::vector<RefCntAutoPtr<IVertexPoolAllocation>> Allocs(NumAllocations);
+    for (auto& Alloc : Allocs)
+    {
+        pVtxPool->Allocate(VertexCount, &Alloc);
+        ASSERT_TRUE(Alloc);
+    }
+    pVtxPool->UpdateAll(pDevice, pContext);
+
+    // Release every other allocation to fragment the pool
+    for (size_t i = 0; i < Allocs.size(); i += 2)
+        Allocs[i].Release();
+
+    VertexPoolUsageStats StatsBefore;
+    pVtxPool->GetUsageStats(StatsBefore);
+
+    VertexPoolDefragmentAttribs Attribs;
+    Attribs.MaxMoveVertexCount = VertexCount * 2;
+    Attribs.AllocationMoved    = [](IVertexPoolAllocation* pAllocation, Uint32 OldStartVertex, void*) {
+        EXPECT_LT(pAllocation->GetStartVertex(), OldStartVertex);
+    };
+
+    Uint32 TotalMoved = 0;
+    for (Uint32 Frame = 0; Frame < NumAllocations; ++Frame)
+    {
+        const auto Moved = pVtxPool->Defragment(pDevice, pContext, Attribs);
+        EXPECT_LE(Moved, Attribs.MaxMoveVertexCount);
+        if (Moved == 0)
+            break;
+        TotalMoved += Moved;
+    }
+    EXPECT_GT(TotalMoved, 0u);
+
+    VertexPoolUsageStats StatsAfter;
+    pVtxPool->GetUsageStats(StatsAfter);
+    EXPECT_EQ(StatsAfter.AllocationCount, StatsBefore.AllocationCount);
+    EXPECT_EQ(StatsAfter.AllocatedVertexCount, StatsBefore.AllocatedVertexCount);
+    EXPECT_EQ(StatsAfter.MovedVertexCount, TotalMoved);
+    EXPECT_LT(StatsAfter.TotalVertexCount, StatsBefore.TotalVertexCount);
+    EXPECT_EQ(StatsAfter.ReclaimedMemorySize, StatsBefore.CommittedMemorySize - StatsAfter.CommittedMemorySize);
+
+    for (const auto& Alloc : Allocs)
+    {
+        if (Alloc)
+            EXPECT_LE(Alloc->GetStartVertex() + VertexCount, StatsAfter.TotalVertexCount);
+    }
+}
+
 } // namespace
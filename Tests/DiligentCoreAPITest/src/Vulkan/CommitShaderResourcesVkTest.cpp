@@ -0,0 +1,189 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Samples the right edge of a 2x1 texture: clamp addressing returns the second texel,
+// wrap addressing returns the first one.
+// clang-format off
+const std::string ViewSamplerTestCS{
+R"(
+layout(local_size_x = 1, local_size_y = 1, local_size_z = 1) in;
+
+uniform sampler2D g_Tex;
+
+layout(rgba8) uniform writeonly image2D g_Output;
+
+void main()
+{
+    imageStore(g_Output, ivec2(0, 0), textureLod(g_Tex, vec2(1.25, 0.5), 0.0));
+}
+)"
+};
+// clang-format on
+
+// The descriptor of a combined image sampler captures the sampler of the texture view when
+// the view is set. Check that a sampler assigned to the view afterwards is used by dynamic
+// descriptor sets when the SRB is committed.
+TEST(CommitShaderResourcesVkTest, DynamicViewSamplerChange)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+    {
+        GTEST_SKIP() << "This test is only relevant for Vulkan";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_GLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.Desc           = {"View sampler test CS", SHADER_TYPE_COMPUTE, true};
+    ShaderCI.EntryPoint     = "main";
+    ShaderCI.Source         = ViewSamplerTestCS.c_str();
+
+    RefCntAutoPtr<IShader> pCS;
+    pDevice->CreateShader(ShaderCI, &pCS);
+    ASSERT_NE(pCS, nullptr);
+
+    ComputePipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name                               = "View sampler test";
+    PSOCreateInfo.PSODesc.PipelineType                       = PIPELINE_TYPE_COMPUTE;
+    PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC;
+    PSOCreateInfo.pCS                                        = pCS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateComputePipelineState(PSOCreateInfo, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPSO->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+
+    SamplerDesc SamDesc{FILTER_TYPE_POINT, FILTER_TYPE_POINT, FILTER_TYPE_POINT,
+                        TEXTURE_ADDRESS_CLAMP, TEXTURE_ADDRESS_CLAMP, TEXTURE_ADDRESS_CLAMP};
+
+    RefCntAutoPtr<ISampler> pClampSampler;
+    pDevice->CreateSampler(SamDesc, &pClampSampler);
+    ASSERT_NE(pClampSampler, nullptr);
+
+    SamDesc.AddressU = TEXTURE_ADDRESS_WRAP;
+    SamDesc.AddressV = TEXTURE_ADDRESS_WRAP;
+    SamDesc.AddressW = TEXTURE_ADDRESS_WRAP;
+    RefCntAutoPtr<ISampler> pWrapSampler;
+    pDevice->CreateSampler(SamDesc, &pWrapSampler);
+    ASSERT_NE(pWrapSampler, nullptr);
+
+    constexpr Uint32 Red   = 0xFF0000FFu;
+    constexpr Uint32 Green = 0xFF00FF00u;
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "View sampler test texture";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = 2;
+    TexDesc.Height    = 1;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+    TexDesc.Usage     = USAGE_IMMUTABLE;
+
+    const Uint32      Texels[] = {Red, Green};
+    TextureSubResData SubResData{Texels, sizeof(Texels)};
+    TextureData       InitData{&SubResData, 1};
+
+    RefCntAutoPtr<ITexture> pTexture;
+    pDevice->CreateTexture(TexDesc, &InitData, &pTexture);
+    ASSERT_NE(pTexture, nullptr);
+
+    TexDesc.Name      = "View sampler test output";
+    TexDesc.Width     = 1;
+    TexDesc.BindFlags = BIND_UNORDERED_ACCESS;
+    TexDesc.Usage     = USAGE_DEFAULT;
+
+    RefCntAutoPtr<ITexture> pOutputs[2];
+    for (auto& pOutput : pOutputs)
+    {
+        pDevice->CreateTexture(TexDesc, nullptr, &pOutput);
+        ASSERT_NE(pOutput, nullptr);
+    }
+
+    TexDesc.Name           = "View sampler test staging texture";
+    TexDesc.Width          = 2;
+    TexDesc.BindFlags      = BIND_NONE;
+    TexDesc.Usage          = USAGE_STAGING;
+    TexDesc.CPUAccessFlags = CPU_ACCESS_READ;
+
+    RefCntAutoPtr<ITexture> pStagingTex;
+    pDevice->CreateTexture(TexDesc, nullptr, &pStagingTex);
+    ASSERT_NE(pStagingTex, nullptr);
+
+    ITextureView* pSRV = pTexture->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE);
+    pSRV->SetSampler(pClampSampler);
+
+    IShaderResourceVariable* pTexVar    = pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Tex");
+    IShaderResourceVariable* pOutputVar = pSRB->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Output");
+    ASSERT_NE(pTexVar, nullptr);
+    ASSERT_NE(pOutputVar, nullptr);
+    pTexVar->Set(pSRV);
+
+    pContext->SetPipelineState(pPSO);
+    for (Uint32 i = 0; i < _countof(pOutputs); ++i)
+    {
+        if (i == 1)
+        {
+            // Change the sampler after the view has been set
+            pSRV->SetSampler(pWrapSampler);
+        }
+
+        pOutputVar->Set(pOutputs[i]->GetDefaultView(TEXTURE_VIEW_UNORDERED_ACCESS));
+        pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->DispatchCompute(DispatchComputeAttribs{1, 1, 1});
+
+        CopyTextureAttribs CopyAttribs{pOutputs[i], RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pStagingTex, RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+        CopyAttribs.DstX = i;
+        pContext->CopyTexture(CopyAttribs);
+    }
+    pContext->WaitForIdle();
+
+    MappedTextureSubresource MappedData;
+    pContext->MapTextureSubresource(pStagingTex, 0, 0, MAP_READ, MAP_FLAG_DO_NOT_WAIT, nullptr, MappedData);
+    ASSERT_NE(MappedData.pData, nullptr);
+    const Uint32* pResults = static_cast<const Uint32*>(MappedData.pData);
+    EXPECT_EQ(pResults[0], Green) << "Clamp sampler must return the second texel";
+    EXPECT_EQ(pResults[1], Red) << "Wrap sampler assigned after the view was set must return the first texel";
+    pContext->UnmapTextureSubresource(pStagingTex, 0, 0);
+}
+
+} // namespace
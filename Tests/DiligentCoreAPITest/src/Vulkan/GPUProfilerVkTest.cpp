@@ -0,0 +1,115 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "GPUTestingEnvironment.hpp"
+
+#include "DeviceContextVk.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(GPUProfilerVkTest, NestedScopes)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+    {
+        GTEST_SKIP() << "GPU profiler is only available in Vulkan";
+    }
+    if (pEnv->GetVkGPUProfilerMaxScopesPerFrame() < 3)
+    {
+        GTEST_SKIP() << "GPU profiler is not enabled. Use --vk_gpu_profiler command line switch to enable it.";
+    }
+    if (!pDevice->GetDeviceInfo().Features.TimestampQueries)
+    {
+        GTEST_SKIP() << "Timestamp queries are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto* pContext = pEnv->GetDeviceContext();
+
+    RefCntAutoPtr<IDeviceContextVk> pContextVk{pContext, IID_DeviceContextVk};
+    ASSERT_NE(pContextVk, nullptr);
+
+    // Finish the frame that may have been started by other tests
+    pContext->Flush();
+    pDevice->IdleGPU();
+    pContext->FinishFrame();
+
+    auto* pSwapChain = pEnv->GetSwapChain();
+    auto* pRTV       = pSwapChain->GetCurrentBackBufferRTV();
+
+    constexpr float ClearColor[] = {0.25f, 0.5f, 0.75f, 1.0f};
+
+    pContext->BeginDebugGroup("Frame");
+    {
+        pContext->BeginDebugGroup("Clear");
+        pContext->SetRenderTargets(1, &pRTV, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->ClearRenderTarget(pRTV, ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->EndDebugGroup();
+
+        pContext->BeginDebugGroup("Empty");
+        pContext->EndDebugGroup();
+    }
+    pContext->EndDebugGroup();
+
+    pContext->Flush();
+    pDevice->IdleGPU();
+    // The frame is complete, so its timings are read back when it is finished
+    pContext->FinishFrame();
+
+    const auto Frame = pContextVk->GetProfilerFrame();
+    ASSERT_EQ(Frame.ScopeCount, 3u);
+    ASSERT_NE(Frame.pScopes, nullptr);
+    EXPECT_EQ(Frame.DroppedScopeCount, 0u);
+
+    const auto& Root = Frame.pScopes[0];
+    EXPECT_STREQ(Root.Name, "Frame");
+    EXPECT_EQ(Root.Depth, 0u);
+    EXPECT_EQ(Root.ParentIndex, ~0u);
+    EXPECT_EQ(Root.StartTime, 0.0);
+    EXPECT_GE(Frame.TotalTime, Root.Duration);
+
+    const char* ChildNames[] = {"Clear", "Empty"};
+    for (Uint32 i = 1; i < Frame.ScopeCount; ++i)
+    {
+        const auto& Scope = Frame.pScopes[i];
+        EXPECT_STREQ(Scope.Name, ChildNames[i - 1]);
+        EXPECT_EQ(Scope.Depth, 1u);
+        EXPECT_EQ(Scope.ParentIndex, 0u);
+        EXPECT_GE(Scope.StartTime, Root.StartTime);
+        EXPECT_LE(Scope.StartTime + Scope.Duration, Root.StartTime + Root.Duration);
+    }
+}
+
+} // namespace
@@ -0,0 +1,131 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "GPUTestingEnvironment.hpp"
+
+#include "DeviceContextVk.h"
+#include "CommandQueueVk.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(QueueWaitVkTest, DeviceWaitForQueue)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+    {
+        GTEST_SKIP() << "Queue timeline semaphores are only available in Vulkan";
+    }
+    if (!pDevice->GetDeviceInfo().Features.NativeFence)
+    {
+        GTEST_SKIP() << "NativeFence feature is not supported";
+    }
+
+    IDeviceContext* pSrcCtx = nullptr;
+    IDeviceContext* pDstCtx = nullptr;
+    for (Uint32 CtxInd = 0; CtxInd < pEnv->GetNumImmediateContexts() && pDstCtx == nullptr; ++CtxInd)
+    {
+        auto* Ctx = pEnv->GetDeviceContext(CtxInd);
+        if (pSrcCtx == nullptr)
+            pSrcCtx = Ctx;
+        else if (Ctx->GetDesc().QueueId != pSrcCtx->GetDesc().QueueId)
+            pDstCtx = Ctx;
+    }
+    if (pSrcCtx == nullptr || pDstCtx == nullptr)
+    {
+        GTEST_SKIP() << "At least two different hardware queues are required";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IDeviceContextVk> pSrcCtxVk{pSrcCtx, IID_DeviceContextVk};
+    RefCntAutoPtr<IDeviceContextVk> pDstCtxVk{pDstCtx, IID_DeviceContextVk};
+    ASSERT_NE(pSrcCtxVk, nullptr);
+    ASSERT_NE(pDstCtxVk, nullptr);
+
+    {
+        RefCntAutoPtr<ICommandQueueVk> pQueueVk{pSrcCtx->LockCommandQueue(), IID_CommandQueueVk};
+        ASSERT_NE(pQueueVk, nullptr);
+        EXPECT_NE(pQueueVk->GetVkTimelineSemaphore(), VK_NULL_HANDLE);
+        pQueueVk.Release();
+        pSrcCtx->UnlockCommandQueue();
+    }
+
+    constexpr Uint32 RefData[] = {1, 2, 3, 4};
+
+    const Uint64 CtxMask = (Uint64{1} << pSrcCtx->GetDesc().ContextId) | (Uint64{1} << pDstCtx->GetDesc().ContextId);
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name                 = "Queue wait test buffer";
+    BuffDesc.Size                 = sizeof(RefData);
+    BuffDesc.BindFlags            = BIND_UNIFORM_BUFFER;
+    BuffDesc.Usage                = USAGE_DEFAULT;
+    BuffDesc.ImmediateContextMask = CtxMask;
+
+    RefCntAutoPtr<IBuffer> pBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+    ASSERT_NE(pBuffer, nullptr);
+
+    BuffDesc.Name                 = "Queue wait test staging buffer";
+    BuffDesc.BindFlags            = BIND_NONE;
+    BuffDesc.Usage                = USAGE_STAGING;
+    BuffDesc.CPUAccessFlags       = CPU_ACCESS_READ;
+    BuffDesc.ImmediateContextMask = Uint64{1} << pDstCtx->GetDesc().ContextId;
+
+    RefCntAutoPtr<IBuffer> pStagingBuffer;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pStagingBuffer);
+    ASSERT_NE(pStagingBuffer, nullptr);
+
+    // Write the data on the first queue
+    pSrcCtx->UpdateBuffer(pBuffer, 0, sizeof(RefData), RefData, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pSrcCtx->Flush();
+
+    const auto SrcFenceValue = pSrcCtxVk->GetLastSubmittedFenceValue();
+    EXPECT_GT(SrcFenceValue, Uint64{0});
+
+    // Read the data on the second queue without waiting on the CPU
+    pDstCtxVk->DeviceWaitForQueue(pSrcCtx->GetDesc().ContextId, SrcFenceValue);
+    pDstCtx->CopyBuffer(pBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                        pStagingBuffer, 0, sizeof(RefData), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pDstCtx->WaitForIdle();
+
+    void* pData = nullptr;
+    pDstCtx->MapBuffer(pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+    ASSERT_NE(pData, nullptr);
+    EXPECT_EQ(memcmp(pData, RefData, sizeof(RefData)), 0) << "Buffer data does not match reference values";
+    pDstCtx->UnmapBuffer(pStagingBuffer, MAP_READ);
+
+    pSrcCtx->WaitForIdle();
+}
+
+} // namespace
@@ -0,0 +1,96 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "GPUTestingEnvironment.hpp"
+
+#include "RenderDeviceVk.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(ReleaseQueueStatsVkTest, ReleasedResources)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+    {
+        GTEST_SKIP() << "This test is Vulkan-specific";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    ASSERT_NE(pDeviceVk, nullptr);
+
+    auto* pContext = pEnv->GetDeviceContext();
+
+    const Uint32 QueueIndex = pContext->GetDesc().ContextId;
+
+    // Make sure that all previously released resources are destroyed
+    pContext->Flush();
+    pDevice->IdleGPU();
+    pDevice->ReleaseStaleResources(true);
+
+    const auto StatsBefore = pDeviceVk->GetReleaseQueueStats(QueueIndex);
+    EXPECT_EQ(StatsBefore.StaleResourceCount, 0u);
+    EXPECT_EQ(StatsBefore.PendingReleaseResourceCount, 0u);
+
+    constexpr Uint32 NumBuffers = 8;
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "Release queue stats test buffer";
+        BuffDesc.Size      = 256;
+        BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+        BuffDesc.Usage     = USAGE_DEFAULT;
+
+        RefCntAutoPtr<IBuffer> pBuffers[NumBuffers];
+        for (auto& pBuffer : pBuffers)
+        {
+            pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+            ASSERT_NE(pBuffer, nullptr);
+        }
+    }
+
+    const auto StatsReleased = pDeviceVk->GetReleaseQueueStats(QueueIndex);
+    EXPECT_GE(StatsReleased.StaleResourceCount + StatsReleased.PendingReleaseResourceCount, NumBuffers);
+
+    pContext->Flush();
+    pDevice->IdleGPU();
+    pDevice->ReleaseStaleResources(true);
+
+    const auto StatsAfter = pDeviceVk->GetReleaseQueueStats(QueueIndex);
+    EXPECT_EQ(StatsAfter.StaleResourceCount, 0u);
+    EXPECT_EQ(StatsAfter.PendingReleaseResourceCount, 0u);
+    EXPECT_GE(StatsAfter.ReleasedResourceCount, StatsBefore.ReleasedResourceCount + NumBuffers);
+    EXPECT_GE(StatsAfter.TotalPurgeTimeNs, StatsBefore.TotalPurgeTimeNs);
+}
+
+} // namespace
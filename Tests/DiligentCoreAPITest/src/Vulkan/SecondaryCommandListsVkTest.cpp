@@ -0,0 +1,213 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <thread>
+#include <array>
+
+#include "GPUTestingEnvironment.hpp"
+#include "TestingSwapChainBase.hpp"
+
+#include "DeviceContextVk.h"
+
+#include "InlineShaders/DrawCommandTestHLSL.h"
+
+#include "gtest/gtest.h"
+
+namespace Diligent
+{
+
+namespace Testing
+{
+
+void RenderDrawCommandReference(ISwapChain* pSwapChain, const float* pClearColor);
+
+} // namespace Testing
+
+} // namespace Diligent
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(SecondaryCommandListsVkTest, DrawInParallel)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+    {
+        GTEST_SKIP() << "Secondary command lists are only supported in Vulkan";
+    }
+    if (pEnv->GetNumDeferredContexts() < 2)
+    {
+        GTEST_SKIP() << "At least two deferred contexts are required";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    RefCntAutoPtr<IDeviceContextVk> pImmediateCtxVk{pEnv->GetDeviceContext(), IID_DeviceContextVk};
+    ASSERT_NE(pImmediateCtxVk, nullptr);
+
+    constexpr float ClearColor[] = {0.25f, 0.5f, 0.125f, 0.75f};
+    RenderDrawCommandReference(pSwapChain, ClearColor);
+
+    RenderPassAttachmentDesc Attachments[1];
+    Attachments[0].Format       = pSwapChain->GetDesc().ColorBufferFormat;
+    Attachments[0].InitialState = RESOURCE_STATE_RENDER_TARGET;
+    Attachments[0].FinalState   = RESOURCE_STATE_RENDER_TARGET;
+    Attachments[0].LoadOp       = ATTACHMENT_LOAD_OP_CLEAR;
+    Attachments[0].StoreOp      = ATTACHMENT_STORE_OP_STORE;
+
+    constexpr AttachmentReference RTAttachmentRefs[] = {{0, RESOURCE_STATE_RENDER_TARGET}};
+
+    SubpassDesc Subpasses[1];
+    Subpasses[0].RenderTargetAttachmentCount = _countof(RTAttachmentRefs);
+    Subpasses[0].pRenderTargetAttachments    = RTAttachmentRefs;
+
+    RenderPassDesc RPDesc;
+    RPDesc.Name            = "Secondary command lists test render pass";
+    RPDesc.AttachmentCount = _countof(Attachments);
+    RPDesc.pAttachments    = Attachments;
+    RPDesc.SubpassCount    = _countof(Subpasses);
+    RPDesc.pSubpasses      = Subpasses;
+
+    RefCntAutoPtr<IRenderPass> pRenderPass;
+    pDevice->CreateRenderPass(RPDesc, &pRenderPass);
+    ASSERT_NE(pRenderPass, nullptr);
+
+    ITextureView* pRTAttachments[] = {pSwapChain->GetCurrentBackBufferRTV()};
+
+    FramebufferDesc FBDesc;
+    FBDesc.Name            = "Secondary command lists test framebuffer";
+    FBDesc.pRenderPass     = pRenderPass;
+    FBDesc.AttachmentCount = _countof(pRTAttachments);
+    FBDesc.ppAttachments   = pRTAttachments;
+
+    RefCntAutoPtr<IFramebuffer> pFramebuffer;
+    pDevice->CreateFramebuffer(FBDesc, &pFramebuffer);
+    ASSERT_NE(pFramebuffer, nullptr);
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    {
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+
+        RefCntAutoPtr<IShader> pVS;
+        ShaderCI.Desc       = {"Secondary command lists test VS", SHADER_TYPE_VERTEX, true};
+        ShaderCI.EntryPoint = "main";
+        ShaderCI.Source     = HLSL::DrawTest_ProceduralTriangleVS.c_str();
+        pDevice->CreateShader(ShaderCI, &pVS);
+        ASSERT_NE(pVS, nullptr);
+
+        RefCntAutoPtr<IShader> pPS;
+        ShaderCI.Desc       = {"Secondary command lists test PS", SHADER_TYPE_PIXEL, true};
+        ShaderCI.EntryPoint = "main";
+        ShaderCI.Source     = HLSL::DrawTest_PS.c_str();
+        pDevice->CreateShader(ShaderCI, &pPS);
+        ASSERT_NE(pPS, nullptr);
+
+        GraphicsPipelineStateCreateInfo PSOCreateInfo;
+        PSOCreateInfo.PSODesc.Name = "Secondary command lists test PSO";
+
+        auto& GraphicsPipeline                        = PSOCreateInfo.GraphicsPipeline;
+        GraphicsPipeline.pRenderPass                  = pRenderPass;
+        GraphicsPipeline.SubpassIndex                 = 0;
+        GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+        GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+        PSOCreateInfo.pVS = pVS;
+        PSOCreateInfo.pPS = pPS;
+        pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+        ASSERT_NE(pPSO, nullptr);
+    }
+
+    // Every thread draws one of the two triangles in its own secondary command list
+    constexpr Uint32                                    NumThreads = 2;
+    std::array<std::thread, NumThreads>                 WorkerThreads;
+    std::array<RefCntAutoPtr<ICommandList>, NumThreads> CmdLists;
+    std::array<ICommandList*, NumThreads>               CmdListPtrs;
+    for (Uint32 i = 0; i < NumThreads; ++i)
+    {
+        WorkerThreads[i] = std::thread(
+            [&](Uint32 thread_id) //
+            {
+                RefCntAutoPtr<IDeviceContextVk> pCtxVk{pEnv->GetDeferredContext(thread_id), IID_DeviceContextVk};
+
+                SecondaryCommandListAttribsVk SecondaryAttribs;
+                SecondaryAttribs.ImmediateContextId = 0;
+                SecondaryAttribs.pRenderPass        = pRenderPass;
+                SecondaryAttribs.SubpassIndex       = 0;
+                SecondaryAttribs.pFramebuffer       = pFramebuffer;
+                pCtxVk->BeginSecondaryCommandList(SecondaryAttribs);
+
+                pCtxVk->SetPipelineState(pPSO);
+
+                DrawAttribs DrawAttrs{3, DRAW_FLAG_VERIFY_ALL};
+                DrawAttrs.StartVertexLocation = 3 * thread_id;
+                pCtxVk->Draw(DrawAttrs);
+
+                pCtxVk->FinishCommandList(&CmdLists[thread_id]);
+                CmdListPtrs[thread_id] = CmdLists[thread_id];
+            },
+            i);
+    }
+
+    for (auto& t : WorkerThreads)
+        t.join();
+
+    for (Uint32 i = 0; i < NumThreads; ++i)
+        ASSERT_NE(CmdLists[i], nullptr);
+
+    OptimizedClearValue ClearValues[1];
+    ClearValues[0].SetColor(TEX_FORMAT_UNKNOWN, ClearColor);
+
+    BeginRenderPassAttribs RPBeginInfo;
+    RPBeginInfo.pRenderPass         = pRenderPass;
+    RPBeginInfo.pFramebuffer        = pFramebuffer;
+    RPBeginInfo.ClearValueCount     = _countof(ClearValues);
+    RPBeginInfo.pClearValues        = ClearValues;
+    RPBeginInfo.StateTransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+    pImmediateCtxVk->BeginSecondaryRenderPass(RPBeginInfo);
+    pImmediateCtxVk->ExecuteSecondaryCommandLists(NumThreads, CmdListPtrs.data());
+    pImmediateCtxVk->EndRenderPass();
+
+    for (Uint32 i = 0; i < NumThreads; ++i)
+        CmdLists[i].Release();
+
+    pSwapChain->Present();
+    pImmediateCtxVk->Flush();
+    pImmediateCtxVk->InvalidateState();
+
+    for (Uint32 i = 0; i < NumThreads; ++i)
+        pEnv->GetDeferredContext(i)->FinishFrame();
+}
+
+} // namespace
@@ -0,0 +1,243 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Minimal microbenchmark harness used by DiligentCoreBenchmark.
+///
+/// The harness follows the Google Benchmark execution model: a benchmark function
+/// receives a State object and runs its timed loop while State::KeepRunning()
+/// returns true. The runner grows the iteration count until the run takes at least
+/// the requested minimum time. Results can be written in the Google Benchmark JSON
+/// format, so the existing tooling (e.g. compare.py) can be used to track them.
+
+#include <chrono>
+#include <ctime>
+#include <string>
+#include <vector>
+#include <initializer_list>
+
+#if defined(_MSC_VER)
+#    include <intrin.h>
+#endif
+
+#include "BasicTypes.h"
+
+namespace Diligent
+{
+
+namespace Benchmarking
+{
+
+/// Benchmark state passed to every benchmark function.
+class State
+{
+public:
+    State(Uint64 MaxIterations, Int64 Arg) noexcept :
+        m_MaxIterations{MaxIterations},
+        m_Arg{Arg}
+    {}
+
+    /// Returns true while the benchmark loop should keep running.
+    /// The timer is started on the first call and stopped on the last one.
+    bool KeepRunning()
+    {
+        if (m_Iterations == 0)
+            StartTimer();
+
+        if (m_Iterations < m_MaxIterations)
+        {
+            ++m_Iterations;
+            return true;
+        }
+
+        StopTimer();
+        return false;
+    }
+
+    /// Excludes the code that follows from the measurement until ResumeTiming() is called.
+    void PauseTiming()
+    {
+        StopTimer();
+    }
+
+    /// Resumes the measurement paused by PauseTiming().
+    void ResumeTiming()
+    {
+        StartTimer();
+    }
+
+    /// Returns the benchmark argument, see DILIGENT_BENCHMARK_ARGS.
+    Int64 GetArg() const { return m_Arg; }
+
+    /// Returns the number of iterations the benchmark loop will run.
+    Uint64 GetMaxIterations() const { return m_MaxIterations; }
+
+    /// Sets the total number of items processed by the benchmark, which
+    /// is used to report the items_per_second counter.
+    void SetItemsProcessed(Uint64 Items) { m_ItemsProcessed = Items; }
+
+    /// Sets the total number of bytes processed by the benchmark, which
+    /// is used to report the bytes_per_second counter.
+    void SetBytesProcessed(Uint64 Bytes) { m_BytesProcessed = Bytes; }
+
+    /// Reports an error. The benchmark results will be discarded.
+    void SkipWithError(const char* Message) { m_Error = Message != nullptr ? Message : "Unknown error"; }
+
+    double             GetRealTime() const { return m_RealTime; }
+    double             GetCPUTime() const { return m_CPUTime; }
+    Uint64             GetItemsProcessed() const { return m_ItemsProcessed; }
+    Uint64             GetBytesProcessed() const { return m_BytesProcessed; }
+    const std::string& GetError() const { return m_Error; }
+
+private:
+    void StartTimer()
+    {
+        if (m_TimerRunning)
+            return;
+
+        m_StartRealTime = std::chrono::high_resolution_clock::now();
+        m_StartCPUTime  = std::clock();
+        m_TimerRunning  = true;
+    }
+
+    void StopTimer()
+    {
+        if (!m_TimerRunning)
+            return;
+
+        const auto    EndRealTime = std::chrono::high_resolution_clock::now();
+        const clock_t EndCPUTime  = std::clock();
+
+        m_RealTime += std::chrono::duration<double>(EndRealTime - m_StartRealTime).count();
+        m_CPUTime += static_cast<double>(EndCPUTime - m_StartCPUTime) / CLOCKS_PER_SEC;
+        m_TimerRunning = false;
+    }
+
+private:
+    const Uint64 m_MaxIterations;
+    const Int64  m_Arg;
+
+    Uint64 m_Iterations     = 0;
+    Uint64 m_ItemsProcessed = 0;
+    Uint64 m_BytesProcessed = 0;
+
+    bool                                           m_TimerRunning = false;
+    std::chrono::high_resolution_clock::time_point m_StartRealTime;
+    clock_t                                        m_StartCPUTime = 0;
+
+    // Accumulated real and CPU time, in seconds
+    double m_RealTime = 0;
+    double m_CPUTime  = 0;
+
+    std::string m_Error;
+};
+
+using BenchmarkFunctionType = void (*)(State&);
+
+/// Registers a benchmark function. Use DILIGENT_BENCHMARK and DILIGENT_BENCHMARK_ARGS
+/// macros instead of using this class directly.
+struct BenchmarkRegistrar
+{
+    BenchmarkRegistrar(const char* Name, BenchmarkFunctionType Func, std::initializer_list<Int64> Args = {});
+};
+
+/// Runs registered benchmarks using the command line arguments:
+///
+///     --benchmark_filter=<regex>        run only benchmarks whose names match the regular expression
+///     --benchmark_min_time=<seconds>    minimum run time of every benchmark (default: 0.5)
+///     --benchmark_repetitions=<count>   number of times every benchmark is repeated (default: 1)
+///     --benchmark_format=<console|json> output format of the standard output (default: console)
+///     --benchmark_out=<file>            also write the results to the file in JSON format
+///     --benchmark_list_tests            list benchmark names and exit
+///
+/// \return 0 on success, non-zero value if any benchmark failed or the arguments are invalid.
+int RunBenchmarks(int argc, char** argv);
+
+
+/// Prevents the compiler from optimizing away the value.
+template <typename T>
+inline void DoNotOptimize(const T& Value)
+{
+#if defined(_MSC_VER)
+    static volatile const void* volatile Sink;
+    Sink = &Value;
+#else
+    asm volatile(""
+                 :
+                 : "r,m"(Value)
+                 : "memory");
+#endif
+}
+
+/// Forces the compiler to assume that all memory may have been modified.
+inline void ClobberMemory()
+{
+#if defined(_MSC_VER)
+    _ReadWriteBarrier();
+#else
+    asm volatile(""
+                 :
+                 :
+                 : "memory");
+#endif
+}
+
+} // namespace Benchmarking
+
+} // namespace Diligent
+
+// clang-format off
+
+/// Defines a benchmark named Group.Name:
+///
+///     DILIGENT_BENCHMARK(Common_LRUCache, GetHit)
+///     {
+///         while (State.KeepRunning())
+///         {
+///             ...
+///         }
+///     }
+#define DILIGENT_BENCHMARK(Group, Name)                                                          \
+    static void Group##_##Name##_Benchmark(::Diligent::Benchmarking::State& State);             \
+    static const ::Diligent::Benchmarking::BenchmarkRegistrar Group##_##Name##_Registrar{       \
+        #Group "." #Name, Group##_##Name##_Benchmark};                                          \
+    static void Group##_##Name##_Benchmark(::Diligent::Benchmarking::State& State)
+
+/// Defines a benchmark that is run once for every argument. The argument is
+/// available through State.GetArg() and is appended to the benchmark name:
+///
+///     DILIGENT_BENCHMARK_ARGS(Common_FixedBlockMemoryAllocator, AllocateFree, 16, 256)
+///
+/// registers Common_FixedBlockMemoryAllocator.AllocateFree/16 and Common_FixedBlockMemoryAllocator.AllocateFree/256.
+#define DILIGENT_BENCHMARK_ARGS(Group, Name, ...)                                                \
+    static void Group##_##Name##_Benchmark(::Diligent::Benchmarking::State& State);             \
+    static const ::Diligent::Benchmarking::BenchmarkRegistrar Group##_##Name##_Registrar{       \
+        #Group "." #Name, Group##_##Name##_Benchmark, {__VA_ARGS__}};                           \
+    static void Group##_##Name##_Benchmark(::Diligent::Benchmarking::State& State)
+
+// clang-format on
@@ -0,0 +1,111 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+namespace Diligent
+{
+
+namespace Benchmarking
+{
+
+// A representative pixel shader used by the shader tools benchmarks
+static constexpr char BenchmarkHLSLSource[] = R"(
+#define NUM_LIGHTS 4
+
+struct LightAttribs
+{
+    float4 Direction;
+    float4 Intensity;
+};
+
+cbuffer cbCameraAttribs
+{
+    float4x4 g_ViewProj;
+    float4   g_CameraPos;
+};
+
+cbuffer cbLights
+{
+    LightAttribs g_Lights[NUM_LIGHTS];
+};
+
+Texture2D    g_BaseColorMap;
+SamplerState g_BaseColorMap_sampler;
+
+Texture2D    g_NormalMap;
+SamplerState g_NormalMap_sampler;
+
+Texture2DArray g_ShadowMap;
+SamplerComparisonState g_ShadowMap_sampler;
+
+struct PSInput
+{
+    float4 Pos      : SV_POSITION;
+    float3 WorldPos : WORLD_POS;
+    float3 Normal   : NORMAL;
+    float2 UV       : TEX_COORD;
+};
+
+struct PSOutput
+{
+    float4 Color : SV_Target;
+};
+
+float ComputeShadow(float3 WorldPos, int Cascade)
+{
+    float4 ShadowPos = mul(float4(WorldPos, 1.0), g_ViewProj);
+    ShadowPos.xyz /= ShadowPos.w;
+    float2 UV = ShadowPos.xy * float2(0.5, -0.5) + float2(0.5, 0.5);
+    return g_ShadowMap.SampleCmpLevelZero(g_ShadowMap_sampler, float3(UV, float(Cascade)), ShadowPos.z);
+}
+
+float3 ApplyLights(float3 BaseColor, float3 Normal, float3 WorldPos)
+{
+    float3 Color = float3(0.0, 0.0, 0.0);
+    [unroll]
+    for (int i = 0; i < NUM_LIGHTS; ++i)
+    {
+        float NdotL = saturate(dot(Normal, -g_Lights[i].Direction.xyz));
+        Color += BaseColor * g_Lights[i].Intensity.rgb * NdotL * ComputeShadow(WorldPos, i);
+    }
+    return Color;
+}
+
+void main(in PSInput PSIn, out PSOutput PSOut)
+{
+    float4 BaseColor = g_BaseColorMap.Sample(g_BaseColorMap_sampler, PSIn.UV);
+    float3 Normal    = g_NormalMap.Sample(g_NormalMap_sampler, PSIn.UV).xyz * 2.0 - 1.0;
+    Normal = normalize(PSIn.Normal + Normal);
+    if (BaseColor.a < 0.5)
+        discard;
+    PSOut.Color = float4(ApplyLights(BaseColor.rgb, Normal, PSIn.WorldPos), BaseColor.a);
+}
+)";
+
+} // namespace Benchmarking
+
+} // namespace Diligent
@@ -0,0 +1,455 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <limits>
+#include <iostream>
+#include <regex>
+#include <sstream>
+#include <thread>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace Benchmarking
+{
+
+namespace
+{
+
+struct BenchmarkInfo
+{
+    std::string           Name;
+    BenchmarkFunctionType Func   = nullptr;
+    Int64                 Arg    = 0;
+    bool                  HasArg = false;
+};
+
+std::vector<BenchmarkInfo>& GetBenchmarkRegistry()
+{
+    static std::vector<BenchmarkInfo> Registry;
+    return Registry;
+}
+
+struct BenchmarkResult
+{
+    std::string Name;
+    std::string RunName;
+    Uint32      RepetitionIndex = 0;
+    Uint64      Iterations      = 0;
+
+    // Per-iteration times, in nanoseconds
+    double RealTime = 0;
+    double CPUTime  = 0;
+
+    double ItemsPerSecond = 0;
+    double BytesPerSecond = 0;
+
+    std::string Error;
+};
+
+struct RunSettings
+{
+    std::string Filter;
+    double      MinTime     = 0.5;
+    Uint32      Repetitions = 1;
+    bool        JsonOutput  = false;
+    bool        ListTests   = false;
+    std::string OutFile;
+};
+
+// The maximum number of iterations the runner will try
+constexpr Uint64 MaxIterations = 1000000000;
+
+BenchmarkResult RunBenchmark(const BenchmarkInfo& Info, double MinTime)
+{
+    BenchmarkResult Result;
+    Result.Name    = Info.Name;
+    Result.RunName = Info.Name;
+
+    Uint64 Iterations = 1;
+    while (true)
+    {
+        State BenchmarkState{Iterations, Info.Arg};
+        try
+        {
+            Info.Func(BenchmarkState);
+        }
+        catch (const std::exception& err)
+        {
+            BenchmarkState.SkipWithError(err.what());
+        }
+        catch (...)
+        {
+            BenchmarkState.SkipWithError("Unknown exception");
+        }
+
+        if (!BenchmarkState.GetError().empty())
+        {
+            Result.Error = BenchmarkState.GetError();
+            return Result;
+        }
+
+        const double RealTime = BenchmarkState.GetRealTime();
+        if (RealTime >= MinTime || Iterations >= MaxIterations)
+        {
+            const double NsPerIter = 1e9 / static_cast<double>(Iterations);
+
+            Result.Iterations = Iterations;
+            Result.RealTime   = RealTime * NsPerIter;
+            Result.CPUTime    = BenchmarkState.GetCPUTime() * NsPerIter;
+            if (RealTime > 0)
+            {
+                Result.ItemsPerSecond = static_cast<double>(BenchmarkState.GetItemsProcessed()) / RealTime;
+                Result.BytesPerSecond = static_cast<double>(BenchmarkState.GetBytesProcessed()) / RealTime;
+            }
+            return Result;
+        }
+
+        // Predict the number of iterations required to reach the minimum time,
+        // with some headroom, but do not grow the count by more than 10x at once
+        // as very short runs are not reliable.
+        double Multiplier = 10;
+        if (RealTime > MinTime / 100)
+            Multiplier = std::min(Multiplier, MinTime * 1.4 / RealTime);
+        Multiplier = std::max(Multiplier, 2.0);
+
+        Iterations = std::min(static_cast<Uint64>(std::ceil(static_cast<double>(Iterations) * Multiplier)), MaxIterations);
+    }
+}
+
+bool ParseArgs(int argc, char** argv, RunSettings& Settings)
+{
+    auto GetValue = [](const char* Arg, const char* Flag, std::string& Value) {
+        const size_t FlagLen = strlen(Flag);
+        if (strncmp(Arg, Flag, FlagLen) != 0 || Arg[FlagLen] != '=')
+            return false;
+        Value = Arg + FlagLen + 1;
+        return true;
+    };
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* Arg = argv[i];
+        std::string Value;
+        if (GetValue(Arg, "--benchmark_filter", Value))
+        {
+            Settings.Filter = Value;
+        }
+        else if (GetValue(Arg, "--benchmark_min_time", Value))
+        {
+            // Google Benchmark accepts an optional 's' suffix
+            Settings.MinTime = std::atof(Value.c_str());
+            if (Settings.MinTime <= 0)
+            {
+                std::cerr << "Invalid minimum time: " << Value << '\n';
+                return false;
+            }
+        }
+        else if (GetValue(Arg, "--benchmark_repetitions", Value))
+        {
+            const int Repetitions = std::atoi(Value.c_str());
+            if (Repetitions <= 0)
+            {
+                std::cerr << "Invalid number of repetitions: " << Value << '\n';
+                return false;
+            }
+            Settings.Repetitions = static_cast<Uint32>(Repetitions);
+        }
+        else if (GetValue(Arg, "--benchmark_format", Value))
+        {
+            if (Value == "json")
+                Settings.JsonOutput = true;
+            else if (Value == "console")
+                Settings.JsonOutput = false;
+            else
+            {
+                std::cerr << "Unknown output format: " << Value << ". Supported formats: console, json\n";
+                return false;
+            }
+        }
+        else if (GetValue(Arg, "--benchmark_out", Value))
+        {
+            Settings.OutFile = Value;
+        }
+        else if (strcmp(Arg, "--benchmark_list_tests") == 0 || strcmp(Arg, "--benchmark_list_tests=true") == 0)
+        {
+            Settings.ListTests = true;
+        }
+        else
+        {
+            std::cerr << "Unknown argument: " << Arg << '\n';
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::string EscapeJsonString(const std::string& Str)
+{
+    std::string Escaped;
+    Escaped.reserve(Str.size());
+    for (char c : Str)
+    {
+        switch (c)
+        {
+            case '"': Escaped += "\\\""; break;
+            case '\\': Escaped += "\\\\"; break;
+            case '\n': Escaped += "\\n"; break;
+            case '\t': Escaped += "\\t"; break;
+            default: Escaped += c;
+        }
+    }
+    return Escaped;
+}
+
+void WriteJson(std::ostream& os, const char* Executable, const std::vector<BenchmarkResult>& Results)
+{
+    const std::time_t Now = std::time(nullptr);
+    char              Date[64]{};
+    std::strftime(Date, sizeof(Date), "%Y-%m-%dT%H:%M:%S", std::localtime(&Now));
+
+    // Use the output format of Google Benchmark so that its tools can process the results
+    os << "{\n"
+       << "  \"context\": {\n"
+       << "    \"date\": \"" << Date << "\",\n"
+       << "    \"executable\": \"" << EscapeJsonString(Executable) << "\",\n"
+       << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+#ifdef DILIGENT_DEBUG
+       << "    \"library_build_type\": \"debug\"\n"
+#else
+       << "    \"library_build_type\": \"release\"\n"
+#endif
+       << "  },\n"
+       << "  \"benchmarks\": [";
+
+    const auto Flags = os.flags();
+    os << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for (size_t i = 0; i < Results.size(); ++i)
+    {
+        const BenchmarkResult& Res = Results[i];
+        os << (i > 0 ? "," : "") << "\n    {\n"
+           << "      \"name\": \"" << EscapeJsonString(Res.Name) << "\",\n"
+           << "      \"run_name\": \"" << EscapeJsonString(Res.RunName) << "\",\n"
+           << "      \"run_type\": \"iteration\",\n"
+           << "      \"repetition_index\": " << Res.RepetitionIndex << ",\n";
+        if (!Res.Error.empty())
+        {
+            os << "      \"error_occurred\": true,\n"
+               << "      \"error_message\": \"" << EscapeJsonString(Res.Error) << "\"\n";
+        }
+        else
+        {
+            os << "      \"iterations\": " << Res.Iterations << ",\n"
+               << "      \"real_time\": " << Res.RealTime << ",\n"
+               << "      \"cpu_time\": " << Res.CPUTime << ",\n"
+               << "      \"time_unit\": \"ns\"";
+            if (Res.ItemsPerSecond > 0)
+                os << ",\n      \"items_per_second\": " << Res.ItemsPerSecond;
+            if (Res.BytesPerSecond > 0)
+                os << ",\n      \"bytes_per_second\": " << Res.BytesPerSecond;
+            os << '\n';
+        }
+        os << "    }";
+    }
+    os.flags(Flags);
+
+    os << "\n  ]\n}\n";
+}
+
+std::string FormatRate(double Value, const char* Unit)
+{
+    static constexpr const char* Prefixes[] = {"", "k", "M", "G", "T"};
+
+    size_t Prefix = 0;
+    while (Value >= 1000 && Prefix + 1 < std::size(Prefixes))
+    {
+        Value /= 1000;
+        ++Prefix;
+    }
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2) << Value << Prefixes[Prefix] << Unit;
+    return ss.str();
+}
+
+void PrintConsoleHeader(size_t NameWidth)
+{
+    std::cout << std::left << std::setw(static_cast<int>(NameWidth)) << "Benchmark"
+              << std::right << std::setw(16) << "Time"
+              << std::setw(16) << "CPU"
+              << std::setw(14) << "Iterations"
+              << "  Counters\n"
+              << std::string(NameWidth + 46 + 10, '-') << '\n';
+}
+
+void PrintConsoleResult(const BenchmarkResult& Res, size_t NameWidth)
+{
+    std::cout << std::left << std::setw(static_cast<int>(NameWidth)) << Res.Name << std::right;
+    if (!Res.Error.empty())
+    {
+        std::cout << "  ERROR: " << Res.Error << '\n';
+        return;
+    }
+
+    std::cout << std::fixed << std::setprecision(1)
+              << std::setw(13) << Res.RealTime << " ns"
+              << std::setw(13) << Res.CPUTime << " ns"
+              << std::setw(14) << Res.Iterations;
+    if (Res.ItemsPerSecond > 0)
+        std::cout << "  items/s=" << FormatRate(Res.ItemsPerSecond, "");
+    if (Res.BytesPerSecond > 0)
+        std::cout << "  bytes/s=" << FormatRate(Res.BytesPerSecond, "B");
+    std::cout << std::endl;
+}
+
+} // namespace
+
+BenchmarkRegistrar::BenchmarkRegistrar(const char* Name, BenchmarkFunctionType Func, std::initializer_list<Int64> Args)
+{
+    VERIFY_EXPR(Name != nullptr && Func != nullptr);
+
+    std::vector<BenchmarkInfo>& Registry = GetBenchmarkRegistry();
+    if (Args.size() == 0)
+    {
+        Registry.emplace_back(BenchmarkInfo{Name, Func});
+    }
+    else
+    {
+        for (Int64 Arg : Args)
+            Registry.emplace_back(BenchmarkInfo{std::string{Name} + "/" + std::to_string(Arg), Func, Arg, true});
+    }
+}
+
+int RunBenchmarks(int argc, char** argv)
+{
+    RunSettings Settings;
+    if (!ParseArgs(argc, argv, Settings))
+        return -1;
+
+    std::vector<BenchmarkInfo> Benchmarks = GetBenchmarkRegistry();
+    std::sort(Benchmarks.begin(), Benchmarks.end(), [](const BenchmarkInfo& lhs, const BenchmarkInfo& rhs) {
+        return lhs.Name < rhs.Name;
+    });
+
+    if (!Settings.Filter.empty())
+    {
+        std::regex FilterRegex;
+        try
+        {
+            FilterRegex = std::regex{Settings.Filter};
+        }
+        catch (const std::regex_error& err)
+        {
+            std::cerr << "Invalid benchmark filter '" << Settings.Filter << "': " << err.what() << '\n';
+            return -1;
+        }
+
+        Benchmarks.erase(std::remove_if(Benchmarks.begin(), Benchmarks.end(),
+                                        [&FilterRegex](const BenchmarkInfo& Info) {
+                                            return !std::regex_search(Info.Name, FilterRegex);
+                                        }),
+                         Benchmarks.end());
+    }
+
+    if (Settings.ListTests)
+    {
+        for (const BenchmarkInfo& Info : Benchmarks)
+            std::cout << Info.Name << '\n';
+        return 0;
+    }
+
+    if (Benchmarks.empty())
+    {
+        std::cerr << "No benchmarks match the filter '" << Settings.Filter << "'\n";
+        return -1;
+    }
+
+    size_t NameWidth = 10;
+    for (const BenchmarkInfo& Info : Benchmarks)
+        NameWidth = std::max(NameWidth, Info.Name.length() + 2);
+
+#ifdef DILIGENT_DEBUG
+    if (!Settings.JsonOutput)
+        std::cout << "***WARNING*** Benchmarks are built in debug configuration. Timings will be affected.\n\n";
+#endif
+
+    if (!Settings.JsonOutput)
+        PrintConsoleHeader(NameWidth);
+
+    std::vector<BenchmarkResult> Results;
+    Results.reserve(Benchmarks.size() * Settings.Repetitions);
+
+    bool AllSucceeded = true;
+    for (const BenchmarkInfo& Info : Benchmarks)
+    {
+        for (Uint32 rep = 0; rep < Settings.Repetitions; ++rep)
+        {
+            BenchmarkResult Res = RunBenchmark(Info, Settings.MinTime);
+            Res.RepetitionIndex = rep;
+            if (!Res.Error.empty())
+                AllSucceeded = false;
+
+            if (!Settings.JsonOutput)
+                PrintConsoleResult(Res, NameWidth);
+
+            Results.emplace_back(std::move(Res));
+        }
+    }
+
+    if (Settings.JsonOutput)
+        WriteJson(std::cout, argv[0], Results);
+
+    if (!Settings.OutFile.empty())
+    {
+        std::ofstream OutFile{Settings.OutFile};
+        if (!OutFile)
+        {
+            std::cerr << "Failed to open output file " << Settings.OutFile << '\n';
+            return -1;
+        }
+        WriteJson(OutFile, argv[0], Results);
+    }
+
+    return AllSucceeded ? 0 : 1;
+}
+
+} // namespace Benchmarking
+
+} // namespace Diligent
@@ -0,0 +1,89 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FixedBlockMemoryAllocator.hpp"
+
+#include <vector>
+
+#include "DefaultRawMemoryAllocator.hpp"
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+// Allocates and immediately releases a single block. The argument is the block size.
+DILIGENT_BENCHMARK_ARGS(Common_FixedBlockMemoryAllocator, AllocateFree, 16, 256)
+{
+    const size_t BlockSize = static_cast<size_t>(State.GetArg());
+
+    FixedBlockMemoryAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator(), BlockSize, 64};
+    while (State.KeepRunning())
+    {
+        void* pBlock = Allocator.Allocate(BlockSize, "Benchmark block", __FILE__, __LINE__);
+        DoNotOptimize(pBlock);
+        Allocator.Free(pBlock);
+    }
+    State.SetItemsProcessed(State.GetMaxIterations());
+}
+
+// Allocates a batch of blocks that spans multiple pages and then releases them
+// in reverse order. The argument is the number of blocks in the batch.
+DILIGENT_BENCHMARK_ARGS(Common_FixedBlockMemoryAllocator, AllocateFreeBatch, 1024)
+{
+    constexpr size_t BlockSize = 64;
+    const size_t     NumBlocks = static_cast<size_t>(State.GetArg());
+
+    FixedBlockMemoryAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator(), BlockSize, 64};
+    std::vector<void*>        Blocks(NumBlocks);
+    while (State.KeepRunning())
+    {
+        for (size_t i = 0; i < NumBlocks; ++i)
+            Blocks[i] = Allocator.Allocate(BlockSize, "Benchmark block", __FILE__, __LINE__);
+        for (size_t i = NumBlocks; i > 0; --i)
+            Allocator.Free(Blocks[i - 1]);
+    }
+    State.SetItemsProcessed(State.GetMaxIterations() * NumBlocks);
+}
+
+// Baseline for comparison: the same pattern using the default raw allocator.
+DILIGENT_BENCHMARK_ARGS(Common_FixedBlockMemoryAllocator, RawAllocatorBaseline, 16, 256)
+{
+    const size_t BlockSize = static_cast<size_t>(State.GetArg());
+
+    DefaultRawMemoryAllocator& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+    while (State.KeepRunning())
+    {
+        void* pBlock = Allocator.Allocate(BlockSize, "Benchmark block", __FILE__, __LINE__);
+        DoNotOptimize(pBlock);
+        Allocator.Free(pBlock);
+    }
+    State.SetItemsProcessed(State.GetMaxIterations());
+}
+
+} // namespace
@@ -0,0 +1,96 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "HashUtils.hpp"
+
+#include <vector>
+
+#include "GraphicsTypes.h"
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+DILIGENT_BENCHMARK(Common_HashUtils, ComputeHashScalars)
+{
+    Uint32 Val0 = 0x12345678u;
+    Uint64 Val1 = 0xABCDEF0123456789ull;
+    float  Val2 = 3.14159f;
+    while (State.KeepRunning())
+    {
+        DoNotOptimize(ComputeHash(Val0, Val1, Val2, TEX_FORMAT_RGBA8_UNORM));
+        ++Val0;
+    }
+    State.SetItemsProcessed(State.GetMaxIterations());
+}
+
+// Hashes a raw memory block. The argument is the block size in bytes.
+DILIGENT_BENCHMARK_ARGS(Common_HashUtils, ComputeHashRaw, 16, 256, 4096)
+{
+    const size_t       Size = static_cast<size_t>(State.GetArg());
+    std::vector<Uint8> Data(Size);
+    for (size_t i = 0; i < Size; ++i)
+        Data[i] = static_cast<Uint8>(i * 31);
+
+    while (State.KeepRunning())
+    {
+        DoNotOptimize(ComputeHashRaw(Data.data(), Data.size()));
+    }
+    State.SetBytesProcessed(State.GetMaxIterations() * Size);
+}
+
+// Constructs a non-owning string key, which hashes the string.
+DILIGENT_BENCHMARK(Common_HashUtils, HashMapStringKey)
+{
+    const char* Str = "g_MaterialAttribs.BaseColorTexture";
+    while (State.KeepRunning())
+    {
+        HashMapStringKey Key{Str};
+        DoNotOptimize(Key.GetHash());
+    }
+    State.SetItemsProcessed(State.GetMaxIterations());
+}
+
+DILIGENT_BENCHMARK(Common_HashUtils, SamplerDesc)
+{
+    SamplerDesc Desc;
+    Desc.MinFilter = FILTER_TYPE_ANISOTROPIC;
+    Desc.MagFilter = FILTER_TYPE_ANISOTROPIC;
+    Desc.MipFilter = FILTER_TYPE_ANISOTROPIC;
+    Desc.AddressU  = TEXTURE_ADDRESS_CLAMP;
+
+    std::hash<SamplerDesc> Hasher;
+    while (State.KeepRunning())
+    {
+        DoNotOptimize(Hasher(Desc));
+    }
+    State.SetItemsProcessed(State.GetMaxIterations());
+}
+
+} // namespace
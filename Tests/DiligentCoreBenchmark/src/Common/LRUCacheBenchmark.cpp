@@ -0,0 +1,123 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "LRUCache.hpp"
+
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+struct CacheData
+{
+    Uint64 Value = 0;
+};
+
+constexpr size_t CacheEntrySize = 64;
+
+// Every lookup finds the data in the cache.
+DILIGENT_BENCHMARK_ARGS(Common_LRUCache, GetHit, 16, 1024)
+{
+    const Uint32 NumKeys = static_cast<Uint32>(State.GetArg());
+
+    LRUCache<Uint32, CacheData> Cache{NumKeys * CacheEntrySize};
+    for (Uint32 Key = 0; Key < NumKeys; ++Key)
+    {
+        Cache.Get(Key, [Key](CacheData& Data, size_t& Size) {
+            Data.Value = Key;
+            Size       = CacheEntrySize;
+        });
+    }
+
+    Uint32 Key = 0;
+    while (State.KeepRunning())
+    {
+        CacheData Data = Cache.Get(Key, [](CacheData& Data, size_t& Size) {
+            Size = CacheEntrySize;
+        });
+        DoNotOptimize(Data);
+        Key = (Key + 1) % NumKeys;
+    }
+    State.SetItemsProcessed(State.GetMaxIterations());
+}
+
+// The working set is twice as large as the cache, so every lookup is a miss
+// that initializes new data and evicts the least recently used entry.
+DILIGENT_BENCHMARK_ARGS(Common_LRUCache, GetMissEvict, 16, 1024)
+{
+    const Uint32 NumKeys = static_cast<Uint32>(State.GetArg());
+
+    LRUCache<Uint32, CacheData> Cache{NumKeys * CacheEntrySize};
+
+    Uint32 Key = 0;
+    while (State.KeepRunning())
+    {
+        CacheData Data = Cache.Get(Key, [Key](CacheData& Data, size_t& Size) {
+            Data.Value = Key;
+            Size       = CacheEntrySize;
+        });
+        DoNotOptimize(Data);
+        Key = (Key + 1) % (NumKeys * 2);
+    }
+    State.SetItemsProcessed(State.GetMaxIterations());
+}
+
+// String keys exercise the hashing and comparison of the key type.
+DILIGENT_BENCHMARK(Common_LRUCache, GetHitStringKey)
+{
+    constexpr Uint32 NumKeys = 256;
+
+    std::vector<std::string> Keys(NumKeys);
+    for (Uint32 i = 0; i < NumKeys; ++i)
+        Keys[i] = "Pipeline state object name " + std::to_string(i);
+
+    LRUCache<std::string, CacheData> Cache{NumKeys * CacheEntrySize};
+    for (const std::string& Key : Keys)
+    {
+        Cache.Get(Key, [](CacheData& Data, size_t& Size) {
+            Size = CacheEntrySize;
+        });
+    }
+
+    Uint32 KeyIdx = 0;
+    while (State.KeepRunning())
+    {
+        CacheData Data = Cache.Get(Keys[KeyIdx], [](CacheData& Data, size_t& Size) {
+            Size = CacheEntrySize;
+        });
+        DoNotOptimize(Data);
+        KeyIdx = (KeyIdx + 1) % NumKeys;
+    }
+    State.SetItemsProcessed(State.GetMaxIterations());
+}
+
+} // namespace
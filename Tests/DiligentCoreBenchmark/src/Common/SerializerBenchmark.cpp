@@ -0,0 +1,127 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Serializer.hpp"
+
+#include <vector>
+
+#include "DefaultRawMemoryAllocator.hpp"
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+// A record that resembles a typical archived object description
+struct BenchmarkRecord
+{
+    const char* Name       = "Benchmark record name";
+    const char* EntryPoint = "main";
+    Uint64      Hash       = 0x12345678ABCDEF01ull;
+    Uint32      Flags      = 0x52830394u;
+    Uint16      Type       = 0x4172;
+    Uint8       Stage      = 0x72;
+
+    Uint8 Bytes[32] = {};
+};
+
+template <SerializerMode Mode>
+bool SerializeRecord(Serializer<Mode>& Ser, typename Serializer<Mode>::template ConstQual<BenchmarkRecord>& Rec)
+{
+    return Ser(Rec.Name, Rec.EntryPoint, Rec.Hash, Rec.Flags, Rec.Type, Rec.Stage) &&
+        Ser.CopyBytes(Rec.Bytes, sizeof(Rec.Bytes));
+}
+
+// Measures the size of the serialized records. The argument is the number of records.
+DILIGENT_BENCHMARK_ARGS(Common_Serializer, Measure, 256)
+{
+    const size_t          NumRecords = static_cast<size_t>(State.GetArg());
+    const BenchmarkRecord Rec;
+    while (State.KeepRunning())
+    {
+        Serializer<SerializerMode::Measure> MSer;
+        for (size_t i = 0; i < NumRecords; ++i)
+            SerializeRecord(MSer, Rec);
+        DoNotOptimize(MSer.GetSize());
+    }
+    State.SetItemsProcessed(State.GetMaxIterations() * NumRecords);
+}
+
+// Writes the records into preallocated memory.
+DILIGENT_BENCHMARK_ARGS(Common_Serializer, Write, 256)
+{
+    const size_t          NumRecords = static_cast<size_t>(State.GetArg());
+    const BenchmarkRecord Rec;
+
+    Serializer<SerializerMode::Measure> MSer;
+    for (size_t i = 0; i < NumRecords; ++i)
+        SerializeRecord(MSer, Rec);
+    const SerializedData Data = MSer.AllocateData(DefaultRawMemoryAllocator::GetAllocator());
+
+    while (State.KeepRunning())
+    {
+        Serializer<SerializerMode::Write> WSer{Data};
+        for (size_t i = 0; i < NumRecords; ++i)
+            SerializeRecord(WSer, Rec);
+        ClobberMemory();
+    }
+    State.SetItemsProcessed(State.GetMaxIterations() * NumRecords);
+    State.SetBytesProcessed(State.GetMaxIterations() * Data.Size());
+}
+
+// Reads the records back.
+DILIGENT_BENCHMARK_ARGS(Common_Serializer, Read, 256)
+{
+    const size_t          NumRecords = static_cast<size_t>(State.GetArg());
+    const BenchmarkRecord Rec;
+
+    Serializer<SerializerMode::Measure> MSer;
+    for (size_t i = 0; i < NumRecords; ++i)
+        SerializeRecord(MSer, Rec);
+    const SerializedData Data = MSer.AllocateData(DefaultRawMemoryAllocator::GetAllocator());
+    {
+        Serializer<SerializerMode::Write> WSer{Data};
+        for (size_t i = 0; i < NumRecords; ++i)
+            SerializeRecord(WSer, Rec);
+    }
+
+    while (State.KeepRunning())
+    {
+        Serializer<SerializerMode::Read> RSer{Data};
+        for (size_t i = 0; i < NumRecords; ++i)
+        {
+            BenchmarkRecord ReadRec;
+            SerializeRecord(RSer, ReadRec);
+            DoNotOptimize(ReadRec);
+        }
+    }
+    State.SetItemsProcessed(State.GetMaxIterations() * NumRecords);
+    State.SetBytesProcessed(State.GetMaxIterations() * Data.Size());
+}
+
+} // namespace
@@ -0,0 +1,100 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ThreadPool.hpp"
+
+#include <atomic>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+// Measures the throughput of enqueueing independent tasks and waiting for them
+// to complete. The argument is the number of tasks per iteration.
+DILIGENT_BENCHMARK_ARGS(Common_ThreadPool, EnqueueAndWait, 1, 64, 1024)
+{
+    const Uint32 NumTasks = static_cast<Uint32>(State.GetArg());
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    std::atomic<Uint32>        Counter{0};
+    while (State.KeepRunning())
+    {
+        for (Uint32 i = 0; i < NumTasks; ++i)
+        {
+            EnqueueAsyncWork(pThreadPool, [&Counter](Uint32 ThreadId) {
+                Counter.fetch_add(1);
+            });
+        }
+        pThreadPool->WaitForAllTasks();
+    }
+    DoNotOptimize(Counter.load());
+    State.SetItemsProcessed(State.GetMaxIterations() * NumTasks);
+}
+
+// Measures the overhead of processing tasks with dependencies: every task
+// depends on the previous one, so tasks are always moved from the waiting list.
+DILIGENT_BENCHMARK_ARGS(Common_ThreadPool, EnqueueChain, 64)
+{
+    const Uint32 NumTasks = static_cast<Uint32>(State.GetArg());
+
+    RefCntAutoPtr<IThreadPool>             pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    std::vector<RefCntAutoPtr<IAsyncTask>> Tasks(NumTasks);
+    while (State.KeepRunning())
+    {
+        for (Uint32 i = 0; i < NumTasks; ++i)
+        {
+            IAsyncTask* pPrerequisite = i > 0 ? Tasks[i - 1].RawPtr() : nullptr;
+            Tasks[i]                  = EnqueueAsyncWork(pThreadPool, &pPrerequisite, pPrerequisite != nullptr ? 1 : 0, [](Uint32 ThreadId) {});
+        }
+        pThreadPool->WaitForAllTasks();
+    }
+    State.SetItemsProcessed(State.GetMaxIterations() * NumTasks);
+}
+
+// Measures the pure queue overhead without any thread synchronization: tasks are
+// processed by the calling thread.
+DILIGENT_BENCHMARK(Common_ThreadPool, ProcessTaskOnCallingThread)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{0});
+
+    Uint64 Counter = 0;
+    while (State.KeepRunning())
+    {
+        EnqueueAsyncWork(pThreadPool, [&Counter](Uint32 ThreadId) {
+            ++Counter;
+        });
+        pThreadPool->ProcessTask(0, false);
+    }
+    DoNotOptimize(Counter);
+    State.SetItemsProcessed(State.GetMaxIterations());
+}
+
+} // namespace
@@ -0,0 +1,106 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "DynamicAtlasManager.hpp"
+
+#include <vector>
+
+#include "FastRand.hpp"
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+constexpr Uint32 AtlasSize = 2048;
+
+// Glyph-like regions with fixed seed for reproducible results
+std::vector<DynamicAtlasManager::RegionSize> GenerateSizes(size_t NumRegions)
+{
+    std::vector<DynamicAtlasManager::RegionSize> Sizes(NumRegions);
+
+    FastRandInt rnd{0, 4, 32};
+    for (auto& Size : Sizes)
+    {
+        Size.width  = rnd();
+        Size.height = rnd();
+    }
+    return Sizes;
+}
+
+void AllocateFree(State& State, DynamicAtlasManager::PackingMode Mode, bool Batch)
+{
+    const auto Sizes = GenerateSizes(static_cast<size_t>(State.GetArg()));
+
+    std::vector<DynamicAtlasManager::Region> Regions(Sizes.size());
+    while (State.KeepRunning())
+    {
+        DynamicAtlasManager Mgr{AtlasSize, AtlasSize, Mode};
+        if (Batch)
+        {
+            Mgr.Allocate(Sizes.data(), static_cast<Uint32>(Sizes.size()), Regions.data());
+        }
+        else
+        {
+            for (size_t i = 0; i < Sizes.size(); ++i)
+                Regions[i] = Mgr.Allocate(Sizes[i].width, Sizes[i].height);
+        }
+        DoNotOptimize(Regions.data());
+
+        for (auto& R : Regions)
+        {
+            if (!R.IsEmpty())
+                Mgr.Free(std::move(R));
+        }
+    }
+    State.SetItemsProcessed(State.GetMaxIterations() * Sizes.size());
+}
+
+// Allocates the given number of regions one by one and then releases them.
+DILIGENT_BENCHMARK_ARGS(GraphicsAccessories_DynamicAtlasManager, Guillotine, 256, 4096)
+{
+    AllocateFree(State, DynamicAtlasManager::PackingMode::Guillotine, false);
+}
+
+DILIGENT_BENCHMARK_ARGS(GraphicsAccessories_DynamicAtlasManager, Skyline, 256, 4096)
+{
+    AllocateFree(State, DynamicAtlasManager::PackingMode::Skyline, false);
+}
+
+// Allocates the given number of regions with a single batch call and then releases them.
+DILIGENT_BENCHMARK_ARGS(GraphicsAccessories_DynamicAtlasManager, GuillotineBatch, 256, 4096)
+{
+    AllocateFree(State, DynamicAtlasManager::PackingMode::Guillotine, true);
+}
+
+DILIGENT_BENCHMARK_ARGS(GraphicsAccessories_DynamicAtlasManager, SkylineBatch, 256, 4096)
+{
+    AllocateFree(State, DynamicAtlasManager::PackingMode::Skyline, true);
+}
+
+} // namespace
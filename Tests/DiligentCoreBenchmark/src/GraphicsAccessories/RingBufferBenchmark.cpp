@@ -0,0 +1,116 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "RingBuffer.hpp"
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "DefaultRawMemoryAllocator.hpp"
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+using OffsetType = RingBuffer::OffsetType;
+
+constexpr OffsetType BufferSize         = OffsetType{64} << 20;
+constexpr Uint32     NumAllocsPerThread = 4096;
+
+// Every iteration records one frame: each thread makes NumAllocsPerThread small allocations,
+// after which the frame is finished and the frame before the previous one is released.
+template <typename AllocateFuncType, typename EndFrameFuncType>
+void RecordFrames(State& State, AllocateFuncType&& Allocate, EndFrameFuncType&& EndFrame)
+{
+    const Uint32 NumThreads = static_cast<Uint32>(State.GetArg());
+
+    Uint64 Frame = 0;
+    while (State.KeepRunning())
+    {
+        std::vector<std::thread> Threads;
+        Threads.reserve(NumThreads);
+        for (Uint32 t = 0; t < NumThreads; ++t)
+        {
+            Threads.emplace_back([&Allocate, t]() {
+                for (Uint32 i = 0; i < NumAllocsPerThread; ++i)
+                {
+                    auto Offset = Allocate(64 + ((t + i) & 7) * 32, 16);
+                    DoNotOptimize(Offset);
+                }
+            });
+        }
+        for (auto& Thread : Threads)
+            Thread.join();
+
+        EndFrame(Frame++);
+    }
+    State.SetItemsProcessed(State.GetMaxIterations() * NumThreads * NumAllocsPerThread);
+}
+
+// Baseline: the ring buffer protected by a mutex.
+// The argument is the number of recording threads.
+DILIGENT_BENCHMARK_ARGS(GraphicsAccessories_RingBuffer, LockedAllocate, 1, 2, 8)
+{
+    RingBuffer RB{BufferSize, DefaultRawMemoryAllocator::GetAllocator()};
+    std::mutex Mtx;
+    RecordFrames(
+        State,
+        [&](OffsetType Size, OffsetType Alignment) {
+            std::lock_guard<std::mutex> Lock{Mtx};
+            return RB.Allocate(Size, Alignment);
+        },
+        [&](Uint64 Frame) {
+            std::lock_guard<std::mutex> Lock{Mtx};
+            RB.FinishCurrentFrame(Frame);
+            if (Frame >= 2)
+                RB.ReleaseCompletedFrames(Frame - 2);
+        });
+    RB.ReleaseCompletedFrames(~Uint64{0});
+}
+
+// Lock-free multi-producer ring buffer.
+// The argument is the number of recording threads.
+DILIGENT_BENCHMARK_ARGS(GraphicsAccessories_AtomicRingBuffer, Allocate, 1, 2, 8)
+{
+    AtomicRingBuffer RB{BufferSize, DefaultRawMemoryAllocator::GetAllocator()};
+    RecordFrames(
+        State,
+        [&](OffsetType Size, OffsetType Alignment) {
+            return RB.Allocate(Size, Alignment);
+        },
+        [&](Uint64 Frame) {
+            RB.FinishCurrentFrame(Frame);
+            if (Frame >= 2)
+                RB.ReleaseCompletedFrames(Frame - 2);
+        });
+    RB.ReleaseCompletedFrames(~Uint64{0});
+}
+
+} // namespace
@@ -0,0 +1,187 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "SizeClassIndex.hpp"
+#include "VariableSizeAllocationsManager.hpp"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "DefaultRawMemoryAllocator.hpp"
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+using OffsetType = VariableSizeAllocationsManager::OffsetType;
+
+// Simulates a pool of device memory pages similar to the one used by the Vulkan memory manager
+class PagePool
+{
+public:
+    explicit PagePool(bool UseSizeClassIndex) :
+        m_UseSizeClassIndex{UseSizeClassIndex}
+    {}
+
+    ~PagePool()
+    {
+        for (auto& pPage : m_Pages)
+            m_Index.Remove(pPage->Loc);
+    }
+
+    struct Page
+    {
+        Page() :
+            // Debug validation walks the entire free list on every operation and would dominate the timings
+            Mgr{{DefaultRawMemoryAllocator::GetAllocator(), PageSize, /*DbgDisableDebugValidation = */ true}}
+        {}
+
+        VariableSizeAllocationsManager Mgr;
+        SizeClassIndex<Page>::Location Loc;
+    };
+
+    struct Allocation
+    {
+        Page*                                      pPage = nullptr;
+        VariableSizeAllocationsManager::Allocation Alloc;
+    };
+
+    Allocation Allocate(OffsetType Size, OffsetType Alignment)
+    {
+        Allocation Allocation;
+        if (m_UseSizeClassIndex)
+        {
+            const auto Required = AlignUp(Size, Alignment) + Alignment - 1;
+            if (Page* pPage = m_Index.FindCandidate(Required))
+                Allocation = {pPage, pPage->Mgr.Allocate(Size, Alignment)};
+            if (!Allocation.Alloc.IsValid())
+            {
+                if (Page* pPage = m_Index.FindGuaranteed(Required))
+                    Allocation = {pPage, pPage->Mgr.Allocate(Size, Alignment)};
+            }
+        }
+        else
+        {
+            // Try every page in turn
+            for (auto& pPage : m_Pages)
+            {
+                Allocation = {pPage.get(), pPage->Mgr.Allocate(Size, Alignment)};
+                if (Allocation.Alloc.IsValid())
+                    break;
+            }
+        }
+
+        if (!Allocation.Alloc.IsValid())
+        {
+            m_Pages.emplace_back(new Page);
+            Allocation = {m_Pages.back().get(), m_Pages.back()->Mgr.Allocate(Size, Alignment)};
+        }
+        VERIFY_EXPR(Allocation.Alloc.IsValid());
+
+        if (m_UseSizeClassIndex)
+            m_Index.Update(*Allocation.pPage, Allocation.pPage->Loc, Allocation.pPage->Mgr.GetMaxFreeBlockSize());
+
+        return Allocation;
+    }
+
+    void Free(Allocation& Allocation)
+    {
+        auto& Page = *Allocation.pPage;
+        Page.Mgr.Free(std::move(Allocation.Alloc));
+        if (m_UseSizeClassIndex)
+            m_Index.Update(Page, Page.Loc, Page.Mgr.GetMaxFreeBlockSize());
+        Allocation.pPage = nullptr;
+    }
+
+    size_t GetNumPages() const { return m_Pages.size(); }
+
+private:
+    static constexpr OffsetType PageSize = OffsetType{1} << 20;
+
+    const bool m_UseSizeClassIndex;
+
+    std::vector<std::unique_ptr<Page>> m_Pages;
+    SizeClassIndex<Page>               m_Index;
+};
+
+// Allocates and releases blocks of random sizes and alignments in random order from a pool of
+// 1 MB pages. The argument is the number of live allocations, which determines the number of pages.
+void AllocateFromPages(State& State, bool UseSizeClassIndex)
+{
+    const size_t NumLiveAllocations = static_cast<size_t>(State.GetArg());
+
+    std::mt19937                              Gen{0}; // Use fixed seed for reproducible results
+    std::uniform_int_distribution<OffsetType> SizeDistr{256, 65536};
+    std::uniform_int_distribution<Uint32>     AlignmentLog2Distr{4, 12};
+    std::uniform_int_distribution<size_t>     IdxDistr{0, NumLiveAllocations - 1};
+
+    PagePool                          Pool{UseSizeClassIndex};
+    std::vector<PagePool::Allocation> Allocations(NumLiveAllocations);
+    for (auto& Alloc : Allocations)
+        Alloc = Pool.Allocate(SizeDistr(Gen), OffsetType{1} << AlignmentLog2Distr(Gen));
+
+    // Pregenerate random numbers so that the generator does not affect the timings
+    constexpr size_t        NumRandomValues = 4096;
+    std::vector<OffsetType> Sizes(NumRandomValues);
+    std::vector<OffsetType> Alignments(NumRandomValues);
+    std::vector<size_t>     Indices(NumRandomValues);
+    for (size_t i = 0; i < NumRandomValues; ++i)
+    {
+        Sizes[i]      = SizeDistr(Gen);
+        Alignments[i] = OffsetType{1} << AlignmentLog2Distr(Gen);
+        Indices[i]    = IdxDistr(Gen);
+    }
+
+    size_t i = 0;
+    while (State.KeepRunning())
+    {
+        auto& Alloc = Allocations[Indices[i]];
+        Pool.Free(Alloc);
+        Alloc = Pool.Allocate(Sizes[i], Alignments[i]);
+        i     = (i + 1) % NumRandomValues;
+    }
+
+    for (auto& Alloc : Allocations)
+        Pool.Free(Alloc);
+
+    State.SetItemsProcessed(State.GetMaxIterations());
+}
+
+DILIGENT_BENCHMARK_ARGS(GraphicsAccessories_SizeClassIndex, LinearPageScan, 1024, 16384)
+{
+    AllocateFromPages(State, false);
+}
+
+DILIGENT_BENCHMARK_ARGS(GraphicsAccessories_SizeClassIndex, SizeClassLookup, 1024, 16384)
+{
+    AllocateFromPages(State, true);
+}
+
+} // namespace
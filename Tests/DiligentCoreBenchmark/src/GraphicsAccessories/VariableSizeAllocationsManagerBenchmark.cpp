@@ -0,0 +1,109 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "VariableSizeAllocationsManager.hpp"
+
+#include <random>
+#include <vector>
+
+#include "DefaultRawMemoryAllocator.hpp"
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+using OffsetType = VariableSizeAllocationsManager::OffsetType;
+
+constexpr OffsetType ManagerSize = OffsetType{64} << 20;
+
+VariableSizeAllocationsManager::CreateInfo GetManagerCI()
+{
+    // Debug validation walks the entire free list on every operation and would dominate the timings
+    return {DefaultRawMemoryAllocator::GetAllocator(), ManagerSize, /*DbgDisableDebugValidation = */ true};
+}
+
+// Allocates and immediately releases a single block from an empty manager.
+// The argument is the allocation size.
+DILIGENT_BENCHMARK_ARGS(GraphicsAccessories_VariableSizeAllocationsManager, AllocateFree, 256, 65536)
+{
+    const OffsetType               Size = static_cast<OffsetType>(State.GetArg());
+    VariableSizeAllocationsManager Mgr{GetManagerCI()};
+    while (State.KeepRunning())
+    {
+        auto Alloc = Mgr.Allocate(Size, 16);
+        DoNotOptimize(Alloc);
+        Mgr.Free(std::move(Alloc));
+    }
+    State.SetItemsProcessed(State.GetMaxIterations());
+}
+
+// Allocates and releases blocks of random sizes in random order, which keeps the
+// free lists fragmented. The argument is the number of live allocations.
+DILIGENT_BENCHMARK_ARGS(GraphicsAccessories_VariableSizeAllocationsManager, Fragmented, 256, 4096)
+{
+    const size_t NumLiveAllocations = static_cast<size_t>(State.GetArg());
+
+    std::mt19937                              Gen{0}; // Use fixed seed for reproducible results
+    std::uniform_int_distribution<OffsetType> SizeDistr{16, 4096};
+    std::uniform_int_distribution<size_t>     IdxDistr{0, NumLiveAllocations - 1};
+
+    VariableSizeAllocationsManager                          Mgr{GetManagerCI()};
+    std::vector<VariableSizeAllocationsManager::Allocation> Allocations(NumLiveAllocations);
+    for (auto& Alloc : Allocations)
+        Alloc = Mgr.Allocate(SizeDistr(Gen), 16);
+
+    // Pregenerate random numbers so that the generator does not affect the timings
+    constexpr size_t        NumRandomValues = 4096;
+    std::vector<OffsetType> Sizes(NumRandomValues);
+    std::vector<size_t>     Indices(NumRandomValues);
+    for (size_t i = 0; i < NumRandomValues; ++i)
+    {
+        Sizes[i]   = SizeDistr(Gen);
+        Indices[i] = IdxDistr(Gen);
+    }
+
+    size_t i = 0;
+    while (State.KeepRunning())
+    {
+        auto& Alloc = Allocations[Indices[i]];
+        if (Alloc.IsValid())
+            Mgr.Free(std::move(Alloc));
+        Alloc = Mgr.Allocate(Sizes[i], 16);
+        i     = (i + 1) % NumRandomValues;
+    }
+
+    for (auto& Alloc : Allocations)
+    {
+        if (Alloc.IsValid())
+            Mgr.Free(std::move(Alloc));
+    }
+    State.SetItemsProcessed(State.GetMaxIterations());
+}
+
+} // namespace
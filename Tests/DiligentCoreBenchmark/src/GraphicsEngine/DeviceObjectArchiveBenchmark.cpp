@@ -0,0 +1,120 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "DeviceObjectArchive.hpp"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "DataBlobImpl.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+using ArchiveDeviceType   = DeviceObjectArchive::DeviceType;
+using ArchiveResourceType = DeviceObjectArchive::ResourceType;
+
+constexpr Uint32 ArchiveContentVersion = 1234;
+
+SerializedData MakeData(size_t Size, Uint8 Fill)
+{
+    SerializedData Data{Size, DefaultRawMemoryAllocator::GetAllocator()};
+    std::memset(Data.Ptr(), Fill, Size);
+    return Data;
+}
+
+std::string GetPipelineName(size_t Idx)
+{
+    return "Benchmark pipeline " + std::to_string(Idx);
+}
+
+// Creates an archive that contains NumPipelines graphics pipelines, each with
+// common and Vulkan-specific data, and two Vulkan shaders per pipeline.
+RefCntAutoPtr<IDataBlob> CreateArchiveData(size_t NumPipelines)
+{
+    DeviceObjectArchive Archive{ArchiveContentVersion};
+    for (size_t i = 0; i < NumPipelines; ++i)
+    {
+        auto& ResData = Archive.GetResourceData(ArchiveResourceType::GraphicsPipeline, GetPipelineName(i).c_str());
+
+        ResData.Common = MakeData(256, static_cast<Uint8>(i));
+
+        ResData.DeviceSpecific[static_cast<size_t>(ArchiveDeviceType::Vulkan)] = MakeData(64, static_cast<Uint8>(i));
+    }
+
+    auto& Shaders = Archive.GetDeviceShaders(ArchiveDeviceType::Vulkan);
+    for (size_t i = 0; i < NumPipelines * 2; ++i)
+        Shaders.emplace_back(MakeData(4096, static_cast<Uint8>(i)));
+
+    RefCntAutoPtr<IDataBlob> pData;
+    Archive.Serialize(&pData);
+    return pData;
+}
+
+// Loads the archive from a data blob without copying the data.
+// The argument is the number of pipelines in the archive.
+DILIGENT_BENCHMARK_ARGS(GraphicsEngine_DeviceObjectArchive, Load, 16, 256)
+{
+    const size_t                   NumPipelines = static_cast<size_t>(State.GetArg());
+    const RefCntAutoPtr<IDataBlob> pData        = CreateArchiveData(NumPipelines);
+
+    while (State.KeepRunning())
+    {
+        DeviceObjectArchive Archive{DeviceObjectArchive::CreateInfo{pData, ArchiveContentVersion, /*MakeCopy = */ false}};
+        DoNotOptimize(Archive);
+    }
+    State.SetItemsProcessed(State.GetMaxIterations() * NumPipelines);
+    State.SetBytesProcessed(State.GetMaxIterations() * pData->GetSize());
+}
+
+// Looks up device-specific pipeline data by name in a loaded archive.
+DILIGENT_BENCHMARK_ARGS(GraphicsEngine_DeviceObjectArchive, FindResource, 256)
+{
+    const size_t                   NumPipelines = static_cast<size_t>(State.GetArg());
+    const RefCntAutoPtr<IDataBlob> pData        = CreateArchiveData(NumPipelines);
+    const DeviceObjectArchive      Archive{DeviceObjectArchive::CreateInfo{pData, ArchiveContentVersion, /*MakeCopy = */ false}};
+
+    std::vector<std::string> Names(NumPipelines);
+    for (size_t i = 0; i < NumPipelines; ++i)
+        Names[i] = GetPipelineName(i);
+
+    size_t i = 0;
+    while (State.KeepRunning())
+    {
+        const auto& Data = Archive.GetDeviceSpecificData(ArchiveResourceType::GraphicsPipeline, Names[i].c_str(), ArchiveDeviceType::Vulkan);
+        DoNotOptimize(Data.Ptr());
+        i = (i + 1) % NumPipelines;
+    }
+    State.SetItemsProcessed(State.GetMaxIterations());
+}
+
+} // namespace
@@ -0,0 +1,119 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "PipelineResourceNameIndex.hpp"
+#include "PipelineResourceSignatureBase.hpp"
+#include "GraphicsAccessories.hpp"
+
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+class SignatureResources
+{
+public:
+    explicit SignatureResources(Uint32 NumResources)
+    {
+        static constexpr SHADER_RESOURCE_TYPE ResTypes[] = {
+            SHADER_RESOURCE_TYPE_CONSTANT_BUFFER,
+            SHADER_RESOURCE_TYPE_TEXTURE_SRV,
+            SHADER_RESOURCE_TYPE_BUFFER_SRV,
+            SHADER_RESOURCE_TYPE_TEXTURE_UAV,
+        };
+
+        Names.reserve(NumResources);
+        Resources.reserve(NumResources);
+        for (Uint32 i = 0; i < NumResources; ++i)
+        {
+            const SHADER_RESOURCE_TYPE ResType = ResTypes[i % _countof(ResTypes)];
+            Names.emplace_back(std::string{GetShaderResourceTypeLiteralName(ResType)} + "_" + std::to_string(i));
+            Resources.emplace_back(SHADER_TYPE_PIXEL, Names.back().c_str(), 1u, ResType);
+        }
+    }
+
+    Uint32 GetCount() const { return static_cast<Uint32>(Resources.size()); }
+
+    std::vector<std::string>          Names;
+    std::vector<PipelineResourceDesc> Resources;
+};
+
+// Looks up every resource by name with a linear scan of the resource array.
+// The argument is the number of resources in the signature.
+DILIGENT_BENCHMARK_ARGS(GraphicsEngine_PipelineResourceNameIndex, LinearSearch, 16, 128, 256)
+{
+    const SignatureResources Res{static_cast<Uint32>(State.GetArg())};
+
+    Uint32 i = 0;
+    while (State.KeepRunning())
+    {
+        Uint32 ResIndex = FindResource(Res.Resources.data(), Res.GetCount(), SHADER_TYPE_PIXEL, Res.Names[i].c_str());
+        DoNotOptimize(ResIndex);
+        i = (i + 1) % Res.GetCount();
+    }
+    State.SetItemsProcessed(State.GetMaxIterations());
+}
+
+// Looks up every resource by name with the hashed name index.
+// The argument is the number of resources in the signature.
+DILIGENT_BENCHMARK_ARGS(GraphicsEngine_PipelineResourceNameIndex, Find, 16, 128, 256)
+{
+    const SignatureResources Res{static_cast<Uint32>(State.GetArg())};
+
+    PipelineResourceNameIndex Index;
+    Index.Initialize(Res.Resources.data(), Res.GetCount());
+
+    Uint32 i = 0;
+    while (State.KeepRunning())
+    {
+        Uint32 ResIndex = Index.FindResource(Res.Resources.data(), SHADER_TYPE_PIXEL, Res.Names[i].c_str());
+        DoNotOptimize(ResIndex);
+        i = (i + 1) % Res.GetCount();
+    }
+    State.SetItemsProcessed(State.GetMaxIterations());
+}
+
+// Builds the name index. The argument is the number of resources in the signature.
+DILIGENT_BENCHMARK_ARGS(GraphicsEngine_PipelineResourceNameIndex, Initialize, 16, 256)
+{
+    const SignatureResources Res{static_cast<Uint32>(State.GetArg())};
+
+    while (State.KeepRunning())
+    {
+        PipelineResourceNameIndex Index;
+        Index.Initialize(Res.Resources.data(), Res.GetCount());
+        DoNotOptimize(Index);
+    }
+    State.SetItemsProcessed(State.GetMaxIterations() * Res.GetCount());
+}
+
+} // namespace
@@ -0,0 +1,92 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "GraphicsUtilities.h"
+
+#include <vector>
+
+#include "GraphicsAccessories.hpp"
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+// Computes the coarse mip level of a square texture whose size is given by the benchmark argument.
+void RunComputeMipLevelBenchmark(State& State, TEXTURE_FORMAT Format, MIP_FILTER_TYPE FilterType, float AlphaCutoff = 0)
+{
+    const Uint32 FineSize   = static_cast<Uint32>(State.GetArg());
+    const Uint32 CoarseSize = FineSize / 2;
+    const Uint32 PixelSize  = GetTextureFormatAttribs(Format).GetElementSize();
+
+    std::vector<Uint8> FineData(size_t{FineSize} * FineSize * PixelSize);
+    std::vector<Uint8> CoarseData(size_t{CoarseSize} * CoarseSize * PixelSize);
+    for (size_t i = 0; i < FineData.size(); ++i)
+        FineData[i] = static_cast<Uint8>((i * 7) ^ (i >> 5));
+
+    ComputeMipLevelAttribs Attribs;
+    Attribs.Format          = Format;
+    Attribs.FineMipWidth    = FineSize;
+    Attribs.FineMipHeight   = FineSize;
+    Attribs.pFineMipData    = FineData.data();
+    Attribs.FineMipStride   = size_t{FineSize} * PixelSize;
+    Attribs.pCoarseMipData  = CoarseData.data();
+    Attribs.CoarseMipStride = size_t{CoarseSize} * PixelSize;
+    Attribs.FilterType      = FilterType;
+    Attribs.AlphaCutoff     = AlphaCutoff;
+
+    while (State.KeepRunning())
+    {
+        ComputeMipLevel(Attribs);
+        ClobberMemory();
+    }
+    State.SetItemsProcessed(State.GetMaxIterations() * CoarseSize * CoarseSize);
+    State.SetBytesProcessed(State.GetMaxIterations() * FineData.size());
+}
+
+DILIGENT_BENCHMARK_ARGS(GraphicsTools_ComputeMipLevel, RGBA8_UNORM, 256, 1024)
+{
+    RunComputeMipLevelBenchmark(State, TEX_FORMAT_RGBA8_UNORM, MIP_FILTER_TYPE_BOX_AVERAGE);
+}
+
+DILIGENT_BENCHMARK_ARGS(GraphicsTools_ComputeMipLevel, RGBA8_UNORM_SRGB, 256, 1024)
+{
+    RunComputeMipLevelBenchmark(State, TEX_FORMAT_RGBA8_UNORM_SRGB, MIP_FILTER_TYPE_BOX_AVERAGE);
+}
+
+DILIGENT_BENCHMARK_ARGS(GraphicsTools_ComputeMipLevel, RGBA8_UNORM_AlphaCutoff, 1024)
+{
+    RunComputeMipLevelBenchmark(State, TEX_FORMAT_RGBA8_UNORM, MIP_FILTER_TYPE_BOX_AVERAGE, 0.5f);
+}
+
+DILIGENT_BENCHMARK_ARGS(GraphicsTools_ComputeMipLevel, R8_UNORM_MostFrequent, 1024)
+{
+    RunComputeMipLevelBenchmark(State, TEX_FORMAT_R8_UNORM, MIP_FILTER_TYPE_MOST_FREQUENT);
+}
+
+} // namespace
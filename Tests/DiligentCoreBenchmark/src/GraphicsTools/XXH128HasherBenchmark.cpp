@@ -0,0 +1,124 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "XXH128Hasher.hpp"
+
+#include <iterator>
+#include <vector>
+
+#include "Benchmark.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+// Hashes a raw memory block. The argument is the block size in bytes.
+DILIGENT_BENCHMARK_ARGS(GraphicsTools_XXH128Hasher, UpdateRaw, 64, 1024, 65536)
+{
+    const size_t       Size = static_cast<size_t>(State.GetArg());
+    std::vector<Uint8> Data(Size);
+    for (size_t i = 0; i < Size; ++i)
+        Data[i] = static_cast<Uint8>(i * 31);
+
+    while (State.KeepRunning())
+    {
+        XXH128State Hasher;
+        Hasher.UpdateRaw(Data.data(), Data.size());
+        DoNotOptimize(Hasher.Digest());
+    }
+    State.SetBytesProcessed(State.GetMaxIterations() * Size);
+}
+
+// Hashes the shader create info the way the render state cache does it.
+DILIGENT_BENCHMARK(GraphicsTools_XXH128Hasher, ShaderCreateInfo)
+{
+    constexpr char Source[] = R"(
+cbuffer Constants
+{
+    float4x4 g_WorldViewProj;
+};
+
+struct VSInput
+{
+    float3 Pos : ATTRIB0;
+    float2 UV  : ATTRIB1;
+};
+
+void main(in VSInput VSIn, out float4 Pos : SV_Position, out float2 UV : TEX_COORD)
+{
+    Pos = mul(float4(VSIn.Pos, 1.0), g_WorldViewProj);
+    UV  = VSIn.UV;
+}
+)";
+
+    const ShaderMacro Macros[] = {
+        {"USE_SHADOWS", "1"},
+        {"NUM_LIGHTS", "4"},
+    };
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.Source                       = Source;
+    ShaderCI.SourceLength                 = sizeof(Source) - 1;
+    ShaderCI.EntryPoint                   = "main";
+    ShaderCI.Macros                       = {Macros, static_cast<Uint32>(std::size(Macros))};
+    ShaderCI.Desc                         = {"Benchmark VS", SHADER_TYPE_VERTEX, true};
+    ShaderCI.SourceLanguage               = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler               = SHADER_COMPILER_DEFAULT;
+    ShaderCI.CompileFlags                 = SHADER_COMPILE_FLAG_NONE;
+    ShaderCI.LoadConstantBufferReflection = true;
+
+    while (State.KeepRunning())
+    {
+        XXH128State Hasher;
+        Hasher.Update(ShaderCI);
+        DoNotOptimize(Hasher.Digest());
+    }
+    State.SetItemsProcessed(State.GetMaxIterations());
+    State.SetBytesProcessed(State.GetMaxIterations() * ShaderCI.SourceLength);
+}
+
+DILIGENT_BENCHMARK(GraphicsTools_XXH128Hasher, GraphicsPipelineDesc)
+{
+    GraphicsPipelineDesc Desc;
+    Desc.NumRenderTargets             = 2;
+    Desc.RTVFormats[0]                = TEX_FORMAT_RGBA8_UNORM_SRGB;
+    Desc.RTVFormats[1]                = TEX_FORMAT_RGBA16_FLOAT;
+    Desc.DSVFormat                    = TEX_FORMAT_D32_FLOAT;
+    Desc.RasterizerDesc.CullMode      = CULL_MODE_BACK;
+    Desc.DepthStencilDesc.DepthEnable = true;
+
+    while (State.KeepRunning())
+    {
+        XXH128State Hasher;
+        Hasher.Update(Desc);
+        DoNotOptimize(Hasher.Digest());
+    }
+    State.SetItemsProcessed(State.GetMaxIterations());
+}
+
+} // namespace
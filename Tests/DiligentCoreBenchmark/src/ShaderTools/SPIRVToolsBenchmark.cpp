@@ -0,0 +1,146 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "SPIRVTools.hpp"
+#include "GLSLangUtils.hpp"
+#include "ThreadPool.hpp"
+
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "BenchmarkHLSLSource.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+// The number of modules processed by every benchmark iteration, which
+// roughly corresponds to the shaders of a few pipelines.
+constexpr size_t NumModules = 32;
+
+constexpr SPIRV_OPTIMIZATION_FLAGS BenchmarkPasses = SPIRV_OPTIMIZATION_FLAG_PERFORMANCE | SPIRV_OPTIMIZATION_FLAG_STRIP_REFLECTION;
+
+const std::vector<uint32_t>& GetBenchmarkSPIRV()
+{
+    static const std::vector<uint32_t> SPIRV = []() {
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.Source         = BenchmarkHLSLSource;
+        ShaderCI.Desc           = {"SPIRV tools benchmark", SHADER_TYPE_PIXEL};
+        ShaderCI.EntryPoint     = "main";
+
+        GLSLangUtils::InitializeGlslang();
+        auto Code = GLSLangUtils::HLSLtoSPIRV(ShaderCI, GLSLangUtils::SpirvVersion::Vk100, nullptr, nullptr);
+        GLSLangUtils::FinalizeGlslang();
+        return Code;
+    }();
+    return SPIRV;
+}
+
+const SPIRVBindingRemapping& GetBenchmarkRemapping()
+{
+    static const SPIRVBindingRemapping Remapping = []() {
+        const char* Names[] = {
+            "cbCameraAttribs",
+            "cbLights",
+            "g_BaseColorMap",
+            "g_BaseColorMap_sampler",
+            "g_NormalMap",
+            "g_NormalMap_sampler",
+            "g_ShadowMap",
+            "g_ShadowMap_sampler",
+        };
+        SPIRVBindingRemapping Mapping;
+        for (Uint32 i = 0; i < _countof(Names); ++i)
+            Mapping.emplace(Names[i], SPIRVResourceBinding{i % 2, i});
+        return Mapping;
+    }();
+    return Remapping;
+}
+
+// Optimizes and remaps the modules one by one on the calling thread, which is how
+// the modules were processed before the batch API.
+DILIGENT_BENCHMARK(ShaderTools_SPIRVTools, OptimizeSPIRV)
+{
+    const auto& SPIRV     = GetBenchmarkSPIRV();
+    const auto& Remapping = GetBenchmarkRemapping();
+    if (SPIRV.empty())
+    {
+        State.SkipWithError("Failed to compile the benchmark shader");
+        return;
+    }
+
+    while (State.KeepRunning())
+    {
+        for (size_t i = 0; i < NumModules; ++i)
+        {
+            auto OptimizedSPIRV = OptimizeSPIRV(SPIRV, SPV_ENV_MAX, BenchmarkPasses);
+            RemapSPIRVBindings(OptimizedSPIRV, Remapping);
+            DoNotOptimize(OptimizedSPIRV.data());
+        }
+    }
+    State.SetItemsProcessed(State.GetMaxIterations() * NumModules);
+    State.SetBytesProcessed(State.GetMaxIterations() * NumModules * SPIRV.size() * sizeof(SPIRV[0]));
+}
+
+// Processes the same modules with OptimizeSPIRVBatch(). The argument is the number
+// of worker threads in the pool; 0 runs the batch on the calling thread only.
+DILIGENT_BENCHMARK_ARGS(ShaderTools_SPIRVTools, OptimizeSPIRVBatch, 0, 2, 4, 8)
+{
+    const auto& SPIRV     = GetBenchmarkSPIRV();
+    const auto& Remapping = GetBenchmarkRemapping();
+    if (SPIRV.empty())
+    {
+        State.SkipWithError("Failed to compile the benchmark shader");
+        return;
+    }
+
+    const Uint32 NumThreads = static_cast<Uint32>(State.GetArg());
+
+    RefCntAutoPtr<IThreadPool> pThreadPool;
+    if (NumThreads > 0)
+        pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads});
+
+    std::vector<SPIRVBatchItem> Items(NumModules);
+    for (auto& Item : Items)
+    {
+        Item.pSrcSPIRV  = &SPIRV;
+        Item.Passes     = BenchmarkPasses;
+        Item.pRemapping = &Remapping;
+    }
+
+    while (State.KeepRunning())
+    {
+        OptimizeSPIRVBatch(Items.data(), Items.size(), pThreadPool);
+        DoNotOptimize(Items.front().SPIRV.data());
+    }
+    State.SetItemsProcessed(State.GetMaxIterations() * NumModules);
+    State.SetBytesProcessed(State.GetMaxIterations() * NumModules * SPIRV.size() * sizeof(SPIRV[0]));
+}
+
+} // namespace
@@ -0,0 +1,180 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "LockFreeStack.hpp"
+
+#include <vector>
+#include <thread>
+#include <memory>
+#include <atomic>
+#include <algorithm>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(Common_LockFreeStack, PushPop)
+{
+    Threading::LockFreeStack<int> Stack;
+    EXPECT_TRUE(Stack.IsEmpty());
+    EXPECT_EQ(Stack.PopAll([](int) {}), size_t{0});
+
+    for (int i = 0; i < 5; ++i)
+        Stack.Push(i);
+    EXPECT_FALSE(Stack.IsEmpty());
+    EXPECT_EQ(Stack.GetSize(), size_t{5});
+
+    std::vector<int> Items;
+    EXPECT_EQ(Stack.Pop(2, [&](int Item) { Items.push_back(Item); }), size_t{2});
+    EXPECT_EQ(Items, (std::vector<int>{4, 3}));
+    EXPECT_EQ(Stack.GetSize(), size_t{3});
+
+    EXPECT_EQ(Stack.Pop(0, [&](int Item) { Items.push_back(Item); }), size_t{0});
+    EXPECT_EQ(Stack.GetSize(), size_t{3});
+
+    Items.clear();
+    EXPECT_EQ(Stack.Pop(10, [&](int Item) { Items.push_back(Item); }), size_t{3});
+    std::sort(Items.begin(), Items.end());
+    EXPECT_EQ(Items, (std::vector<int>{0, 1, 2}));
+    EXPECT_TRUE(Stack.IsEmpty());
+    EXPECT_EQ(Stack.GetSize(), size_t{0});
+}
+
+TEST(Common_LockFreeStack, MoveOnly)
+{
+    Threading::LockFreeStack<std::unique_ptr<int>> Stack;
+    Stack.Push(std::make_unique<int>(1));
+    Stack.Push(new int{2});
+
+    std::vector<int> Items;
+    Stack.PopAll([&](std::unique_ptr<int>&& pItem) { Items.push_back(*pItem); });
+    std::sort(Items.begin(), Items.end());
+    EXPECT_EQ(Items, (std::vector<int>{1, 2}));
+
+    // Items that were not popped are released by the destructor
+    Stack.Push(std::make_unique<int>(3));
+}
+
+TEST(Common_LockFreeStack, RawAllocator)
+{
+    class CountingAllocator final : public IMemoryAllocator
+    {
+    public:
+        virtual void* Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override
+        {
+            ++NumAllocations;
+            return DefaultRawMemoryAllocator::GetAllocator().Allocate(Size, dbgDescription, dbgFileName, dbgLineNumber);
+        }
+
+        virtual void Free(void* Ptr) override
+        {
+            ++NumFrees;
+            DefaultRawMemoryAllocator::GetAllocator().Free(Ptr);
+        }
+
+        int NumAllocations = 0;
+        int NumFrees       = 0;
+    } Allocator;
+
+    {
+        Threading::LockFreeStack<std::unique_ptr<int>> Stack{Allocator};
+        for (int i = 0; i < 4; ++i)
+            Stack.Push(std::make_unique<int>(i));
+        // Nodes are allocated in blocks
+        EXPECT_EQ(Allocator.NumAllocations, 1);
+
+        // Popped nodes are kept for reuse
+        EXPECT_EQ(Stack.Pop(2, [](std::unique_ptr<int>&&) {}), size_t{2});
+        EXPECT_EQ(Allocator.NumFrees, 0);
+        for (int i = 0; i < 2; ++i)
+            Stack.Push(std::make_unique<int>(i));
+        EXPECT_EQ(Allocator.NumAllocations, 1);
+
+        for (int i = 0; i < 64; ++i)
+            Stack.Push(std::make_unique<int>(i));
+        EXPECT_GT(Allocator.NumAllocations, 1);
+        EXPECT_EQ(Allocator.NumFrees, 0);
+        EXPECT_EQ(Stack.GetSize(), size_t{68});
+    }
+    // All blocks and the remaining items are released by the destructor
+    EXPECT_EQ(Allocator.NumFrees, Allocator.NumAllocations);
+}
+
+TEST(Common_LockFreeStack, ThreadContention)
+{
+    const auto NumCores   = std::thread::hardware_concurrency();
+    const auto NumThreads = std::max(NumCores, 2u) * 2;
+    LOG_INFO_MESSAGE("Running LockFreeStack test on ", NumThreads, " threads / ", NumCores, " cores");
+
+    static constexpr size_t NumThreadIterations = 16384;
+
+    // Every thread pushes its own values, then pops and pushes back items in batches
+    // of different sizes, like a context that recycles pools through the global stack.
+    Threading::LockFreeStack<size_t> Stack;
+
+    std::vector<std::thread> Workers;
+    Workers.reserve(NumThreads);
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Workers.emplace_back(
+            [&Stack, t] //
+            {
+                std::vector<size_t> Batch;
+                for (size_t i = 0; i < NumThreadIterations; ++i)
+                {
+                    Stack.Push(t * NumThreadIterations + i);
+                    if ((i % 4) == 3)
+                    {
+                        Stack.Pop(1 + i % 7, [&](size_t Item) { Batch.push_back(Item); });
+                        for (auto Item : Batch)
+                            Stack.Push(Item);
+                        Batch.clear();
+                    }
+                }
+            });
+    }
+
+    for (auto& Thread : Workers)
+        Thread.join();
+
+    // Every item must be in the stack exactly once
+    std::vector<size_t> Items;
+    Items.reserve(NumThreadIterations * NumThreads);
+    EXPECT_EQ(Stack.PopAll([&](size_t Item) { Items.push_back(Item); }), NumThreadIterations * NumThreads);
+    std::sort(Items.begin(), Items.end());
+
+    bool AllItemsPresent = Items.size() == NumThreadIterations * NumThreads;
+    for (size_t i = 0; i < Items.size() && AllItemsPresent; ++i)
+        AllItemsPresent = (Items[i] == i);
+    EXPECT_TRUE(AllItemsPresent);
+    EXPECT_TRUE(Stack.IsEmpty());
+    EXPECT_EQ(Stack.GetSize(), size_t{0});
+}
+
+} // namespace
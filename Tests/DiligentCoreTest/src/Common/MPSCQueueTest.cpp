@@ -0,0 +1,168 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "MPSCQueue.hpp"
+
+#include <vector>
+#include <thread>
+#include <memory>
+#include <atomic>
+#include <algorithm>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(Common_MPSCQueue, PushPop)
+{
+    Threading::MPSCQueue<int> Queue;
+    EXPECT_TRUE(Queue.IsEmpty());
+    EXPECT_EQ(Queue.PopAll([](int) {}), size_t{0});
+
+    for (int i = 0; i < 5; ++i)
+        Queue.Push(i);
+    EXPECT_FALSE(Queue.IsEmpty());
+    EXPECT_EQ(Queue.GetSize(), size_t{5});
+
+    std::vector<int> Items;
+    EXPECT_EQ(Queue.PopAll([&](int Item) { Items.push_back(Item); }), size_t{5});
+    EXPECT_EQ(Items, (std::vector<int>{0, 1, 2, 3, 4}));
+    EXPECT_TRUE(Queue.IsEmpty());
+    EXPECT_EQ(Queue.GetSize(), size_t{0});
+}
+
+TEST(Common_MPSCQueue, MoveOnly)
+{
+    Threading::MPSCQueue<std::unique_ptr<int>> Queue;
+    Queue.Push(std::make_unique<int>(1));
+    Queue.Push(new int{2});
+
+    std::vector<int> Items;
+    Queue.PopAll([&](std::unique_ptr<int>&& pItem) { Items.push_back(*pItem); });
+    EXPECT_EQ(Items, (std::vector<int>{1, 2}));
+
+    // Items that were not popped are released by the destructor
+    Queue.Push(std::make_unique<int>(3));
+}
+
+TEST(Common_MPSCQueue, RawAllocator)
+{
+    class CountingAllocator final : public IMemoryAllocator
+    {
+    public:
+        virtual void* Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override
+        {
+            ++NumAllocations;
+            return DefaultRawMemoryAllocator::GetAllocator().Allocate(Size, dbgDescription, dbgFileName, dbgLineNumber);
+        }
+
+        virtual void Free(void* Ptr) override
+        {
+            ++NumFrees;
+            DefaultRawMemoryAllocator::GetAllocator().Free(Ptr);
+        }
+
+        int NumAllocations = 0;
+        int NumFrees       = 0;
+    } Allocator;
+
+    {
+        Threading::MPSCQueue<std::unique_ptr<int>> Queue{Allocator};
+        for (int i = 0; i < 4; ++i)
+            Queue.Push(std::make_unique<int>(i));
+        EXPECT_EQ(Allocator.NumAllocations, 4);
+
+        EXPECT_EQ(Queue.PopAll([](std::unique_ptr<int>&&) {}), size_t{4});
+        EXPECT_EQ(Allocator.NumFrees, 4);
+
+        Queue.Push(std::make_unique<int>(4));
+    }
+    // The remaining node is released by the destructor
+    EXPECT_EQ(Allocator.NumAllocations, 5);
+    EXPECT_EQ(Allocator.NumFrees, 5);
+}
+
+TEST(Common_MPSCQueue, ThreadContention)
+{
+    const auto NumCores   = std::thread::hardware_concurrency();
+    const auto NumThreads = std::max(NumCores, 2u) * 2;
+    LOG_INFO_MESSAGE("Running MPSCQueue test on ", NumThreads, " threads / ", NumCores, " cores");
+
+    struct Item
+    {
+        size_t Thread;
+        size_t Value;
+    };
+    Threading::MPSCQueue<Item> Queue;
+
+    static constexpr size_t NumThreadIterations = 16384;
+
+    std::atomic<size_t>      NumFinishedThreads{0};
+    std::vector<std::thread> Workers;
+    Workers.reserve(NumThreads);
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Workers.emplace_back(
+            [&Queue, &NumFinishedThreads, t] //
+            {
+                for (size_t i = 0; i < NumThreadIterations; ++i)
+                    Queue.Push(Item{t, i});
+                NumFinishedThreads.fetch_add(1);
+            });
+    }
+
+    // Items from every producer must be consumed in the order they were pushed
+    std::vector<size_t> NextValue(NumThreads);
+
+    size_t NumItems     = 0;
+    bool   OrderIsValid = true;
+    bool   SizeIsValid  = true;
+    auto   Consume      = [&](Item&& It) {
+        OrderIsValid         = OrderIsValid && (It.Value == NextValue[It.Thread]);
+        NextValue[It.Thread] = It.Value + 1;
+        ++NumItems;
+    };
+    while (NumFinishedThreads.load() < NumThreads)
+    {
+        Queue.PopAll(Consume);
+        // The size must never underflow when an item is popped before the producer updates the counter
+        SizeIsValid = SizeIsValid && Queue.GetSize() <= NumThreadIterations * NumThreads;
+    }
+
+    for (auto& Thread : Workers)
+        Thread.join();
+    Queue.PopAll(Consume);
+
+    EXPECT_TRUE(OrderIsValid);
+    EXPECT_TRUE(SizeIsValid);
+    EXPECT_EQ(NumItems, NumThreadIterations * NumThreads);
+    EXPECT_TRUE(Queue.IsEmpty());
+}
+
+} // namespace
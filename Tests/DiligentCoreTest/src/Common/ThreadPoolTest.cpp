@@ -57,6 +57,7 @@ TEST(Common_ThreadPool, EnqueueTask)
 
     auto pThreadPool = CreateThreadPool(PoolCI);
     ASSERT_NE(pThreadPool, nullptr);
+    EXPECT_EQ(pThreadPool->GetThreadCount(), NumThreads);
 
     std::array<std::atomic<float>, NumTasks>        Results{};
     std::array<std::atomic<bool>, NumTasks>         WorkComplete{};
@@ -94,6 +95,9 @@ TEST(Common_ThreadPool, EnqueueTask)
     // Check that multiple calls to WaitForAllTasks work fine
     pThreadPool->WaitForAllTasks();
 
+    pThreadPool->StopThreads();
+    EXPECT_EQ(pThreadPool->GetThreadCount(), 0u);
+
     pThreadPool.Release();
     EXPECT_EQ(NumThreadsFinished.load(), PoolCI.NumThreads);
 }
@@ -106,6 +110,7 @@ TEST(Common_ThreadPool, ProcessTask)
 
     auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{0});
     ASSERT_NE(pThreadPool, nullptr);
+    EXPECT_EQ(pThreadPool->GetThreadCount(), 0u);
 
     std::vector<std::thread> WorkerThreads(NumThreads);
     for (Uint32 i = 0; i < NumThreads; ++i)
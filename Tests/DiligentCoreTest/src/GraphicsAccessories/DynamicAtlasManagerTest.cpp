@@ -465,4 +465,184 @@ TEST(GraphicsAccessories_DynamicAtlasManager, AllocateRandom)
     }
 }
 
+TEST(GraphicsAccessories_DynamicAtlasManager, Skyline_Allocate)
+{
+    DynamicAtlasManager Mgr{16, 8, DynamicAtlasManager::PackingMode::Skyline};
+    EXPECT_TRUE(Mgr.IsEmpty());
+    EXPECT_EQ(Mgr.GetFreeRegionCount(), 1U);
+
+    auto R0 = Mgr.Allocate(4, 4);
+    EXPECT_EQ(R0, Region(0, 0, 4, 4));
+    auto R1 = Mgr.Allocate(4, 2);
+    EXPECT_EQ(R1, Region(4, 0, 4, 2));
+    auto R2 = Mgr.Allocate(8, 8);
+    EXPECT_EQ(R2, Region(8, 0, 8, 8));
+    // The lowest position is above R1
+    auto R3 = Mgr.Allocate(4, 2);
+    EXPECT_EQ(R3, Region(4, 2, 4, 2));
+    auto R4 = Mgr.Allocate(8, 4);
+    EXPECT_EQ(R4, Region(0, 4, 8, 4));
+    EXPECT_TRUE(Mgr.Allocate(1, 1).IsEmpty());
+    EXPECT_EQ(Mgr.GetTotalFreeArea(), 0U);
+
+    // R1 is below R3 and can't be returned to the skyline
+    Mgr.Free(std::move(R1));
+    EXPECT_EQ(Mgr.GetTotalFreeArea(), 8U);
+
+    // Freed region is reused
+    auto R5 = Mgr.Allocate(2, 2);
+    EXPECT_EQ(R5, Region(4, 0, 2, 2));
+    Mgr.Free(std::move(R5));
+
+    // Freeing R4 and R3 lowers the skyline and returns R1 to it
+    Mgr.Free(std::move(R4));
+    Mgr.Free(std::move(R3));
+    EXPECT_EQ(Mgr.GetFreeRegionCount(), 3U);
+    auto R6 = Mgr.Allocate(4, 8);
+    EXPECT_EQ(R6, Region(4, 0, 4, 8));
+
+    Mgr.Free(std::move(R0));
+    Mgr.Free(std::move(R2));
+    Mgr.Free(std::move(R6));
+    EXPECT_TRUE(Mgr.IsEmpty());
+    EXPECT_EQ(Mgr.GetFreeRegionCount(), 1U);
+    auto R7 = Mgr.Allocate(16, 8);
+    EXPECT_EQ(R7, Region(0, 0, 16, 8));
+    Mgr.Free(std::move(R7));
+}
+
+TEST(GraphicsAccessories_DynamicAtlasManager, Skyline_AllocateRandom)
+{
+    DynamicAtlasManager Mgr{256, 256, DynamicAtlasManager::PackingMode::Skyline};
+    const Uint32        NumIterations = 10;
+    for (Uint32 i = 0; i < NumIterations; ++i)
+    {
+        FastRandInt         rnd{static_cast<unsigned int>(i), 1, 16};
+        std::vector<Region> Regions(i * 64);
+        for (auto& R : Regions)
+        {
+            R = Mgr.Allocate(rnd(), rnd());
+        }
+        // Release every other region first to exercise the reuse of freed regions
+        for (size_t r = 0; r < Regions.size(); r += 2)
+        {
+            if (!Regions[r].IsEmpty())
+                Mgr.Free(std::move(Regions[r]));
+        }
+        for (auto& R : Regions)
+        {
+            if (R.IsEmpty())
+                continue;
+            auto R2 = Mgr.Allocate(R.width, R.height);
+            Mgr.Free(std::move(R));
+            if (!R2.IsEmpty())
+                Mgr.Free(std::move(R2));
+        }
+        EXPECT_TRUE(Mgr.IsEmpty());
+    }
+}
+
+TEST(GraphicsAccessories_DynamicAtlasManager, AllocateBatch)
+{
+    for (auto Mode : {DynamicAtlasManager::PackingMode::Guillotine, DynamicAtlasManager::PackingMode::Skyline})
+    {
+        DynamicAtlasManager Mgr{64, 64, Mode};
+
+        std::vector<DynamicAtlasManager::RegionSize> Sizes(64);
+        FastRandInt                                  rnd{0, 1, 16};
+        for (auto& Size : Sizes)
+        {
+            Size.width  = rnd();
+            Size.height = rnd();
+        }
+
+        std::vector<Region> Regions(Sizes.size());
+        const auto          NumAllocated = Mgr.Allocate(Sizes.data(), static_cast<Uint32>(Sizes.size()), Regions.data());
+
+        Uint32 Count = 0;
+        for (size_t i = 0; i < Regions.size(); ++i)
+        {
+            const auto& R = Regions[i];
+            if (R.IsEmpty())
+                continue;
+            ++Count;
+            EXPECT_EQ(R.width, Sizes[i].width);
+            EXPECT_EQ(R.height, Sizes[i].height);
+            for (size_t j = i + 1; j < Regions.size(); ++j)
+            {
+                const auto& R1 = Regions[j];
+                const bool  Overlap =
+                    !R1.IsEmpty() &&
+                    R.x < R1.x + R1.width && R1.x < R.x + R.width &&
+                    R.y < R1.y + R1.height && R1.y < R.y + R.height;
+                EXPECT_FALSE(Overlap) << R << " overlaps " << R1;
+            }
+        }
+        EXPECT_EQ(Count, NumAllocated);
+
+        for (auto& R : Regions)
+        {
+            if (!R.IsEmpty())
+                Mgr.Free(std::move(R));
+        }
+        EXPECT_TRUE(Mgr.IsEmpty());
+    }
+}
+
+// Reports the fraction of the atlas area that is filled with glyph-like regions
+// before the first allocation fails.
+TEST(GraphicsAccessories_DynamicAtlasManager, OccupancyReport)
+{
+    constexpr Uint32 AtlasSize = 512;
+
+    std::vector<DynamicAtlasManager::RegionSize> Sizes(4096);
+    FastRandInt                                  rnd{0, 4, 32};
+    for (auto& Size : Sizes)
+    {
+        Size.width  = rnd();
+        Size.height = rnd();
+    }
+
+    auto GetOccupancy = [&](DynamicAtlasManager::PackingMode Mode, bool Batch) {
+        DynamicAtlasManager Mgr{AtlasSize, AtlasSize, Mode};
+        std::vector<Region> Regions(Sizes.size());
+        if (Batch)
+        {
+            Mgr.Allocate(Sizes.data(), static_cast<Uint32>(Sizes.size()), Regions.data());
+        }
+        else
+        {
+            for (size_t i = 0; i < Sizes.size(); ++i)
+            {
+                Regions[i] = Mgr.Allocate(Sizes[i].width, Sizes[i].height);
+                if (Regions[i].IsEmpty())
+                    break;
+            }
+        }
+        const auto TotalArea = Uint64{AtlasSize} * Uint64{AtlasSize};
+        const auto Occupancy = static_cast<double>(TotalArea - Mgr.GetTotalFreeArea()) / static_cast<double>(TotalArea);
+        for (auto& R : Regions)
+        {
+            if (!R.IsEmpty())
+                Mgr.Free(std::move(R));
+        }
+        return Occupancy;
+    };
+
+    const auto GuillotineOccupancy      = GetOccupancy(DynamicAtlasManager::PackingMode::Guillotine, false);
+    const auto GuillotineBatchOccupancy = GetOccupancy(DynamicAtlasManager::PackingMode::Guillotine, true);
+    const auto SkylineOccupancy         = GetOccupancy(DynamicAtlasManager::PackingMode::Skyline, false);
+    const auto SkylineBatchOccupancy    = GetOccupancy(DynamicAtlasManager::PackingMode::Skyline, true);
+
+    LOG_INFO_MESSAGE("Atlas occupancy (", AtlasSize, "x", AtlasSize, ", regions 4..32 px):",
+                     "\n    Guillotine:         ", GuillotineOccupancy * 100, '%',
+                     "\n    Guillotine (batch): ", GuillotineBatchOccupancy * 100, '%',
+                     "\n    Skyline:            ", SkylineOccupancy * 100, '%',
+                     "\n    Skyline (batch):    ", SkylineBatchOccupancy * 100, '%');
+
+    // Sorting the regions must not make packing worse
+    EXPECT_GE(SkylineBatchOccupancy, SkylineOccupancy);
+    EXPECT_GT(SkylineBatchOccupancy, 0.9);
+}
+
 } // namespace
@@ -26,6 +26,9 @@
  */
 
 #include <memory>
+#include <thread>
+#include <vector>
+#include <atomic>
 
 #include "ResourceReleaseQueue.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
@@ -128,4 +131,70 @@ TEST(GraphicsAccessories_ResourceReleaseQueue, GetFilterTypeLiteralName)
     }
 }
 
+TEST(GraphicsAccessories_ResourceReleaseQueue, BatchedRelease)
+{
+    static std::atomic<int> NumAlive{0};
+    struct Resource
+    {
+        Resource() { NumAlive.fetch_add(1); }
+        ~Resource() { NumAlive.fetch_sub(1); }
+    };
+
+    ResourceReleaseQueue<DynamicStaleResourceWrapper> Queue(DefaultRawMemoryAllocator::GetAllocator());
+
+    constexpr size_t NumThreads         = 4;
+    constexpr size_t NumResPerThread    = 1000;
+    constexpr size_t NumResPerCmdBuffer = NumResPerThread / 2;
+
+    // Release resources from multiple threads. The first half is released before
+    // command buffer 0 is submitted, the second half - before command buffer 1.
+    std::vector<std::thread> Threads;
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&Queue]() {
+            for (size_t i = 0; i < NumResPerThread; ++i)
+                Queue.SafeReleaseResource(std::unique_ptr<Resource>{new Resource}, i < NumResPerCmdBuffer ? 0 : 1);
+        });
+    }
+    for (auto& Thread : Threads)
+        Thread.join();
+
+    EXPECT_EQ(NumAlive, static_cast<int>(NumThreads * NumResPerThread));
+    EXPECT_EQ(Queue.GetStaleResourceCount(), NumThreads * NumResPerThread);
+    EXPECT_EQ(Queue.GetPendingReleaseResourceCount(), size_t{0});
+
+    // Resources are ordered by command buffer number within each thread only,
+    // so stop at the first resource released for command buffer 1.
+    Queue.DiscardStaleResources(0, 1);
+    EXPECT_GE(Queue.GetPendingReleaseResourceCount(), NumResPerCmdBuffer);
+    EXPECT_EQ(Queue.GetStaleResourceCount() + Queue.GetPendingReleaseResourceCount(), NumThreads * NumResPerThread);
+
+    Queue.DiscardStaleResources(1, 2);
+    EXPECT_EQ(Queue.GetStaleResourceCount(), size_t{0});
+    EXPECT_EQ(Queue.GetPendingReleaseResourceCount(), NumThreads * NumResPerThread);
+
+    // Nothing is released until the fence is signaled
+    EXPECT_EQ(Queue.Purge(0), size_t{0});
+    EXPECT_EQ(NumAlive, static_cast<int>(NumThreads * NumResPerThread));
+
+    // Release at most 100 resources
+    EXPECT_EQ(Queue.Purge(2, 100), size_t{100});
+    EXPECT_EQ(NumAlive, static_cast<int>(NumThreads * NumResPerThread - 100));
+
+    auto Stats = Queue.GetStats();
+    EXPECT_EQ(Stats.StaleResourceCount, size_t{0});
+    EXPECT_EQ(Stats.PendingReleaseResourceCount, NumThreads * NumResPerThread - 100);
+    EXPECT_EQ(Stats.ReleasedResourceCount, Uint64{100});
+    EXPECT_EQ(Stats.LastPurgeReleasedCount, size_t{100});
+
+    EXPECT_EQ(Queue.Purge(2), NumThreads * NumResPerThread - 100);
+    EXPECT_EQ(NumAlive, 0);
+
+    Stats = Queue.GetStats();
+    EXPECT_EQ(Stats.PendingReleaseResourceCount, size_t{0});
+    EXPECT_EQ(Stats.ReleasedResourceCount, Uint64{NumThreads * NumResPerThread});
+    EXPECT_EQ(Stats.LastPurgeReleasedCount, NumThreads * NumResPerThread - 100);
+    EXPECT_GE(Stats.TotalPurgeTimeNs, Stats.LastPurgeTimeNs);
+}
+
 } // namespace
@@ -28,6 +28,10 @@
 #include "RingBuffer.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
 
+#include <thread>
+#include <vector>
+#include <algorithm>
+
 #include "gtest/gtest.h"
 
 using namespace Diligent;
@@ -294,4 +298,92 @@ TEST(GraphicsAccessories_RingBuffer, AllocDealloc)
     }
 }
 
+TEST(GraphicsAccessories_AtomicRingBuffer, AllocDealloc)
+{
+    const auto InvalidOffset = AtomicRingBuffer::InvalidOffset;
+    using OffsetType         = AtomicRingBuffer::OffsetType;
+
+    AtomicRingBuffer RB(1024, DefaultRawMemoryAllocator::GetAllocator());
+
+    EXPECT_EQ(RB.Allocate(120, 16), OffsetType{0});
+    EXPECT_EQ(RB.Allocate(10, 1), OffsetType{128});
+    EXPECT_EQ(RB.GetUsedSize(), OffsetType{138});
+    RB.FinishCurrentFrame(1);
+
+    EXPECT_EQ(RB.Allocate(800, 16), OffsetType{144});
+    //                                     h
+    //  |                                  |    |
+    //  0                                 944  1024
+    RB.FinishCurrentFrame(2);
+
+    // Not enough space at the end, and the beginning is still in use
+    EXPECT_EQ(RB.Allocate(128, 1), InvalidOffset);
+
+    RB.ReleaseCompletedFrames(1);
+    //             t                       h
+    //  |          |                       |    |
+    //  0         138                     944  1024
+    // The new head must not reach the tail, so the buffer can't be filled completely
+    EXPECT_EQ(RB.Allocate(138, 1), InvalidOffset);
+    EXPECT_EQ(RB.Allocate(128, 1), OffsetType{0});
+    EXPECT_EQ(RB.GetUsedSize(), OffsetType{1024 - 138 + 128});
+    RB.FinishCurrentFrame(3);
+
+    RB.ReleaseCompletedFrames(3);
+    EXPECT_TRUE(RB.IsEmpty());
+    EXPECT_EQ(RB.GetUsedSize(), OffsetType{0});
+}
+
+TEST(GraphicsAccessories_AtomicRingBuffer, MultithreadedAlloc)
+{
+    using OffsetType = AtomicRingBuffer::OffsetType;
+
+    constexpr OffsetType BufferSize        = 1 << 17;
+    constexpr size_t     NumThreads        = 8;
+    constexpr size_t     NumFrames         = 16;
+    constexpr size_t     NumAllocsPerFrame = 64;
+
+    AtomicRingBuffer RB(BufferSize, DefaultRawMemoryAllocator::GetAllocator());
+    for (Uint64 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        std::vector<std::vector<std::pair<OffsetType, OffsetType>>> Allocations(NumThreads);
+
+        std::vector<std::thread> Threads;
+        for (size_t t = 0; t < NumThreads; ++t)
+        {
+            Threads.emplace_back([&RB, &Allocations, t, Frame]() {
+                for (size_t i = 0; i < NumAllocsPerFrame; ++i)
+                {
+                    const OffsetType Size   = 16 + ((t + i + Frame) % 7) * 8;
+                    const auto       Offset = RB.Allocate(Size, 16);
+                    if (Offset != AtomicRingBuffer::InvalidOffset)
+                        Allocations[t].emplace_back(Offset, Size);
+                }
+            });
+        }
+        for (auto& Thread : Threads)
+            Thread.join();
+
+        std::vector<std::pair<OffsetType, OffsetType>> AllAllocations;
+        for (const auto& ThreadAllocations : Allocations)
+            AllAllocations.insert(AllAllocations.end(), ThreadAllocations.begin(), ThreadAllocations.end());
+        EXPECT_EQ(AllAllocations.size(), NumThreads * NumAllocsPerFrame);
+
+        // Allocations made in the same frame must not overlap
+        std::sort(AllAllocations.begin(), AllAllocations.end());
+        for (size_t i = 1; i < AllAllocations.size(); ++i)
+            EXPECT_LE(AllAllocations[i - 1].first + AllAllocations[i - 1].second, AllAllocations[i].first);
+        for (const auto& Allocation : AllAllocations)
+            EXPECT_LE(Allocation.first + Allocation.second, BufferSize);
+
+        RB.FinishCurrentFrame(Frame);
+        // Keep two frames in flight
+        if (Frame >= 2)
+            RB.ReleaseCompletedFrames(Frame - 2);
+    }
+
+    RB.ReleaseCompletedFrames(NumFrames);
+    EXPECT_TRUE(RB.IsEmpty());
+}
+
 } // namespace
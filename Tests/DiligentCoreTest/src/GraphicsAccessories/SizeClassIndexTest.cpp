@@ -0,0 +1,226 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "SizeClassIndex.hpp"
+#include "VariableSizeAllocationsManager.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+struct TestPage
+{
+    Uint64                             MaxFreeBlockSize = 0;
+    SizeClassIndex<TestPage>::Location Loc;
+};
+
+TEST(GraphicsAccessories_SizeClassIndex, GetSizeClass)
+{
+    using IndexType = SizeClassIndex<TestPage>;
+    EXPECT_EQ(IndexType::GetSizeClass(1), 0u);
+    EXPECT_EQ(IndexType::GetSizeClass(2), 1u);
+    EXPECT_EQ(IndexType::GetSizeClass(3), 1u);
+    EXPECT_EQ(IndexType::GetSizeClass(4), 2u);
+    EXPECT_EQ(IndexType::GetSizeClass(1023), 9u);
+    EXPECT_EQ(IndexType::GetSizeClass(1024), 10u);
+    EXPECT_EQ(IndexType::GetSizeClass(Uint64{1} << 40), 40u);
+}
+
+TEST(GraphicsAccessories_SizeClassIndex, UpdateRemove)
+{
+    SizeClassIndex<TestPage> Index;
+    EXPECT_TRUE(Index.IsEmpty());
+
+    TestPage Pages[3];
+    Index.Update(Pages[0], Pages[0].Loc, 100);
+    Index.Update(Pages[1], Pages[1].Loc, 120);
+    Index.Update(Pages[2], Pages[2].Loc, 1000);
+    EXPECT_EQ(Index.GetSize(), size_t{3});
+    EXPECT_EQ(Pages[0].Loc.SizeClass, 6u);
+    EXPECT_EQ(Pages[1].Loc.SizeClass, 6u);
+    EXPECT_EQ(Pages[2].Loc.SizeClass, 9u);
+
+    // Removing the first page in the bucket moves the last one in its place
+    Index.Remove(Pages[0].Loc);
+    EXPECT_FALSE(Pages[0].Loc.IsValid());
+    EXPECT_EQ(Pages[1].Loc.Pos, 0u);
+    EXPECT_EQ(Index.GetSize(), size_t{2});
+
+    // Removing a page that is not in the index is a no-op
+    Index.Remove(Pages[0].Loc);
+    EXPECT_EQ(Index.GetSize(), size_t{2});
+
+    // Zero free space removes the page
+    Index.Update(Pages[1], Pages[1].Loc, 0);
+    EXPECT_FALSE(Pages[1].Loc.IsValid());
+
+    Index.Update(Pages[2], Pages[2].Loc, 5000);
+    EXPECT_EQ(Pages[2].Loc.SizeClass, 12u);
+    Index.Remove(Pages[2].Loc);
+    EXPECT_TRUE(Index.IsEmpty());
+}
+
+TEST(GraphicsAccessories_SizeClassIndex, Find)
+{
+    SizeClassIndex<TestPage> Index;
+    EXPECT_EQ(Index.FindGuaranteed(1), nullptr);
+    EXPECT_EQ(Index.FindCandidate(1), nullptr);
+
+    TestPage Small, Medium, Large;
+    Index.Update(Small, Small.Loc, 100);   // Class 6
+    Index.Update(Medium, Medium.Loc, 600); // Class 9
+    Index.Update(Large, Large.Loc, 5000);  // Class 12
+
+    // All pages in class 7 and above have at least 128 bytes, the smallest one is picked
+    EXPECT_EQ(Index.FindGuaranteed(128), &Medium);
+    EXPECT_EQ(Index.FindGuaranteed(100), &Medium);
+    EXPECT_EQ(Index.FindGuaranteed(64), &Small);
+    EXPECT_EQ(Index.FindGuaranteed(600), &Large);
+    EXPECT_EQ(Index.FindGuaranteed(4096), &Large);
+    EXPECT_EQ(Index.FindGuaranteed(4097), nullptr);
+    EXPECT_EQ(Index.FindGuaranteed(Uint64{1} << 63), nullptr);
+    EXPECT_EQ(Index.FindGuaranteed((Uint64{1} << 63) + 1), nullptr);
+
+    // Candidates come from the same class and may not fit
+    EXPECT_EQ(Index.FindCandidate(100), &Small);
+    EXPECT_EQ(Index.FindCandidate(120), &Small);
+    EXPECT_EQ(Index.FindCandidate(520), &Medium);
+    EXPECT_EQ(Index.FindCandidate(2000), nullptr);
+
+    Index.Remove(Small.Loc);
+    Index.Remove(Medium.Loc);
+    Index.Remove(Large.Loc);
+}
+
+TEST(GraphicsAccessories_SizeClassIndex, AllocatePages)
+{
+    struct Page
+    {
+        explicit Page(size_t Size) :
+            Mgr{Size, DefaultRawMemoryAllocator::GetAllocator()}
+        {}
+        VariableSizeAllocationsManager Mgr;
+        SizeClassIndex<Page>::Location Loc;
+    };
+
+    constexpr size_t PageSize = 1 << 16;
+
+    SizeClassIndex<Page>               Index;
+    std::vector<std::unique_ptr<Page>> Pages;
+
+    struct AllocationInfo
+    {
+        Page*                                      pPage;
+        VariableSizeAllocationsManager::Allocation Alloc;
+    };
+    std::vector<AllocationInfo> Allocations;
+
+    auto Allocate = [&](size_t Size, size_t Alignment) {
+        const auto Required = AlignUp(Size, Alignment) + Alignment - 1;
+
+        VariableSizeAllocationsManager::Allocation Alloc;
+
+        Page* pPage = Index.FindCandidate(Required);
+        if (pPage != nullptr)
+            Alloc = pPage->Mgr.Allocate(Size, Alignment);
+
+        if (!Alloc.IsValid())
+        {
+            pPage = Index.FindGuaranteed(Required);
+            if (pPage != nullptr)
+            {
+                Alloc = pPage->Mgr.Allocate(Size, Alignment);
+                // Pages from the guaranteed size classes must always fit the allocation
+                EXPECT_TRUE(Alloc.IsValid());
+            }
+        }
+
+        if (!Alloc.IsValid())
+        {
+            Pages.emplace_back(new Page{PageSize});
+            pPage = Pages.back().get();
+            Alloc = pPage->Mgr.Allocate(Size, Alignment);
+            EXPECT_TRUE(Alloc.IsValid());
+        }
+
+        EXPECT_LE(AlignUp(Alloc.UnalignedOffset, Alignment) + Size, Alloc.UnalignedOffset + Alloc.Size);
+        Index.Update(*pPage, pPage->Loc, pPage->Mgr.GetMaxFreeBlockSize());
+        Allocations.push_back({pPage, std::move(Alloc)});
+    };
+
+    auto Free = [&](size_t i) {
+        auto& Info = Allocations[i];
+        Info.pPage->Mgr.Free(std::move(Info.Alloc));
+        Index.Update(*Info.pPage, Info.pPage->Loc, Info.pPage->Mgr.GetMaxFreeBlockSize());
+        Allocations[i] = std::move(Allocations.back());
+        Allocations.pop_back();
+    };
+
+    std::mt19937 gen{0};
+    for (size_t i = 0; i < 5000; ++i)
+    {
+        if (!Allocations.empty() && gen() % 3 == 0)
+        {
+            Free(gen() % Allocations.size());
+        }
+        else
+        {
+            const size_t Size      = 1 + gen() % 4096;
+            const size_t Alignment = size_t{1} << (gen() % 9);
+            Allocate(Size, Alignment);
+        }
+    }
+
+    // The index must reflect the largest free block of every page
+    for (const auto& pPage : Pages)
+    {
+        const auto MaxFreeBlockSize = pPage->Mgr.GetMaxFreeBlockSize();
+        if (MaxFreeBlockSize == 0)
+            EXPECT_FALSE(pPage->Loc.IsValid());
+        else
+            EXPECT_EQ(pPage->Loc.SizeClass, SizeClassIndex<Page>::GetSizeClass(MaxFreeBlockSize));
+    }
+
+    while (!Allocations.empty())
+        Free(Allocations.size() - 1);
+
+    for (const auto& pPage : Pages)
+    {
+        EXPECT_TRUE(pPage->Mgr.IsEmpty());
+        EXPECT_EQ(pPage->Loc.SizeClass, SizeClassIndex<Page>::GetSizeClass(PageSize));
+    }
+    EXPECT_EQ(Index.GetSize(), Pages.size());
+}
+
+} // namespace
@@ -249,4 +249,70 @@ TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, Free)
     }
 }
 
+TEST(GraphicsAccessories_VariableSizeGPUAllocationsManager, AllocateBelowShrink)
+{
+    auto& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    using OffsetType = VariableSizeAllocationsManager::OffsetType;
+
+    {
+        VariableSizeAllocationsManager ListMgr(128, Allocator);
+        EXPECT_EQ(ListMgr.GetTailFreeSize(), OffsetType{128});
+
+        VariableSizeAllocationsManager::Allocation al[8];
+        for (size_t o = 0; o < _countof(al); ++o)
+            al[o] = ListMgr.Allocate(16, 4);
+        EXPECT_TRUE(ListMgr.IsFull());
+        EXPECT_EQ(ListMgr.GetTailFreeSize(), OffsetType{0});
+
+        ListMgr.Free(std::move(al[1]));
+        ListMgr.Free(std::move(al[3]));
+        ListMgr.Free(std::move(al[7]));
+        EXPECT_EQ(ListMgr.GetTailFreeSize(), OffsetType{16});
+
+        // There is no free block below offset 16
+        auto a = ListMgr.AllocateBelow(16, 4, al[0].UnalignedOffset);
+        EXPECT_FALSE(a.IsValid());
+
+        // The lowest suitable block must be selected
+        a = ListMgr.AllocateBelow(16, 4, al[6].UnalignedOffset);
+        EXPECT_EQ(a.UnalignedOffset, OffsetType{16});
+        EXPECT_EQ(a.Size, OffsetType{16});
+        ListMgr.Free(std::move(al[6]));
+        al[6] = a;
+        EXPECT_EQ(ListMgr.GetTailFreeSize(), OffsetType{32});
+
+        a = ListMgr.AllocateBelow(16, 4, al[5].UnalignedOffset);
+        EXPECT_EQ(a.UnalignedOffset, OffsetType{48});
+        ListMgr.Free(std::move(al[5]));
+        al[5] = a;
+        EXPECT_EQ(ListMgr.GetTailFreeSize(), OffsetType{48});
+
+        // The block is too large for any free space below
+        a = ListMgr.AllocateBelow(32, 4, al[4].UnalignedOffset);
+        EXPECT_FALSE(a.IsValid());
+
+        ListMgr.Shrink(32);
+        EXPECT_EQ(ListMgr.GetMaxSize(), OffsetType{96});
+        EXPECT_EQ(ListMgr.GetTailFreeSize(), OffsetType{16});
+        EXPECT_EQ(ListMgr.GetUsedSize(), OffsetType{80});
+
+        ListMgr.Shrink(16);
+        EXPECT_EQ(ListMgr.GetMaxSize(), OffsetType{80});
+        EXPECT_EQ(ListMgr.GetTailFreeSize(), OffsetType{0});
+        EXPECT_TRUE(ListMgr.IsFull());
+
+        ListMgr.Extend(16);
+        EXPECT_EQ(ListMgr.GetTailFreeSize(), OffsetType{16});
+
+        for (size_t o = 0; o < _countof(al); ++o)
+        {
+            if (al[o].IsValid())
+                ListMgr.Free(std::move(al[o]));
+        }
+        EXPECT_TRUE(ListMgr.IsEmpty());
+        EXPECT_EQ(ListMgr.GetTailFreeSize(), OffsetType{96});
+    }
+}
+
 } // namespace
@@ -0,0 +1,134 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "PipelineResourceNameIndex.hpp"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(GraphicsEngine_PipelineResourceNameIndex, Empty)
+{
+    PipelineResourceNameIndex Index;
+    EXPECT_TRUE(Index.IsEmpty());
+    EXPECT_EQ(Index.FindResource(nullptr, SHADER_TYPE_ALL_GRAPHICS, "g_Tex"), PipelineResourceNameIndex::InvalidIndex);
+
+    Index.Initialize(nullptr, 0);
+    EXPECT_TRUE(Index.IsEmpty());
+}
+
+TEST(GraphicsEngine_PipelineResourceNameIndex, FindResource)
+{
+    // clang-format off
+    const PipelineResourceDesc Resources[] =
+    {
+        {SHADER_TYPE_VERTEX, "g_CB",      1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER},
+        {SHADER_TYPE_PIXEL,  "g_Tex",     1, SHADER_RESOURCE_TYPE_TEXTURE_SRV},
+        {SHADER_TYPE_VERTEX, "g_Tex",     1, SHADER_RESOURCE_TYPE_TEXTURE_SRV},
+        {SHADER_TYPE_PIXEL,  "g_Sampler", 1, SHADER_RESOURCE_TYPE_SAMPLER},
+        {SHADER_TYPE_PIXEL,  "g_CB",      1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER},
+    };
+    // clang-format on
+
+    PipelineResourceNameIndex Index;
+    Index.Initialize(Resources, _countof(Resources));
+    EXPECT_FALSE(Index.IsEmpty());
+
+    EXPECT_EQ(Index.FindResource(Resources, SHADER_TYPE_VERTEX, "g_CB"), 0u);
+    EXPECT_EQ(Index.FindResource(Resources, SHADER_TYPE_PIXEL, "g_CB"), 4u);
+    EXPECT_EQ(Index.FindResource(Resources, SHADER_TYPE_ALL_GRAPHICS, "g_CB"), 0u);
+    EXPECT_EQ(Index.FindResource(Resources, SHADER_TYPE_PIXEL, "g_Tex"), 1u);
+    EXPECT_EQ(Index.FindResource(Resources, SHADER_TYPE_VERTEX, "g_Tex"), 2u);
+    EXPECT_EQ(Index.FindResource(Resources, SHADER_TYPE_PIXEL, "g_Sampler"), 3u);
+
+    EXPECT_EQ(Index.FindResource(Resources, SHADER_TYPE_VERTEX, "g_Sampler"), PipelineResourceNameIndex::InvalidIndex);
+    EXPECT_EQ(Index.FindResource(Resources, SHADER_TYPE_PIXEL, "g_Te"), PipelineResourceNameIndex::InvalidIndex);
+    EXPECT_EQ(Index.FindResource(Resources, SHADER_TYPE_PIXEL, "g_Texture"), PipelineResourceNameIndex::InvalidIndex);
+    EXPECT_EQ(Index.FindResource(Resources, SHADER_TYPE_COMPUTE, "g_CB"), PipelineResourceNameIndex::InvalidIndex);
+}
+
+TEST(GraphicsEngine_PipelineResourceNameIndex, FindOrder)
+{
+    // clang-format off
+    const PipelineResourceDesc Resources[] =
+    {
+        {SHADER_TYPE_VERTEX,   "g_Buffer", 1, SHADER_RESOURCE_TYPE_BUFFER_SRV},
+        {SHADER_TYPE_PIXEL,    "g_Other",  1, SHADER_RESOURCE_TYPE_BUFFER_SRV},
+        {SHADER_TYPE_PIXEL,    "g_Buffer", 1, SHADER_RESOURCE_TYPE_BUFFER_SRV},
+        {SHADER_TYPE_GEOMETRY, "g_Buffer", 1, SHADER_RESOURCE_TYPE_BUFFER_SRV},
+    };
+    // clang-format on
+
+    PipelineResourceNameIndex Index;
+    Index.Initialize(Resources, _countof(Resources));
+
+    std::vector<Uint32> Found;
+    EXPECT_FALSE(Index.Find("g_Buffer", [&](Uint32 ResIndex) {
+        Found.push_back(ResIndex);
+        return false;
+    }));
+    EXPECT_EQ(Found, (std::vector<Uint32>{0, 2, 3}));
+
+    Found.clear();
+    EXPECT_TRUE(Index.Find("g_Buffer", [&](Uint32 ResIndex) {
+        Found.push_back(ResIndex);
+        return ResIndex == 2;
+    }));
+    EXPECT_EQ(Found, (std::vector<Uint32>{0, 2}));
+
+    EXPECT_FALSE(Index.Find(nullptr, [](Uint32) { return true; }));
+}
+
+TEST(GraphicsEngine_PipelineResourceNameIndex, LargeSignature)
+{
+    constexpr Uint32 NumResources = 300;
+
+    std::vector<std::string> Names;
+    Names.reserve(NumResources);
+    std::vector<PipelineResourceDesc> Resources;
+    for (Uint32 i = 0; i < NumResources; ++i)
+    {
+        Names.emplace_back("g_Resource" + std::to_string(i));
+        Resources.emplace_back(SHADER_TYPE_PIXEL, Names.back().c_str(), 1u, SHADER_RESOURCE_TYPE_TEXTURE_SRV);
+    }
+
+    PipelineResourceNameIndex Index;
+    Index.Initialize(Resources.data(), NumResources);
+
+    for (Uint32 i = 0; i < NumResources; ++i)
+    {
+        EXPECT_EQ(Index.FindResource(Resources.data(), SHADER_TYPE_PIXEL, Names[i].c_str()), i);
+    }
+    EXPECT_EQ(Index.FindResource(Resources.data(), SHADER_TYPE_PIXEL, "g_Resource300"), PipelineResourceNameIndex::InvalidIndex);
+}
+
+} // namespace
@@ -0,0 +1,150 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ShaderResourceCacheCommon.hpp"
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+class MockResourceCache : public ShaderResourceCacheBase
+{
+public:
+    void SetResource()
+    {
+        UpdateRevision();
+    }
+};
+
+using TrackerType = ShaderResourceCommitTracker<4>;
+
+// Signatures are only compared by address
+const int Signatures[4] = {};
+
+TEST(GraphicsEngine_ShaderResourceCommitTracker, Commit)
+{
+    TrackerType       Tracker;
+    MockResourceCache Cache0;
+    MockResourceCache Cache1;
+
+    EXPECT_FALSE(Tracker.IsCommitted(0, Cache0));
+
+    Tracker.Commit(0, &Cache0, &Signatures[0]);
+    EXPECT_TRUE(Tracker.IsCommitted(0, Cache0));
+    EXPECT_FALSE(Tracker.IsCommitted(1, Cache0));
+    EXPECT_FALSE(Tracker.IsCommitted(0, Cache1));
+
+    Tracker.Commit(0, &Cache1, &Signatures[0]);
+    EXPECT_FALSE(Tracker.IsCommitted(0, Cache0));
+    EXPECT_TRUE(Tracker.IsCommitted(0, Cache1));
+
+    Tracker.Commit(0, nullptr, nullptr);
+    EXPECT_FALSE(Tracker.IsCommitted(0, Cache1));
+}
+
+TEST(GraphicsEngine_ShaderResourceCommitTracker, RevisionChange)
+{
+    TrackerType       Tracker;
+    MockResourceCache Cache;
+
+    Tracker.Commit(1, &Cache, &Signatures[1]);
+    EXPECT_TRUE(Tracker.IsCommitted(1, Cache));
+
+    Cache.SetResource();
+    EXPECT_FALSE(Tracker.IsCommitted(1, Cache));
+
+    Tracker.Commit(1, &Cache, &Signatures[1]);
+    EXPECT_TRUE(Tracker.IsCommitted(1, Cache));
+}
+
+TEST(GraphicsEngine_ShaderResourceCommitTracker, CacheAddressReuse)
+{
+    TrackerType Tracker;
+
+    alignas(MockResourceCache) unsigned char Storage[sizeof(MockResourceCache)];
+
+    auto* pCache0 = new (Storage) MockResourceCache;
+    Tracker.Commit(0, pCache0, &Signatures[0]);
+    EXPECT_TRUE(Tracker.IsCommitted(0, *pCache0));
+    pCache0->~MockResourceCache();
+
+    // A new cache at the same address with the same revision must not be treated as committed
+    auto* pCache1 = new (Storage) MockResourceCache;
+    EXPECT_FALSE(Tracker.IsCommitted(0, *pCache1));
+    pCache1->~MockResourceCache();
+}
+
+TEST(GraphicsEngine_ShaderResourceCommitTracker, OnPipelineChanged)
+{
+    TrackerType       Tracker;
+    MockResourceCache Caches[3];
+    for (Uint32 i = 0; i < 3; ++i)
+        Tracker.Commit(i, &Caches[i], &Signatures[i]);
+
+    // Same signatures - nothing is reset
+    Tracker.OnPipelineChanged(3, [](Uint32 i) -> const void* { return &Signatures[i]; });
+    for (Uint32 i = 0; i < 3; ++i)
+        EXPECT_TRUE(Tracker.IsCommitted(i, Caches[i]));
+
+    // Pipeline uses fewer signatures - nothing is reset
+    Tracker.OnPipelineChanged(2, [](Uint32 i) -> const void* { return &Signatures[i]; });
+    for (Uint32 i = 0; i < 3; ++i)
+        EXPECT_TRUE(Tracker.IsCommitted(i, Caches[i]));
+
+    // Signature at slot 1 is different - slots 1 and above are reset
+    Tracker.OnPipelineChanged(3, [](Uint32 i) -> const void* { return i == 1 ? &Signatures[3] : &Signatures[i]; });
+    EXPECT_TRUE(Tracker.IsCommitted(0, Caches[0]));
+    EXPECT_FALSE(Tracker.IsCommitted(1, Caches[1]));
+    EXPECT_FALSE(Tracker.IsCommitted(2, Caches[2]));
+
+    // Slot 1 is empty, but the pipeline expects a signature there - slots 1 and above are reset
+    Tracker.Commit(2, &Caches[2], &Signatures[2]);
+    Tracker.OnPipelineChanged(3, [](Uint32 i) -> const void* { return &Signatures[i]; });
+    EXPECT_TRUE(Tracker.IsCommitted(0, Caches[0]));
+    EXPECT_FALSE(Tracker.IsCommitted(2, Caches[2]));
+}
+
+TEST(GraphicsEngine_ShaderResourceCommitTracker, SetFrameNumber)
+{
+    TrackerType       Tracker;
+    MockResourceCache Cache;
+
+    Tracker.SetFrameNumber(1);
+    Tracker.Commit(0, &Cache, &Signatures[0]);
+
+    Tracker.SetFrameNumber(1);
+    EXPECT_TRUE(Tracker.IsCommitted(0, Cache));
+
+    Tracker.SetFrameNumber(2);
+    EXPECT_FALSE(Tracker.IsCommitted(0, Cache));
+}
+
+} // namespace
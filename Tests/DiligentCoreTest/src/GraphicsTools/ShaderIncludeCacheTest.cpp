@@ -0,0 +1,197 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ShaderIncludeCache.hpp"
+#include "ShaderSourceFactoryUtils.hpp"
+#include "ObjectBase.hpp"
+
+#include <unordered_map>
+#include <string>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+// Shader source factory that counts how many times each file has been requested
+class CountingShaderSourceFactory final : public ObjectBase<IShaderSourceInputStreamFactory>
+{
+public:
+    using TBase = ObjectBase<IShaderSourceInputStreamFactory>;
+
+    CountingShaderSourceFactory(IReferenceCounters* pRefCounters, IShaderSourceInputStreamFactory* pFactory) :
+        TBase{pRefCounters},
+        m_pFactory{pFactory}
+    {}
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_IShaderSourceInputStreamFactory, TBase)
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream(const Char* Name, IFileStream** ppStream) override final
+    {
+        CreateInputStream2(Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE, ppStream);
+    }
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream2(const Char*                             Name,
+                                                       CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
+                                                       IFileStream**                           ppStream) override final
+    {
+        ++m_ReadCounts[Name];
+        m_pFactory->CreateInputStream2(Name, Flags, ppStream);
+    }
+
+    size_t GetReadCount(const char* Name) const
+    {
+        auto it = m_ReadCounts.find(Name);
+        return it != m_ReadCounts.end() ? it->second : 0;
+    }
+
+private:
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> m_pFactory;
+    std::unordered_map<std::string, size_t>        m_ReadCounts;
+};
+
+constexpr char MainSource[]     = "#include \"Common.fxh\"\n#include \"Utils.fxh\"\nvoid main(){}\n";
+constexpr char CommonSource[]   = "#include \"Utils.fxh\"\nfloat4 g_Color;\n";
+constexpr char UtilsSource[]    = "float Square(float x) { return x * x; }\n";
+constexpr char UtilsSource2[]   = "float Square(float x) { return x * x * 1.0; }\n";
+constexpr char MainFileName[]   = "Main.psh";
+constexpr char CommonFileName[] = "Common.fxh";
+constexpr char UtilsFileName[]  = "Utils.fxh";
+
+ShaderCreateInfo GetShaderCI(IShaderSourceInputStreamFactory* pFactory, SHADER_TYPE ShaderType = SHADER_TYPE_PIXEL)
+{
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.Desc                       = {"Test shader", ShaderType};
+    ShaderCI.FilePath                   = MainFileName;
+    ShaderCI.pShaderSourceStreamFactory = pFactory;
+    return ShaderCI;
+}
+
+TEST(ShaderIncludeCacheTest, ReadFilesOnce)
+{
+    auto pMemFactory = CreateMemoryShaderSourceFactory({{MainFileName, MainSource}, {CommonFileName, CommonSource}, {UtilsFileName, UtilsSource}});
+    ASSERT_NE(pMemFactory, nullptr);
+
+    RefCntAutoPtr<CountingShaderSourceFactory> pCountingFactory{MakeNewRCObj<CountingShaderSourceFactory>()(pMemFactory)};
+    auto                                       pCache = CreateShaderIncludeCache(pCountingFactory);
+    ASSERT_NE(pCache, nullptr);
+
+    XXH128Hash Hash0;
+    {
+        XXH128State Hasher;
+        Hasher.Update(GetShaderCI(pCache, SHADER_TYPE_PIXEL));
+        Hash0 = Hasher.Digest();
+    }
+
+    XXH128Hash Hash1;
+    {
+        XXH128State Hasher;
+        Hasher.Update(GetShaderCI(pCache, SHADER_TYPE_VERTEX));
+        Hash1 = Hasher.Digest();
+    }
+    EXPECT_NE(Hash0, Hash1);
+
+    XXH128Hash Hash2;
+    {
+        XXH128State Hasher;
+        Hasher.Update(GetShaderCI(pCache, SHADER_TYPE_PIXEL));
+        Hash2 = Hasher.Digest();
+    }
+    EXPECT_EQ(Hash0, Hash2);
+
+    EXPECT_EQ(pCountingFactory->GetReadCount(MainFileName), size_t{1});
+    EXPECT_EQ(pCountingFactory->GetReadCount(CommonFileName), size_t{1});
+    EXPECT_EQ(pCountingFactory->GetReadCount(UtilsFileName), size_t{1});
+
+    // Streams created by the cache must return the original contents
+    RefCntAutoPtr<IFileStream> pStream;
+    pCache->CreateInputStream(CommonFileName, &pStream);
+    ASSERT_NE(pStream, nullptr);
+    EXPECT_EQ(pStream->GetSize(), strlen(CommonSource));
+    EXPECT_EQ(pCountingFactory->GetReadCount(CommonFileName), size_t{1});
+}
+
+TEST(ShaderIncludeCacheTest, ContentChange)
+{
+    auto pFactory0 = CreateMemoryShaderSourceFactory({{MainFileName, MainSource}, {CommonFileName, CommonSource}, {UtilsFileName, UtilsSource}});
+    auto pFactory1 = CreateMemoryShaderSourceFactory({{MainFileName, MainSource}, {CommonFileName, CommonSource}, {UtilsFileName, UtilsSource2}});
+
+    auto pCache0 = CreateShaderIncludeCache(pFactory0);
+    auto pCache1 = CreateShaderIncludeCache(pFactory1);
+
+    XXH128Hash Hash0, Hash1;
+    EXPECT_TRUE(pCache0->GetSourceHash(GetShaderCI(pCache0), Hash0));
+    EXPECT_TRUE(pCache1->GetSourceHash(GetShaderCI(pCache1), Hash1));
+    EXPECT_NE(Hash0, Hash1);
+
+    XXH128Hash FileHash0, FileHash1;
+    EXPECT_TRUE(pCache0->GetFileHash(MainFileName, FileHash0));
+    EXPECT_TRUE(pCache1->GetFileHash(MainFileName, FileHash1));
+    EXPECT_EQ(FileHash0, FileHash1);
+
+    EXPECT_FALSE(pCache0->GetFileHash("Missing.fxh", FileHash0));
+}
+
+TEST(ShaderIncludeCacheTest, InlineSource)
+{
+    auto pMemFactory = CreateMemoryShaderSourceFactory({{CommonFileName, CommonSource}, {UtilsFileName, UtilsSource}});
+    auto pCache      = CreateShaderIncludeCache(pMemFactory);
+
+    ShaderCreateInfo ShaderCI = GetShaderCI(pCache);
+    ShaderCI.FilePath         = nullptr;
+    ShaderCI.Source           = MainSource;
+
+    XXH128Hash Hash0, Hash1;
+    EXPECT_TRUE(pCache->GetSourceHash(ShaderCI, Hash0));
+
+    ShaderCI.Source = "#include \"Utils.fxh\"\nvoid main(){}\n";
+    EXPECT_TRUE(pCache->GetSourceHash(ShaderCI, Hash1));
+    EXPECT_NE(Hash0, Hash1);
+}
+
+TEST(ShaderIncludeCacheTest, Invalidate)
+{
+    auto pMemFactory = CreateMemoryShaderSourceFactory({{MainFileName, MainSource}, {CommonFileName, CommonSource}, {UtilsFileName, UtilsSource}});
+
+    RefCntAutoPtr<CountingShaderSourceFactory> pCountingFactory{MakeNewRCObj<CountingShaderSourceFactory>()(pMemFactory)};
+    auto                                       pCache = CreateShaderIncludeCache(pCountingFactory);
+
+    XXH128Hash Hash0, Hash1;
+    EXPECT_TRUE(pCache->GetSourceHash(GetShaderCI(pCache), Hash0));
+    EXPECT_EQ(pCountingFactory->GetReadCount(UtilsFileName), size_t{1});
+
+    const Uint32 Stamp = pCache->GetStamp();
+    EXPECT_EQ(pCache->Invalidate(), Stamp + 1);
+    EXPECT_EQ(pCache->GetStamp(), Stamp + 1);
+
+    EXPECT_TRUE(pCache->GetSourceHash(GetShaderCI(pCache), Hash1));
+    EXPECT_EQ(Hash0, Hash1);
+    EXPECT_EQ(pCountingFactory->GetReadCount(UtilsFileName), size_t{2});
+}
+
+} // namespace
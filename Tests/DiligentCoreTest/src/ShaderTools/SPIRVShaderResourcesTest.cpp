@@ -0,0 +1,193 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "SPIRVShaderResources.hpp"
+#include "GLSLangUtils.hpp"
+#include "EngineMemory.h"
+
+#include "TestingEnvironment.hpp"
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+static constexpr char g_HLSLSource[] = R"(
+cbuffer cbConstants
+{
+    float4 g_Color;
+}
+
+Texture2D<float4>         g_Tex2D;
+SamplerState              g_Sampler;
+Texture2DArray<float4>    g_Tex2DArr[4];
+StructuredBuffer<float4>  g_StructBuff;
+RWBuffer<float4>          g_RWBuff;
+
+struct VSInput
+{
+    float4 Pos : ATTRIB0;
+    float2 UV  : ATTRIB1;
+};
+
+float4 main(VSInput In) : SV_Position
+{
+    return In.Pos * g_Color +
+           g_Tex2D.SampleLevel(g_Sampler, In.UV, 0.0) +
+           g_Tex2DArr[1].SampleLevel(g_Sampler, float3(In.UV, 0.0), 0.0) +
+           g_StructBuff[0] +
+           g_RWBuff[0];
+}
+)";
+
+std::vector<uint32_t> CompileTestShader(ShaderDesc& Desc)
+{
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.Source         = g_HLSLSource;
+    ShaderCI.Desc           = Desc;
+    ShaderCI.EntryPoint     = "main";
+
+    GLSLangUtils::InitializeGlslang();
+    auto SPIRV = GLSLangUtils::HLSLtoSPIRV(ShaderCI, GLSLangUtils::SpirvVersion::Vk100, nullptr, nullptr);
+    GLSLangUtils::FinalizeGlslang();
+
+    return SPIRV;
+}
+
+void CompareResources(const SPIRVShaderResources& Ref, const SPIRVShaderResources& Res)
+{
+    ASSERT_EQ(Ref.GetTotalResources(), Res.GetTotalResources());
+    EXPECT_EQ(Ref.GetNumUBs(), Res.GetNumUBs());
+    EXPECT_EQ(Ref.GetNumSBs(), Res.GetNumSBs());
+    EXPECT_EQ(Ref.GetNumImgs(), Res.GetNumImgs());
+    EXPECT_EQ(Ref.GetNumSmpldImgs(), Res.GetNumSmpldImgs());
+    EXPECT_EQ(Ref.GetNumACs(), Res.GetNumACs());
+    EXPECT_EQ(Ref.GetNumSepSmplrs(), Res.GetNumSepSmplrs());
+    EXPECT_EQ(Ref.GetNumSepImgs(), Res.GetNumSepImgs());
+    EXPECT_EQ(Ref.GetNumInptAtts(), Res.GetNumInptAtts());
+    EXPECT_EQ(Ref.GetNumAccelStructs(), Res.GetNumAccelStructs());
+    EXPECT_EQ(Ref.GetShaderType(), Res.GetShaderType());
+    EXPECT_EQ(Ref.IsHLSLSource(), Res.IsHLSLSource());
+    EXPECT_EQ(Ref.GetComputeGroupSize(), Res.GetComputeGroupSize());
+    EXPECT_STREQ(Ref.GetShaderName(), Res.GetShaderName());
+
+    for (Uint32 i = 0; i < Ref.GetTotalResources(); ++i)
+    {
+        const auto& RefAttribs = Ref.GetResource(i);
+        const auto& Attribs    = Res.GetResource(i);
+        EXPECT_STREQ(RefAttribs.Name, Attribs.Name);
+        EXPECT_EQ(RefAttribs.ArraySize, Attribs.ArraySize);
+        EXPECT_EQ(RefAttribs.Type, Attribs.Type);
+        EXPECT_EQ(RefAttribs.GetResourceDimension(), Attribs.GetResourceDimension());
+        EXPECT_EQ(RefAttribs.IsMultisample(), Attribs.IsMultisample());
+        EXPECT_EQ(RefAttribs.BindingDecorationOffset, Attribs.BindingDecorationOffset);
+        EXPECT_EQ(RefAttribs.DescriptorSetDecorationOffset, Attribs.DescriptorSetDecorationOffset);
+        EXPECT_EQ(RefAttribs.BufferStaticSize, Attribs.BufferStaticSize);
+        EXPECT_EQ(RefAttribs.BufferStride, Attribs.BufferStride);
+    }
+
+    ASSERT_EQ(Ref.GetNumShaderStageInputs(), Res.GetNumShaderStageInputs());
+    for (Uint32 i = 0; i < Ref.GetNumShaderStageInputs(); ++i)
+    {
+        const auto& RefInput = Ref.GetShaderStageInputAttribs(i);
+        const auto& Input    = Res.GetShaderStageInputAttribs(i);
+        EXPECT_STREQ(RefInput.Semantic, Input.Semantic);
+        EXPECT_EQ(RefInput.LocationDecorationOffset, Input.LocationDecorationOffset);
+    }
+}
+
+TEST(SPIRVShaderResourcesTest, SerializeResources)
+{
+    ShaderDesc Desc{"SPIRV resources test", SHADER_TYPE_VERTEX};
+
+    const auto SPIRV = CompileTestShader(Desc);
+    ASSERT_FALSE(SPIRV.empty());
+
+    auto&       Allocator = GetRawAllocator();
+    std::string EntryPoint;
+
+    SPIRVShaderResources RefResources{Allocator, SPIRV, Desc, nullptr, true, false, EntryPoint};
+    EXPECT_EQ(EntryPoint, "main");
+    EXPECT_GT(RefResources.GetTotalResources(), 0u);
+    EXPECT_GT(RefResources.GetNumShaderStageInputs(), 0u);
+
+    const auto Data = RefResources.Serialize(EntryPoint.c_str(), Allocator);
+    ASSERT_TRUE(Data);
+
+    std::string          RestoredEntryPoint;
+    SPIRVShaderResources Resources{Allocator, Data, Desc, nullptr, RestoredEntryPoint};
+    EXPECT_EQ(RestoredEntryPoint, EntryPoint);
+    CompareResources(RefResources, Resources);
+
+    // The shader type must match the serialized one
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Serialized resources of shader 'SPIRV resources test' were produced for"};
+
+        ShaderDesc  PSDesc{"SPIRV resources test", SHADER_TYPE_PIXEL};
+        std::string PSEntryPoint;
+        EXPECT_THROW(SPIRVShaderResources(Allocator, Data, PSDesc, nullptr, PSEntryPoint), std::runtime_error);
+    }
+}
+
+TEST(SPIRVShaderResourcesTest, AppendSerializedResources)
+{
+    ShaderDesc Desc{"SPIRV resources test", SHADER_TYPE_VERTEX};
+
+    const auto SPIRV = CompileTestShader(Desc);
+    ASSERT_FALSE(SPIRV.empty());
+
+    const size_t SPIRVSize = SPIRV.size() * sizeof(SPIRV[0]);
+
+    SerializedData Data;
+    EXPECT_EQ(SPIRVShaderResources::ExtractSerializedResources(SPIRV.data(), SPIRVSize, Data), SPIRVSize);
+    EXPECT_FALSE(Data);
+
+    auto&       Allocator = GetRawAllocator();
+    std::string EntryPoint;
+
+    SPIRVShaderResources RefResources{Allocator, SPIRV, Desc, nullptr, true, false, EntryPoint};
+
+    const auto RefData = RefResources.Serialize(EntryPoint.c_str(), Allocator);
+    ASSERT_TRUE(RefData);
+
+    auto ByteCode = SPIRV;
+    SPIRVShaderResources::AppendSerializedResources(ByteCode, RefData);
+    EXPECT_GT(ByteCode.size(), SPIRV.size());
+
+    EXPECT_EQ(SPIRVShaderResources::ExtractSerializedResources(ByteCode.data(), ByteCode.size() * sizeof(ByteCode[0]), Data), SPIRVSize);
+    ASSERT_TRUE(Data);
+    EXPECT_EQ(Data, RefData);
+    EXPECT_EQ(memcmp(ByteCode.data(), SPIRV.data(), SPIRVSize), 0);
+
+    std::string          RestoredEntryPoint;
+    SPIRVShaderResources Resources{Allocator, Data, Desc, nullptr, RestoredEntryPoint};
+    CompareResources(RefResources, Resources);
+}
+
+} // namespace
@@ -0,0 +1,207 @@
+/*
+ *  Copyright 2019-2024 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "SPIRVTools.hpp"
+#include "SPIRVShaderResources.hpp"
+#include "GLSLangUtils.hpp"
+#include "ThreadPool.hpp"
+#include "EngineMemory.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+static constexpr char g_HLSLSource[] = R"(
+cbuffer cbConstants
+{
+    float4 g_Color;
+}
+
+Texture2D<float4> g_Tex2D;
+SamplerState      g_Sampler;
+
+float4 main(float4 Pos : SV_Position, float2 UV : TEXCOORD) : SV_Target
+{
+    return g_Color * g_Tex2D.Sample(g_Sampler, UV);
+}
+)";
+
+std::vector<uint32_t> CompileTestShader(const ShaderDesc& Desc)
+{
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.Source         = g_HLSLSource;
+    ShaderCI.Desc           = Desc;
+    ShaderCI.EntryPoint     = "main";
+
+    GLSLangUtils::InitializeGlslang();
+    auto SPIRV = GLSLangUtils::HLSLtoSPIRV(ShaderCI, GLSLangUtils::SpirvVersion::Vk100, nullptr, nullptr);
+    GLSLangUtils::FinalizeGlslang();
+
+    return SPIRV;
+}
+
+void CheckBinding(const std::vector<uint32_t>& SPIRV, const ShaderDesc& Desc, const char* Name, const SPIRVResourceBinding& Binding)
+{
+    std::string                EntryPoint;
+    const SPIRVShaderResources Resources{GetRawAllocator(), SPIRV, Desc, nullptr, false, false, EntryPoint};
+
+    bool Found = false;
+    for (Uint32 i = 0; i < Resources.GetTotalResources(); ++i)
+    {
+        const auto& Attribs = Resources.GetResource(i);
+        if (strcmp(Attribs.Name, Name) != 0)
+            continue;
+
+        EXPECT_EQ(SPIRV[Attribs.BindingDecorationOffset], Binding.Binding);
+        EXPECT_EQ(SPIRV[Attribs.DescriptorSetDecorationOffset], Binding.DescriptorSet);
+        Found = true;
+    }
+    EXPECT_TRUE(Found) << "Resource '" << Name << "' is not found";
+}
+
+SPIRVBindingRemapping CreateTestRemapping(Uint32 DescriptorSet, Uint32 FirstBinding)
+{
+    SPIRVBindingRemapping Remapping;
+    Remapping.emplace("cbConstants", SPIRVResourceBinding{DescriptorSet, FirstBinding});
+    Remapping.emplace("g_Tex2D", SPIRVResourceBinding{DescriptorSet + 1, FirstBinding + 1});
+    Remapping.emplace("g_Sampler", SPIRVResourceBinding{DescriptorSet + 1, FirstBinding + 2});
+    return Remapping;
+}
+
+TEST(SPIRVToolsTest, RemapSPIRVBindings)
+{
+    const ShaderDesc Desc{"SPIRV remapping test", SHADER_TYPE_PIXEL};
+
+    auto SPIRV = CompileTestShader(Desc);
+    ASSERT_FALSE(SPIRV.empty());
+
+    auto Remapping = CreateTestRemapping(1, 7);
+    Remapping.emplace("g_Unused", SPIRVResourceBinding{0, 9});
+    EXPECT_EQ(RemapSPIRVBindings(SPIRV, Remapping), 3u);
+
+    for (const auto& it : Remapping)
+    {
+        if (strcmp(it.first.GetStr(), "g_Unused") != 0)
+            CheckBinding(SPIRV, Desc, it.first.GetStr(), it.second);
+    }
+}
+
+TEST(SPIRVToolsTest, OptimizeSPIRVBatch)
+{
+    const ShaderDesc Desc{"SPIRV batch test", SHADER_TYPE_PIXEL};
+
+    const auto SPIRV = CompileTestShader(Desc);
+    ASSERT_FALSE(SPIRV.empty());
+
+    const auto Remapping = CreateTestRemapping(0, 1);
+
+    constexpr SPIRV_OPTIMIZATION_FLAGS PassesToTest[] = {
+        SPIRV_OPTIMIZATION_FLAG_NONE,
+        SPIRV_OPTIMIZATION_FLAG_PERFORMANCE,
+        SPIRV_OPTIMIZATION_FLAG_STRIP_REFLECTION,
+        SPIRV_OPTIMIZATION_FLAG_LEGALIZATION | SPIRV_OPTIMIZATION_FLAG_PERFORMANCE,
+    };
+
+    std::vector<SPIRVBatchItem> Items(32);
+    for (size_t i = 0; i < Items.size(); ++i)
+    {
+        auto& Item      = Items[i];
+        Item.pSrcSPIRV  = &SPIRV;
+        Item.Passes     = PassesToTest[i % _countof(PassesToTest)];
+        Item.pRemapping = (i % 2) == 0 ? &Remapping : nullptr;
+    }
+
+    for (Uint32 NumThreads : {0u, 4u})
+    {
+        RefCntAutoPtr<IThreadPool> pThreadPool;
+        if (NumThreads > 0)
+        {
+            pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads});
+            ASSERT_TRUE(pThreadPool);
+        }
+
+        OptimizeSPIRVBatch(Items.data(), Items.size(), pThreadPool);
+
+        for (const auto& Item : Items)
+        {
+            auto RefSPIRV = Item.Passes != SPIRV_OPTIMIZATION_FLAG_NONE ?
+                OptimizeSPIRV(SPIRV, SPV_ENV_MAX, Item.Passes) :
+                SPIRV;
+            ASSERT_FALSE(RefSPIRV.empty());
+
+            if (Item.pRemapping != nullptr)
+            {
+                EXPECT_EQ(RemapSPIRVBindings(RefSPIRV, Remapping), 3u);
+                EXPECT_EQ(Item.NumRemappedResources, 3u);
+                CheckBinding(Item.SPIRV, Desc, "g_Tex2D", Remapping.find("g_Tex2D")->second);
+            }
+            else
+            {
+                EXPECT_EQ(Item.NumRemappedResources, 0u);
+            }
+            EXPECT_EQ(Item.SPIRV, RefSPIRV);
+        }
+    }
+}
+
+TEST(SPIRVToolsTest, FindStrippedResourceDecorations)
+{
+    const ShaderDesc Desc{"SPIRV strip reflection test", SHADER_TYPE_PIXEL};
+
+    const auto SPIRV = CompileTestShader(Desc);
+    ASSERT_FALSE(SPIRV.empty());
+    EXPECT_TRUE(HasSPIRVReflectionInstructions(SPIRV));
+
+    const auto StrippedSPIRV = OptimizeSPIRV(SPIRV, SPV_ENV_MAX, SPIRV_OPTIMIZATION_FLAG_STRIP_REFLECTION);
+    ASSERT_FALSE(StrippedSPIRV.empty());
+    EXPECT_FALSE(HasSPIRVReflectionInstructions(StrippedSPIRV));
+    EXPECT_LT(StrippedSPIRV.size(), SPIRV.size());
+
+    std::string                EntryPoint;
+    const SPIRVShaderResources Resources{GetRawAllocator(), SPIRV, Desc, nullptr, false, false, EntryPoint};
+    ASSERT_GT(Resources.GetTotalResources(), 0u);
+
+    std::vector<uint32_t> Ids(Resources.GetTotalResources());
+    for (Uint32 i = 0; i < Resources.GetTotalResources(); ++i)
+        Ids[i] = SPIRV[Resources.GetResource(i).BindingDecorationOffset - 2];
+
+    const auto Offsets = FindResourceDecorationOffsets(StrippedSPIRV, Ids);
+    ASSERT_EQ(Offsets.size(), Ids.size());
+    for (Uint32 i = 0; i < Resources.GetTotalResources(); ++i)
+    {
+        const auto& Attribs = Resources.GetResource(i);
+        ASSERT_NE(Offsets[i].Binding, 0u) << Attribs.Name;
+        ASSERT_NE(Offsets[i].DescriptorSet, 0u) << Attribs.Name;
+        EXPECT_EQ(StrippedSPIRV[Offsets[i].Binding], SPIRV[Attribs.BindingDecorationOffset]) << Attribs.Name;
+        EXPECT_EQ(StrippedSPIRV[Offsets[i].DescriptorSet], SPIRV[Attribs.DescriptorSetDecorationOffset]) << Attribs.Name;
+    }
+}
+
+} // namespace
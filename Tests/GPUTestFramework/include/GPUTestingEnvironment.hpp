@@ -59,6 +59,9 @@ public:
         Uint32             AdapterId              = DEFAULT_ADAPTER_ID;
         Uint32             NumDeferredContexts    = 4;
         bool               EnableDeviceSimulation = false;
+        bool               EnableVkDescrBuffers   = false;
+        bool               EnableVkGPUProfiler    = false;
+        const char*        VkPipelineCacheDir     = nullptr;
 
         DeviceFeatures Features{DEVICE_FEATURE_STATE_OPTIONAL};
 
@@ -142,6 +145,10 @@ public:
 
     ADAPTER_TYPE GetAdapterType() const { return m_AdapterType; }
 
+    // Returns EngineVkCreateInfo::GPUProfilerMaxScopesPerFrame the device was created with.
+    // The GPU profiler is only enabled by the --vk_gpu_profiler command line switch.
+    Uint32 GetVkGPUProfilerMaxScopesPerFrame() const { return m_VkGPUProfilerMaxScopesPerFrame; }
+
     bool NeedWARPResourceArrayIndexingBugWorkaround() const
     {
         return m_NeedWARPResourceArrayIndexingBugWorkaround;
@@ -170,7 +177,8 @@ protected:
     std::vector<RefCntAutoPtr<IDeviceContext>> m_pDeviceContexts;
     Uint32                                     m_NumImmediateContexts = 1;
     RefCntAutoPtr<ISwapChain>                  m_pSwapChain;
-    SHADER_COMPILER                            m_ShaderCompiler = SHADER_COMPILER_DEFAULT;
+    SHADER_COMPILER                            m_ShaderCompiler                 = SHADER_COMPILER_DEFAULT;
+    Uint32                                     m_VkGPUProfilerMaxScopesPerFrame = 0;
 
     // As of Windows version 2004 (build 19041), there is a bug in D3D12 WARP rasterizer:
     // Shader resource array indexing always references array element 0 when shaders are compiled.
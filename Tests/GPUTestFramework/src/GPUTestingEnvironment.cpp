@@ -61,6 +61,10 @@
 #    include "EngineFactoryWebGPU.h"
 #endif
 
+#if NULL_SUPPORTED
+#    include "EngineFactoryNull.h"
+#endif
+
 #if ARCHIVER_SUPPORTED
 #    include "ArchiverFactoryLoader.h"
 #endif
@@ -96,6 +100,10 @@ GPUTestingEnvironment* CreateTestingEnvironmentMtl(const GPUTestingEnvironment::
 GPUTestingEnvironment* CreateTestingEnvironmentWebGPU(const GPUTestingEnvironment::CreateInfo& CI, const SwapChainDesc& SCDesc);
 #endif
 
+#if NULL_SUPPORTED
+GPUTestingEnvironment* CreateTestingEnvironmentNull(const GPUTestingEnvironment::CreateInfo& CI, const SwapChainDesc& SCDesc);
+#endif
+
 Uint32 GPUTestingEnvironment::FindAdapter(const std::vector<GraphicsAdapterInfo>& Adapters,
                                           ADAPTER_TYPE                            AdapterType,
                                           Uint32                                  AdapterId)
@@ -414,6 +422,12 @@ GPUTestingEnvironment::GPUTestingEnvironment(const CreateInfo& EnvCI, const Swap
             EngineCI.MainDescriptorPoolSize    = VulkanDescriptorPoolSize{64, 64, 256, 256, 64, 32, 32, 32, 32, 16, 16};
             EngineCI.DynamicDescriptorPoolSize = VulkanDescriptorPoolSize{64, 64, 256, 256, 64, 32, 32, 32, 32, 16, 16};
             EngineCI.UploadHeapPageSize        = 32 * 1024;
+            // Use small batches to exercise batch overflow
+            EngineCI.InitialDataUploadBatchSize   = 64 * 1024;
+            EngineCI.EnableDescriptorBuffers      = EnvCI.EnableVkDescrBuffers;
+            EngineCI.PipelineCacheDirectory       = EnvCI.VkPipelineCacheDir;
+            EngineCI.GPUProfilerMaxScopesPerFrame = EnvCI.EnableVkGPUProfiler ? 64 : 0;
+            m_VkGPUProfilerMaxScopesPerFrame      = EngineCI.GPUProfilerMaxScopesPerFrame;
             //EngineCI.DeviceLocalMemoryReserveSize = 32 << 20;
             //EngineCI.HostVisibleMemoryReserveSize = 48 << 20;
             EngineCI.Features                  = EnvCI.Features;
@@ -479,6 +493,40 @@ GPUTestingEnvironment::GPUTestingEnvironment(const CreateInfo& EnvCI, const Swap
         }
 #endif
         break;
+
+#if NULL_SUPPORTED
+        case RENDER_DEVICE_TYPE_NULL:
+        {
+#    if EXPLICITLY_LOAD_ENGINE_NULL_DLL
+            auto GetEngineFactoryNull = LoadGraphicsEngineNull();
+            if (GetEngineFactoryNull == nullptr)
+            {
+                LOG_ERROR_AND_THROW("Failed to load the engine");
+            }
+#    endif
+            auto* pFactoryNull = GetEngineFactoryNull();
+            pFactoryNull->SetMessageCallback(EnvCI.MessageCallback);
+
+            EnumerateAdapters(pFactoryNull, Version{},
+                              [](const GraphicsAdapterInfo& AdapterInfo, Uint32 AdapterId) {
+                                  return std::vector<DisplayModeAttribs>{};
+                              });
+
+            EngineCreateInfo EngineCI;
+            EngineCI.AdapterId = FindAdapter(Adapters, EnvCI.AdapterType, EnvCI.AdapterId);
+            EngineCI.Features  = EnvCI.Features;
+
+            // Always enable validation
+            EngineCI.SetValidationLevel(VALIDATION_LEVEL_1);
+
+            NumDeferredCtx               = EnvCI.NumDeferredContexts;
+            EngineCI.NumDeferredContexts = NumDeferredCtx;
+            ppContexts.resize(std::max(size_t{1}, ContextCI.size()) + NumDeferredCtx);
+            pFactoryNull->CreateDeviceAndContextsNull(EngineCI, &m_pDevice, ppContexts.data());
+        }
+        break;
+#endif
+
         default:
             LOG_ERROR_AND_THROW("Unknown device type");
             break;
@@ -832,6 +880,11 @@ void GPUTestingEnvironment::SetDefaultCompiler(SHADER_COMPILER compiler)
             }
             break;
 
+        case RENDER_DEVICE_TYPE_NULL:
+            // Null backend does not compile shaders
+            m_ShaderCompiler = SHADER_COMPILER_DEFAULT;
+            break;
+
         default:
             LOG_WARNING_MESSAGE("Unexpected device type");
             m_ShaderCompiler = SHADER_COMPILER_DEFAULT;
@@ -896,7 +949,8 @@ GPUTestingEnvironment* GPUTestingEnvironment::Initialize(int argc, char** argv)
     SHADER_COMPILER                   ShCompiler = SHADER_COMPILER_DEFAULT;
     for (int i = 1; i < argc; ++i)
     {
-        const std::string AdapterArgName = "--adapter=";
+        const std::string AdapterArgName            = "--adapter=";
+        const std::string VkPipelineCacheDirArgName = "--vk_pipeline_cache_dir=";
 
         const auto* arg = argv[i];
         if (strcmp(arg, "--mode=d3d11") == 0)
@@ -942,6 +996,10 @@ GPUTestingEnvironment* GPUTestingEnvironment::Initialize(int argc, char** argv)
         {
             TestEnvCI.deviceType = RENDER_DEVICE_TYPE_WEBGPU;
         }
+        else if (strcmp(arg, "--mode=null") == 0)
+        {
+            TestEnvCI.deviceType = RENDER_DEVICE_TYPE_NULL;
+        }
         else if (AdapterArgName.compare(0, AdapterArgName.length(), arg, AdapterArgName.length()) == 0)
         {
             const auto* AdapterStr = arg + AdapterArgName.length();
@@ -962,6 +1020,18 @@ GPUTestingEnvironment* GPUTestingEnvironment::Initialize(int argc, char** argv)
         {
             TestEnvCI.EnableDeviceSimulation = true;
         }
+        else if (strcmp(arg, "--vk_descr_buffers") == 0)
+        {
+            TestEnvCI.EnableVkDescrBuffers = true;
+        }
+        else if (strcmp(arg, "--vk_gpu_profiler") == 0)
+        {
+            TestEnvCI.EnableVkGPUProfiler = true;
+        }
+        else if (VkPipelineCacheDirArgName.compare(0, VkPipelineCacheDirArgName.length(), arg, VkPipelineCacheDirArgName.length()) == 0)
+        {
+            TestEnvCI.VkPipelineCacheDir = arg + VkPipelineCacheDirArgName.length();
+        }
         else if (ParseFeatureState(arg, TestEnvCI.Features))
         {
             // Feature state has been updated by ParseFeatureState
@@ -1028,6 +1098,12 @@ GPUTestingEnvironment* GPUTestingEnvironment::Initialize(int argc, char** argv)
                 break;
 #endif
 
+#if NULL_SUPPORTED
+            case RENDER_DEVICE_TYPE_NULL:
+                pEnv = CreateTestingEnvironmentNull(TestEnvCI, SCDesc);
+                break;
+#endif
+
             default:
                 LOG_ERROR_AND_THROW("Unsupported device type");
         }
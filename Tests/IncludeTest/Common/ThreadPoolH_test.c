@@ -53,6 +53,8 @@ void TestThreadPool()
     (void)QueueSize;
     Uint32 TaskCount = IThreadPool_GetRunningTaskCount((IThreadPool*)NULL);
     (void)TaskCount;
+    Uint32 ThreadCount = IThreadPool_GetThreadCount((IThreadPool*)NULL);
+    (void)ThreadCount;
     IThreadPool_StopThreads((IThreadPool*)NULL);
     bool MoreTasks = IThreadPool_ProcessTask((IThreadPool*)NULL, 1, true);
     (void)MoreTasks;
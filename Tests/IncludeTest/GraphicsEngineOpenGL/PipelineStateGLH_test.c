@@ -32,4 +32,6 @@ void TestPipelineStateGL_CInterface(IPipelineStateGL* pPsoGL)
 {
     GLuint Handle = IPipelineStateGL_GetGLProgramHandle(pPsoGL, SHADER_TYPE_VERTEX);
     (void)Handle;
+    Bool LoadedFromBinary = IPipelineStateGL_IsGLProgramLoadedFromBinary(pPsoGL, SHADER_TYPE_VERTEX);
+    (void)LoadedFromBinary;
 }
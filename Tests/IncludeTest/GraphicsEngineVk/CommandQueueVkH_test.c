@@ -47,4 +47,7 @@ void TestCommandQueueVk_CInterface(ICommandQueueVk* pQueue)
     ICommandQueueVk_EnqueueSignalFence(pQueue, (VkFence)NULL);
 
     ICommandQueueVk_EnqueueSignal(pQueue, (VkSemaphore)NULL, (Uint64)0);
+
+    VkSemaphore vkSemaphore = ICommandQueueVk_GetVkTimelineSemaphore(pQueue);
+    (void)vkSemaphore;
 }
@@ -32,4 +32,15 @@ void TestDeviceContextVk_CInterface(IDeviceContextVk* pCtx)
 {
     IDeviceContextVk_TransitionImageLayout(pCtx, (ITexture*)NULL, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
     IDeviceContextVk_BufferMemoryBarrier(pCtx, (IBuffer*)NULL, VK_ACCESS_HOST_READ_BIT);
+    IDeviceContextVk_BeginSecondaryRenderPass(pCtx, (const struct BeginRenderPassAttribs*)NULL);
+    IDeviceContextVk_BeginSecondaryCommandList(pCtx, (const struct SecondaryCommandListAttribsVk*)NULL);
+    IDeviceContextVk_ExecuteSecondaryCommandLists(pCtx, 1, (ICommandList* const*)NULL);
+
+    GPUProfilerFrameVk Frame = IDeviceContextVk_GetProfilerFrame(pCtx);
+    (void)Frame;
+
+    IDeviceContextVk_DeviceWaitForQueue(pCtx, 1, (Uint64)1);
+
+    Uint64 FenceValue = IDeviceContextVk_GetLastSubmittedFenceValue(pCtx);
+    (void)FenceValue;
 }
@@ -44,4 +44,16 @@ void TestRenderDeviceVkCInterface(IRenderDeviceVk* pDevice)
     IRenderDeviceVk_CreateBLASFromVulkanResource(pDevice, (VkAccelerationStructureKHR)NULL, (BottomLevelASDesc*)NULL, RESOURCE_STATE_BUILD_AS_READ, (IBottomLevelAS**)NULL);
     IRenderDeviceVk_CreateTLASFromVulkanResource(pDevice, (VkAccelerationStructureKHR)NULL, (TopLevelASDesc*)NULL, RESOURCE_STATE_BUILD_AS_READ, (ITopLevelAS**)NULL);
     IRenderDeviceVk_CreateFenceFromVulkanResource(pDevice, (VkSemaphore)NULL, (const FenceDesc*)NULL, (IFence**)NULL);
+
+    MemoryBudgetVk Budget = IRenderDeviceVk_GetMemoryBudget(pDevice);
+    (void)Budget;
+
+    Bool Saved = IRenderDeviceVk_SavePipelineCache(pDevice);
+    (void)Saved;
+
+    PipelineCacheStatsVk CacheStats = IRenderDeviceVk_GetPipelineCacheStats(pDevice);
+    (void)CacheStats;
+
+    ReleaseQueueStats QueueStats = IRenderDeviceVk_GetReleaseQueueStats(pDevice, 0);
+    (void)QueueStats;
 }